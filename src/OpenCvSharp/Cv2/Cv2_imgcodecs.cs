@@ -1,5 +1,6 @@
 ﻿using System;
 using System.Collections.Generic;
+using System.Runtime.InteropServices;
 using OpenCvSharp.Util;
 
 namespace OpenCvSharp
@@ -175,6 +176,235 @@ namespace OpenCvSharp
             return new Mat(matPtr);
         }
 
+        /// <summary>
+        /// Decodes many images at once on the native thread pool. The buffers are read in place (pinned, not copied).
+        /// </summary>
+        /// <param name="bufs">Encoded images</param>
+        /// <param name="flags">The same flags as in imread</param>
+        /// <param name="dst">One destination per buffer. A destination which already has the size and type of
+        /// the decoded image is written in place, so reusing the destinations avoids allocations; otherwise it is
+        /// reallocated. The destination of a failed image is released.</param>
+        /// <param name="maxConcurrency">Maximum number of images decoded at the same time (0: no limit)</param>
+        /// <returns>The status and decoding time of each image</returns>
+        public static ImageBatchResult[] ImDecodeBatch(
+            IList<byte[]> bufs, ImreadModes flags, IList<Mat> dst, int maxConcurrency = 0)
+        {
+            if (bufs == null)
+                throw new ArgumentNullException(nameof(bufs));
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            if (bufs.Count != dst.Count)
+                throw new ArgumentException("dst must have one Mat per buffer");
+
+            var handles = PinBuffers(bufs, out var bufsPtrs, out var bufLengths);
+            try
+            {
+                return ImDecodeBatch(bufsPtrs, bufLengths, flags, dst, maxConcurrency);
+            }
+            finally
+            {
+                FreeHandles(handles);
+            }
+        }
+
+        /// <summary>
+        /// Decodes many images at once on the native thread pool.
+        /// </summary>
+        /// <param name="bufs">Encoded images</param>
+        /// <param name="flags">The same flags as in imread</param>
+        /// <param name="results">The status and decoding time of each image</param>
+        /// <param name="maxConcurrency">Maximum number of images decoded at the same time (0: no limit)</param>
+        /// <returns>The decoded images; empty for the images which failed</returns>
+        public static Mat[] ImDecodeBatch(
+            IList<byte[]> bufs, ImreadModes flags, out ImageBatchResult[] results, int maxConcurrency = 0)
+        {
+            if (bufs == null)
+                throw new ArgumentNullException(nameof(bufs));
+            var dst = new Mat[bufs.Count];
+            for (int i = 0; i < dst.Length; i++)
+                dst[i] = new Mat();
+            results = ImDecodeBatch(bufs, flags, dst, maxConcurrency);
+            return dst;
+        }
+
+        /// <summary>
+        /// Decodes many images held in unmanaged memory at once on the native thread pool, without copying them.
+        /// </summary>
+        /// <param name="bufs">Addresses of the encoded images; they must stay valid during the call</param>
+        /// <param name="bufLengths">Sizes of the encoded images [bytes]</param>
+        /// <param name="flags">The same flags as in imread</param>
+        /// <param name="dst">One destination per buffer, see ImDecodeBatch(IList&lt;byte[]&gt;, ImreadModes, IList&lt;Mat&gt;, int)</param>
+        /// <param name="maxConcurrency">Maximum number of images decoded at the same time (0: no limit)</param>
+        /// <returns>The status and decoding time of each image</returns>
+        public static ImageBatchResult[] ImDecodeBatch(
+            IntPtr[] bufs, long[] bufLengths, ImreadModes flags, IList<Mat> dst, int maxConcurrency = 0)
+        {
+            if (bufs == null)
+                throw new ArgumentNullException(nameof(bufs));
+            if (bufLengths == null)
+                throw new ArgumentNullException(nameof(bufLengths));
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            if (bufs.Length != bufLengths.Length || bufs.Length != dst.Count)
+                throw new ArgumentException("bufs, bufLengths and dst must have the same length");
+
+            var dstPtrs = EnumerableEx.SelectPtrs(dst);
+            var results = new ImageBatchResult[bufs.Length];
+            NativeMethods.imgcodecs_imdecode_batch(
+                bufs, bufLengths, bufs.Length, (int) flags, dstPtrs, maxConcurrency, results);
+            GC.KeepAlive(dst);
+            return results;
+        }
+
+        /// <summary>
+        /// Decodes many images at once on the native thread pool, scaled down to fit into maxSize
+        /// (see ImDecodeReduced). The buffers are read in place (pinned, not copied).
+        /// </summary>
+        /// <param name="bufs">Encoded images</param>
+        /// <param name="flags">The same flags as in imread</param>
+        /// <param name="maxSize">Each result fits into this size, keeping its aspect ratio; a zero component leaves that side free</param>
+        /// <param name="dst">One destination per buffer</param>
+        /// <param name="stats">How each image was decoded</param>
+        /// <param name="rois">Optional region of interest per image, in full-resolution coordinates</param>
+        /// <param name="maxConcurrency">Maximum number of images decoded at the same time (0: no limit)</param>
+        /// <returns>The status and decoding time of each image</returns>
+        public static ImageBatchResult[] ImDecodeBatch(
+            IList<byte[]> bufs, ImreadModes flags, Size maxSize, IList<Mat> dst, out ImageDecodeStats[] stats,
+            IList<Rect> rois = null, int maxConcurrency = 0)
+        {
+            if (bufs == null)
+                throw new ArgumentNullException(nameof(bufs));
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            if (bufs.Count != dst.Count || (rois != null && rois.Count != bufs.Count))
+                throw new ArgumentException("dst and rois must have one element per buffer");
+
+            var dstPtrs = EnumerableEx.SelectPtrs(dst);
+            var roisArray = rois == null ? null : EnumerableEx.ToArray(rois);
+            var results = new ImageBatchResult[bufs.Count];
+            stats = new ImageDecodeStats[bufs.Count];
+            var handles = PinBuffers(bufs, out var bufsPtrs, out var bufLengths);
+            try
+            {
+                NativeMethods.imgcodecs_imdecode_batch_reduced(
+                    bufsPtrs, bufLengths, bufsPtrs.Length, (int) flags, maxSize, roisArray, dstPtrs,
+                    maxConcurrency, results, stats);
+                GC.KeepAlive(dst);
+                return results;
+            }
+            finally
+            {
+                FreeHandles(handles);
+            }
+        }
+
+        /// <summary>
+        /// Loads an image from a file, scaled down to fit into maxSize. A JPEG is scaled by 1/2, 1/4 or 1/8 while
+        /// it is decoded (as far as the result stays at least as large as required), which is much faster than
+        /// decoding it at full resolution; the rest is done by an area resize.
+        /// </summary>
+        /// <param name="fileName">Name of file to be loaded.</param>
+        /// <param name="maxSize">The result fits into this size, keeping its aspect ratio. A zero component leaves
+        /// that side free; the image is never enlarged.</param>
+        /// <param name="flags">The same flags as in imread; only Color and Grayscale allow scaling while decoding</param>
+        /// <param name="roi">Optional region of interest in the coordinates of the full-resolution image; only the
+        /// region is returned, scaled to fit into maxSize</param>
+        /// <returns>The image, empty if it could not be loaded</returns>
+        public static Mat ImReadReduced(string fileName, Size maxSize, ImreadModes flags = ImreadModes.Color, Rect? roi = null)
+        {
+            return ImReadReduced(fileName, maxSize, flags, roi, out _);
+        }
+
+        /// <summary>
+        /// Loads an image from a file, scaled down to fit into maxSize (see ImReadReduced(string, Size, ImreadModes, Rect?)).
+        /// </summary>
+        /// <param name="fileName">Name of file to be loaded.</param>
+        /// <param name="maxSize">The result fits into this size, keeping its aspect ratio</param>
+        /// <param name="flags">The same flags as in imread</param>
+        /// <param name="roi">Optional region of interest in the coordinates of the full-resolution image</param>
+        /// <param name="stats">How the image was decoded</param>
+        /// <param name="measureBaseline">Also decodes the image at full resolution to measure the time saved (for tuning only)</param>
+        /// <returns>The image, empty if it could not be loaded</returns>
+        public static Mat ImReadReduced(string fileName, Size maxSize, ImreadModes flags, Rect? roi,
+            out ImageDecodeStats stats, bool measureBaseline = false)
+        {
+            if (fileName == null)
+                throw new ArgumentNullException(nameof(fileName));
+            var dst = new Mat();
+            NativeMethods.imgcodecs_imread_reduced(
+                fileName, (int) flags, maxSize, roi.GetValueOrDefault(), measureBaseline ? 1 : 0, dst.CvPtr, out stats);
+            return dst;
+        }
+
+        /// <summary>
+        /// Decodes an image from a buffer, scaled down to fit into maxSize (see ImReadReduced(string, Size, ImreadModes, Rect?)).
+        /// </summary>
+        /// <param name="buf">Encoded image</param>
+        /// <param name="maxSize">The result fits into this size, keeping its aspect ratio</param>
+        /// <param name="flags">The same flags as in imread</param>
+        /// <param name="roi">Optional region of interest in the coordinates of the full-resolution image</param>
+        /// <returns>The image, empty if it could not be decoded</returns>
+        public static Mat ImDecodeReduced(byte[] buf, Size maxSize, ImreadModes flags = ImreadModes.Color, Rect? roi = null)
+        {
+            return ImDecodeReduced(buf, maxSize, flags, roi, out _);
+        }
+
+        /// <summary>
+        /// Decodes an image from a buffer, scaled down to fit into maxSize (see ImReadReduced(string, Size, ImreadModes, Rect?)).
+        /// </summary>
+        /// <param name="buf">Encoded image</param>
+        /// <param name="maxSize">The result fits into this size, keeping its aspect ratio</param>
+        /// <param name="flags">The same flags as in imread</param>
+        /// <param name="roi">Optional region of interest in the coordinates of the full-resolution image</param>
+        /// <param name="stats">How the image was decoded</param>
+        /// <param name="measureBaseline">Also decodes the image at full resolution to measure the time saved (for tuning only)</param>
+        /// <returns>The image, empty if it could not be decoded</returns>
+        public static Mat ImDecodeReduced(byte[] buf, Size maxSize, ImreadModes flags, Rect? roi,
+            out ImageDecodeStats stats, bool measureBaseline = false)
+        {
+            if (buf == null)
+                throw new ArgumentNullException(nameof(buf));
+            if (buf.Length == 0)
+                throw new ArgumentException("buf is empty", nameof(buf));
+            var dst = new Mat();
+            NativeMethods.imgcodecs_imdecode_reduced(
+                buf, buf.Length, (int) flags, maxSize, roi.GetValueOrDefault(), measureBaseline ? 1 : 0, dst.CvPtr, out stats);
+            return dst;
+        }
+
+        private static GCHandle[] PinBuffers(IList<byte[]> bufs, out IntPtr[] ptrs, out long[] lengths)
+        {
+            var handles = new GCHandle[bufs.Count];
+            ptrs = new IntPtr[bufs.Count];
+            lengths = new long[bufs.Count];
+            try
+            {
+                for (int i = 0; i < bufs.Count; i++)
+                {
+                    if (bufs[i] == null)
+                        throw new ArgumentException("bufs contains null");
+                    handles[i] = GCHandle.Alloc(bufs[i], GCHandleType.Pinned);
+                    ptrs[i] = handles[i].AddrOfPinnedObject();
+                    lengths[i] = bufs[i].Length;
+                }
+                return handles;
+            }
+            catch
+            {
+                FreeHandles(handles);
+                throw;
+            }
+        }
+
+        private static void FreeHandles(GCHandle[] handles)
+        {
+            foreach (var handle in handles)
+            {
+                if (handle.IsAllocated)
+                    handle.Free();
+            }
+        }
+
         /// <summary>
         /// Compresses the image and stores it in the memory buffer
         /// </summary>
@@ -200,6 +430,31 @@ namespace OpenCvSharp
             }
         }
 
+        /// <summary>
+        /// Compresses the image into a native buffer which is handed over without copying it to a managed array
+        /// </summary>
+        /// <param name="ext">The file extension that defines the output format</param>
+        /// <param name="img">The image to be written</param>
+        /// <param name="buf">Output buffer; dispose it to free the memory.</param>
+        /// <param name="prms">Format-specific parameters.</param>
+        public static bool ImEncodeToNativeBuffer(string ext, InputArray img, out NativeBuffer<byte> buf, int[] prms = null)
+        {
+            if (string.IsNullOrEmpty(ext))
+                throw new ArgumentNullException(nameof(ext));
+            if (img == null)
+                throw new ArgumentNullException(nameof(img));
+            if (prms == null)
+                prms = new int[0];
+            img.ThrowIfDisposed();
+            using (var bufVec = new VectorOfByte())
+            {
+                int ret = NativeMethods.imgcodecs_imencode_vector(ext, img.CvPtr, bufVec.CvPtr, prms, prms.Length);
+                GC.KeepAlive(img);
+                buf = bufVec.Detach();
+                return ret != 0;
+            }
+        }
+
         /// <summary>
         /// Compresses the image and stores it in the memory buffer
         /// </summary>
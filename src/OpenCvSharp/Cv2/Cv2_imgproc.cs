@@ -2614,6 +2614,40 @@ namespace OpenCvSharp
             image.Fix();
             GC.KeepAlive(image);
         }
+
+        /// <summary>
+        /// Finds contours in a binary image, returning all contour points in one array (see FlatJaggedArray).
+        /// This avoids the per-contour allocations of FindContours when there are many contours.
+        /// </summary>
+        /// <param name="image">Source, an 8-bit single-channel image. Non-zero pixels are treated as 1’s. 
+        /// Zero pixels remain 0’s, so the image is treated as binary.
+        /// The function modifies the image while extracting the contours.</param> 
+        /// <param name="contours">Detected contours. Row i holds the points of contour i.</param>
+        /// <param name="hierarchy">Optional output vector, containing information about the image topology.</param>
+        /// <param name="mode">Contour retrieval mode</param>
+        /// <param name="method">Contour approximation method</param>
+        /// <param name="offset"> Optional offset by which every contour point is shifted.</param>
+        public static void FindContoursFlat(InputOutputArray image, out FlatJaggedArray<Point> contours,
+            out HierarchyIndex[] hierarchy, RetrievalModes mode, ContourApproximationModes method, Point? offset = null)
+        {
+            if (image == null)
+                throw new ArgumentNullException(nameof(image));
+            image.ThrowIfNotReady();
+
+            Point offset0 = offset.GetValueOrDefault(new Point());
+            IntPtr contoursPtr, hierarchyPtr;
+            NativeMethods.imgproc_findContours1_vector(image.CvPtr, out contoursPtr, out hierarchyPtr, (int)mode, (int)method, offset0);
+
+            using (var contoursVec = new VectorOfVectorPoint(contoursPtr))
+            using (var hierarchyVec = new VectorOfVec4i(hierarchyPtr))
+            {
+                contours = contoursVec.ToFlatArray();
+                Vec4i[] hierarchyOrg = hierarchyVec.ToArray();
+                hierarchy = EnumerableEx.SelectToArray(hierarchyOrg, HierarchyIndex.FromVec4i);
+            }
+            image.Fix();
+            GC.KeepAlive(image);
+        }
 #if LANG_JP
         /// <summary>
         /// 2値画像中の輪郭を検出します．
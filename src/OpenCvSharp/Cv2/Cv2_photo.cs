@@ -62,6 +62,26 @@ namespace OpenCvSharp
             dst.Fix();
             GC.KeepAlive(src);
         }
+
+        /// <summary>
+        /// Creates a job which runs FastNlMeansDenoising on a worker thread of NativeJobQueue.
+        /// Submit it with NativeJob.Submit; the denoised image is NativeJob.GetResult().
+        /// </summary>
+        /// <param name="src">Input 8-bit 1-channel, 2-channel or 3-channel image. Do not modify it until the job has finished.</param>
+        /// <param name="h">Parameter regulating filter strength.</param>
+        /// <param name="templateWindowSize">Size in pixels of the template patch that is used to compute weights.</param>
+        /// <param name="searchWindowSize">Size in pixels of the window that is used to compute weighted average for given pixel.</param>
+        /// <returns></returns>
+        public static NativeJob FastNlMeansDenoisingJob(InputArray src, float h = 3,
+            int templateWindowSize = 7, int searchWindowSize = 21)
+        {
+            if (src == null)
+                throw new ArgumentNullException(nameof(src));
+            src.ThrowIfDisposed();
+            var job = NativeMethods.photo_fastNlMeansDenoising_job(src.CvPtr, h, templateWindowSize, searchWindowSize);
+            GC.KeepAlive(src);
+            return new NativeJob(job);
+        }
         #endregion
         #region FastNlMeansDenoisingColored
 
@@ -93,6 +113,28 @@ namespace OpenCvSharp
             dst.Fix();
             GC.KeepAlive(src);
         }
+
+        /// <summary>
+        /// Creates a job which runs FastNlMeansDenoisingColored on a worker thread of NativeJobQueue.
+        /// Submit it with NativeJob.Submit; the denoised image is NativeJob.GetResult().
+        /// </summary>
+        /// <param name="src">Input 8-bit 3-channel image. Do not modify it until the job has finished.</param>
+        /// <param name="h">Parameter regulating filter strength for luminance component.</param>
+        /// <param name="hColor">The same as h but for color components.</param>
+        /// <param name="templateWindowSize">Size in pixels of the template patch that is used to compute weights.</param>
+        /// <param name="searchWindowSize">Size in pixels of the window that is used to compute weighted average for given pixel.</param>
+        /// <returns></returns>
+        public static NativeJob FastNlMeansDenoisingColoredJob(InputArray src,
+            float h = 3, float hColor = 3,
+            int templateWindowSize = 7, int searchWindowSize = 21)
+        {
+            if (src == null)
+                throw new ArgumentNullException(nameof(src));
+            src.ThrowIfDisposed();
+            var job = NativeMethods.photo_fastNlMeansDenoisingColored_job(src.CvPtr, h, hColor, templateWindowSize, searchWindowSize);
+            GC.KeepAlive(src);
+            return new NativeJob(job);
+        }
         #endregion
         #region FastNlMeansDenoisingMulti
         /// <summary>
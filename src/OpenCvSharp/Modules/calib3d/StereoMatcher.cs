@@ -44,6 +44,29 @@ namespace OpenCvSharp
             disparity.Fix();
         }
 
+        /// <summary>
+        /// Creates a job which computes the disparity map on a worker thread of NativeJobQueue.
+        /// Submit it with NativeJob.Submit; the disparity map is NativeJob.GetResult().
+        /// The job shares this matcher: do not change its parameters until the job has finished.
+        /// </summary>
+        /// <param name="left">Left 8-bit single-channel image.</param>
+        /// <param name="right">Right image of the same size and the same type as the left one.</param>
+        /// <returns></returns>
+        public NativeJob ComputeJob(InputArray left, InputArray right)
+        {
+            if (left == null)
+                throw new ArgumentNullException(nameof(left));
+            if (right == null)
+                throw new ArgumentNullException(nameof(right));
+            left.ThrowIfDisposed();
+            right.ThrowIfDisposed();
+            var job = NativeMethods.calib3d_StereoMatcher_compute_job(ptr, left.CvPtr, right.CvPtr);
+            GC.KeepAlive(this);
+            GC.KeepAlive(left);
+            GC.KeepAlive(right);
+            return new NativeJob(job);
+        }
+
         #region Properties
 
         /// <summary>
@@ -0,0 +1,59 @@
+﻿using System;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Records the calls of a set of native functions with their arguments to a binary log, which the native
+    /// tool OpenCvSharpExtern_replay re-executes without the .NET runtime.
+    /// Only 12 functions are recorded: Add, Subtract, Multiply, CvtColor, Threshold, Resize, WarpAffine, Canny,
+    /// GaussianBlur, MedianBlur, ImEncode and ImDecode. Calls of any other function are missing from the log,
+    /// so the replay skips them.
+    /// </summary>
+    public static class CallRecorder
+    {
+        /// <summary>
+        /// Whether calls are being recorded
+        /// </summary>
+        public static bool IsRecording
+        {
+            get { return NativeMethods.core_CallRecorder_isRecording() != 0; }
+        }
+
+        /// <summary>
+        /// Number of calls written since the last Start
+        /// </summary>
+        public static long RecordedCalls
+        {
+            get { return (long)NativeMethods.core_CallRecorder_recordedCalls(); }
+        }
+
+        /// <summary>
+        /// Size of the log written since the last Start [bytes]
+        /// </summary>
+        public static long RecordedBytes
+        {
+            get { return (long)NativeMethods.core_CallRecorder_recordedBytes(); }
+        }
+
+        /// <summary>
+        /// Starts recording to a new log file (an earlier recording is stopped)
+        /// </summary>
+        /// <param name="path"></param>
+        /// <param name="mode"></param>
+        public static void Start(string path, CallRecorderMode mode = CallRecorderMode.Hashes)
+        {
+            if (path == null)
+                throw new ArgumentNullException(nameof(path));
+            if (NativeMethods.core_CallRecorder_start(path, (int)mode) == 0)
+                throw new OpenCvSharpException("Failed to create the call log " + path);
+        }
+
+        /// <summary>
+        /// Stops recording and closes the log file
+        /// </summary>
+        public static void Stop()
+        {
+            NativeMethods.core_CallRecorder_stop();
+        }
+    }
+}
@@ -0,0 +1,19 @@
+﻿namespace OpenCvSharp
+{
+    /// <summary>
+    /// What CallRecorder stores about the input arrays of the recorded calls
+    /// </summary>
+    public enum CallRecorderMode : int
+    {
+        /// <summary>
+        /// Shape, type and a hash of the contents; the replayer fills the arrays with noise of the same shape.
+        /// Arrays of up to 4 KiB (e.g. a transformation matrix) are stored with their contents in any mode.
+        /// </summary>
+        Hashes = 0,
+
+        /// <summary>
+        /// The contents as well, so the replayed calls see the original data
+        /// </summary>
+        Contents = 1,
+    }
+}
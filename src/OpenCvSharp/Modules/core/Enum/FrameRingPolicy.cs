@@ -0,0 +1,18 @@
+﻿namespace OpenCvSharp
+{
+    /// <summary>
+    /// What the producer of a FrameRing does when the slot it is about to reuse has not been read yet
+    /// </summary>
+    public enum FrameRingPolicy : int
+    {
+        /// <summary>
+        /// Overwrite the oldest frame; consumers that fall behind skip the lost frames
+        /// </summary>
+        DropOldest = 0,
+
+        /// <summary>
+        /// Wait until every registered consumer has released the slot
+        /// </summary>
+        Block = 1,
+    }
+}
@@ -0,0 +1,43 @@
+﻿namespace OpenCvSharp
+{
+    /// <summary>
+    /// Kinds of native objects counted by NativeHandleStatistics
+    /// </summary>
+    public enum NativeHandleKind : int
+    {
+        /// <summary>
+        /// cv::Mat
+        /// </summary>
+        Mat = 0,
+
+        /// <summary>
+        /// std::vector of any element type
+        /// </summary>
+        Vector = 1,
+
+        /// <summary>
+        /// cv::Ptr of a cv::Algorithm subclass (feature detectors, ml models, background subtractors, ...)
+        /// </summary>
+        Algorithm = 2,
+
+        /// <summary>
+        /// Any other cv::Ptr
+        /// </summary>
+        OtherPtr = 3,
+
+        /// <summary>
+        /// cv::FileStorage
+        /// </summary>
+        FileStorage = 4,
+
+        /// <summary>
+        /// cv::VideoCapture
+        /// </summary>
+        VideoCapture = 5,
+
+        /// <summary>
+        /// cv::dnn::Net
+        /// </summary>
+        Net = 6,
+    }
+}
@@ -0,0 +1,38 @@
+﻿namespace OpenCvSharp
+{
+    /// <summary>
+    /// State of a NativeJob
+    /// </summary>
+    public enum NativeJobStatus : int
+    {
+        /// <summary>
+        /// Created and not submitted yet
+        /// </summary>
+        Created = 0,
+
+        /// <summary>
+        /// Waiting in the native job queue
+        /// </summary>
+        Queued = 1,
+
+        /// <summary>
+        /// Being executed by a worker thread
+        /// </summary>
+        Running = 2,
+
+        /// <summary>
+        /// Finished; the results are available
+        /// </summary>
+        Completed = 3,
+
+        /// <summary>
+        /// The operation threw an exception; see NativeJob.ErrorMessage
+        /// </summary>
+        Failed = 4,
+
+        /// <summary>
+        /// Cancelled before it started or at one of its cancellation points
+        /// </summary>
+        Cancelled = 5,
+    }
+}
@@ -0,0 +1,60 @@
+﻿using System;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Call counters and latency histograms of every native export.
+    /// </summary>
+    /// <remarks>
+    /// Only available when OpenCvSharpExtern was built with the CMake option OPENCVSHARP_PROFILE_EXPORTS
+    /// (GCC/Clang on ELF platforms). Otherwise IsAvailable is false and no data is recorded.
+    /// Recording is off until Enabled is set; calls made while disabled only cost a few instructions.
+    /// </remarks>
+    public static class ExportProfiler
+    {
+        /// <summary>
+        /// Whether the native library was built with export profiling
+        /// </summary>
+        public static bool IsAvailable
+        {
+            get { return NativeMethods.core_ExportProfiler_isAvailable() != 0; }
+        }
+
+        /// <summary>
+        /// Gets or sets whether calls are recorded
+        /// </summary>
+        public static bool Enabled
+        {
+            get { return NativeMethods.core_ExportProfiler_isEnabled() != 0; }
+            set { NativeMethods.core_ExportProfiler_setEnabled(value ? 1 : 0); }
+        }
+
+        /// <summary>
+        /// Returns the statistics of every export called since the last reset, most total time first
+        /// </summary>
+        /// <returns></returns>
+        public static ExportProfileEntry[] GetEntries()
+        {
+            while (true)
+            {
+                var count = NativeMethods.core_ExportProfiler_getEntries(null, 0);
+                // room for exports first called in between
+                var entries = new ExportProfileEntry[count + 16];
+                var actual = NativeMethods.core_ExportProfiler_getEntries(entries, entries.Length);
+                if (actual <= entries.Length)
+                {
+                    Array.Resize(ref entries, actual);
+                    return entries;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Clears all counters
+        /// </summary>
+        public static void Reset()
+        {
+            NativeMethods.core_ExportProfiler_reset();
+        }
+    }
+}
@@ -0,0 +1,79 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Lets Mats reference memory owned outside of OpenCV without copying it.
+    /// The owner is notified when the last Mat referencing the memory (including ROIs and
+    /// header copies made by OpenCV functions) is released.
+    /// </summary>
+    /// <remarks>
+    /// The release notification runs on the thread that drops the last reference,
+    /// which may be a native worker thread.
+    /// </remarks>
+    public static class ExternalMatAllocator
+    {
+        private static readonly MatReleaseCallback releaseCallback = OnRelease;
+        private static readonly IntPtr releaseCallbackPtr = Marshal.GetFunctionPointerForDelegate(releaseCallback);
+
+        /// <summary>
+        /// Number of external buffers that are still referenced by some Mat
+        /// </summary>
+        public static long LiveCount
+        {
+            get { return (long)NativeMethods.core_ExternalMatAllocator_liveCount(); }
+        }
+
+        /// <summary>
+        /// Creates the native Mat through <paramref name="create"/>, passing it the managed release
+        /// callback and a token which identifies <paramref name="onRelease"/>.
+        /// </summary>
+        internal static IntPtr Create(Action<IntPtr> onRelease, Func<IntPtr, IntPtr, IntPtr> create)
+        {
+            if (onRelease == null)
+                throw new ArgumentNullException(nameof(onRelease));
+
+            var owner = new Owner(onRelease);
+            var handle = GCHandle.Alloc(owner);
+            try
+            {
+                return create(releaseCallbackPtr, GCHandle.ToIntPtr(handle));
+            }
+            catch
+            {
+                // the callback has not been attached unless the native side failed after attaching it
+                if (!owner.Released)
+                    handle.Free();
+                throw;
+            }
+        }
+
+        private static void OnRelease(IntPtr data, IntPtr userToken)
+        {
+            var handle = GCHandle.FromIntPtr(userToken);
+            var owner = (Owner)handle.Target;
+            handle.Free();
+            owner.Released = true;
+            try
+            {
+                owner.OnRelease(data);
+            }
+            catch
+            {
+                // an exception must not unwind into the native Mat destructor
+            }
+        }
+
+        private sealed class Owner
+        {
+            public readonly Action<IntPtr> OnRelease;
+            public volatile bool Released;
+
+            public Owner(Action<IntPtr> onRelease)
+            {
+                OnRelease = onRelease;
+            }
+        }
+    }
+}
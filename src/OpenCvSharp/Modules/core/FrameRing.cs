@@ -0,0 +1,291 @@
+﻿using System;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Ring of fixed-size frame slots in named shared memory, for passing frames between processes
+    /// without copying them. One producer writes the frames, up to 16 consumers (in the same or other
+    /// processes) read them; the slots are synchronized without locks.
+    /// </summary>
+    /// <remarks>
+    /// The Mats returned by BeginWrite and Acquire are headers over the shared slot. They stay valid
+    /// memory after the ring is disposed, but the producer reuses the slot once the consumers released
+    /// it (FrameRingPolicy.Block) or as soon as the ring wraps around (FrameRingPolicy.DropOldest;
+    /// check IsValid after reading the frame).
+    /// </remarks>
+    public sealed class FrameRing : DisposableCvObject
+    {
+        private FrameRing(IntPtr p)
+        {
+            ptr = p;
+        }
+
+        /// <summary>
+        /// Creates the shared memory of a ring and opens it as the producer. Fails if shared memory of that name
+        /// already exists (see Unlink for one left behind by a producer which did not shut down).
+        /// The shared memory is removed when the producer is disposed.
+        /// </summary>
+        /// <param name="name">Name of the shared memory object ("/name" on POSIX systems)</param>
+        /// <param name="slotCount">Number of frames the ring holds</param>
+        /// <param name="slotBytes">Maximum size in bytes of the pixels of one frame</param>
+        /// <param name="policy">What to do when the consumers fall behind</param>
+        /// <returns></returns>
+        public static FrameRing Create(string name, int slotCount, long slotBytes, FrameRingPolicy policy = FrameRingPolicy.DropOldest)
+        {
+            if (name == null)
+                throw new ArgumentNullException(nameof(name));
+            if (slotCount <= 0)
+                throw new ArgumentOutOfRangeException(nameof(slotCount));
+            if (slotBytes <= 0)
+                throw new ArgumentOutOfRangeException(nameof(slotBytes));
+            return new FrameRing(NativeMethods.core_FrameRing_create(name, slotCount, (ulong)slotBytes, (int)policy));
+        }
+
+        /// <summary>
+        /// Opens a ring created by a producer, in order to add consumers to it
+        /// </summary>
+        /// <param name="name">Name passed to Create</param>
+        /// <returns></returns>
+        public static FrameRing Open(string name)
+        {
+            if (name == null)
+                throw new ArgumentNullException(nameof(name));
+            return new FrameRing(NativeMethods.core_FrameRing_open(name));
+        }
+
+        /// <summary>
+        /// Removes the name of the shared memory of a ring whose producer did not shut down, so that Create can
+        /// use the name again. Processes which still have the ring open keep their mapping, but a new ring of that
+        /// name is a different one; only call it when the old producer is known to be gone.
+        /// On Windows the shared memory disappears with the last process using it, and this does nothing.
+        /// </summary>
+        /// <param name="name">Name passed to Create</param>
+        /// <returns>false if there was no shared memory of that name</returns>
+        public static bool Unlink(string name)
+        {
+            if (name == null)
+                throw new ArgumentNullException(nameof(name));
+            return NativeMethods.core_FrameRing_unlink(name) != 0;
+        }
+
+        /// <summary>
+        /// Releases unmanaged resources
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.core_FrameRing_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        #region Properties
+
+        /// <summary>
+        /// Number of frames the ring holds
+        /// </summary>
+        public int SlotCount
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var ret = NativeMethods.core_FrameRing_slotCount(ptr);
+                GC.KeepAlive(this);
+                return ret;
+            }
+        }
+
+        /// <summary>
+        /// Maximum size in bytes of the pixels of one frame
+        /// </summary>
+        public long SlotBytes
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var ret = (long)NativeMethods.core_FrameRing_slotBytes(ptr);
+                GC.KeepAlive(this);
+                return ret;
+            }
+        }
+
+        /// <summary>
+        /// What the producer does when the consumers fall behind
+        /// </summary>
+        public FrameRingPolicy Policy
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var ret = (FrameRingPolicy)NativeMethods.core_FrameRing_policy(ptr);
+                GC.KeepAlive(this);
+                return ret;
+            }
+        }
+
+        /// <summary>
+        /// Number of frames committed so far
+        /// </summary>
+        public long WriteSequence
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var ret = (long)NativeMethods.core_FrameRing_writeSequence(ptr);
+                GC.KeepAlive(this);
+                return ret;
+            }
+        }
+
+        /// <summary>
+        /// True once the producer has been disposed
+        /// </summary>
+        public bool IsClosed
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var ret = NativeMethods.core_FrameRing_isClosed(ptr) != 0;
+                GC.KeepAlive(this);
+                return ret;
+            }
+        }
+
+        #endregion
+
+        #region Producer
+
+        /// <summary>
+        /// Waits for the next free slot and makes dst a header over it, to be filled in place.
+        /// The frame becomes visible to the consumers on Commit.
+        /// </summary>
+        /// <param name="rows">Number of rows of the frame</param>
+        /// <param name="cols">Number of columns of the frame</param>
+        /// <param name="type">Array type of the frame</param>
+        /// <param name="dst">Receives the header over the slot</param>
+        /// <param name="timeoutMs">Maximum wait in milliseconds under FrameRingPolicy.Block (-1: infinite)</param>
+        /// <returns>false on timeout</returns>
+        public bool BeginWrite(int rows, int cols, MatType type, Mat dst, int timeoutMs = -1)
+        {
+            ThrowIfDisposed();
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            dst.ThrowIfDisposed();
+            var ret = NativeMethods.core_FrameRing_beginWrite(ptr, rows, cols, type, timeoutMs, dst.CvPtr) != 0;
+            GC.KeepAlive(this);
+            GC.KeepAlive(dst);
+            return ret;
+        }
+
+        /// <summary>
+        /// Publishes the frame started by BeginWrite
+        /// </summary>
+        /// <param name="timestamp">Timestamp passed on to the consumers</param>
+        /// <returns>Sequence number of the frame</returns>
+        public long Commit(long timestamp)
+        {
+            ThrowIfDisposed();
+            var ret = (long)NativeMethods.core_FrameRing_commit(ptr, timestamp);
+            GC.KeepAlive(this);
+            return ret;
+        }
+
+        /// <summary>
+        /// Copies src into the next free slot and publishes it
+        /// </summary>
+        /// <param name="src">Frame to write</param>
+        /// <param name="timestamp">Timestamp passed on to the consumers</param>
+        /// <param name="timeoutMs">Maximum wait in milliseconds under FrameRingPolicy.Block (-1: infinite)</param>
+        /// <returns>false on timeout</returns>
+        public bool Write(Mat src, long timestamp, int timeoutMs = -1)
+        {
+            if (src == null)
+                throw new ArgumentNullException(nameof(src));
+            src.ThrowIfDisposed();
+            using (var slot = new Mat())
+            {
+                if (!BeginWrite(src.Rows, src.Cols, src.Type(), slot, timeoutMs))
+                    return false;
+                src.CopyTo(slot);
+                Commit(timestamp);
+                return true;
+            }
+        }
+
+        #endregion
+
+        #region Consumer
+
+        /// <summary>
+        /// Registers a consumer which reads the frames written from now on
+        /// </summary>
+        /// <returns>Consumer id</returns>
+        public int AddConsumer()
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.core_FrameRing_addConsumer(ptr);
+            GC.KeepAlive(this);
+            if (ret < 0)
+                throw new OpenCvSharpException("The frame ring has no free consumer entry");
+            return ret;
+        }
+
+        /// <summary>
+        /// Unregisters a consumer, so that a blocking producer no longer waits for it
+        /// </summary>
+        /// <param name="consumer">Consumer id returned by AddConsumer</param>
+        public void RemoveConsumer(int consumer)
+        {
+            ThrowIfDisposed();
+            NativeMethods.core_FrameRing_removeConsumer(ptr, consumer);
+            GC.KeepAlive(this);
+        }
+
+        /// <summary>
+        /// Waits for the next frame of the consumer and makes dst a header over its slot.
+        /// Acquiring again before Release returns the same frame.
+        /// </summary>
+        /// <param name="consumer">Consumer id returned by AddConsumer</param>
+        /// <param name="dst">Receives the header over the slot</param>
+        /// <param name="info">Frame metadata</param>
+        /// <param name="timeoutMs">Maximum wait in milliseconds (-1: infinite)</param>
+        /// <returns>false on timeout, or if the producer is closed and every frame has been read (see IsClosed)</returns>
+        public bool Acquire(int consumer, Mat dst, out FrameRingFrameInfo info, int timeoutMs = -1)
+        {
+            ThrowIfDisposed();
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            dst.ThrowIfDisposed();
+            var ret = NativeMethods.core_FrameRing_acquire(ptr, consumer, timeoutMs, dst.CvPtr, out info) > 0;
+            GC.KeepAlive(this);
+            GC.KeepAlive(dst);
+            return ret;
+        }
+
+        /// <summary>
+        /// Hands the slot of an acquired frame back to the producer
+        /// </summary>
+        /// <param name="consumer">Consumer id returned by AddConsumer</param>
+        /// <param name="info">Metadata returned by Acquire</param>
+        public void Release(int consumer, FrameRingFrameInfo info)
+        {
+            ThrowIfDisposed();
+            NativeMethods.core_FrameRing_release(ptr, consumer, info.Sequence);
+            GC.KeepAlive(this);
+        }
+
+        /// <summary>
+        /// Returns true while the slot of the frame has not been reused by the producer.
+        /// Under FrameRingPolicy.DropOldest, the data read from an acquired frame is consistent only if this holds after reading it.
+        /// </summary>
+        /// <param name="info">Metadata returned by Acquire</param>
+        /// <returns></returns>
+        public bool IsValid(FrameRingFrameInfo info)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.core_FrameRing_isValid(ptr, info.Sequence) != 0;
+            GC.KeepAlive(this);
+            return ret;
+        }
+
+        #endregion
+    }
+}
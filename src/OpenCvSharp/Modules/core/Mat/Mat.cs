@@ -520,6 +520,30 @@ namespace OpenCvSharp
             base.DisposeUnmanaged();
         }
 
+        /// <summary>
+        /// Disposes several Mats with a single native call
+        /// </summary>
+        /// <param name="mats">Mats to dispose; null and already disposed entries are skipped</param>
+        public static void DisposeMany(IEnumerable<Mat> mats)
+        {
+            if (mats == null)
+                throw new ArgumentNullException(nameof(mats));
+            var handles = new List<IntPtr>();
+            foreach (var mat in mats)
+            {
+                if (mat == null || mat.IsDisposed)
+                    continue;
+                if (mat.IsEnabledDispose && mat.ptr != IntPtr.Zero)
+                {
+                    handles.Add(mat.ptr);
+                    mat.ptr = IntPtr.Zero; // DisposeUnmanaged skips the native delete
+                }
+                mat.Dispose();
+            }
+            if (handles.Count > 0)
+                NativeMethods.core_Mat_deleteMany(handles.ToArray(), handles.Count);
+        }
+
         #region Static Initializers
 
 #if LANG_JP
@@ -611,6 +635,107 @@ namespace OpenCvSharp
             return ImDecode(imageBytes, mode);
         }
 
+        /// <summary>
+        /// Creates a Mat that references external data without copying it and
+        /// notifies the owner once the data is no longer referenced by any Mat.
+        /// </summary>
+        /// <param name="rows">Number of rows in a 2D array.</param>
+        /// <param name="cols">Number of columns in a 2D array.</param>
+        /// <param name="type">Array type.</param>
+        /// <param name="data">Pointer to the external data.</param>
+        /// <param name="step">Number of bytes each matrix row occupies (0: no padding).</param>
+        /// <param name="onRelease">Called with <paramref name="data"/> when the last Mat referencing it
+        /// (including ROIs and copies of the header) is released. It may run on any thread and must not throw.</param>
+        /// <returns></returns>
+        public static Mat FromExternalData(int rows, int cols, MatType type, IntPtr data, long step, Action<IntPtr> onRelease)
+        {
+            if (data == IntPtr.Zero)
+                throw new ArgumentNullException(nameof(data));
+            IntPtr p = ExternalMatAllocator.Create(onRelease, (callback, token) =>
+                NativeMethods.core_Mat_new_External8(rows, cols, type, data, new IntPtr(step), callback, token));
+            return new Mat(p);
+        }
+
+        /// <summary>
+        /// Creates an n-dimensional Mat that references external data without copying it and
+        /// notifies the owner once the data is no longer referenced by any Mat.
+        /// </summary>
+        /// <param name="sizes">Array of integers specifying an n-dimensional array shape.</param>
+        /// <param name="type">Array type.</param>
+        /// <param name="data">Pointer to the external data.</param>
+        /// <param name="steps">Array of ndims-1 steps (null: the data is continuous).</param>
+        /// <param name="onRelease">Called with <paramref name="data"/> when the last Mat referencing it
+        /// (including ROIs and copies of the header) is released. It may run on any thread and must not throw.</param>
+        /// <returns></returns>
+        public static Mat FromExternalData(IEnumerable<int> sizes, MatType type, IntPtr data, IEnumerable<long> steps,
+            Action<IntPtr> onRelease)
+        {
+            if (sizes == null)
+                throw new ArgumentNullException(nameof(sizes));
+            if (data == IntPtr.Zero)
+                throw new ArgumentNullException(nameof(data));
+            int[] sizesArray = EnumerableEx.ToArray(sizes);
+            IntPtr[] stepsArray = (steps == null) ? null : EnumerableEx.SelectToArray(steps, s => new IntPtr(s));
+            IntPtr p = ExternalMatAllocator.Create(onRelease, (callback, token) =>
+                NativeMethods.core_Mat_new_External9(sizesArray.Length, sizesArray, type, data, stepsArray, callback, token));
+            return new Mat(p);
+        }
+
+        /// <summary>
+        /// Creates a Mat that references external data without copying it and calls a native function
+        /// once the data is no longer referenced by any Mat (e.g. the free function of a decoder or a frame pool).
+        /// </summary>
+        /// <param name="rows">Number of rows in a 2D array.</param>
+        /// <param name="cols">Number of columns in a 2D array.</param>
+        /// <param name="type">Array type.</param>
+        /// <param name="data">Pointer to the external data.</param>
+        /// <param name="step">Number of bytes each matrix row occupies (0: no padding).</param>
+        /// <param name="releaseCallback">Pointer to a cdecl function void(void *data, void *userToken).</param>
+        /// <param name="userToken">Value passed to <paramref name="releaseCallback"/>.</param>
+        /// <returns></returns>
+        public static Mat FromExternalData(int rows, int cols, MatType type, IntPtr data, long step,
+            IntPtr releaseCallback, IntPtr userToken)
+        {
+            if (data == IntPtr.Zero)
+                throw new ArgumentNullException(nameof(data));
+            IntPtr p = NativeMethods.core_Mat_new_External8(rows, cols, type, data, new IntPtr(step), releaseCallback, userToken);
+            return new Mat(p);
+        }
+
+        /// <summary>
+        /// Creates a Mat that uses the memory of a managed array without copying it.
+        /// The array stays pinned until the last Mat referencing it is released,
+        /// which may be later than the disposal of the returned instance.
+        /// </summary>
+        /// <param name="rows">Number of rows in a 2D array.</param>
+        /// <param name="cols">Number of columns in a 2D array.</param>
+        /// <param name="type">Array type.</param>
+        /// <param name="data">Array of a blittable element type.</param>
+        /// <param name="step">Number of bytes each matrix row occupies (0: no padding).</param>
+        /// <returns></returns>
+        public static Mat FromPinnedArray(int rows, int cols, MatType type, Array data, long step = 0)
+        {
+            if (data == null)
+                throw new ArgumentNullException(nameof(data));
+            GCHandle handle = GCHandle.Alloc(data, GCHandleType.Pinned);
+            bool released = false;
+            try
+            {
+                return FromExternalData(rows, cols, type, handle.AddrOfPinnedObject(), step, _ =>
+                {
+                    released = true;
+                    handle.Free();
+                });
+            }
+            catch
+            {
+                // once the release callback has been attached, it owns the pin (and has run if the native side failed)
+                if (!released)
+                    handle.Free();
+                throw;
+            }
+        }
+
         #endregion
 
         #endregion
@@ -5043,6 +5168,196 @@ namespace OpenCvSharp
 
         #endregion
 
+        #region Mapped file
+
+        /// <summary>
+        /// Creates (or overwrites) a file that holds a rows x cols matrix and returns a Mat over
+        /// a read-write memory mapping of it. The pixels are paged in by the OS as they are touched,
+        /// so the matrix may be much larger than the physical memory.
+        /// </summary>
+        /// <param name="path">Path of the file (a small header followed by the pixels)</param>
+        /// <param name="rows">Number of rows</param>
+        /// <param name="cols">Number of columns</param>
+        /// <param name="type">Array type</param>
+        /// <returns></returns>
+        public static Mat CreateMapped(string path, int rows, int cols, MatType type)
+        {
+            if (path == null)
+                throw new ArgumentNullException(nameof(path));
+            IntPtr p = NativeMethods.core_Mat_new_MappedCreate(path, rows, cols, type);
+            return new Mat(p);
+        }
+
+        /// <summary>
+        /// Returns a Mat over a memory mapping of a file written by CreateMapped.
+        /// The mapping is released when the last Mat referencing it (including ROIs) is released.
+        /// </summary>
+        /// <param name="path">Path of the file</param>
+        /// <param name="writable">If false, the pixels must not be modified</param>
+        /// <returns></returns>
+        public static Mat OpenMapped(string path, bool writable = false)
+        {
+            if (path == null)
+                throw new ArgumentNullException(nameof(path));
+            IntPtr p = NativeMethods.core_Mat_new_MappedOpen(path, writable ? 1 : 0);
+            return new Mat(p);
+        }
+
+        /// <summary>
+        /// Writes the modified pixels of this matrix (or ROI) back to its mapped file
+        /// </summary>
+        /// <returns>false if the matrix is not backed by a mapped file</returns>
+        public bool FlushMapped()
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.core_Mat_flushMapped(ptr) != 0;
+            GC.KeepAlive(this);
+            return ret;
+        }
+
+        /// <summary>
+        /// Returns true if the data of this matrix is a memory mapped file
+        /// </summary>
+        /// <returns></returns>
+        public bool IsMapped()
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.core_Mat_isMapped(ptr) != 0;
+            GC.KeepAlive(this);
+            return ret;
+        }
+
+        #endregion
+
+        #region GetRegion / SetRegion
+
+        /// <summary>
+        /// Copies a rectangle of this matrix to an external buffer in one call,
+        /// optionally converting the depth and reordering the channels.
+        /// The buffer receives saturate_cast&lt;dataType&gt;(this(roi) * alpha + beta).
+        /// </summary>
+        /// <param name="roi">Rectangle of this matrix to copy</param>
+        /// <param name="data">Pointer to the first element of the destination buffer</param>
+        /// <param name="step">Distance between the buffer rows in bytes (0: rows are packed)</param>
+        /// <param name="dataType">Element type of the buffer; its depth may differ from this matrix</param>
+        /// <param name="alpha">Scale factor applied while copying</param>
+        /// <param name="beta">Offset added after scaling</param>
+        /// <param name="channelOrder">For each buffer channel, the channel of this matrix it is taken from
+        /// (e.g. {2, 1, 0} turns BGR into RGB). null means the channels are copied as they are.</param>
+        public void GetRegion(Rect roi, IntPtr data, long step, MatType dataType,
+            double alpha = 1, double beta = 0, int[] channelOrder = null)
+        {
+            ThrowIfDisposed();
+            if (data == IntPtr.Zero)
+                throw new ArgumentNullException(nameof(data));
+            if (step < 0)
+                throw new ArgumentOutOfRangeException(nameof(step));
+            NativeMethods.core_Mat_getRegion(ptr, roi, data, new IntPtr(step), dataType,
+                alpha, beta, channelOrder, channelOrder?.Length ?? 0);
+            GC.KeepAlive(this);
+        }
+
+        /// <summary>
+        /// Copies a rectangle of this matrix to a packed array in one call,
+        /// optionally converting the depth and reordering the channels.
+        /// The array receives saturate_cast&lt;dataType&gt;(this(roi) * alpha + beta).
+        /// </summary>
+        /// <typeparam name="T">Array element type (e.g. byte, float, Vec3f)</typeparam>
+        /// <param name="roi">Rectangle of this matrix to copy</param>
+        /// <param name="data">Destination array that holds roi.Width * roi.Height elements of dataType</param>
+        /// <param name="dataType">Element type of the array; its depth may differ from this matrix</param>
+        /// <param name="alpha">Scale factor applied while copying</param>
+        /// <param name="beta">Offset added after scaling</param>
+        /// <param name="channelOrder">For each array channel, the channel of this matrix it is taken from
+        /// (e.g. {2, 1, 0} turns BGR into RGB). null means the channels are copied as they are.</param>
+        public void GetRegion<T>(Rect roi, T[] data, MatType dataType,
+            double alpha = 1, double beta = 0, int[] channelOrder = null)
+            where T : struct
+        {
+            CheckArgumentsForRegion(roi, data, dataType);
+            using (var address = new ArrayAddress1<T>(data))
+            {
+                GetRegion(roi, address.Pointer, 0, dataType, alpha, beta, channelOrder);
+            }
+        }
+
+        /// <summary>
+        /// Writes an external buffer to a rectangle of this matrix in one call,
+        /// optionally converting the depth and reordering the channels.
+        /// The rectangle receives saturate_cast(buffer * alpha + beta) in the depth of this matrix.
+        /// </summary>
+        /// <param name="roi">Rectangle of this matrix to overwrite</param>
+        /// <param name="data">Pointer to the first element of the source buffer</param>
+        /// <param name="step">Distance between the buffer rows in bytes (0: rows are packed)</param>
+        /// <param name="dataType">Element type of the buffer; its depth may differ from this matrix</param>
+        /// <param name="alpha">Scale factor applied while copying</param>
+        /// <param name="beta">Offset added after scaling</param>
+        /// <param name="channelOrder">For each buffer channel, the channel of this matrix it is written to.
+        /// Channels of this matrix that are not listed are left unchanged.
+        /// null means the channels are copied as they are.</param>
+        public void SetRegion(Rect roi, IntPtr data, long step, MatType dataType,
+            double alpha = 1, double beta = 0, int[] channelOrder = null)
+        {
+            ThrowIfDisposed();
+            if (data == IntPtr.Zero)
+                throw new ArgumentNullException(nameof(data));
+            if (step < 0)
+                throw new ArgumentOutOfRangeException(nameof(step));
+            NativeMethods.core_Mat_setRegion(ptr, roi, data, new IntPtr(step), dataType,
+                alpha, beta, channelOrder, channelOrder?.Length ?? 0);
+            GC.KeepAlive(this);
+        }
+
+        /// <summary>
+        /// Writes a packed array to a rectangle of this matrix in one call,
+        /// optionally converting the depth and reordering the channels.
+        /// The rectangle receives saturate_cast(data * alpha + beta) in the depth of this matrix.
+        /// </summary>
+        /// <typeparam name="T">Array element type (e.g. byte, float, Vec3f)</typeparam>
+        /// <param name="roi">Rectangle of this matrix to overwrite</param>
+        /// <param name="data">Source array that holds roi.Width * roi.Height elements of dataType</param>
+        /// <param name="dataType">Element type of the array; its depth may differ from this matrix</param>
+        /// <param name="alpha">Scale factor applied while copying</param>
+        /// <param name="beta">Offset added after scaling</param>
+        /// <param name="channelOrder">For each array channel, the channel of this matrix it is written to.
+        /// Channels of this matrix that are not listed are left unchanged.
+        /// null means the channels are copied as they are.</param>
+        public void SetRegion<T>(Rect roi, T[] data, MatType dataType,
+            double alpha = 1, double beta = 0, int[] channelOrder = null)
+            where T : struct
+        {
+            CheckArgumentsForRegion(roi, data, dataType);
+            using (var address = new ArrayAddress1<T>(data))
+            {
+                SetRegion(roi, address.Pointer, 0, dataType, alpha, beta, channelOrder);
+            }
+        }
+
+        private static void CheckArgumentsForRegion<T>(Rect roi, T[] data, MatType dataType)
+            where T : struct
+        {
+            if (data == null)
+                throw new ArgumentNullException(nameof(data));
+            if (roi.Width < 0 || roi.Height < 0)
+                throw new ArgumentOutOfRangeException(nameof(roi));
+
+            int depthSize;
+            switch (dataType.Depth)
+            {
+                case MatType.CV_8U: case MatType.CV_8S: depthSize = 1; break;
+                case MatType.CV_16U: case MatType.CV_16S: depthSize = 2; break;
+                case MatType.CV_32S: case MatType.CV_32F: depthSize = 4; break;
+                default: depthSize = 8; break;
+            }
+            long required = (long)roi.Width * roi.Height * dataType.Channels * depthSize;
+            long available = (long)data.Length * Marshal.SizeOf(typeof(T));
+            if (available < required)
+                throw new ArgumentException(
+                    $"The array holds {available} bytes but the region needs {required} bytes", nameof(data));
+        }
+
+        #endregion
+
         #region Reserve
 
         /// <summary>
@@ -43,6 +43,39 @@ namespace OpenCvSharp
 
         #endregion
 
+        #region Fused evaluation
+
+        /// <summary>
+        /// Gets or sets whether element-wise Mat/MatExpr operators are evaluated lazily.
+        /// When enabled, a chain such as (a * 0.5 + b) / c builds an expression tree that is evaluated
+        /// in one parallel, vectorized pass (without full-size temporaries) when it is converted to a Mat or assigned.
+        /// </summary>
+        /// <remarks>
+        /// Intermediate results are saturated to their type but not rounded, so the result can differ by one
+        /// from the eager evaluation. CV_32S/CV_64F data is always evaluated eagerly.
+        /// </remarks>
+        public static bool FusedEvaluation
+        {
+            get { return NativeMethods.core_MatExpr_getFusedEvaluation() != 0; }
+            set { NativeMethods.core_MatExpr_setFusedEvaluation(value ? 1 : 0); }
+        }
+
+        /// <summary>
+        /// Returns true if this expression is a lazily evaluated (fused) expression tree
+        /// </summary>
+        public bool IsFused
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var res = NativeMethods.core_MatExpr_isFused(ptr) != 0;
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        #endregion
+
         #region Cast
 
         /// <summary>
@@ -648,6 +681,548 @@ namespace OpenCvSharp
             }
         }
         #endregion
+        #region &
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="e"></param>
+        /// <param name="m"></param>
+        /// <returns></returns>
+        public static MatExpr operator &(MatExpr e, Mat m)
+        {
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            e.ThrowIfDisposed();
+            m.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorAnd_MatExprMat(e.CvPtr, m.CvPtr);
+                GC.KeepAlive(e);
+                GC.KeepAlive(m);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="m"></param>
+        /// <param name="e"></param>
+        /// <returns></returns>
+        public static MatExpr operator &(Mat m, MatExpr e)
+        {
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            m.ThrowIfDisposed();
+            e.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorAnd_MatMatExpr(m.CvPtr, e.CvPtr);
+                GC.KeepAlive(m);
+                GC.KeepAlive(e);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="e"></param>
+        /// <param name="s"></param>
+        /// <returns></returns>
+        public static MatExpr operator &(MatExpr e, double s)
+        {
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            e.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorAnd_MatExprDouble(e.CvPtr, s);
+                GC.KeepAlive(e);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="s"></param>
+        /// <param name="e"></param>
+        /// <returns></returns>
+        public static MatExpr operator &(double s, MatExpr e)
+        {
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            e.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorAnd_DoubleMatExpr(s, e.CvPtr);
+                GC.KeepAlive(e);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="e1"></param>
+        /// <param name="e2"></param>
+        /// <returns></returns>
+        public static MatExpr operator &(MatExpr e1, MatExpr e2)
+        {
+            if (e1 == null)
+                throw new ArgumentNullException(nameof(e1));
+            if (e2 == null)
+                throw new ArgumentNullException(nameof(e2));
+            e1.ThrowIfDisposed();
+            e2.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorAnd_MatExprMatExpr(e1.CvPtr, e2.CvPtr);
+                GC.KeepAlive(e1);
+                GC.KeepAlive(e2);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        #endregion
+        #region |
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="e"></param>
+        /// <param name="m"></param>
+        /// <returns></returns>
+        public static MatExpr operator |(MatExpr e, Mat m)
+        {
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            e.ThrowIfDisposed();
+            m.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorOr_MatExprMat(e.CvPtr, m.CvPtr);
+                GC.KeepAlive(e);
+                GC.KeepAlive(m);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="m"></param>
+        /// <param name="e"></param>
+        /// <returns></returns>
+        public static MatExpr operator |(Mat m, MatExpr e)
+        {
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            m.ThrowIfDisposed();
+            e.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorOr_MatMatExpr(m.CvPtr, e.CvPtr);
+                GC.KeepAlive(m);
+                GC.KeepAlive(e);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="e"></param>
+        /// <param name="s"></param>
+        /// <returns></returns>
+        public static MatExpr operator |(MatExpr e, double s)
+        {
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            e.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorOr_MatExprDouble(e.CvPtr, s);
+                GC.KeepAlive(e);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="s"></param>
+        /// <param name="e"></param>
+        /// <returns></returns>
+        public static MatExpr operator |(double s, MatExpr e)
+        {
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            e.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorOr_DoubleMatExpr(s, e.CvPtr);
+                GC.KeepAlive(e);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="e1"></param>
+        /// <param name="e2"></param>
+        /// <returns></returns>
+        public static MatExpr operator |(MatExpr e1, MatExpr e2)
+        {
+            if (e1 == null)
+                throw new ArgumentNullException(nameof(e1));
+            if (e2 == null)
+                throw new ArgumentNullException(nameof(e2));
+            e1.ThrowIfDisposed();
+            e2.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorOr_MatExprMatExpr(e1.CvPtr, e2.CvPtr);
+                GC.KeepAlive(e1);
+                GC.KeepAlive(e2);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        #endregion
+        #region ^
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="e"></param>
+        /// <param name="m"></param>
+        /// <returns></returns>
+        public static MatExpr operator ^(MatExpr e, Mat m)
+        {
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            e.ThrowIfDisposed();
+            m.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorXor_MatExprMat(e.CvPtr, m.CvPtr);
+                GC.KeepAlive(e);
+                GC.KeepAlive(m);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="m"></param>
+        /// <param name="e"></param>
+        /// <returns></returns>
+        public static MatExpr operator ^(Mat m, MatExpr e)
+        {
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            m.ThrowIfDisposed();
+            e.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorXor_MatMatExpr(m.CvPtr, e.CvPtr);
+                GC.KeepAlive(m);
+                GC.KeepAlive(e);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="e"></param>
+        /// <param name="s"></param>
+        /// <returns></returns>
+        public static MatExpr operator ^(MatExpr e, double s)
+        {
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            e.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorXor_MatExprDouble(e.CvPtr, s);
+                GC.KeepAlive(e);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="s"></param>
+        /// <param name="e"></param>
+        /// <returns></returns>
+        public static MatExpr operator ^(double s, MatExpr e)
+        {
+            if (e == null)
+                throw new ArgumentNullException(nameof(e));
+            e.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorXor_DoubleMatExpr(s, e.CvPtr);
+                GC.KeepAlive(e);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        /// <summary>
+        /// 
+        /// </summary>
+        /// <param name="e1"></param>
+        /// <param name="e2"></param>
+        /// <returns></returns>
+        public static MatExpr operator ^(MatExpr e1, MatExpr e2)
+        {
+            if (e1 == null)
+                throw new ArgumentNullException(nameof(e1));
+            if (e2 == null)
+                throw new ArgumentNullException(nameof(e2));
+            e1.ThrowIfDisposed();
+            e2.ThrowIfDisposed();
+            try
+            {
+                IntPtr retPtr = NativeMethods.core_operatorXor_MatExprMatExpr(e1.CvPtr, e2.CvPtr);
+                GC.KeepAlive(e1);
+                GC.KeepAlive(e2);
+                return new MatExpr(retPtr);
+            }
+            catch (BadImageFormatException ex)
+            {
+                throw PInvokeHelper.CreateException(ex);
+            }
+        }
+        #endregion
+        #region Comparison
+        /// <summary>
+        /// operator &lt;
+        /// </summary>
+        /// <param name="m"></param>
+        /// <returns></returns>
+        public MatExpr LessThan(Mat m)
+        {
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            ThrowIfDisposed();
+            m.ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareMat(ptr, m.CvPtr, (int)CmpTypes.LT);
+            GC.KeepAlive(this);
+            GC.KeepAlive(m);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator &lt;
+        /// </summary>
+        /// <param name="d"></param>
+        /// <returns></returns>
+        public MatExpr LessThan(double d)
+        {
+            ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareDouble(ptr, d, (int)CmpTypes.LT);
+            GC.KeepAlive(this);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator &lt;=
+        /// </summary>
+        /// <param name="m"></param>
+        /// <returns></returns>
+        public MatExpr LessThanOrEqual(Mat m)
+        {
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            ThrowIfDisposed();
+            m.ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareMat(ptr, m.CvPtr, (int)CmpTypes.LE);
+            GC.KeepAlive(this);
+            GC.KeepAlive(m);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator &lt;=
+        /// </summary>
+        /// <param name="d"></param>
+        /// <returns></returns>
+        public MatExpr LessThanOrEqual(double d)
+        {
+            ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareDouble(ptr, d, (int)CmpTypes.LE);
+            GC.KeepAlive(this);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator ==
+        /// </summary>
+        /// <param name="m"></param>
+        /// <returns></returns>
+        public MatExpr Equals(Mat m)
+        {
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            ThrowIfDisposed();
+            m.ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareMat(ptr, m.CvPtr, (int)CmpTypes.EQ);
+            GC.KeepAlive(this);
+            GC.KeepAlive(m);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator ==
+        /// </summary>
+        /// <param name="d"></param>
+        /// <returns></returns>
+        public MatExpr Equals(double d)
+        {
+            ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareDouble(ptr, d, (int)CmpTypes.EQ);
+            GC.KeepAlive(this);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator !=
+        /// </summary>
+        /// <param name="m"></param>
+        /// <returns></returns>
+        public MatExpr NotEquals(Mat m)
+        {
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            ThrowIfDisposed();
+            m.ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareMat(ptr, m.CvPtr, (int)CmpTypes.NE);
+            GC.KeepAlive(this);
+            GC.KeepAlive(m);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator !=
+        /// </summary>
+        /// <param name="d"></param>
+        /// <returns></returns>
+        public MatExpr NotEquals(double d)
+        {
+            ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareDouble(ptr, d, (int)CmpTypes.NE);
+            GC.KeepAlive(this);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator &gt;
+        /// </summary>
+        /// <param name="m"></param>
+        /// <returns></returns>
+        public MatExpr GreaterThan(Mat m)
+        {
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            ThrowIfDisposed();
+            m.ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareMat(ptr, m.CvPtr, (int)CmpTypes.GT);
+            GC.KeepAlive(this);
+            GC.KeepAlive(m);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator &gt;
+        /// </summary>
+        /// <param name="d"></param>
+        /// <returns></returns>
+        public MatExpr GreaterThan(double d)
+        {
+            ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareDouble(ptr, d, (int)CmpTypes.GT);
+            GC.KeepAlive(this);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator &gt;=
+        /// </summary>
+        /// <param name="m"></param>
+        /// <returns></returns>
+        public MatExpr GreaterThanOrEqual(Mat m)
+        {
+            if (m == null)
+                throw new ArgumentNullException(nameof(m));
+            ThrowIfDisposed();
+            m.ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareMat(ptr, m.CvPtr, (int)CmpTypes.GE);
+            GC.KeepAlive(this);
+            GC.KeepAlive(m);
+            return new MatExpr(retPtr);
+        }
+        /// <summary>
+        /// operator &gt;=
+        /// </summary>
+        /// <param name="d"></param>
+        /// <returns></returns>
+        public MatExpr GreaterThanOrEqual(double d)
+        {
+            ThrowIfDisposed();
+            IntPtr retPtr = NativeMethods.core_MatExpr_compareDouble(ptr, d, (int)CmpTypes.GE);
+            GC.KeepAlive(this);
+            return new MatExpr(retPtr);
+        }
+        #endregion
         #endregion
 
         #region Methods
@@ -0,0 +1,58 @@
+﻿using System;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Counts of the native objects (Mat, std::vector, cv::Ptr, FileStorage, VideoCapture, Net) which are
+    /// currently owned by managed wrappers. Useful to find leaked or undisposed objects.
+    /// </summary>
+    public static class NativeHandleStatistics
+    {
+        /// <summary>
+        /// Returns the counters of every kind, indexed by NativeHandleKind
+        /// </summary>
+        /// <returns></returns>
+        public static NativeHandleStats[] GetSnapshot()
+        {
+            var stats = new NativeHandleStats[NativeMethods.core_HandleStats_getKindCount()];
+            var count = NativeMethods.core_HandleStats_getSnapshot(stats, stats.Length);
+            if (count != stats.Length)
+                throw new OpenCvSharpException("Failed to get the native handle statistics");
+            return stats;
+        }
+
+        /// <summary>
+        /// Returns the counters of one kind
+        /// </summary>
+        /// <param name="kind"></param>
+        /// <returns></returns>
+        public static NativeHandleStats Get(NativeHandleKind kind)
+        {
+            var stats = GetSnapshot();
+            var index = (int)kind;
+            if (index < 0 || index >= stats.Length)
+                throw new ArgumentOutOfRangeException(nameof(kind));
+            return stats[index];
+        }
+
+        /// <summary>
+        /// Enables or disables the measurement of the bytes of the Mat buffers (disabled by default).
+        /// While enabled, the default Mat allocator is wrapped by one which counts the buffers it allocates and frees,
+        /// so the buffers of Mats filled later (e.g. the output of a Cv2 function) are included.
+        /// Buffers allocated while it was disabled are not included.
+        /// </summary>
+        /// <param name="enabled"></param>
+        public static void SetTrackBytes(bool enabled)
+        {
+            NativeMethods.core_HandleStats_setTrackBytes(enabled ? 1 : 0);
+        }
+
+        /// <summary>
+        /// Sets the high-water mark of every kind to its current live count
+        /// </summary>
+        public static void ResetHighWater()
+        {
+            NativeMethods.core_HandleStats_resetHighWater();
+        }
+    }
+}
@@ -0,0 +1,183 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using System.Text;
+using System.Threading;
+
+namespace OpenCvSharp
+{
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal delegate void NativeJobCallback(int status, IntPtr userData);
+
+    /// <summary>
+    /// A long-running native operation (e.g. Cv2.FastNlMeansDenoisingJob, Stitcher.StitchJob) executed by
+    /// the worker threads of NativeJobQueue, so that the calling thread is not blocked in native code.
+    /// </summary>
+    /// <remarks>
+    /// The inputs are captured when the job is created; the outputs are kept in the job and read with
+    /// GetResult after completion. Disposing a submitted job does not cancel it.
+    /// </remarks>
+    public sealed class NativeJob : DisposableCvObject
+    {
+        // one delegate for every job; the job is found through the GCHandle passed as user data
+        private static readonly NativeJobCallback completedCallback = OnCompleted;
+        private static readonly IntPtr completedCallbackPtr = Marshal.GetFunctionPointerForDelegate(completedCallback);
+
+        private Action<NativeJob> completed;
+
+        internal NativeJob(IntPtr ptr)
+        {
+            if (ptr == IntPtr.Zero)
+                throw new OpenCvSharpException("Failed to create the native job");
+            this.ptr = ptr;
+        }
+
+        /// <summary>
+        /// Releases unmanaged resources
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.core_Ptr_NativeJob_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        /// <summary>
+        /// Adds the job to the native job queue
+        /// </summary>
+        /// <param name="priority">Jobs with a higher priority are started first; equal priorities in submission order</param>
+        /// <param name="completed">Called once on a thread pool thread when the job has completed, failed or been cancelled</param>
+        /// <returns>this job</returns>
+        public NativeJob Submit(int priority = 0, Action<NativeJob> completed = null)
+        {
+            ThrowIfDisposed();
+            this.completed = completed;
+            // keeps the job reachable until the native side reports its completion
+            var handle = GCHandle.Alloc(this);
+            if (NativeMethods.core_NativeJob_submit(ptr, priority, completedCallbackPtr, GCHandle.ToIntPtr(handle)) == 0)
+            {
+                handle.Free();
+                throw new OpenCvSharpException("The job was already submitted or the native job queue is full");
+            }
+            return this;
+        }
+
+        /// <summary>
+        /// Requests cancellation. A queued job is cancelled immediately; a running job stops at its next
+        /// cancellation point if it has one, and otherwise completes. A job which has not been submitted yet
+        /// (or has finished) is not affected.
+        /// </summary>
+        public void Cancel()
+        {
+            ThrowIfDisposed();
+            NativeMethods.core_NativeJob_cancel(ptr);
+            GC.KeepAlive(this);
+        }
+
+        /// <summary>
+        /// Blocks until the job has finished (completed, failed or cancelled)
+        /// </summary>
+        /// <param name="millisecondsTimeout">Timeout, or Timeout.Infinite</param>
+        /// <returns>false if the timeout elapsed first</returns>
+        public bool Wait(int millisecondsTimeout = Timeout.Infinite)
+        {
+            ThrowIfDisposed();
+            if (Status == NativeJobStatus.Created)
+                throw new OpenCvSharpException("The job has not been submitted");
+            var res = NativeMethods.core_NativeJob_wait(ptr, millisecondsTimeout);
+            GC.KeepAlive(this);
+            return res != 0;
+        }
+
+        /// <summary>
+        /// Current state of the job
+        /// </summary>
+        public NativeJobStatus Status
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var res = (NativeJobStatus)NativeMethods.core_NativeJob_status(ptr);
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        /// <summary>
+        /// Message of the exception which made the job fail
+        /// </summary>
+        public string ErrorMessage
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var buf = new StringBuilder(1024);
+                NativeMethods.core_NativeJob_error(ptr, buf, buf.Capacity);
+                GC.KeepAlive(this);
+                return buf.ToString();
+            }
+        }
+
+        /// <summary>
+        /// Status code returned by the operation, if it has one (e.g. Stitcher.Status for Stitcher.StitchJob)
+        /// </summary>
+        public int ResultCode
+        {
+            get
+            {
+                ThrowIfNotCompleted();
+                var res = NativeMethods.core_NativeJob_resultCode(ptr);
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        /// <summary>
+        /// Number of output arrays
+        /// </summary>
+        public int ResultCount
+        {
+            get
+            {
+                ThrowIfNotCompleted();
+                var res = NativeMethods.core_NativeJob_resultCount(ptr);
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        /// <summary>
+        /// Returns an output array of the completed job (sharing its data with the job)
+        /// </summary>
+        /// <param name="index"></param>
+        /// <returns></returns>
+        public Mat GetResult(int index = 0)
+        {
+            ThrowIfNotCompleted();
+            if (index < 0 || index >= ResultCount)
+                throw new ArgumentOutOfRangeException(nameof(index));
+            var res = NativeMethods.core_NativeJob_result(ptr, index);
+            GC.KeepAlive(this);
+            return new Mat(res);
+        }
+
+        private void ThrowIfNotCompleted()
+        {
+            var status = Status;
+            if (status == NativeJobStatus.Failed)
+                throw new OpenCvSharpException("The job failed: " + ErrorMessage);
+            if (status != NativeJobStatus.Completed)
+                throw new OpenCvSharpException("The job has not completed (status: " + status + ")");
+        }
+
+        private static void OnCompleted(int status, IntPtr userData)
+        {
+            var handle = GCHandle.FromIntPtr(userData);
+            var job = (NativeJob)handle.Target;
+            handle.Free();
+            var callback = job.completed;
+            job.completed = null;
+            // user code does not run on (nor block) the native worker thread
+            if (callback != null)
+                ThreadPool.QueueUserWorkItem(state => callback(job));
+        }
+    }
+}
@@ -0,0 +1,39 @@
+﻿namespace OpenCvSharp
+{
+    /// <summary>
+    /// The bounded priority queue and worker threads which execute NativeJobs.
+    /// By default up to 256 jobs may wait, executed by half of the CPUs (at least 1, at most 4).
+    /// </summary>
+    public static class NativeJobQueue
+    {
+        /// <summary>
+        /// Changes the number of worker threads and the maximum number of waiting jobs
+        /// </summary>
+        /// <param name="workers">Number of worker threads (0: unchanged)</param>
+        /// <param name="capacity">Maximum number of queued jobs; NativeJob.Submit fails when it is reached (0: unchanged)</param>
+        public static void Configure(int workers, int capacity)
+        {
+            if (workers < 0)
+                throw new System.ArgumentOutOfRangeException(nameof(workers));
+            if (capacity < 0)
+                throw new System.ArgumentOutOfRangeException(nameof(capacity));
+            NativeMethods.core_NativeJobQueue_configure(workers, capacity);
+        }
+
+        /// <summary>
+        /// Number of jobs waiting for a worker
+        /// </summary>
+        public static int QueuedCount
+        {
+            get { return NativeMethods.core_NativeJobQueue_queued(); }
+        }
+
+        /// <summary>
+        /// Number of jobs being executed
+        /// </summary>
+        public static int RunningCount
+        {
+            get { return NativeMethods.core_NativeJobQueue_running(); }
+        }
+    }
+}
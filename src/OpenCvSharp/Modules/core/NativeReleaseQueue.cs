@@ -0,0 +1,53 @@
+﻿namespace OpenCvSharp
+{
+    /// <summary>
+    /// Background thread which frees the buffers of released Mats (and byte / Mat vectors released
+    /// through the deleteMany entry points), so that the thread dropping the last reference - often
+    /// the GC finalizer thread - does not pay for freeing large buffers.
+    /// </summary>
+    /// <remarks>
+    /// Disabled by default. Only objects holding the last reference to a buffer of at least
+    /// ThresholdBytes are deferred; everything else is released immediately.
+    /// A deferred release completes on the background thread: the release callback of a Mat created by
+    /// Mat.FromPinnedArray / Mat.FromExternalData runs there, and a buffer of the pooled allocator is returned
+    /// to the free lists of that thread.
+    /// </remarks>
+    public static class NativeReleaseQueue
+    {
+        /// <summary>
+        /// Gets or sets whether large buffers are released on the background thread
+        /// </summary>
+        public static bool Enabled
+        {
+            get { return GetStats().Enabled; }
+            set { NativeMethods.core_NativeReleaseQueue_setEnabled(value ? 1 : 0); }
+        }
+
+        /// <summary>
+        /// Gets or sets the minimum buffer size of the objects released on the background thread (default: 1 MiB)
+        /// </summary>
+        public static long ThresholdBytes
+        {
+            get { return (long)GetStats().ThresholdBytes; }
+            set { NativeMethods.core_NativeReleaseQueue_setThresholdBytes((ulong)value); }
+        }
+
+        /// <summary>
+        /// Returns the queue counters
+        /// </summary>
+        /// <returns></returns>
+        public static NativeReleaseQueueStats GetStats()
+        {
+            NativeMethods.core_NativeReleaseQueue_getStats(out var stats);
+            return stats;
+        }
+
+        /// <summary>
+        /// Waits until every deferred object has been released
+        /// </summary>
+        public static void Flush()
+        {
+            NativeMethods.core_NativeReleaseQueue_flush();
+        }
+    }
+}
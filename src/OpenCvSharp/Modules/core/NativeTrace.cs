@@ -0,0 +1,106 @@
+﻿using System;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Timeline of native calls, written as Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev).
+    /// </summary>
+    /// <remarks>
+    /// The trace contains the regions opened with BeginRegion / Region and the worker tasks of the
+    /// parallel loops run by OpenCvSharpExtern itself (MatKernel, MatRegion, TiledFilter).
+    /// When OpenCvSharpExtern was built with OPENCVSHARP_PROFILE_EXPORTS (see ExportProfiler),
+    /// every call of a native export is recorded as well.
+    /// </remarks>
+    public static class NativeTrace
+    {
+        /// <summary>
+        /// Default maximum number of recorded events
+        /// </summary>
+        public const int DefaultCapacity = 1 << 20;
+
+        /// <summary>
+        /// Whether events are being recorded
+        /// </summary>
+        public static bool IsActive
+        {
+            get { return NativeMethods.core_Trace_isActive() != 0; }
+        }
+
+        /// <summary>
+        /// Discards the recorded events and starts recording
+        /// </summary>
+        /// <param name="path">File written by Flush</param>
+        /// <param name="capacity">Maximum number of recorded events; later events are dropped</param>
+        public static void Start(string path, int capacity = DefaultCapacity)
+        {
+            if (path == null)
+                throw new ArgumentNullException(nameof(path));
+            if (capacity < 0)
+                throw new ArgumentOutOfRangeException(nameof(capacity));
+            NativeMethods.core_Trace_start(path, capacity);
+        }
+
+        /// <summary>
+        /// Stops recording. The recorded events are kept until the next Start.
+        /// </summary>
+        public static void Stop()
+        {
+            NativeMethods.core_Trace_stop();
+        }
+
+        /// <summary>
+        /// Writes every event recorded since Start to the file given to Start
+        /// </summary>
+        /// <returns>Number of events written</returns>
+        public static int Flush()
+        {
+            var count = NativeMethods.core_Trace_flush();
+            if (count < 0)
+                throw new OpenCvSharpException("Failed to write the trace file");
+            return count;
+        }
+
+        /// <summary>
+        /// Opens a region on the calling thread. Regions nest and must be closed by EndRegion on the same thread.
+        /// </summary>
+        /// <param name="name"></param>
+        public static void BeginRegion(string name)
+        {
+            if (name == null)
+                throw new ArgumentNullException(nameof(name));
+            NativeMethods.core_Trace_beginRegion(name);
+        }
+
+        /// <summary>
+        /// Closes the innermost region opened on the calling thread
+        /// </summary>
+        public static void EndRegion()
+        {
+            NativeMethods.core_Trace_endRegion();
+        }
+
+        /// <summary>
+        /// Opens a region which is closed when the returned object is disposed
+        /// </summary>
+        /// <param name="name"></param>
+        /// <returns></returns>
+        public static IDisposable Region(string name)
+        {
+            BeginRegion(name);
+            return new RegionScope();
+        }
+
+        private sealed class RegionScope : IDisposable
+        {
+            private bool disposed;
+
+            public void Dispose()
+            {
+                if (disposed)
+                    return;
+                disposed = true;
+                EndRegion();
+            }
+        }
+    }
+}
@@ -0,0 +1,91 @@
+﻿using System;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Mat buffer allocator which keeps released buffers in per-thread, size-class free lists
+    /// and reuses them for subsequent Mats of (nearly) the same size.
+    /// </summary>
+    /// <remarks>
+    /// Once installed globally, every Mat allocated by OpenCV (including the results of Cv2 functions)
+    /// uses the pool. Buffers are returned to the free lists of the thread that releases them.
+    /// </remarks>
+    public static class PooledMatAllocator
+    {
+        /// <summary>
+        /// Gets or sets whether the pool is the default allocator of all Mats
+        /// </summary>
+        public static bool IsGlobal
+        {
+            get { return NativeMethods.core_PooledMatAllocator_isGlobal() != 0; }
+            set { NativeMethods.core_PooledMatAllocator_setGlobal(value ? 1 : 0); }
+        }
+
+        /// <summary>
+        /// Makes the next allocation of the specified Mat use the pool (or the default allocator)
+        /// </summary>
+        /// <param name="mat">Mat whose allocator is changed</param>
+        /// <param name="pooled">true to use the pool, false to use the default allocator</param>
+        public static void Attach(Mat mat, bool pooled = true)
+        {
+            if (mat == null)
+                throw new ArgumentNullException(nameof(mat));
+            mat.ThrowIfDisposed();
+            NativeMethods.core_Mat_setPooledAllocator(mat.CvPtr, pooled ? 1 : 0);
+            GC.KeepAlive(mat);
+        }
+
+        /// <summary>
+        /// Returns true if the specified Mat allocates its buffer from the pool
+        /// </summary>
+        /// <param name="mat"></param>
+        /// <returns></returns>
+        public static bool IsAttached(Mat mat)
+        {
+            if (mat == null)
+                throw new ArgumentNullException(nameof(mat));
+            mat.ThrowIfDisposed();
+            var ret = NativeMethods.core_Mat_isPooledAllocator(mat.CvPtr) != 0;
+            GC.KeepAlive(mat);
+            return ret;
+        }
+
+        /// <summary>
+        /// Frees all the buffers held by the free lists
+        /// </summary>
+        public static void Trim()
+        {
+            NativeMethods.core_PooledMatAllocator_trim();
+        }
+
+        /// <summary>
+        /// Frees all the buffers held by the free lists and resets the hit/miss counters
+        /// </summary>
+        public static void Reset()
+        {
+            NativeMethods.core_PooledMatAllocator_reset();
+        }
+
+        /// <summary>
+        /// Sets the upper limit of the bytes retained by the free lists of one thread.
+        /// Buffers released beyond the limit are freed immediately.
+        /// </summary>
+        /// <param name="value"></param>
+        public static void SetMaxBytesPerThread(long value)
+        {
+            if (value < 0)
+                throw new ArgumentOutOfRangeException(nameof(value));
+            NativeMethods.core_PooledMatAllocator_setMaxBytesPerThread((ulong)value);
+        }
+
+        /// <summary>
+        /// Gets the counters of the pool
+        /// </summary>
+        /// <returns></returns>
+        public static PooledMatAllocatorStats GetStats()
+        {
+            NativeMethods.core_PooledMatAllocator_getStats(out var stats);
+            return stats;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Call statistics of one native export, recorded by ExportProfiler
+    /// </summary>
+    [Serializable]
+    [StructLayout(LayoutKind.Sequential, CharSet = CharSet.Ansi)]
+    public struct ExportProfileEntry
+    {
+        /// <summary>
+        /// Number of histogram buckets
+        /// </summary>
+        public const int BucketCount = 32;
+
+        /// <summary>
+        /// Number of calls
+        /// </summary>
+        public ulong Calls;
+
+        /// <summary>
+        /// Total time spent in the export [ns]
+        /// </summary>
+        public ulong TotalNanoseconds;
+
+        /// <summary>
+        /// Longest call [ns]
+        /// </summary>
+        public ulong MaxNanoseconds;
+
+        /// <summary>
+        /// Latency histogram. Histogram[0] counts calls shorter than 2 ns, Histogram[i] calls of
+        /// [2^i, 2^(i+1)) ns; the last bucket also counts every longer call.
+        /// </summary>
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = BucketCount)]
+        public ulong[] Histogram;
+
+        /// <summary>
+        /// Name of the exported function (e.g. core_Mat_new1)
+        /// </summary>
+        [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 128)]
+        public string Name;
+
+        /// <summary>
+        /// Mean time per call [ns]
+        /// </summary>
+        public double MeanNanoseconds
+        {
+            get { return Calls == 0 ? 0 : (double)TotalNanoseconds / Calls; }
+        }
+
+        /// <summary>
+        /// Returns the lower bound [ns] of the given histogram bucket
+        /// </summary>
+        /// <param name="bucket"></param>
+        /// <returns></returns>
+        public static ulong BucketLowerBound(int bucket)
+        {
+            if (bucket < 0 || bucket >= BucketCount)
+                throw new ArgumentOutOfRangeException(nameof(bucket));
+            return bucket == 0 ? 0 : 1UL << bucket;
+        }
+
+        /// <inheritdoc />
+        public override string ToString()
+        {
+            return $"{Name}: {Calls} calls, {TotalNanoseconds} ns total, {MaxNanoseconds} ns max";
+        }
+    }
+}
@@ -0,0 +1,50 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Metadata of a frame acquired from a FrameRing
+    /// </summary>
+    [Serializable]
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FrameRingFrameInfo
+    {
+        /// <summary>
+        /// Number of frames the producer wrote before this one
+        /// </summary>
+        public ulong Sequence;
+
+        /// <summary>
+        /// Timestamp passed by the producer to Commit
+        /// </summary>
+        public long Timestamp;
+
+        /// <summary>
+        /// Array type of the frame
+        /// </summary>
+        public int Type;
+
+        /// <summary>
+        /// Number of rows of the frame
+        /// </summary>
+        public int Rows;
+
+        /// <summary>
+        /// Number of columns of the frame
+        /// </summary>
+        public int Cols;
+
+        private int reserved;
+
+        /// <summary>
+        /// Distance in bytes between the rows of the frame
+        /// </summary>
+        public ulong Step;
+
+        /// <summary>
+        /// Number of frames this consumer missed since its previous frame (FrameRingPolicy.DropOldest only)
+        /// </summary>
+        public ulong Dropped;
+    }
+}
@@ -0,0 +1,47 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Live instance counters of one kind of native object, see NativeHandleStatistics
+    /// </summary>
+    [Serializable]
+    [StructLayout(LayoutKind.Sequential)]
+    public struct NativeHandleStats
+    {
+        /// <summary>
+        /// Objects created and not yet released
+        /// </summary>
+        public long Live;
+
+        /// <summary>
+        /// Maximum of Live since the process started or the last ResetHighWater
+        /// </summary>
+        public long HighWater;
+
+        /// <summary>
+        /// Objects created
+        /// </summary>
+        public ulong Created;
+
+        /// <summary>
+        /// Objects released
+        /// </summary>
+        public ulong Deleted;
+
+        /// <summary>
+        /// Mat only, while byte tracking is enabled [bytes]: the Mat buffers allocated by the default allocator
+        /// since tracking was enabled and not freed yet, whether they belong to a wrapper or to a native temporary.
+        /// 0 for the other kinds.
+        /// </summary>
+        public ulong Bytes;
+
+        /// <summary>
+        /// Whether Bytes was measured (byte tracking was enabled)
+        /// </summary>
+        public int BytesTracked;
+
+        private int reserved;
+    }
+}
@@ -0,0 +1,49 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Counters of the native release queue
+    /// </summary>
+    [Serializable]
+    [StructLayout(LayoutKind.Sequential)]
+    public struct NativeReleaseQueueStats
+    {
+        /// <summary>
+        /// Number of objects waiting for or being released by the background thread
+        /// </summary>
+        public ulong Depth;
+
+        /// <summary>
+        /// Buffer bytes held by these objects
+        /// </summary>
+        public ulong BytesPending;
+
+        /// <summary>
+        /// Number of objects handed to the background thread so far
+        /// </summary>
+        public ulong Deferred;
+
+        /// <summary>
+        /// Number of objects released by the background thread so far
+        /// </summary>
+        public ulong Released;
+
+        /// <summary>
+        /// Minimum buffer size of the objects released in the background
+        /// </summary>
+        public ulong ThresholdBytes;
+
+        private int enabled;
+        private int reserved;
+
+        /// <summary>
+        /// Whether the queue is enabled
+        /// </summary>
+        public bool Enabled
+        {
+            get { return enabled != 0; }
+        }
+    }
+}
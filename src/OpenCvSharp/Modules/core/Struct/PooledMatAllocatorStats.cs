@@ -0,0 +1,43 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Counters of the pooled Mat buffer allocator
+    /// </summary>
+    [Serializable]
+    [StructLayout(LayoutKind.Sequential)]
+    public struct PooledMatAllocatorStats
+    {
+        /// <summary>
+        /// Number of allocations served from a free list
+        /// </summary>
+        public ulong Hits;
+
+        /// <summary>
+        /// Number of allocations that had to allocate new memory
+        /// </summary>
+        public ulong Misses;
+
+        /// <summary>
+        /// Bytes held by the free lists of all threads
+        /// </summary>
+        public ulong BytesRetained;
+
+        /// <summary>
+        /// Number of buffers held by the free lists of all threads
+        /// </summary>
+        public ulong BlocksRetained;
+
+        /// <summary>
+        /// Bytes of pool-allocated buffers currently owned by Mats
+        /// </summary>
+        public ulong BytesInUse;
+
+        /// <summary>
+        /// Upper limit of the bytes retained by the free lists of one thread
+        /// </summary>
+        public ulong MaxBytesPerThread;
+    }
+}
@@ -1,4 +1,4 @@
-using System;
+﻿using System;
 using System.Collections.Generic;
 using System.Runtime.InteropServices;
 using OpenCvSharp.Util;
@@ -319,6 +319,22 @@ namespace OpenCvSharp.Dnn
             GC.KeepAlive(this);
         }
 
+        /// <summary>
+        /// Creates a job which runs the forward pass (with the inputs set by SetInput) on a worker thread of NativeJobQueue.
+        /// Submit it with NativeJob.Submit; NativeJob.GetResult(i) is the output of the i-th layer of outBlobNames.
+        /// The job shares this network: do not use it until the job has finished.
+        /// </summary>
+        /// <param name="outBlobNames">names of the layers whose outputs are needed; null for the output of the last layer</param>
+        /// <returns></returns>
+        public NativeJob ForwardJob(IEnumerable<string> outBlobNames = null)
+        {
+            ThrowIfDisposed();
+            var outBlobNamesArray = (outBlobNames == null) ? new string[0] : EnumerableEx.ToArray(outBlobNames);
+            var job = NativeMethods.dnn_Net_forward_job(ptr, outBlobNamesArray, outBlobNamesArray.Length);
+            GC.KeepAlive(this);
+            return new NativeJob(job);
+        }
+
         /// <summary>
         /// Compile Halide layers.
         /// Schedule layers that support Halide backend. Then compile them for 
@@ -212,6 +212,68 @@ namespace OpenCvSharp
 
         #region *Match
 
+        /// <summary>
+        /// KnnMatch returning the matches of all query descriptors in one array (see FlatJaggedArray).
+        /// Row i holds the matches of query descriptor i.
+        /// </summary>
+        /// <param name="queryDescriptors"></param>
+        /// <param name="trainDescriptors"></param>
+        /// <param name="k"></param>
+        /// <param name="mask"></param>
+        /// <param name="compactResult"></param>
+        /// <returns></returns>
+        public FlatJaggedArray<DMatch> KnnMatchFlat(Mat queryDescriptors, Mat trainDescriptors,
+            int k, Mat mask = null, bool compactResult = false)
+        {
+            ThrowIfDisposed();
+            if (queryDescriptors == null)
+                throw new ArgumentNullException(nameof(queryDescriptors));
+            if (trainDescriptors == null)
+                throw new ArgumentNullException(nameof(trainDescriptors));
+            using (var matchesVec = new VectorOfVectorDMatch())
+            {
+                NativeMethods.features2d_DescriptorMatcher_knnMatch1(
+                    ptr, queryDescriptors.CvPtr, trainDescriptors.CvPtr,
+                    matchesVec.CvPtr, k, Cv2.ToPtr(mask), compactResult ? 1 : 0);
+                GC.KeepAlive(this);
+                GC.KeepAlive(queryDescriptors);
+                GC.KeepAlive(trainDescriptors);
+                GC.KeepAlive(mask);
+                return matchesVec.ToFlatArray();
+            }
+        }
+
+        /// <summary>
+        /// RadiusMatch returning the matches of all query descriptors in one array (see FlatJaggedArray).
+        /// Row i holds the matches of query descriptor i.
+        /// </summary>
+        /// <param name="queryDescriptors"></param>
+        /// <param name="trainDescriptors"></param>
+        /// <param name="maxDistance"></param>
+        /// <param name="mask"></param>
+        /// <param name="compactResult"></param>
+        /// <returns></returns>
+        public FlatJaggedArray<DMatch> RadiusMatchFlat(Mat queryDescriptors, Mat trainDescriptors,
+            float maxDistance, Mat mask = null, bool compactResult = false)
+        {
+            ThrowIfDisposed();
+            if (queryDescriptors == null)
+                throw new ArgumentNullException(nameof(queryDescriptors));
+            if (trainDescriptors == null)
+                throw new ArgumentNullException(nameof(trainDescriptors));
+            using (var matchesVec = new VectorOfVectorDMatch())
+            {
+                NativeMethods.features2d_DescriptorMatcher_radiusMatch1(
+                    ptr, queryDescriptors.CvPtr, trainDescriptors.CvPtr,
+                    matchesVec.CvPtr, maxDistance, Cv2.ToPtr(mask), compactResult ? 1 : 0);
+                GC.KeepAlive(this);
+                GC.KeepAlive(queryDescriptors);
+                GC.KeepAlive(trainDescriptors);
+                GC.KeepAlive(mask);
+                return matchesVec.ToFlatArray();
+            }
+        }
+
         /// <summary>
         /// Find one best match for each query descriptor (if mask is empty).
         /// </summary>
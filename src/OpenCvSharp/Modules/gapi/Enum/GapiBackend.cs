@@ -0,0 +1,19 @@
+﻿namespace OpenCvSharp
+{
+    /// <summary>
+    /// Kernels a G-API graph is compiled with
+    /// </summary>
+    public enum GapiBackend
+    {
+        /// <summary>
+        /// OpenCV (CPU) kernels, executed one operation at a time
+        /// </summary>
+        Cpu = 0,
+
+        /// <summary>
+        /// Fluid kernels where available, which run the operations line by line on small reused buffers;
+        /// CPU kernels for the other operations
+        /// </summary>
+        Fluid = 1,
+    }
+}
@@ -0,0 +1,107 @@
+﻿using System;
+using OpenCvSharp.Util;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// A GapiGraph compiled for fixed input metadata (cv::GCompiled), applied to every new frame in one call
+    /// </summary>
+    public sealed class GapiCompiled : DisposableCvObject
+    {
+        internal GapiCompiled(IntPtr ptr)
+        {
+            if (ptr == IntPtr.Zero)
+                throw new OpenCvSharpException("Failed to compile the G-API graph");
+            this.ptr = ptr;
+        }
+
+        /// <summary>
+        /// Releases unmanaged resources
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.gapi_Compiled_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        /// <summary>
+        /// Number of inputs Apply expects
+        /// </summary>
+        public int InputCount
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var res = NativeMethods.gapi_Compiled_inputCount(ptr);
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        /// <summary>
+        /// Number of outputs Apply writes
+        /// </summary>
+        public int OutputCount
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var res = NativeMethods.gapi_Compiled_outputCount(ptr);
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        /// <summary>
+        /// Returns the size and type of an output, as inferred at compilation
+        /// </summary>
+        /// <param name="index"></param>
+        /// <param name="size"></param>
+        /// <param name="type"></param>
+        public void GetOutputDesc(int index, out Size size, out MatType type)
+        {
+            ThrowIfDisposed();
+            int t;
+            NativeMethods.gapi_Compiled_outputDesc(ptr, index, out size, out t);
+            GC.KeepAlive(this);
+            type = t;
+        }
+
+        /// <summary>
+        /// Runs the graph. The inputs must match the metadata the graph was compiled for. The outputs are
+        /// allocated only when their size or type differs from the compiled output metadata, so reusing the
+        /// same output Mats for every frame avoids per-frame allocations.
+        /// </summary>
+        /// <param name="inputs">one image per graph input, in the order of GapiGraph.Input calls</param>
+        /// <param name="outputs">one image per graph output, in the order of GapiGraph.Output calls</param>
+        public void Apply(Mat[] inputs, Mat[] outputs)
+        {
+            ThrowIfDisposed();
+            if (inputs == null)
+                throw new ArgumentNullException(nameof(inputs));
+            if (outputs == null)
+                throw new ArgumentNullException(nameof(outputs));
+
+            var inputsPtrs = EnumerableEx.SelectPtrs(inputs);
+            var outputsPtrs = EnumerableEx.SelectPtrs(outputs);
+            NativeMethods.gapi_Compiled_apply(ptr, inputsPtrs, inputsPtrs.Length, outputsPtrs, outputsPtrs.Length);
+            GC.KeepAlive(this);
+            GC.KeepAlive(inputs);
+            GC.KeepAlive(outputs);
+        }
+
+        /// <summary>
+        /// Runs a graph with one input and one output
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="dst"></param>
+        public void Apply(Mat src, Mat dst)
+        {
+            if (src == null)
+                throw new ArgumentNullException(nameof(src));
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            Apply(new[] {src}, new[] {dst});
+        }
+    }
+}
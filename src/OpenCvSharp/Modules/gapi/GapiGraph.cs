@@ -0,0 +1,598 @@
+﻿using System;
+using OpenCvSharp.Util;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Builds a G-API graph (cv::GComputation) from imgproc and core operations. The graph is compiled once
+    /// for fixed input metadata and then applied to every new frame in a single call, with the intermediate
+    /// images kept inside the compiled graph.
+    /// </summary>
+    /// <example>
+    /// using (var graph = new GapiGraph())
+    /// {
+    ///     var gray = graph.CvtColor(graph.Input(), ColorConversionCodes.BGR2GRAY);
+    ///     graph.Output(graph.GaussianBlur(gray, new Size(5, 5), 1.5));
+    ///     using (var compiled = graph.Compile(GapiBackend.Cpu, frame))
+    ///         compiled.Apply(frame, dst);
+    /// }
+    /// </example>
+    public sealed class GapiGraph : DisposableCvObject
+    {
+        // must match GapiArithmOp in gapi.h
+        private enum ArithmOp
+        {
+            Add = 0,
+            Subtract = 1,
+            Multiply = 2,
+            Divide = 3,
+            AbsDiff = 4,
+            Min = 5,
+            Max = 6,
+            BitwiseAnd = 7,
+            BitwiseOr = 8,
+            BitwiseXor = 9,
+        }
+
+        #region Init and Disposal
+
+        /// <summary>
+        /// Creates an empty graph
+        /// </summary>
+        public GapiGraph()
+        {
+            ptr = NativeMethods.gapi_Graph_new();
+            if (ptr == IntPtr.Zero)
+                throw new OpenCvSharpException();
+        }
+
+        /// <summary>
+        /// Releases unmanaged resources
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.gapi_Graph_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        #endregion
+
+        #region Inputs and outputs
+
+        /// <summary>
+        /// Adds an input image. The inputs are passed to GapiCompiled.Apply in the order they were added.
+        /// </summary>
+        /// <returns></returns>
+        public GapiNode Input()
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_input(ptr);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Marks a node as an output. The outputs are written by GapiCompiled.Apply in the order they were marked.
+        /// </summary>
+        /// <param name="node"></param>
+        public void Output(GapiNode node)
+        {
+            ThrowIfDisposed();
+            NativeMethods.gapi_Graph_output(ptr, node.Index);
+            GC.KeepAlive(this);
+        }
+
+        #endregion
+
+        #region imgproc
+
+        /// <summary>
+        /// Converts an image from one color space to another.
+        /// Supported: RGB2GRAY, BGR2GRAY, RGB2YUV, YUV2RGB, BGR2YUV, YUV2BGR, RGB2Lab, BGR2Luv and Luv2BGR.
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="code"></param>
+        /// <returns></returns>
+        public GapiNode CvtColor(GapiNode src, ColorConversionCodes code)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_cvtColor(ptr, src.Index, (int)code);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Resizes an image
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="dsize">output image size; if it equals zero, it is computed from fx and fy</param>
+        /// <param name="fx"></param>
+        /// <param name="fy"></param>
+        /// <param name="interpolation"></param>
+        /// <returns></returns>
+        public GapiNode Resize(GapiNode src, Size dsize, double fx = 0, double fy = 0,
+            InterpolationFlags interpolation = InterpolationFlags.Linear)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_resize(ptr, src.Index, dsize, fx, fy, (int)interpolation);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Smoothes an image using the normalized box filter
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="ksize"></param>
+        /// <param name="anchor"></param>
+        /// <param name="borderType"></param>
+        /// <returns></returns>
+        public GapiNode Blur(GapiNode src, Size ksize, Point? anchor = null,
+            BorderTypes borderType = BorderTypes.Default)
+        {
+            ThrowIfDisposed();
+            var anchor0 = anchor.GetValueOrDefault(new Point(-1, -1));
+            var ret = NativeMethods.gapi_Graph_blur(ptr, src.Index, ksize, anchor0, (int)borderType);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Blurs an image using a Gaussian filter
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="ksize"></param>
+        /// <param name="sigmaX"></param>
+        /// <param name="sigmaY"></param>
+        /// <param name="borderType"></param>
+        /// <returns></returns>
+        public GapiNode GaussianBlur(GapiNode src, Size ksize, double sigmaX, double sigmaY = 0,
+            BorderTypes borderType = BorderTypes.Default)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_gaussianBlur(ptr, src.Index, ksize, sigmaX, sigmaY, (int)borderType);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Blurs an image using the median filter
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="ksize"></param>
+        /// <returns></returns>
+        public GapiNode MedianBlur(GapiNode src, int ksize)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_medianBlur(ptr, src.Index, ksize);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Convolves an image with the kernel
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="ddepth"></param>
+        /// <param name="kernel">the kernel is copied into the graph</param>
+        /// <param name="anchor"></param>
+        /// <param name="delta"></param>
+        /// <param name="borderType"></param>
+        /// <returns></returns>
+        public GapiNode Filter2D(GapiNode src, MatType ddepth, Mat kernel, Point? anchor = null,
+            double delta = 0, BorderTypes borderType = BorderTypes.Default)
+        {
+            ThrowIfDisposed();
+            if (kernel == null)
+                throw new ArgumentNullException(nameof(kernel));
+            kernel.ThrowIfDisposed();
+            var anchor0 = anchor.GetValueOrDefault(new Point(-1, -1));
+            var ret = NativeMethods.gapi_Graph_filter2D(
+                ptr, src.Index, ddepth, kernel.CvPtr, anchor0, Scalar.All(delta), (int)borderType);
+            GC.KeepAlive(this);
+            GC.KeepAlive(kernel);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Calculates the first, second, third or mixed image derivatives using an extended Sobel operator
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="ddepth"></param>
+        /// <param name="xorder"></param>
+        /// <param name="yorder"></param>
+        /// <param name="ksize"></param>
+        /// <param name="scale"></param>
+        /// <param name="delta"></param>
+        /// <param name="borderType"></param>
+        /// <returns></returns>
+        public GapiNode Sobel(GapiNode src, MatType ddepth, int xorder, int yorder, int ksize = 3,
+            double scale = 1, double delta = 0, BorderTypes borderType = BorderTypes.Default)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_sobel(
+                ptr, src.Index, ddepth, xorder, yorder, ksize, scale, delta, (int)borderType);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Finds edges in an image using the Canny algorithm
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="threshold1"></param>
+        /// <param name="threshold2"></param>
+        /// <param name="apertureSize"></param>
+        /// <param name="L2gradient"></param>
+        /// <returns></returns>
+        public GapiNode Canny(GapiNode src, double threshold1, double threshold2, int apertureSize = 3,
+            bool L2gradient = false)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_canny(
+                ptr, src.Index, threshold1, threshold2, apertureSize, L2gradient ? 1 : 0);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Erodes an image by using a specific structuring element
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="element">the structuring element is copied into the graph</param>
+        /// <param name="anchor"></param>
+        /// <param name="iterations"></param>
+        /// <param name="borderType"></param>
+        /// <returns></returns>
+        public GapiNode Erode(GapiNode src, Mat element, Point? anchor = null, int iterations = 1,
+            BorderTypes borderType = BorderTypes.Constant)
+        {
+            ThrowIfDisposed();
+            if (element == null)
+                throw new ArgumentNullException(nameof(element));
+            element.ThrowIfDisposed();
+            var anchor0 = anchor.GetValueOrDefault(new Point(-1, -1));
+            var ret = NativeMethods.gapi_Graph_erode(ptr, src.Index, element.CvPtr, anchor0, iterations, (int)borderType);
+            GC.KeepAlive(this);
+            GC.KeepAlive(element);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Dilates an image by using a specific structuring element
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="element">the structuring element is copied into the graph</param>
+        /// <param name="anchor"></param>
+        /// <param name="iterations"></param>
+        /// <param name="borderType"></param>
+        /// <returns></returns>
+        public GapiNode Dilate(GapiNode src, Mat element, Point? anchor = null, int iterations = 1,
+            BorderTypes borderType = BorderTypes.Constant)
+        {
+            ThrowIfDisposed();
+            if (element == null)
+                throw new ArgumentNullException(nameof(element));
+            element.ThrowIfDisposed();
+            var anchor0 = anchor.GetValueOrDefault(new Point(-1, -1));
+            var ret = NativeMethods.gapi_Graph_dilate(ptr, src.Index, element.CvPtr, anchor0, iterations, (int)borderType);
+            GC.KeepAlive(this);
+            GC.KeepAlive(element);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Applies a fixed-level threshold to each array element (Otsu and Triangle are not supported)
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="thresh"></param>
+        /// <param name="maxval"></param>
+        /// <param name="type"></param>
+        /// <returns></returns>
+        public GapiNode Threshold(GapiNode src, double thresh, double maxval, ThresholdTypes type)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_threshold(ptr, src.Index, thresh, maxval, (int)type);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        #endregion
+
+        #region core
+
+        /// <summary>
+        /// Calculates the per-element sum of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <param name="ddepth">output depth, or -1 for the depth of the inputs</param>
+        /// <returns></returns>
+        public GapiNode Add(GapiNode src1, GapiNode src2, int ddepth = -1)
+        {
+            return Arithm(ArithmOp.Add, src1, src2, 1, ddepth);
+        }
+
+        /// <summary>
+        /// Calculates the per-element difference of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <param name="ddepth">output depth, or -1 for the depth of the inputs</param>
+        /// <returns></returns>
+        public GapiNode Subtract(GapiNode src1, GapiNode src2, int ddepth = -1)
+        {
+            return Arithm(ArithmOp.Subtract, src1, src2, 1, ddepth);
+        }
+
+        /// <summary>
+        /// Calculates the per-element scaled product of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <param name="scale"></param>
+        /// <param name="ddepth">output depth, or -1 for the depth of the inputs</param>
+        /// <returns></returns>
+        public GapiNode Multiply(GapiNode src1, GapiNode src2, double scale = 1, int ddepth = -1)
+        {
+            return Arithm(ArithmOp.Multiply, src1, src2, scale, ddepth);
+        }
+
+        /// <summary>
+        /// Performs per-element division of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <param name="scale"></param>
+        /// <param name="ddepth">output depth, or -1 for the depth of the inputs</param>
+        /// <returns></returns>
+        public GapiNode Divide(GapiNode src1, GapiNode src2, double scale = 1, int ddepth = -1)
+        {
+            return Arithm(ArithmOp.Divide, src1, src2, scale, ddepth);
+        }
+
+        /// <summary>
+        /// Calculates the per-element absolute difference of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <returns></returns>
+        public GapiNode AbsDiff(GapiNode src1, GapiNode src2)
+        {
+            return Arithm(ArithmOp.AbsDiff, src1, src2, 1, -1);
+        }
+
+        /// <summary>
+        /// Calculates the per-element minimum of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <returns></returns>
+        public GapiNode Min(GapiNode src1, GapiNode src2)
+        {
+            return Arithm(ArithmOp.Min, src1, src2, 1, -1);
+        }
+
+        /// <summary>
+        /// Calculates the per-element maximum of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <returns></returns>
+        public GapiNode Max(GapiNode src1, GapiNode src2)
+        {
+            return Arithm(ArithmOp.Max, src1, src2, 1, -1);
+        }
+
+        /// <summary>
+        /// Computes the per-element bit-wise conjunction of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <returns></returns>
+        public GapiNode BitwiseAnd(GapiNode src1, GapiNode src2)
+        {
+            return Arithm(ArithmOp.BitwiseAnd, src1, src2, 1, -1);
+        }
+
+        /// <summary>
+        /// Computes the per-element bit-wise disjunction of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <returns></returns>
+        public GapiNode BitwiseOr(GapiNode src1, GapiNode src2)
+        {
+            return Arithm(ArithmOp.BitwiseOr, src1, src2, 1, -1);
+        }
+
+        /// <summary>
+        /// Computes the per-element bit-wise "exclusive or" of two images
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <returns></returns>
+        public GapiNode BitwiseXor(GapiNode src1, GapiNode src2)
+        {
+            return Arithm(ArithmOp.BitwiseXor, src1, src2, 1, -1);
+        }
+
+        /// <summary>
+        /// Adds a constant to each element
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="value"></param>
+        /// <param name="ddepth">output depth, or -1 for the depth of the input</param>
+        /// <returns></returns>
+        public GapiNode Add(GapiNode src, Scalar value, int ddepth = -1)
+        {
+            return ArithmC(ArithmOp.Add, src, value, 1, ddepth);
+        }
+
+        /// <summary>
+        /// Subtracts a constant from each element
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="value"></param>
+        /// <param name="ddepth">output depth, or -1 for the depth of the input</param>
+        /// <returns></returns>
+        public GapiNode Subtract(GapiNode src, Scalar value, int ddepth = -1)
+        {
+            return ArithmC(ArithmOp.Subtract, src, value, 1, ddepth);
+        }
+
+        /// <summary>
+        /// Multiplies each element by a constant
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="value"></param>
+        /// <param name="ddepth">output depth, or -1 for the depth of the input</param>
+        /// <returns></returns>
+        public GapiNode Multiply(GapiNode src, Scalar value, int ddepth = -1)
+        {
+            return ArithmC(ArithmOp.Multiply, src, value, 1, ddepth);
+        }
+
+        /// <summary>
+        /// Divides each element by a constant
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="value"></param>
+        /// <param name="scale"></param>
+        /// <param name="ddepth">output depth, or -1 for the depth of the input</param>
+        /// <returns></returns>
+        public GapiNode Divide(GapiNode src, Scalar value, double scale = 1, int ddepth = -1)
+        {
+            return ArithmC(ArithmOp.Divide, src, value, scale, ddepth);
+        }
+
+        /// <summary>
+        /// Calculates the per-element absolute difference between an image and a constant
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="value"></param>
+        /// <returns></returns>
+        public GapiNode AbsDiff(GapiNode src, Scalar value)
+        {
+            return ArithmC(ArithmOp.AbsDiff, src, value, 1, -1);
+        }
+
+        /// <summary>
+        /// Calculates the weighted sum of two images: src1*alpha + src2*beta + gamma
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="alpha"></param>
+        /// <param name="src2"></param>
+        /// <param name="beta"></param>
+        /// <param name="gamma"></param>
+        /// <param name="ddepth">output depth, or -1 for the depth of the inputs</param>
+        /// <returns></returns>
+        public GapiNode AddWeighted(GapiNode src1, double alpha, GapiNode src2, double beta, double gamma, int ddepth = -1)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_addWeighted(ptr, src1.Index, alpha, src2.Index, beta, gamma, ddepth);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Inverts every bit of an image
+        /// </summary>
+        /// <param name="src"></param>
+        /// <returns></returns>
+        public GapiNode BitwiseNot(GapiNode src)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_bitwiseNot(ptr, src.Index);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Converts an image to another depth with optional scaling: src*alpha + beta
+        /// </summary>
+        /// <param name="src"></param>
+        /// <param name="rdepth"></param>
+        /// <param name="alpha"></param>
+        /// <param name="beta"></param>
+        /// <returns></returns>
+        public GapiNode ConvertTo(GapiNode src, MatType rdepth, double alpha = 1, double beta = 0)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_convertTo(ptr, src.Index, rdepth, alpha, beta);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        /// <summary>
+        /// Splits a 3-channel image into its planes
+        /// </summary>
+        /// <param name="src"></param>
+        /// <returns></returns>
+        public GapiNode[] Split3(GapiNode src)
+        {
+            ThrowIfDisposed();
+            var planes = new int[3];
+            NativeMethods.gapi_Graph_split3(ptr, src.Index, planes);
+            GC.KeepAlive(this);
+            return new[] {new GapiNode(planes[0]), new GapiNode(planes[1]), new GapiNode(planes[2])};
+        }
+
+        /// <summary>
+        /// Merges three single-channel images into a 3-channel image
+        /// </summary>
+        /// <param name="src1"></param>
+        /// <param name="src2"></param>
+        /// <param name="src3"></param>
+        /// <returns></returns>
+        public GapiNode Merge3(GapiNode src1, GapiNode src2, GapiNode src3)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_merge3(ptr, src1.Index, src2.Index, src3.Index);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        private GapiNode Arithm(ArithmOp op, GapiNode src1, GapiNode src2, double scale, int ddepth)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_arithm(ptr, (int)op, src1.Index, src2.Index, scale, ddepth);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        private GapiNode ArithmC(ArithmOp op, GapiNode src, Scalar value, double scale, int ddepth)
+        {
+            ThrowIfDisposed();
+            var ret = NativeMethods.gapi_Graph_arithmC(ptr, (int)op, src.Index, value, scale, ddepth);
+            GC.KeepAlive(this);
+            return new GapiNode(ret);
+        }
+
+        #endregion
+
+        #region Compilation
+
+        /// <summary>
+        /// Compiles the graph for inputs with the size, depth and channels of the samples (one per input,
+        /// in the order of Input calls). The graph can be modified or disposed afterwards.
+        /// </summary>
+        /// <param name="backend"></param>
+        /// <param name="samples"></param>
+        /// <returns></returns>
+        public GapiCompiled Compile(GapiBackend backend, params Mat[] samples)
+        {
+            ThrowIfDisposed();
+            if (samples == null)
+                throw new ArgumentNullException(nameof(samples));
+
+            var samplesPtrs = EnumerableEx.SelectPtrs(samples);
+            var ret = NativeMethods.gapi_Graph_compile(ptr, samplesPtrs, samplesPtrs.Length, (int)backend);
+            GC.KeepAlive(this);
+            GC.KeepAlive(samples);
+            return new GapiCompiled(ret);
+        }
+
+        #endregion
+    }
+}
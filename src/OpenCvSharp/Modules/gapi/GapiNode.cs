@@ -0,0 +1,19 @@
+﻿namespace OpenCvSharp
+{
+    /// <summary>
+    /// An image (cv::GMat) in a GapiGraph: a graph input or the result of an operation.
+    /// Only meaningful for the graph which created it.
+    /// </summary>
+    public struct GapiNode
+    {
+        internal GapiNode(int index)
+        {
+            Index = index;
+        }
+
+        /// <summary>
+        /// Index of the node in its graph
+        /// </summary>
+        public int Index { get; }
+    }
+}
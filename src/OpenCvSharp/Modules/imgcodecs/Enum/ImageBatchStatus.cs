@@ -0,0 +1,28 @@
+﻿namespace OpenCvSharp
+{
+    /// <summary>
+    /// Outcome of one image of a batch decode or encode
+    /// </summary>
+    public enum ImageBatchStatus
+    {
+        /// <summary>
+        /// The image was processed
+        /// </summary>
+        Ok = 0,
+
+        /// <summary>
+        /// The codec did not produce a result (unknown format or corrupt data)
+        /// </summary>
+        Failed = 1,
+
+        /// <summary>
+        /// OpenCV raised an error while processing the image
+        /// </summary>
+        Error = 2,
+
+        /// <summary>
+        /// The result did not fit into the space provided by the caller
+        /// </summary>
+        TooSmall = 3,
+    }
+}
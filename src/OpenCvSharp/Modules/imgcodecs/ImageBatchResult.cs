@@ -0,0 +1,30 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Outcome and timing of one image of Cv2.ImDecodeBatch or ImageEncoder.EncodeBatch
+    /// </summary>
+    [Serializable]
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ImageBatchResult
+    {
+        /// <summary>
+        /// Whether the image was processed
+        /// </summary>
+        public ImageBatchStatus Status;
+
+        private int reserved;
+
+        /// <summary>
+        /// Time spent on the image [ms]
+        /// </summary>
+        public double Milliseconds;
+
+        /// <summary>
+        /// Whether Status is ImageBatchStatus.Ok
+        /// </summary>
+        public bool Succeeded => Status == ImageBatchStatus.Ok;
+    }
+}
@@ -0,0 +1,53 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// How an image was decoded by Cv2.ImReadReduced / Cv2.ImDecodeReduced
+    /// </summary>
+    [Serializable]
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ImageDecodeStats
+    {
+        /// <summary>
+        /// The factor (1, 2, 4 or 8) by which the codec scaled the image down while decoding it
+        /// </summary>
+        public int Reduction;
+
+        private int reserved;
+
+        /// <summary>
+        /// Size of the encoded image (for JPEG before EXIF orientation)
+        /// </summary>
+        public Size FullSize;
+
+        /// <summary>
+        /// Size of the image produced by the codec
+        /// </summary>
+        public Size DecodedSize;
+
+        /// <summary>
+        /// Time spent decoding [ms]
+        /// </summary>
+        public double DecodeMilliseconds;
+
+        /// <summary>
+        /// Time spent cropping and resizing the decoded image [ms]
+        /// </summary>
+        public double ResizeMilliseconds;
+
+        /// <summary>
+        /// Time a full-resolution decode followed by the same crop and resize took [ms], 
+        /// or -1 if it was not measured
+        /// </summary>
+        public double BaselineMilliseconds;
+
+        /// <summary>
+        /// Time saved compared to the full-resolution decode [ms], or NaN if the baseline was not measured
+        /// </summary>
+        public double SavedMilliseconds => BaselineMilliseconds < 0
+            ? double.NaN
+            : BaselineMilliseconds - DecodeMilliseconds - ResizeMilliseconds;
+    }
+}
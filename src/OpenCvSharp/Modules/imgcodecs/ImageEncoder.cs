@@ -0,0 +1,186 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+using OpenCvSharp.Util;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Encodes images with a fixed format and fixed parameters (cv::imencode), reusing its output buffers
+    /// from one call to the next. The buffers are sized from the recent results, so encoding a stream of
+    /// similar frames does not allocate.
+    /// </summary>
+    public sealed class ImageEncoder : DisposableCvObject
+    {
+        /// <summary>
+        /// Creates an encoding session
+        /// </summary>
+        /// <param name="ext">The file extension that defines the output format (e.g. ".jpg")</param>
+        /// <param name="prms">Format-specific parameters (pairs of ImwriteFlags and values).</param>
+        public ImageEncoder(string ext, int[] prms = null)
+        {
+            if (string.IsNullOrEmpty(ext))
+                throw new ArgumentNullException(nameof(ext));
+            if (prms == null)
+                prms = new int[0];
+            ptr = NativeMethods.imgcodecs_ImageEncoder_new(ext, prms, prms.Length);
+            if (ptr == IntPtr.Zero)
+                throw new OpenCvSharpException();
+            Extension = ext;
+        }
+
+        /// <summary>
+        /// Creates an encoding session
+        /// </summary>
+        /// <param name="ext">The file extension that defines the output format (e.g. ".jpg")</param>
+        /// <param name="prms">Format-specific parameters.</param>
+        public ImageEncoder(string ext, params ImageEncodingParam[] prms)
+            : this(ext, ToInts(prms))
+        {
+        }
+
+        /// <summary>
+        /// Releases unmanaged resources
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.imgcodecs_ImageEncoder_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        /// <summary>
+        /// The file extension that defines the output format
+        /// </summary>
+        public string Extension { get; }
+
+        /// <summary>
+        /// Expected size of the next encoded image [bytes], e.g. for sizing the slabs of EncodeBatch
+        /// </summary>
+        public long SizeHint
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var res = NativeMethods.imgcodecs_ImageEncoder_sizeHint(ptr);
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        /// <summary>
+        /// Encodes the image into the buffer of the session, without copying it out.
+        /// Must not be called from several threads at the same time.
+        /// </summary>
+        /// <param name="img">The image to be written</param>
+        /// <param name="data">Address of the encoded image, valid until the next call of Encode or the disposal of the session</param>
+        /// <param name="length">Size of the encoded image [bytes]</param>
+        /// <returns></returns>
+        public bool Encode(InputArray img, out IntPtr data, out int length)
+        {
+            ThrowIfDisposed();
+            if (img == null)
+                throw new ArgumentNullException(nameof(img));
+            img.ThrowIfDisposed();
+
+            int ret = NativeMethods.imgcodecs_ImageEncoder_encode(ptr, img.CvPtr, out data, out var length64);
+            GC.KeepAlive(this);
+            GC.KeepAlive(img);
+            length = checked((int) length64);
+            return ret != 0;
+        }
+
+        /// <summary>
+        /// Encodes the image into a new managed array.
+        /// Must not be called from several threads at the same time.
+        /// </summary>
+        /// <param name="img">The image to be written</param>
+        /// <param name="buf">The encoded image</param>
+        /// <returns></returns>
+        public bool Encode(InputArray img, out byte[] buf)
+        {
+            if (!Encode(img, out IntPtr data, out int length))
+            {
+                buf = new byte[0];
+                return false;
+            }
+            buf = new byte[length];
+            if (length > 0)
+                Marshal.Copy(data, buf, 0, length);
+            GC.KeepAlive(this);
+            return true;
+        }
+
+        /// <summary>
+        /// Encodes many images in parallel on the native thread pool, each into a slab provided by the caller.
+        /// Can run at the same time as Encode.
+        /// </summary>
+        /// <param name="images">The images to be written</param>
+        /// <param name="dst">One output slab per image; several slabs may share an array</param>
+        /// <param name="lengths">The encoded size of each image [bytes]. For the images whose result did not
+        /// fit (ImageBatchStatus.TooSmall) it is the size the slab needs.</param>
+        /// <param name="maxConcurrency">Maximum number of images encoded at the same time (0: no limit)</param>
+        /// <returns>The status and encoding time of each image</returns>
+        public ImageBatchResult[] EncodeBatch(
+            IList<Mat> images, IList<ArraySegment<byte>> dst, out int[] lengths, int maxConcurrency = 0)
+        {
+            ThrowIfDisposed();
+            if (images == null)
+                throw new ArgumentNullException(nameof(images));
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            if (images.Count != dst.Count)
+                throw new ArgumentException("dst must have one slab per image");
+
+            var imagesPtrs = EnumerableEx.SelectPtrs(images);
+            var count = imagesPtrs.Length;
+            var handles = new GCHandle[count];
+            try
+            {
+                var dstPtrs = new IntPtr[count];
+                var capacities = new long[count];
+                for (int i = 0; i < count; i++)
+                {
+                    var slab = dst[i];
+                    if (slab.Array == null)
+                        throw new ArgumentException("dst contains an empty ArraySegment");
+                    handles[i] = GCHandle.Alloc(slab.Array, GCHandleType.Pinned);
+                    dstPtrs[i] = new IntPtr(handles[i].AddrOfPinnedObject().ToInt64() + slab.Offset);
+                    capacities[i] = slab.Count;
+                }
+
+                var lengths64 = new long[count];
+                var results = new ImageBatchResult[count];
+                NativeMethods.imgcodecs_ImageEncoder_encodeBatch(
+                    ptr, imagesPtrs, count, dstPtrs, capacities, lengths64, maxConcurrency, results);
+                GC.KeepAlive(this);
+                GC.KeepAlive(images);
+
+                lengths = new int[count];
+                for (int i = 0; i < count; i++)
+                    lengths[i] = checked((int) lengths64[i]);
+                return results;
+            }
+            finally
+            {
+                foreach (var handle in handles)
+                {
+                    if (handle.IsAllocated)
+                        handle.Free();
+                }
+            }
+        }
+
+        private static int[] ToInts(ImageEncodingParam[] prms)
+        {
+            if (prms == null)
+                return null;
+            var p = new List<int>();
+            foreach (ImageEncodingParam item in prms)
+            {
+                p.Add((int) item.EncodingId);
+                p.Add(item.Value);
+            }
+            return p.ToArray();
+        }
+    }
+}
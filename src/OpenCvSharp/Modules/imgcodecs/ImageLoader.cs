@@ -0,0 +1,165 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Linq;
+using System.Threading;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Loads a list of image files on native decoder threads ahead of the consumer. The decoded (and optionally
+    /// resized and color-converted) images wait in a bounded queue, so that reading and decoding overlap the
+    /// processing of the previous images, and a slow consumer holds back the decoders.
+    /// </summary>
+    public sealed class ImageLoader : DisposableCvObject
+    {
+        private string[] fileNames;
+        private int taken;
+
+        /// <summary>
+        /// Starts loading the files
+        /// </summary>
+        /// <param name="fileNames">The files, loaded in this order</param>
+        /// <param name="options">Settings (null: defaults)</param>
+        public ImageLoader(IEnumerable<string> fileNames, ImageLoaderOptions options = null)
+        {
+            if (fileNames == null)
+                throw new ArgumentNullException(nameof(fileNames));
+            var files = fileNames.ToArray();
+            if (files.Any(f => f == null))
+                throw new ArgumentException("fileNames contains null", nameof(fileNames));
+            var nativeOptions = (options ?? new ImageLoaderOptions()).ToNative();
+
+            ptr = NativeMethods.imgcodecs_ImageLoader_new(files, files.Length, nativeOptions);
+            if (ptr == IntPtr.Zero)
+                throw new OpenCvSharpException("Failed to create ImageLoader");
+            this.fileNames = files;
+        }
+
+        private ImageLoader(IntPtr ptr)
+        {
+            if (ptr == IntPtr.Zero)
+                throw new OpenCvSharpException("Failed to create ImageLoader");
+            this.ptr = ptr;
+        }
+
+        /// <summary>
+        /// Starts loading the files which match the pattern (Cv2.Glob)
+        /// </summary>
+        /// <param name="pattern">The pattern, e.g. "images/*.jpg"</param>
+        /// <param name="recursive">Searches the subdirectories as well</param>
+        /// <param name="options">Settings (null: defaults)</param>
+        /// <returns></returns>
+        public static ImageLoader FromGlob(string pattern, bool recursive = false, ImageLoaderOptions options = null)
+        {
+            if (pattern == null)
+                throw new ArgumentNullException(nameof(pattern));
+            var nativeOptions = (options ?? new ImageLoaderOptions()).ToNative();
+            return new ImageLoader(NativeMethods.imgcodecs_ImageLoader_newGlob(pattern, recursive ? 1 : 0, nativeOptions));
+        }
+
+        /// <summary>
+        /// Stops the decoders and releases the images which have not been taken
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.imgcodecs_ImageLoader_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        /// <summary>
+        /// The files being loaded; the index returned by TryTake refers to this list
+        /// </summary>
+        public string[] FileNames
+        {
+            get
+            {
+                ThrowIfDisposed();
+                if (fileNames == null)
+                {
+                    using (var vec = new VectorOfString())
+                    {
+                        NativeMethods.imgcodecs_ImageLoader_fileNames(ptr, vec.CvPtr);
+                        GC.KeepAlive(this);
+                        fileNames = vec.ToArray();
+                    }
+                }
+                return (string[]) fileNames.Clone();
+            }
+        }
+
+        /// <summary>
+        /// The number of files
+        /// </summary>
+        public int Count
+        {
+            get
+            {
+                if (fileNames == null)
+                    return FileNames.Length;
+                return fileNames.Length;
+            }
+        }
+
+        /// <summary>
+        /// True when every image has been taken
+        /// </summary>
+        public bool IsCompleted => taken == Count;
+
+        /// <summary>
+        /// Number of decoded images waiting to be taken
+        /// </summary>
+        public int QueuedCount
+        {
+            get
+            {
+                ThrowIfDisposed();
+                NativeMethods.imgcodecs_ImageLoader_queued(ptr, out var count, out _);
+                GC.KeepAlive(this);
+                return count;
+            }
+        }
+
+        /// <summary>
+        /// Size of the decoded images waiting to be taken [bytes]
+        /// </summary>
+        public long QueuedBytes
+        {
+            get
+            {
+                ThrowIfDisposed();
+                NativeMethods.imgcodecs_ImageLoader_queued(ptr, out _, out var bytes);
+                GC.KeepAlive(this);
+                return bytes;
+            }
+        }
+
+        /// <summary>
+        /// Takes the next image: the next one in the file list, or with Ordered = false the first one ready.
+        /// The decoded image is handed over to dst without copying. Must not be called from several threads at the same time.
+        /// </summary>
+        /// <param name="dst">Receives the image; empty if the file could not be loaded</param>
+        /// <param name="index">Index of the image in FileNames</param>
+        /// <param name="status">Whether the file was loaded</param>
+        /// <param name="millisecondsTimeout">Maximum time to wait for the image (Timeout.Infinite: no limit)</param>
+        /// <returns>false if every image has been taken (IsCompleted) or the timeout expired</returns>
+        public bool TryTake(Mat dst, out int index, out ImageBatchStatus status, int millisecondsTimeout = Timeout.Infinite)
+        {
+            ThrowIfDisposed();
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            dst.ThrowIfDisposed();
+
+            int ret = NativeMethods.imgcodecs_ImageLoader_pop(ptr, millisecondsTimeout, dst.CvPtr, out index, out var s);
+            GC.KeepAlive(this);
+            GC.KeepAlive(dst);
+            status = (ImageBatchStatus) s;
+            if (ret <= 0)
+            {
+                index = -1;
+                return false;
+            }
+            taken++;
+            return true;
+        }
+    }
+}
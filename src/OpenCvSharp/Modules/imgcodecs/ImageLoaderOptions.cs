@@ -0,0 +1,91 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Settings of an ImageLoader
+    /// </summary>
+    public class ImageLoaderOptions
+    {
+        /// <summary>
+        /// Number of decoder threads (0: the number of CPUs)
+        /// </summary>
+        public int Threads { get; set; }
+
+        /// <summary>
+        /// Maximum number of images decoded ahead of the consumer, including those being decoded
+        /// (0: twice the number of threads)
+        /// </summary>
+        public int MaxQueued { get; set; }
+
+        /// <summary>
+        /// The decoders stop taking new files while the decoded images waiting in the queue reach this size [bytes]
+        /// (0: no limit). The images being decoded at that moment may still exceed it.
+        /// </summary>
+        public long MaxQueuedBytes { get; set; }
+
+        /// <summary>
+        /// Specifies color type of the loaded images
+        /// </summary>
+        public ImreadModes Flags { get; set; } = ImreadModes.Color;
+
+        /// <summary>
+        /// The images are resized to this size on the decoder threads, unless it is empty
+        /// </summary>
+        public Size Size { get; set; }
+
+        /// <summary>
+        /// Interpolation method of the resize
+        /// </summary>
+        public InterpolationFlags Interpolation { get; set; } = InterpolationFlags.Area;
+
+        /// <summary>
+        /// Color conversion applied on the decoder threads after resizing (null: none)
+        /// </summary>
+        public ColorConversionCodes? ColorConversion { get; set; }
+
+        /// <summary>
+        /// If true, the images are taken in the order of the file list; otherwise as soon as they are ready
+        /// </summary>
+        public bool Ordered { get; set; } = true;
+
+        internal NativeStruct ToNative()
+        {
+            if (Threads < 0)
+                throw new ArgumentOutOfRangeException(nameof(Threads));
+            if (MaxQueued < 0)
+                throw new ArgumentOutOfRangeException(nameof(MaxQueued));
+            if (MaxQueuedBytes < 0)
+                throw new ArgumentOutOfRangeException(nameof(MaxQueuedBytes));
+
+            return new NativeStruct
+            {
+                MaxQueuedBytes = MaxQueuedBytes,
+                MaxQueued = MaxQueued,
+                Threads = Threads,
+                Flags = (int) Flags,
+                Size = Size,
+                Interpolation = (int) Interpolation,
+                ColorConversion = ColorConversion.HasValue ? (int) ColorConversion.Value : -1,
+                Ordered = Ordered ? 1 : 0,
+            };
+        }
+
+        [StructLayout(LayoutKind.Sequential)]
+#pragma warning disable 1591
+        public struct NativeStruct
+        {
+            public long MaxQueuedBytes;
+            public int MaxQueued;
+            public int Threads;
+            public int Flags;
+            public Size Size;
+            public int Interpolation;
+            public int ColorConversion;
+            public int Ordered;
+            public int Reserved;
+        }
+#pragma warning restore 1591
+    }
+}
@@ -0,0 +1,135 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Reads the pages of a multi-page TIFF file one at a time. Unlike Cv2.ImReadMulti, only the page
+    /// being decoded is held in memory, and the file is opened once for all pages.
+    /// Files in other formats have a single page; BigTIFF files are rejected, as OpenCV cannot decode them.
+    /// Must not be used from several threads at the same time.
+    /// </summary>
+    public sealed class ImagePageReader : DisposableCvObject
+    {
+        /// <summary>
+        /// Opens the file and locates its pages
+        /// </summary>
+        /// <param name="fileName">Name of file to be loaded (smaller than 2 GB).</param>
+        public ImagePageReader(string fileName)
+        {
+            if (string.IsNullOrEmpty(fileName))
+                throw new ArgumentNullException(nameof(fileName));
+            ptr = NativeMethods.imgcodecs_ImagePageReader_new(fileName);
+            if (ptr == IntPtr.Zero)
+                throw new OpenCvSharpException("Failed to open the file: " + fileName);
+        }
+
+        /// <summary>
+        /// Releases unmanaged resources
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.imgcodecs_ImagePageReader_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        /// <summary>
+        /// The number of pages in the file
+        /// </summary>
+        public int PageCount
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var res = NativeMethods.imgcodecs_ImagePageReader_pageCount(ptr);
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        /// <summary>
+        /// Decodes one page into dst, which is reused when it already has the size and type of the page
+        /// </summary>
+        /// <param name="index">Zero-based index of the page</param>
+        /// <param name="dst">Destination image; released if the page cannot be decoded</param>
+        /// <param name="flags">Specifies color type of the loaded image</param>
+        /// <returns>false if the page could not be decoded</returns>
+        public bool Read(int index, Mat dst, ImreadModes flags = ImreadModes.Color)
+        {
+            ThrowIfDisposed();
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            dst.ThrowIfDisposed();
+            if (index < 0 || index >= PageCount)
+                throw new ArgumentOutOfRangeException(nameof(index));
+
+            int ret = NativeMethods.imgcodecs_ImagePageReader_read(ptr, index, (int) flags, dst.CvPtr);
+            GC.KeepAlive(this);
+            GC.KeepAlive(dst);
+            return ret != 0;
+        }
+
+        /// <summary>
+        /// Decodes one page into a new image
+        /// </summary>
+        /// <param name="index">Zero-based index of the page</param>
+        /// <param name="flags">Specifies color type of the loaded image</param>
+        /// <returns>The page; empty if it could not be decoded</returns>
+        public Mat Read(int index, ImreadModes flags = ImreadModes.Color)
+        {
+            var dst = new Mat();
+            try
+            {
+                Read(index, dst, flags);
+                return dst;
+            }
+            catch
+            {
+                dst.Dispose();
+                throw;
+            }
+        }
+
+        /// <summary>
+        /// Decodes a range of pages one after another, all into the same image.
+        /// The yielded image is overwritten by the next page; clone it to keep it.
+        /// </summary>
+        /// <param name="start">Zero-based index of the first page</param>
+        /// <param name="count">Number of pages (-1: up to the last page)</param>
+        /// <param name="flags">Specifies color type of the loaded images</param>
+        /// <param name="dst">Destination image to reuse; if null, one is created and disposed at the end of the enumeration</param>
+        /// <returns></returns>
+        public IEnumerable<Mat> ReadPages(int start = 0, int count = -1, ImreadModes flags = ImreadModes.Color, Mat dst = null)
+        {
+            ThrowIfDisposed();
+            var pageCount = PageCount;
+            if (start < 0 || start > pageCount)
+                throw new ArgumentOutOfRangeException(nameof(start));
+            if (count < 0)
+                count = pageCount - start;
+            if (start + count > pageCount)
+                throw new ArgumentOutOfRangeException(nameof(count));
+
+            return ReadPagesCore(start, count, flags, dst);
+        }
+
+        private IEnumerable<Mat> ReadPagesCore(int start, int count, ImreadModes flags, Mat dst)
+        {
+            var page = dst ?? new Mat();
+            try
+            {
+                for (int i = start; i < start + count; i++)
+                {
+                    if (!Read(i, page, flags))
+                        throw new OpenCvSharpException("Failed to decode page " + i);
+                    yield return page;
+                }
+            }
+            finally
+            {
+                if (dst == null)
+                    page.Dispose();
+            }
+        }
+    }
+}
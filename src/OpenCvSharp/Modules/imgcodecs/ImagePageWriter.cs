@@ -0,0 +1,101 @@
+﻿using System;
+using System.Collections.Generic;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Writes a multi-page TIFF file one page at a time. Unlike Cv2.ImWrite with a list of images,
+    /// the pages do not have to be in memory together: each page is encoded and appended as it is written.
+    /// Must not be used from several threads at the same time.
+    /// </summary>
+    public sealed class ImagePageWriter : DisposableCvObject
+    {
+        /// <summary>
+        /// Creates (or truncates) the file
+        /// </summary>
+        /// <param name="fileName">Name of the file.</param>
+        /// <param name="prms">Format-specific parameters (pairs of ImwriteFlags and values), used for every page.</param>
+        public ImagePageWriter(string fileName, int[] prms = null)
+        {
+            if (string.IsNullOrEmpty(fileName))
+                throw new ArgumentNullException(nameof(fileName));
+            if (prms == null)
+                prms = new int[0];
+            ptr = NativeMethods.imgcodecs_ImagePageWriter_new(fileName, prms, prms.Length);
+            if (ptr == IntPtr.Zero)
+                throw new OpenCvSharpException("Failed to create the file: " + fileName);
+        }
+
+        /// <summary>
+        /// Creates (or truncates) the file
+        /// </summary>
+        /// <param name="fileName">Name of the file.</param>
+        /// <param name="prms">Format-specific parameters, used for every page.</param>
+        public ImagePageWriter(string fileName, params ImageEncodingParam[] prms)
+            : this(fileName, ToInts(prms))
+        {
+        }
+
+        /// <summary>
+        /// Releases unmanaged resources; the file is closed if Close has not been called
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.imgcodecs_ImagePageWriter_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        /// <summary>
+        /// The number of pages written so far
+        /// </summary>
+        public int PageCount
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var res = NativeMethods.imgcodecs_ImagePageWriter_pageCount(ptr);
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        /// <summary>
+        /// Encodes the image and appends it to the file as the next page
+        /// </summary>
+        /// <param name="page">The image to be written</param>
+        public void Write(Mat page)
+        {
+            ThrowIfDisposed();
+            if (page == null)
+                throw new ArgumentNullException(nameof(page));
+            page.ThrowIfDisposed();
+
+            NativeMethods.imgcodecs_ImagePageWriter_write(ptr, page.CvPtr);
+            GC.KeepAlive(this);
+            GC.KeepAlive(page);
+        }
+
+        /// <summary>
+        /// Flushes and closes the file, reporting write errors. No pages can be written afterwards.
+        /// </summary>
+        public void Close()
+        {
+            ThrowIfDisposed();
+            NativeMethods.imgcodecs_ImagePageWriter_close(ptr);
+            GC.KeepAlive(this);
+        }
+
+        private static int[] ToInts(ImageEncodingParam[] prms)
+        {
+            if (prms == null)
+                return null;
+            var p = new List<int>();
+            foreach (ImageEncodingParam item in prms)
+            {
+                p.Add((int) item.EncodingId);
+                p.Add(item.Value);
+            }
+            return p.ToArray();
+        }
+    }
+}
@@ -0,0 +1,306 @@
+﻿using System;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Applies an image filter tile by tile, so that arbitrarily large images (e.g. memory mapped Mats)
+    /// can be processed with a working memory that depends on the tile size only.
+    /// </summary>
+    /// <remarks>
+    /// Each tile is read together with the halo the filter needs around it, and the image borders are
+    /// extrapolated exactly as in the corresponding Cv2 call, so the result equals the whole-image call.
+    /// Tiles are processed in parallel by the OpenCV thread pool.
+    /// </remarks>
+    public sealed class TiledFilter : DisposableCvObject
+    {
+        private TiledFilter(IntPtr p)
+        {
+            ptr = p;
+        }
+
+        /// <summary>
+        /// Releases unmanaged resources
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.imgproc_TiledFilter_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        #region Filters
+
+        /// <summary>
+        /// Tiled version of Cv2.GaussianBlur
+        /// </summary>
+        /// <param name="ksize">Gaussian kernel size (0: computed from sigma)</param>
+        /// <param name="sigmaX">Gaussian kernel standard deviation in X direction</param>
+        /// <param name="sigmaY">Gaussian kernel standard deviation in Y direction (0: same as sigmaX)</param>
+        /// <param name="borderType">pixel extrapolation method</param>
+        /// <returns></returns>
+        public static TiledFilter GaussianBlur(Size ksize, double sigmaX, double sigmaY = 0,
+            BorderTypes borderType = BorderTypes.Default)
+        {
+            return new TiledFilter(NativeMethods.imgproc_TiledFilter_new_GaussianBlur(ksize, sigmaX, sigmaY, (int)borderType));
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.BoxFilter
+        /// </summary>
+        /// <param name="ddepth">the output image depth (-1 to use src.Depth())</param>
+        /// <param name="ksize">The smoothing kernel size</param>
+        /// <param name="anchor">The anchor point (null: the kernel center)</param>
+        /// <param name="normalize">Indicates, whether the kernel is normalized by its area or not</param>
+        /// <param name="borderType">The border mode used to extrapolate pixels outside of the image</param>
+        /// <returns></returns>
+        public static TiledFilter BoxFilter(MatType ddepth, Size ksize, Point? anchor = null, bool normalize = true,
+            BorderTypes borderType = BorderTypes.Default)
+        {
+            Point anchor0 = anchor.GetValueOrDefault(new Point(-1, -1));
+            return new TiledFilter(NativeMethods.imgproc_TiledFilter_new_boxFilter(
+                ddepth, ksize, anchor0, normalize ? 1 : 0, (int)borderType));
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.Blur
+        /// </summary>
+        /// <param name="ksize">The smoothing kernel size</param>
+        /// <param name="anchor">The anchor point (null: the kernel center)</param>
+        /// <param name="borderType">The border mode used to extrapolate pixels outside of the image</param>
+        /// <returns></returns>
+        public static TiledFilter Blur(Size ksize, Point? anchor = null, BorderTypes borderType = BorderTypes.Default)
+        {
+            return BoxFilter(-1, ksize, anchor, true, borderType);
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.MedianBlur
+        /// </summary>
+        /// <param name="ksize">The aperture linear size. It must be odd and more than 1, i.e. 3, 5, 7 ...</param>
+        /// <returns></returns>
+        public static TiledFilter MedianBlur(int ksize)
+        {
+            return new TiledFilter(NativeMethods.imgproc_TiledFilter_new_medianBlur(ksize));
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.BilateralFilter
+        /// </summary>
+        /// <param name="d">The diameter of each pixel neighborhood</param>
+        /// <param name="sigmaColor">Filter sigma in the color space</param>
+        /// <param name="sigmaSpace">Filter sigma in the coordinate space</param>
+        /// <param name="borderType"></param>
+        /// <returns></returns>
+        public static TiledFilter BilateralFilter(int d, double sigmaColor, double sigmaSpace,
+            BorderTypes borderType = BorderTypes.Default)
+        {
+            return new TiledFilter(NativeMethods.imgproc_TiledFilter_new_bilateralFilter(d, sigmaColor, sigmaSpace, (int)borderType));
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.Filter2D
+        /// </summary>
+        /// <param name="ddepth">The desired depth of the destination image (-1: same as src)</param>
+        /// <param name="kernel">Convolution kernel (the filter keeps a copy)</param>
+        /// <param name="anchor">The anchor of the kernel (null: the kernel center)</param>
+        /// <param name="delta">The optional value added to the filtered pixels</param>
+        /// <param name="borderType">The pixel extrapolation method</param>
+        /// <returns></returns>
+        public static TiledFilter Filter2D(MatType ddepth, InputArray kernel, Point? anchor = null, double delta = 0,
+            BorderTypes borderType = BorderTypes.Default)
+        {
+            if (kernel == null)
+                throw new ArgumentNullException(nameof(kernel));
+            kernel.ThrowIfDisposed();
+            Point anchor0 = anchor.GetValueOrDefault(new Point(-1, -1));
+            var p = NativeMethods.imgproc_TiledFilter_new_filter2D(ddepth, kernel.CvPtr, anchor0, delta, (int)borderType);
+            GC.KeepAlive(kernel);
+            return new TiledFilter(p);
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.SepFilter2D
+        /// </summary>
+        /// <param name="ddepth">The destination image depth</param>
+        /// <param name="kernelX">The coefficients for filtering each row</param>
+        /// <param name="kernelY">The coefficients for filtering each column</param>
+        /// <param name="anchor">The anchor position within the kernel (null: the kernel center)</param>
+        /// <param name="delta">The value added to the filtered results before storing them</param>
+        /// <param name="borderType">The pixel extrapolation method</param>
+        /// <returns></returns>
+        public static TiledFilter SepFilter2D(MatType ddepth, InputArray kernelX, InputArray kernelY,
+            Point? anchor = null, double delta = 0, BorderTypes borderType = BorderTypes.Default)
+        {
+            if (kernelX == null)
+                throw new ArgumentNullException(nameof(kernelX));
+            if (kernelY == null)
+                throw new ArgumentNullException(nameof(kernelY));
+            kernelX.ThrowIfDisposed();
+            kernelY.ThrowIfDisposed();
+            Point anchor0 = anchor.GetValueOrDefault(new Point(-1, -1));
+            var p = NativeMethods.imgproc_TiledFilter_new_sepFilter2D(
+                ddepth, kernelX.CvPtr, kernelY.CvPtr, anchor0, delta, (int)borderType);
+            GC.KeepAlive(kernelX);
+            GC.KeepAlive(kernelY);
+            return new TiledFilter(p);
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.Sobel
+        /// </summary>
+        /// <param name="ddepth">The destination image depth</param>
+        /// <param name="xorder">Order of the derivative x</param>
+        /// <param name="yorder">Order of the derivative y</param>
+        /// <param name="ksize">Size of the extended Sobel kernel, must be 1, 3, 5 or 7</param>
+        /// <param name="scale">The optional scale factor for the computed derivative values</param>
+        /// <param name="delta">The optional delta value, added to the results</param>
+        /// <param name="borderType">The pixel extrapolation method</param>
+        /// <returns></returns>
+        public static TiledFilter Sobel(MatType ddepth, int xorder, int yorder, int ksize = 3, double scale = 1,
+            double delta = 0, BorderTypes borderType = BorderTypes.Default)
+        {
+            return new TiledFilter(NativeMethods.imgproc_TiledFilter_new_Sobel(
+                ddepth, xorder, yorder, ksize, scale, delta, (int)borderType));
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.Scharr
+        /// </summary>
+        /// <param name="ddepth">The destination image depth</param>
+        /// <param name="xorder">Order of the derivative x</param>
+        /// <param name="yorder">Order of the derivative y</param>
+        /// <param name="scale">The optional scale factor for the computed derivative values</param>
+        /// <param name="delta">The optional delta value, added to the results</param>
+        /// <param name="borderType">The pixel extrapolation method</param>
+        /// <returns></returns>
+        public static TiledFilter Scharr(MatType ddepth, int xorder, int yorder, double scale = 1, double delta = 0,
+            BorderTypes borderType = BorderTypes.Default)
+        {
+            return new TiledFilter(NativeMethods.imgproc_TiledFilter_new_Scharr(
+                ddepth, xorder, yorder, scale, delta, (int)borderType));
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.Laplacian
+        /// </summary>
+        /// <param name="ddepth">The desired depth of the destination image</param>
+        /// <param name="ksize">The aperture size used to compute the second-derivative filters</param>
+        /// <param name="scale">The optional scale factor for the computed Laplacian values</param>
+        /// <param name="delta">The optional delta value, added to the results</param>
+        /// <param name="borderType">The pixel extrapolation method</param>
+        /// <returns></returns>
+        public static TiledFilter Laplacian(MatType ddepth, int ksize = 1, double scale = 1, double delta = 0,
+            BorderTypes borderType = BorderTypes.Default)
+        {
+            return new TiledFilter(NativeMethods.imgproc_TiledFilter_new_Laplacian(
+                ddepth, ksize, scale, delta, (int)borderType));
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.MorphologyEx (MorphTypes.HitMiss is not supported)
+        /// </summary>
+        /// <param name="op">Type of morphological operation</param>
+        /// <param name="element">Structuring element (null: 3x3 rectangle)</param>
+        /// <param name="anchor">Position of the anchor within the element (null: the element center)</param>
+        /// <param name="iterations">Number of times erosion and dilation are applied</param>
+        /// <param name="borderType">The pixel extrapolation method</param>
+        /// <param name="borderValue">The border value in case of a constant border (null: Cv2.MorphologyDefaultBorderValue())</param>
+        /// <returns></returns>
+        public static TiledFilter MorphologyEx(MorphTypes op, InputArray element, Point? anchor = null, int iterations = 1,
+            BorderTypes borderType = BorderTypes.Constant, Scalar? borderValue = null)
+        {
+            element?.ThrowIfDisposed();
+            Point anchor0 = anchor.GetValueOrDefault(new Point(-1, -1));
+            Scalar borderValue0 = borderValue.GetValueOrDefault(Cv2.MorphologyDefaultBorderValue());
+            var p = NativeMethods.imgproc_TiledFilter_new_morphologyEx(
+                (int)op, Cv2.ToPtr(element), anchor0, iterations, (int)borderType, borderValue0);
+            GC.KeepAlive(element);
+            return new TiledFilter(p);
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.Erode
+        /// </summary>
+        /// <param name="element">Structuring element (null: 3x3 rectangle)</param>
+        /// <param name="anchor">Position of the anchor within the element (null: the element center)</param>
+        /// <param name="iterations">The number of times erosion is applied</param>
+        /// <param name="borderType">The pixel extrapolation method</param>
+        /// <param name="borderValue">The border value in case of a constant border (null: Cv2.MorphologyDefaultBorderValue())</param>
+        /// <returns></returns>
+        public static TiledFilter Erode(InputArray element, Point? anchor = null, int iterations = 1,
+            BorderTypes borderType = BorderTypes.Constant, Scalar? borderValue = null)
+        {
+            return MorphologyEx(MorphTypes.Erode, element, anchor, iterations, borderType, borderValue);
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.Dilate
+        /// </summary>
+        /// <param name="element">Structuring element (null: 3x3 rectangle)</param>
+        /// <param name="anchor">Position of the anchor within the element (null: the element center)</param>
+        /// <param name="iterations">The number of times dilation is applied</param>
+        /// <param name="borderType">The pixel extrapolation method</param>
+        /// <param name="borderValue">The border value in case of a constant border (null: Cv2.MorphologyDefaultBorderValue())</param>
+        /// <returns></returns>
+        public static TiledFilter Dilate(InputArray element, Point? anchor = null, int iterations = 1,
+            BorderTypes borderType = BorderTypes.Constant, Scalar? borderValue = null)
+        {
+            return MorphologyEx(MorphTypes.Dilate, element, anchor, iterations, borderType, borderValue);
+        }
+
+        /// <summary>
+        /// Tiled version of Cv2.CvtColor (conversions that change the image size, such as YUV 4:2:0, are not supported)
+        /// </summary>
+        /// <param name="code">The color space conversion code</param>
+        /// <param name="dstCn">The number of channels in the destination image (0: derived from code)</param>
+        /// <returns></returns>
+        public static TiledFilter CvtColor(ColorConversionCodes code, int dstCn = 0)
+        {
+            return new TiledFilter(NativeMethods.imgproc_TiledFilter_new_cvtColor((int)code, dstCn));
+        }
+
+        #endregion
+
+        #region Methods
+
+        /// <summary>
+        /// Number of pixels read on each side of a tile
+        /// </summary>
+        public Size Halo
+        {
+            get
+            {
+                ThrowIfDisposed();
+                var ret = NativeMethods.imgproc_TiledFilter_halo(ptr);
+                GC.KeepAlive(this);
+                return ret;
+            }
+        }
+
+        /// <summary>
+        /// Filters src into dst tile by tile
+        /// </summary>
+        /// <param name="src">Source image (e.g. a memory mapped Mat)</param>
+        /// <param name="dst">Destination image; must not share memory with src. If it already has
+        /// the size and type of the result (e.g. a memory mapped Mat), it is written in place.</param>
+        /// <param name="tileSize">Size of the tiles (enlarged to at least the halo)</param>
+        /// <param name="memoryBudget">Maximum working memory in bytes used by the tiles processed
+        /// at the same time (0: one tile per worker thread)</param>
+        public void Apply(InputArray src, OutputArray dst, Size tileSize, long memoryBudget = 0)
+        {
+            ThrowIfDisposed();
+            if (src == null)
+                throw new ArgumentNullException(nameof(src));
+            if (dst == null)
+                throw new ArgumentNullException(nameof(dst));
+            src.ThrowIfDisposed();
+            dst.ThrowIfNotReady();
+            NativeMethods.imgproc_TiledFilter_apply(ptr, src.CvPtr, dst.CvPtr, tileSize, memoryBudget);
+            GC.KeepAlive(this);
+            GC.KeepAlive(src);
+            GC.KeepAlive(dst);
+            dst.Fix();
+        }
+
+        #endregion
+    }
+}
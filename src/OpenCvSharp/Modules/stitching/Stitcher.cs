@@ -470,6 +470,28 @@ namespace OpenCvSharp
             return status;
         }
 
+        /// <summary>
+        /// Creates a job which stitches the given images on a worker thread of NativeJobQueue.
+        /// Submit it with NativeJob.Submit; NativeJob.ResultCode is the Status and the panorama is
+        /// NativeJob.GetResult() if it is Status.OK. The job can be cancelled between the registration
+        /// and the compositing. It shares this stitcher: do not use it until the job has finished.
+        /// </summary>
+        /// <param name="images">Input images.</param>
+        /// <returns></returns>
+        public NativeJob StitchJob(IEnumerable<Mat> images)
+        {
+            if (images == null)
+                throw new ArgumentNullException(nameof(images));
+            ThrowIfDisposed();
+
+            IntPtr[] imagesPtrs = EnumerableEx.SelectPtrs(images);
+
+            var job = NativeMethods.stitching_Stitcher_stitch_job(ptrObj.CvPtr, imagesPtrs, imagesPtrs.Length);
+            GC.KeepAlive(this);
+            GC.KeepAlive(images);
+            return new NativeJob(job);
+        }
+
         /// <summary>
         /// Try to stitch the given images.
         /// </summary>
@@ -0,0 +1,68 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+#pragma warning disable 1591
+
+namespace OpenCvSharp
+{
+    static partial class NativeMethods
+    {
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr gapi_Graph_new();
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void gapi_Graph_delete(IntPtr obj);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_input(IntPtr obj);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void gapi_Graph_output(IntPtr obj, int node);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_cvtColor(IntPtr obj, int src, int code);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_resize(IntPtr obj, int src, Size dsize, double fx, double fy, int interpolation);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_blur(IntPtr obj, int src, Size ksize, Point anchor, int borderType);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_gaussianBlur(IntPtr obj, int src, Size ksize, double sigmaX, double sigmaY, int borderType);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_medianBlur(IntPtr obj, int src, int ksize);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_filter2D(IntPtr obj, int src, int ddepth, IntPtr kernel, Point anchor, Scalar delta, int borderType);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_sobel(IntPtr obj, int src, int ddepth, int dx, int dy, int ksize, double scale, double delta, int borderType);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_canny(IntPtr obj, int src, double threshold1, double threshold2, int apertureSize, int L2gradient);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_erode(IntPtr obj, int src, IntPtr kernel, Point anchor, int iterations, int borderType);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_dilate(IntPtr obj, int src, IntPtr kernel, Point anchor, int iterations, int borderType);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_threshold(IntPtr obj, int src, double thresh, double maxval, int type);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_arithm(IntPtr obj, int op, int src1, int src2, double scale, int ddepth);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_arithmC(IntPtr obj, int op, int src, Scalar value, double scale, int ddepth);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_addWeighted(IntPtr obj, int src1, double alpha, int src2, double beta, double gamma, int ddepth);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_bitwiseNot(IntPtr obj, int src);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_convertTo(IntPtr obj, int src, int rdepth, double alpha, double beta);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void gapi_Graph_split3(IntPtr obj, int src, [Out] int[] dst);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Graph_merge3(IntPtr obj, int src1, int src2, int src3);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr gapi_Graph_compile(IntPtr obj, IntPtr[] samples, int samplesLength, int backend);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void gapi_Compiled_delete(IntPtr obj);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Compiled_inputCount(IntPtr obj);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int gapi_Compiled_outputCount(IntPtr obj);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void gapi_Compiled_outputDesc(IntPtr obj, int index, out Size size, out int type);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void gapi_Compiled_apply(IntPtr obj, IntPtr[] inputs, int inputsLength, IntPtr[] outputs, int outputsLength);
+    }
+}
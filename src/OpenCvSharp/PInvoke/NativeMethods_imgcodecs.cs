@@ -27,6 +27,88 @@ namespace OpenCvSharp
 
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern IntPtr imgcodecs_imdecode_InputArray(IntPtr buf, int flags);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_imdecode_batch(
+            IntPtr[] bufs, long[] bufLengths, int count, int flags, IntPtr[] dst, int maxConcurrency,
+            [Out] ImageBatchResult[] results);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true, ExactSpelling = true)]
+        public static extern int imgcodecs_imread_reduced(
+            [MarshalAs(UnmanagedType.LPStr)] string filename, int flags, Size maxSize, Rect roi, int measureBaseline,
+            IntPtr dst, out ImageDecodeStats stats);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int imgcodecs_imdecode_reduced(
+            byte[] buf, long bufLength, int flags, Size maxSize, Rect roi, int measureBaseline,
+            IntPtr dst, out ImageDecodeStats stats);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_imdecode_batch_reduced(
+            IntPtr[] bufs, long[] bufLengths, int count, int flags, Size maxSize, Rect[] rois, IntPtr[] dst,
+            int maxConcurrency, [Out] ImageBatchResult[] results, [Out] ImageDecodeStats[] stats);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true, ExactSpelling = true)]
+        public static extern IntPtr imgcodecs_ImageEncoder_new([MarshalAs(UnmanagedType.LPStr)] string ext, [In] int[] @params, int paramsLength);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_ImageEncoder_delete(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int imgcodecs_ImageEncoder_encode(IntPtr obj, IntPtr img, out IntPtr data, out long length);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_ImageEncoder_encodeBatch(
+            IntPtr obj, IntPtr[] images, int count, IntPtr[] dst, long[] dstCapacity, [Out] long[] dstLength,
+            int maxConcurrency, [Out] ImageBatchResult[] results);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern long imgcodecs_ImageEncoder_sizeHint(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true, ExactSpelling = true)]
+        public static extern IntPtr imgcodecs_ImagePageReader_new([MarshalAs(UnmanagedType.LPStr)] string filename);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_ImagePageReader_delete(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int imgcodecs_ImagePageReader_pageCount(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int imgcodecs_ImagePageReader_read(IntPtr obj, int index, int flags, IntPtr dst);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true, ExactSpelling = true)]
+        public static extern IntPtr imgcodecs_ImagePageWriter_new([MarshalAs(UnmanagedType.LPStr)] string filename, [In] int[] @params, int paramsLength);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_ImagePageWriter_delete(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int imgcodecs_ImagePageWriter_pageCount(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_ImagePageWriter_write(IntPtr obj, IntPtr page);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_ImagePageWriter_close(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true, BestFitMapping = false, ThrowOnUnmappableChar = true)]
+        public static extern IntPtr imgcodecs_ImageLoader_new(string[] files, int count, ImageLoaderOptions.NativeStruct options);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true, ExactSpelling = true)]
+        public static extern IntPtr imgcodecs_ImageLoader_newGlob([MarshalAs(UnmanagedType.LPStr)] string pattern, int recursive, ImageLoaderOptions.NativeStruct options);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_ImageLoader_delete(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_ImageLoader_fileNames(IntPtr obj, IntPtr result);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int imgcodecs_ImageLoader_pop(IntPtr obj, int timeoutMs, IntPtr dst, out int index, out int status);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgcodecs_ImageLoader_queued(IntPtr obj, out int count, out long bytes);
         
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, BestFitMapping = false, ThrowOnUnmappableChar = true, ExactSpelling = true)]
         public static extern int imgcodecs_imencode_vector([MarshalAs(UnmanagedType.LPStr)] string ext, IntPtr img, IntPtr buf, [In] int[] @params, int paramsLength);
@@ -73,6 +73,9 @@ namespace OpenCvSharp
         public static extern int stitching_Stitcher_stitch1_MatArray(
             IntPtr obj, [MarshalAs(UnmanagedType.LPArray)] IntPtr[] images, int imagesSize, IntPtr pano);
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr stitching_Stitcher_stitch_job(
+            IntPtr obj, [MarshalAs(UnmanagedType.LPArray)] IntPtr[] images, int imagesSize);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern int stitching_Stitcher_stitch2_InputArray(
             IntPtr obj, IntPtr images,
             IntPtr[] rois, int roisSize1, int[] roisSize2,
@@ -13,6 +13,9 @@ namespace OpenCvSharp
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern void calib3d_StereoMatcher_compute(
             IntPtr obj, IntPtr left, IntPtr right, IntPtr disparity);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr calib3d_StereoMatcher_compute_job(
+            IntPtr obj, IntPtr left, IntPtr right);
 
 
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
@@ -0,0 +1,20 @@
+﻿using System.Runtime.InteropServices;
+
+#pragma warning disable 1591
+
+namespace OpenCvSharp
+{
+    static partial class NativeMethods
+    {
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int core_ExportProfiler_isAvailable();
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_ExportProfiler_setEnabled(int enabled);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int core_ExportProfiler_isEnabled();
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int core_ExportProfiler_getEntries([Out] ExportProfileEntry[] entries, int capacity);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_ExportProfiler_reset();
+    }
+}
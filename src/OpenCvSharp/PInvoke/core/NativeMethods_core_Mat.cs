@@ -38,6 +38,20 @@ namespace OpenCvSharp
         public static extern IntPtr core_Mat_new11(int ndims, [MarshalAs(UnmanagedType.LPArray)] int[] sizes, int type, Scalar s);
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern IntPtr core_Mat_new12(IntPtr mat);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_new_External8(int rows, int cols, int type, IntPtr data, IntPtr step,
+            IntPtr callback, IntPtr userToken);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_new_External9(int ndims, [MarshalAs(UnmanagedType.LPArray)] int[] sizes,
+            int type, IntPtr data, [MarshalAs(UnmanagedType.LPArray)] IntPtr[] steps, IntPtr callback, IntPtr userToken);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_new_MappedCreate([MarshalAs(UnmanagedType.LPStr)] string path, int rows, int cols, int type);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_new_MappedOpen([MarshalAs(UnmanagedType.LPStr)] string path, int writable);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int core_Mat_flushMapped(IntPtr self);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int core_Mat_isMapped(IntPtr self);
         
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern IntPtr core_Mat_new_FromIplImage(IntPtr img, int copyData);
@@ -49,6 +63,35 @@ namespace OpenCvSharp
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern void core_Mat_delete(IntPtr mat);
 
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_new1(IntPtr buf);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_new4(IntPtr buf, IntPtr mat, Range rowRange, Range colRange);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_new7(IntPtr buf, IntPtr mat, Rect roi);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_new8(IntPtr buf, int rows, int cols, int type, IntPtr data, IntPtr step);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_new12(IntPtr buf, IntPtr mat);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_subMat1(IntPtr buf, IntPtr self, int rowStart, int rowEnd, int colStart, int colEnd);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_row(IntPtr buf, IntPtr self, int y);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_col(IntPtr buf, IntPtr self, int x);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_rowRange(IntPtr buf, IntPtr self, int startRow, int endRow);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_colRange(IntPtr buf, IntPtr self, int startCol, int endCol);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_Mat_placement_reshape(IntPtr buf, IntPtr self, int cn, int rows);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_Mat_placement_delete(IntPtr mat);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_Mat_headerCounts(out ulong heap, out ulong placement);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_Mat_resetHeaderCounts();
+
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern IntPtr core_Mat_adjustROI(IntPtr nativeObj, int dtop, int dbottom, int dleft, int dright);
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
@@ -445,6 +488,18 @@ namespace OpenCvSharp
 
         #endregion
 
+        #region getRegion / setRegion
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_Mat_getRegion(IntPtr obj, Rect roi, IntPtr buf, IntPtr bufStep, int bufType,
+            double alpha, double beta, [In] int[] channelOrder, int channelOrderLength);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_Mat_setRegion(IntPtr obj, Rect roi, IntPtr buf, IntPtr bufStep, int bufType,
+            double alpha, double beta, [In] int[] channelOrder, int channelOrderLength);
+
+        #endregion
+
         #region push_back
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern void core_Mat_push_back_Mat(IntPtr self, IntPtr m);
@@ -0,0 +1,39 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+#pragma warning disable 1591
+
+namespace OpenCvSharp
+{
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    internal delegate void MatReleaseCallback(IntPtr data, IntPtr userToken);
+
+    static partial class NativeMethods
+    {
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr core_PooledMatAllocator_get();
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_PooledMatAllocator_setGlobal(int enabled);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int core_PooledMatAllocator_isGlobal();
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_PooledMatAllocator_trim();
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_PooledMatAllocator_reset();
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_PooledMatAllocator_setMaxBytesPerThread(ulong value);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_PooledMatAllocator_getStats(out PooledMatAllocatorStats stats);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void core_Mat_setPooledAllocator(IntPtr self, int pooled);
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern int core_Mat_isPooledAllocator(IntPtr self);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern ulong core_ExternalMatAllocator_liveCount();
+    }
+}
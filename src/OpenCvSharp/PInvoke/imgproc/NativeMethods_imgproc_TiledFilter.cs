@@ -0,0 +1,54 @@
+﻿using System;
+using System.Runtime.InteropServices;
+
+#pragma warning disable 1591
+
+namespace OpenCvSharp
+{
+    static partial class NativeMethods
+    {
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgproc_TiledFilter_delete(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern void imgproc_TiledFilter_apply(IntPtr obj, IntPtr src, IntPtr dst, Size tileSize, long memoryBudget);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern Size imgproc_TiledFilter_halo(IntPtr obj);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_GaussianBlur(Size ksize, double sigmaX, double sigmaY, int borderType);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_boxFilter(int ddepth, Size ksize, Point anchor, int normalize, int borderType);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_medianBlur(int ksize);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_bilateralFilter(int d, double sigmaColor, double sigmaSpace, int borderType);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_filter2D(int ddepth, IntPtr kernel, Point anchor, double delta, int borderType);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_sepFilter2D(int ddepth, IntPtr kernelX, IntPtr kernelY,
+            Point anchor, double delta, int borderType);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_Sobel(int ddepth, int dx, int dy, int ksize, double scale, double delta, int borderType);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_Scharr(int ddepth, int dx, int dy, double scale, double delta, int borderType);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_Laplacian(int ddepth, int ksize, double scale, double delta, int borderType);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_morphologyEx(int op, IntPtr kernel, Point anchor, int iterations,
+            int borderType, Scalar borderValue);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr imgproc_TiledFilter_new_cvtColor(int code, int dstCn);
+    }
+}
@@ -20,6 +20,14 @@ namespace OpenCvSharp
         public static extern void photo_fastNlMeansDenoisingColored(IntPtr src, IntPtr dst,
             float h, float hColor, int templateWindowSize, int searchWindowSize);
 
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr photo_fastNlMeansDenoising_job(IntPtr src, float h,
+            int templateWindowSize, int searchWindowSize);
+
+        [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
+        public static extern IntPtr photo_fastNlMeansDenoisingColored_job(IntPtr src,
+            float h, float hColor, int templateWindowSize, int searchWindowSize);
+
         [DllImport(DllExtern, CallingConvention = CallingConvention.Cdecl, ExactSpelling = true)]
         public static extern void photo_fastNlMeansDenoisingMulti(IntPtr[] srcImgs, int srcImgsLength,
             IntPtr dst, int imgToDenoiseIndex, int temporalWindowSize,
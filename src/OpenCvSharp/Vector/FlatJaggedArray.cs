@@ -0,0 +1,82 @@
+﻿using System;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Jagged array stored as one contiguous data array plus row offsets (CSR layout).
+    /// Row i consists of the elements Data[Offsets[i]] .. Data[Offsets[i + 1] - 1].
+    /// </summary>
+    /// <typeparam name="T"></typeparam>
+    public sealed class FlatJaggedArray<T>
+    {
+        /// <summary>
+        /// Constructor
+        /// </summary>
+        /// <param name="data">Elements of all rows, stored back to back</param>
+        /// <param name="offsets">Index of the first element of every row, followed by data.Length</param>
+        public FlatJaggedArray(T[] data, int[] offsets)
+        {
+            if (data == null)
+                throw new ArgumentNullException(nameof(data));
+            if (offsets == null)
+                throw new ArgumentNullException(nameof(offsets));
+            if (offsets.Length == 0 || offsets[0] != 0 || offsets[offsets.Length - 1] != data.Length)
+                throw new ArgumentException("offsets must start with 0 and end with data.Length", nameof(offsets));
+            Data = data;
+            Offsets = offsets;
+        }
+
+        /// <summary>
+        /// Elements of all rows, stored back to back
+        /// </summary>
+        public T[] Data { get; }
+
+        /// <summary>
+        /// Index of the first element of every row, followed by Data.Length (RowCount + 1 entries)
+        /// </summary>
+        public int[] Offsets { get; }
+
+        /// <summary>
+        /// Number of rows
+        /// </summary>
+        public int RowCount
+        {
+            get { return Offsets.Length - 1; }
+        }
+
+        /// <summary>
+        /// Number of elements of a row
+        /// </summary>
+        /// <param name="row"></param>
+        /// <returns></returns>
+        public int RowLength(int row)
+        {
+            return Offsets[row + 1] - Offsets[row];
+        }
+
+        /// <summary>
+        /// The elements of a row (without copying them)
+        /// </summary>
+        /// <param name="row"></param>
+        /// <returns></returns>
+        public ArraySegment<T> this[int row]
+        {
+            get { return new ArraySegment<T>(Data, Offsets[row], RowLength(row)); }
+        }
+
+        /// <summary>
+        /// Copies the rows to a jagged array
+        /// </summary>
+        /// <returns></returns>
+        public T[][] ToJaggedArray()
+        {
+            var ret = new T[RowCount][];
+            for (int i = 0; i < ret.Length; i++)
+            {
+                ret[i] = new T[RowLength(i)];
+                Array.Copy(Data, Offsets[i], ret[i], 0, ret[i].Length);
+            }
+            return ret;
+        }
+    }
+}
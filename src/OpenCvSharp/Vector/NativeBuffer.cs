@@ -0,0 +1,101 @@
+﻿using System;
+using OpenCvSharp.Util;
+
+namespace OpenCvSharp
+{
+    /// <summary>
+    /// Elements taken over from a native std::vector without copying them (see VectorOfByte.Detach etc.).
+    /// The memory is freed when this object is disposed.
+    /// </summary>
+    /// <typeparam name="T"></typeparam>
+    public sealed class NativeBuffer<T> : DisposableCvObject
+        where T : unmanaged
+    {
+        private readonly IntPtr data;
+        private readonly int length;
+
+        internal NativeBuffer(IntPtr handle, IntPtr data, IntPtr length)
+        {
+            ptr = handle;
+            this.data = data;
+            this.length = checked((int)length.ToInt64());
+        }
+
+        /// <summary>
+        /// Releases unmanaged resources
+        /// </summary>
+        protected override void DisposeUnmanaged()
+        {
+            NativeMethods.vector_detached_delete(ptr);
+            base.DisposeUnmanaged();
+        }
+
+        /// <summary>
+        /// Address of the first element (IntPtr.Zero if the buffer is empty)
+        /// </summary>
+        public IntPtr Data
+        {
+            get
+            {
+                ThrowIfDisposed();
+                return data;
+            }
+        }
+
+        /// <summary>
+        /// Number of elements
+        /// </summary>
+        public int Length
+        {
+            get { return length; }
+        }
+
+        /// <summary>
+        /// Reference to an element
+        /// </summary>
+        /// <param name="index"></param>
+        /// <returns></returns>
+        public unsafe ref T this[int index]
+        {
+            get
+            {
+                ThrowIfDisposed();
+                if ((uint)index >= (uint)length)
+                    throw new ArgumentOutOfRangeException(nameof(index));
+                return ref ((T*)data)[index];
+            }
+        }
+
+        /// <summary>
+        /// Copies the elements to a managed array
+        /// </summary>
+        /// <param name="array">Destination</param>
+        /// <param name="arrayIndex">Index of array at which the first element is stored</param>
+        public unsafe void CopyTo(T[] array, int arrayIndex = 0)
+        {
+            ThrowIfDisposed();
+            if (array == null)
+                throw new ArgumentNullException(nameof(array));
+            if (arrayIndex < 0 || array.Length - arrayIndex < length)
+                throw new ArgumentOutOfRangeException(nameof(arrayIndex));
+            if (length == 0)
+                return;
+            fixed (T* dst = &array[arrayIndex])
+            {
+                MemoryHelper.CopyMemory(dst, data.ToPointer(), (uint)length * (uint)sizeof(T));
+            }
+            GC.KeepAlive(this);
+        }
+
+        /// <summary>
+        /// Copies the elements to a new managed array
+        /// </summary>
+        /// <returns></returns>
+        public T[] ToArray()
+        {
+            var ret = new T[length];
+            CopyTo(ret);
+            return ret;
+        }
+    }
+}
@@ -93,5 +93,17 @@ namespace OpenCvSharp
                                 // make sure we are not disposed until finished with copy.
             return dst;
         }
+
+        /// <summary>
+        /// Takes over the elements without copying them; this vector becomes empty.
+        /// </summary>
+        /// <returns></returns>
+        public NativeBuffer<byte> Detach()
+        {
+            ThrowIfDisposed();
+            var handle = NativeMethods.vector_uchar_detach(ptr, out var data, out var size);
+            GC.KeepAlive(this);
+            return new NativeBuffer<byte>(handle, data, size);
+        }
     }
 }
@@ -104,5 +104,17 @@ namespace OpenCvSharp
                                 // make sure we are not disposed until finished with copy.
             return dst;
         }
+
+        /// <summary>
+        /// Takes over the elements without copying them; this vector becomes empty.
+        /// </summary>
+        /// <returns></returns>
+        public NativeBuffer<Point2f> Detach()
+        {
+            ThrowIfDisposed();
+            var handle = NativeMethods.vector_Point2f_detach(ptr, out var data, out var size);
+            GC.KeepAlive(this);
+            return new NativeBuffer<Point2f>(handle, data, size);
+        }
     }
 }
@@ -114,5 +114,32 @@ namespace OpenCvSharp
             }
             return ret;
         }
+
+        /// <summary>
+        /// Total number of elements of all inner vectors
+        /// </summary>
+        public long TotalSize
+        {
+            get
+            {
+                var res = NativeMethods.vector_vector_DMatch_getTotalSize(ptr).ToInt64();
+                GC.KeepAlive(this);
+                return res;
+            }
+        }
+
+        /// <summary>
+        /// Converts std::vector to one contiguous managed array plus row offsets.
+        /// Unlike ToArray, this needs one copy per inner vector and one managed allocation for the data.
+        /// </summary>
+        /// <returns></returns>
+        public FlatJaggedArray<DMatch> ToFlatArray()
+        {
+            var offsets = new int[Size1 + 1];
+            var data = new DMatch[TotalSize];
+            NativeMethods.vector_vector_DMatch_copyFlat(ptr, data, offsets);
+            GC.KeepAlive(this);
+            return new FlatJaggedArray<DMatch>(data, offsets);
+        }
     }
 }
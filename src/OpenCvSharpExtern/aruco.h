@@ -9,7 +9,7 @@ CVAPI(cv::Ptr<cv::aruco::DetectorParameters>*) aruco_DetectorParameters_create()
 
     // This code corrupt memory
     //return c(*p);
-    return new cv::Ptr<cv::aruco::DetectorParameters>(p);
+    return trackHandle(new cv::Ptr<cv::aruco::DetectorParameters>(p));
 }
 
 CVAPI(void) aruco_drawDetectedMarkers(
@@ -60,12 +60,12 @@ CVAPI(cv::Ptr<cv::aruco::Dictionary>*) aruco_getPredefinedDictionary(cv::aruco::
 {
     cv::Ptr<cv::aruco::Dictionary> dictionary = cv::aruco::getPredefinedDictionary(name);
 
-    return new cv::Ptr<cv::aruco::Dictionary>(dictionary);
+    return trackHandle(new cv::Ptr<cv::aruco::Dictionary>(dictionary));
 }
 
 CVAPI(void) aruco_Ptr_DetectorParameters_delete(cv::Ptr<cv::aruco::DetectorParameters> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::aruco::DetectorParameters*) aruco_Ptr_DetectorParameters_get(cv::Ptr<cv::aruco::DetectorParameters> *ptr)
@@ -236,7 +236,7 @@ CVAPI(double) aruco_DetectorParameters_getErrorCorrectionRate(cv::aruco::Detecto
 
 CVAPI(void) aruco_Ptr_Dictionary_delete(cv::Ptr<cv::aruco::Dictionary> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::aruco::Dictionary*) aruco_Ptr_Dictionary_get(cv::Ptr<cv::aruco::Dictionary> *ptr)
@@ -253,7 +253,7 @@ CVAPI(void) aruco_Dictionary_setMaxCorrectionBits(cv::aruco::Dictionary *obj, in
 }
 CVAPI(cv::Mat*) aruco_Dictionary_getBytesList(cv::aruco::Dictionary *obj)
 {
-    return new cv::Mat(obj->bytesList);
+    return trackHandle(new cv::Mat(obj->bytesList));
 }
 CVAPI(int) aruco_Dictionary_getMarkerSize(cv::aruco::Dictionary *obj)
 {
@@ -0,0 +1,326 @@
+// Minimal benchmark runner for OpenCvSharpExtern_bench
+
+#ifndef _OPENCVSHARP_BENCH_H_
+#define _OPENCVSHARP_BENCH_H_
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    // operator new calls / bytes of the whole process (see bench_main.cpp)
+    std::atomic<unsigned long long> &allocationCount();
+    std::atomic<unsigned long long> &allocationBytes();
+
+    // Passed to every benchmark function. Work before the first keepRunning() call and after the
+    // last one (setup / teardown) is neither timed nor counted.
+    class State
+    {
+    public:
+        explicit State(long long iterations)
+            : iterations(iterations), remaining(iterations), started(false), elapsedNs(0), allocs(0), bytes(0)
+        {
+        }
+
+        bool keepRunning()
+        {
+            if (!started)
+            {
+                started = true;
+                allocs = allocationCount().load();
+                bytes = allocationBytes().load();
+                start = Clock::now();
+            }
+            if (remaining-- > 0)
+                return true;
+
+            const Clock::time_point end = Clock::now();
+            elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            allocs = allocationCount().load() - allocs;
+            bytes = allocationBytes().load() - bytes;
+            return false;
+        }
+
+        long long iterationCount() const { return iterations; }
+        long long elapsedNanoseconds() const { return elapsedNs; }
+        unsigned long long allocations() const { return allocs; }
+        unsigned long long allocatedBytes() const { return bytes; }
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+        long long iterations;
+        long long remaining;
+        bool started;
+        Clock::time_point start;
+        long long elapsedNs;
+        unsigned long long allocs;
+        unsigned long long bytes;
+    };
+
+    typedef std::function<void(State &)> Function;
+
+    struct Benchmark
+    {
+        std::string name;
+        Function function;
+    };
+
+    struct Result
+    {
+        std::string name;
+        long long iterations;
+        double nsPerOp;
+        double opsPerSec;
+        double allocsPerOp;
+        double bytesPerOp;
+    };
+
+    struct Options
+    {
+        std::string filter;
+        std::string jsonPath;
+        std::string baselinePath;
+        double minTimeSec;
+        int repetitions;
+        double threshold;
+
+        Options()
+            : minTimeSec(0.2), repetitions(5), threshold(0.10)
+        {
+        }
+    };
+
+    inline std::vector<Benchmark> &registry()
+    {
+        static std::vector<Benchmark> benchmarks;
+        return benchmarks;
+    }
+
+    inline void add(const std::string &name, const Function &function)
+    {
+        const Benchmark b = { name, function };
+        registry().push_back(b);
+    }
+
+    // Grows the iteration count until one run takes minTimeSec, then keeps the median of the repetitions
+    inline Result run(const Benchmark &b, const Options &options)
+    {
+        long long iterations = 1;
+        for (;;)
+        {
+            State state(iterations);
+            b.function(state);
+            const double sec = state.elapsedNanoseconds() * 1e-9;
+            if (sec >= options.minTimeSec || iterations >= (1LL << 40))
+                break;
+            const double scale = (sec <= 0) ? 10.0 : std::min(10.0, std::max(1.5, 1.2 * options.minTimeSec / sec));
+            iterations = static_cast<long long>(std::ceil(iterations * scale));
+        }
+
+        std::vector<Result> samples;
+        for (int r = 0; r < std::max(options.repetitions, 1); r++)
+        {
+            State state(iterations);
+            b.function(state);
+            Result s;
+            s.name = b.name;
+            s.iterations = iterations;
+            s.nsPerOp = static_cast<double>(state.elapsedNanoseconds()) / iterations;
+            s.opsPerSec = (s.nsPerOp > 0) ? 1e9 / s.nsPerOp : 0;
+            s.allocsPerOp = static_cast<double>(state.allocations()) / iterations;
+            s.bytesPerOp = static_cast<double>(state.allocatedBytes()) / iterations;
+            samples.push_back(s);
+        }
+        std::sort(samples.begin(), samples.end(), [](const Result &a, const Result &b) { return a.nsPerOp < b.nsPerOp; });
+        return samples[samples.size() / 2];
+    }
+
+    inline std::string escape(const std::string &s)
+    {
+        std::string ret;
+        for (size_t i = 0; i < s.size(); i++)
+        {
+            if (s[i] == '"' || s[i] == '\\')
+                ret += '\\';
+            ret += s[i];
+        }
+        return ret;
+    }
+
+    // One benchmark per line, so that readBaseline can parse the file without a JSON library
+    inline bool writeJson(const std::string &path, const std::vector<Result> &results, const std::string &context)
+    {
+        std::ofstream ofs(path.c_str());
+        if (!ofs)
+            return false;
+        ofs << "{\n\"context\": " << context << ",\n\"benchmarks\": [\n";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result &r = results[i];
+            char buf[512];
+            snprintf(buf, sizeof(buf),
+                "{\"name\": \"%s\", \"iterations\": %lld, \"ns_per_op\": %.3f, \"ops_per_sec\": %.3f, \"allocs_per_op\": %.3f, \"bytes_per_op\": %.1f}",
+                escape(r.name).c_str(), r.iterations, r.nsPerOp, r.opsPerSec, r.allocsPerOp, r.bytesPerOp);
+            ofs << buf << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        ofs << "]\n}\n";
+        return static_cast<bool>(ofs);
+    }
+
+    inline bool findField(const std::string &line, const char *key, std::string &value)
+    {
+        const std::string pattern = std::string("\"") + key + "\": ";
+        size_t pos = line.find(pattern);
+        if (pos == std::string::npos)
+            return false;
+        pos += pattern.size();
+        if (line[pos] == '"')
+        {
+            value.clear();
+            for (pos++; pos < line.size() && line[pos] != '"'; pos++)
+            {
+                if (line[pos] == '\\' && pos + 1 < line.size())
+                    pos++;
+                value += line[pos];
+            }
+            return true;
+        }
+        const size_t end = line.find_first_of(",}", pos);
+        value = line.substr(pos, end - pos);
+        return true;
+    }
+
+    inline bool readBaseline(const std::string &path, std::vector<Result> &results)
+    {
+        std::ifstream ifs(path.c_str());
+        if (!ifs)
+            return false;
+        std::string line;
+        while (std::getline(ifs, line))
+        {
+            Result r = Result();
+            std::string ns, allocs;
+            if (!findField(line, "name", r.name) || !findField(line, "ns_per_op", ns))
+                continue;
+            r.nsPerOp = atof(ns.c_str());
+            if (findField(line, "allocs_per_op", allocs))
+                r.allocsPerOp = atof(allocs.c_str());
+            results.push_back(r);
+        }
+        return true;
+    }
+
+    // Prints the change of every benchmark found in both runs. Returns the number of regressions:
+    // benchmarks which got slower by more than threshold or allocate more per call.
+    inline int compare(const std::vector<Result> &baseline, const std::vector<Result> &current, double threshold)
+    {
+        int regressions = 0;
+        printf("\n%-40s %14s %14s %9s %11s\n", "benchmark", "baseline ns", "current ns", "change", "allocs");
+        for (size_t i = 0; i < current.size(); i++)
+        {
+            const Result &c = current[i];
+            const Result *b = NULL;
+            for (size_t j = 0; j < baseline.size(); j++)
+            {
+                if (baseline[j].name == c.name)
+                    b = &baseline[j];
+            }
+            if (b == NULL)
+            {
+                printf("%-40s %14s %14.1f %9s\n", c.name.c_str(), "-", c.nsPerOp, "new");
+                continue;
+            }
+
+            const double change = (b->nsPerOp > 0) ? c.nsPerOp / b->nsPerOp - 1 : 0;
+            const bool slower = change > threshold;
+            const bool moreAllocs = c.allocsPerOp > b->allocsPerOp + 0.5;
+            if (slower || moreAllocs)
+                regressions++;
+            printf("%-40s %14.1f %14.1f %+8.1f%% %5.1f/%-5.1f%s\n", c.name.c_str(), b->nsPerOp, c.nsPerOp, change * 100,
+                b->allocsPerOp, c.allocsPerOp, (slower || moreAllocs) ? "  REGRESSION" : "");
+        }
+        return regressions;
+    }
+
+    inline int main(int argc, char **argv, const std::string &context)
+    {
+        Options options;
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+            if (arg == "--filter" && hasValue)
+                options.filter = argv[++i];
+            else if (arg == "--json" && hasValue)
+                options.jsonPath = argv[++i];
+            else if (arg == "--baseline" && hasValue)
+                options.baselinePath = argv[++i];
+            else if (arg == "--min-time" && hasValue)
+                options.minTimeSec = atof(argv[++i]);
+            else if (arg == "--repetitions" && hasValue)
+                options.repetitions = atoi(argv[++i]);
+            else if (arg == "--threshold" && hasValue)
+                options.threshold = atof(argv[++i]);
+            else if (arg == "--list")
+            {
+                for (size_t b = 0; b < registry().size(); b++)
+                    printf("%s\n", registry()[b].name.c_str());
+                return 0;
+            }
+            else if (arg == "--data" && hasValue)
+                i++; // handled by the caller
+            else
+            {
+                fprintf(stderr,
+                    "usage: %s [--filter substring] [--json out.json] [--baseline baseline.json] [--threshold 0.10]\n"
+                    "          [--min-time seconds] [--repetitions n] [--data dir] [--list]\n", argv[0]);
+                return 2;
+            }
+        }
+
+        std::vector<Result> results;
+        printf("%-40s %12s %14s %14s %12s\n", "benchmark", "iterations", "ns/op", "ops/s", "allocs/op");
+        for (size_t b = 0; b < registry().size(); b++)
+        {
+            const Benchmark &benchmark = registry()[b];
+            if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos)
+                continue;
+            const Result r = run(benchmark, options);
+            printf("%-40s %12lld %14.1f %14.1f %12.2f\n", r.name.c_str(), r.iterations, r.nsPerOp, r.opsPerSec, r.allocsPerOp);
+            fflush(stdout);
+            results.push_back(r);
+        }
+
+        if (!options.jsonPath.empty() && !writeJson(options.jsonPath, results, context))
+        {
+            fprintf(stderr, "cannot write %s\n", options.jsonPath.c_str());
+            return 2;
+        }
+
+        if (!options.baselinePath.empty())
+        {
+            std::vector<Result> baseline;
+            if (!readBaseline(options.baselinePath, baseline))
+            {
+                fprintf(stderr, "cannot read %s\n", options.baselinePath.c_str());
+                return 2;
+            }
+            const int regressions = compare(baseline, results, options.threshold);
+            printf("\n%d regression(s) (threshold %.0f%%)\n", regressions, options.threshold * 100);
+            return regressions > 0 ? 1 : 0;
+        }
+        return 0;
+    }
+}
+
+#endif
@@ -0,0 +1,352 @@
+// OpenCvSharpExtern_bench: calls the exported functions of OpenCvSharpExtern the way the managed side does
+//
+//   OpenCvSharpExtern_bench [--filter substring] [--json out.json] [--baseline baseline.json] [--threshold 0.10]
+//
+// Allocations are the operator new calls made anywhere in the process during the timed loop
+// (including OpenCvSharpExtern and OpenCV on ELF platforms, where this replacement is global;
+// buffers from cv::fastMalloc are not included).
+
+#include <opencv2/opencv.hpp>
+#include <opencv2/core/core_c.h>
+#include <new>
+#include "../my_types.h"
+#include "bench.h"
+
+#pragma region Allocation counting
+
+namespace bench
+{
+    std::atomic<unsigned long long> &allocationCount()
+    {
+        static std::atomic<unsigned long long> count(0);
+        return count;
+    }
+
+    std::atomic<unsigned long long> &allocationBytes()
+    {
+        static std::atomic<unsigned long long> bytes(0);
+        return bytes;
+    }
+}
+
+static void *countedAlloc(size_t size)
+{
+    bench::allocationCount().fetch_add(1, std::memory_order_relaxed);
+    bench::allocationBytes().fetch_add(size, std::memory_order_relaxed);
+    void *p = malloc(size == 0 ? 1 : size);
+    if (p == NULL)
+        throw std::bad_alloc();
+    return p;
+}
+
+void *operator new(size_t size) { return countedAlloc(size); }
+void *operator new[](size_t size) { return countedAlloc(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+#pragma endregion
+
+#pragma region Exports
+
+extern "C"
+{
+    cv::Mat *core_Mat_new1();
+    cv::Mat *core_Mat_new2(int rows, int cols, int type);
+    cv::Mat *core_Mat_clone(cv::Mat *self);
+    void core_Mat_delete(cv::Mat *self);
+
+    cv::_InputArray *core_InputArray_new_byMat(cv::Mat *mat);
+    void core_InputArray_delete(cv::_InputArray *ia);
+    cv::_OutputArray *core_OutputArray_new_byMat(cv::Mat *mat);
+    void core_OutputArray_delete(cv::_OutputArray *oa);
+
+    std::vector<uchar> *vector_uchar_new1();
+    void vector_uchar_delete(std::vector<uchar> *vector);
+    std::vector<cv::Point2f> *vector_Point2f_new3(cv::Point2f *data, size_t dataLength);
+    void vector_Point2f_delete(std::vector<cv::Point2f> *vector);
+    std::vector<cv::KeyPoint> *vector_KeyPoint_new1();
+    void vector_KeyPoint_delete(std::vector<cv::KeyPoint> *vector);
+    void vector_Vec4i_delete(std::vector<cv::Vec4i> *vector);
+    size_t vector_vector_Point_getSize1(std::vector<std::vector<cv::Point> > *vec);
+    size_t vector_vector_Point_getTotalSize(std::vector<std::vector<cv::Point> > *vec);
+    void vector_vector_Point_copyFlat(std::vector<std::vector<cv::Point> > *vec, cv::Point *data, int *offsets);
+    void vector_vector_Point_delete(std::vector<std::vector<cv::Point> > *vec);
+
+    void core_add(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst, cv::_InputArray *mask, int dtype);
+    void core_multiply(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst, double scale, int dtype);
+
+    int imgcodecs_imencode_vector(const char *ext, cv::_InputArray *img, std::vector<uchar> *buf, int *params, int paramsLength);
+    cv::Mat *imgcodecs_imdecode_vector(uchar *buf, size_t bufLength, int flags);
+
+    void imgproc_GaussianBlur(cv::_InputArray *src, cv::_OutputArray *dst, CvSize ksize, double sigmaX, double sigmaY, int borderType);
+    void imgproc_cvtColor(cv::_InputArray *src, cv::_OutputArray *dst, int code, int dstCn);
+    void imgproc_findContours1_vector(cv::_InputOutputArray *image, std::vector<std::vector<cv::Point> > **contours,
+        std::vector<cv::Vec4i> **hierarchy, int mode, int method, MyCvPoint offset);
+
+    cv::Ptr<cv::ORB> *features2d_ORB_create(int nFeatures, float scaleFactor, int nlevels, int edgeThreshold,
+        int firstLevel, int wtaK, int scoreType, int patchSize);
+    cv::ORB *features2d_Ptr_ORB_get(cv::Ptr<cv::ORB> *ptr);
+    void features2d_Ptr_ORB_delete(cv::Ptr<cv::ORB> *ptr);
+    void features2d_Feature2D_detect_Mat1(cv::Feature2D *detector, cv::Mat *image, std::vector<cv::KeyPoint> *keypoints, cv::Mat *mask);
+
+    cv::dnn::Net *dnn_readNetFromCaffe(const char *prototxt, const char *caffeModel);
+    void dnn_Net_delete(cv::dnn::Net *net);
+    cv::Mat *dnn_blobFromImage(cv::Mat *image, const double scalefactor, const MyCvSize size, const MyCvScalar mean, const int swapRB, const int crop);
+    void dnn_Net_setInput(cv::dnn::Net *net, const cv::Mat *blob, const char *name);
+    cv::Mat *dnn_Net_forward1(cv::dnn::Net *net, const char *outputName);
+}
+
+#pragma endregion
+
+#pragma region Benchmarks
+
+// Inputs shared by the benchmarks: a 640x480 BGR image with some structure, so that codecs,
+// contours and features do realistic work
+struct Fixture
+{
+    cv::Mat bgr, gray, binary, f32a, f32b;
+
+    Fixture()
+    {
+        bgr.create(480, 640, CV_8UC3);
+        cv::RNG rng(0);
+        rng.fill(bgr, cv::RNG::UNIFORM, 0, 64);
+        for (int i = 0; i < 60; i++)
+        {
+            const cv::Point center(rng.uniform(0, 640), rng.uniform(0, 480));
+            cv::circle(bgr, center, rng.uniform(5, 60), cv::Scalar(rng.uniform(64, 256), rng.uniform(64, 256), rng.uniform(64, 256)), -1);
+        }
+        cv::cvtColor(bgr, gray, cv::COLOR_BGR2GRAY);
+        cv::threshold(gray, binary, 100, 255, cv::THRESH_BINARY);
+        gray.convertTo(f32a, CV_32F, 1 / 255.0);
+        f32b = f32a.clone();
+    }
+};
+
+static void registerBenchmarks(Fixture &f, const std::string &dataDir)
+{
+    using bench::State;
+
+    // Mat lifecycle
+
+    bench::add("mat/new1_delete", [](State &state)
+    {
+        while (state.keepRunning())
+            core_Mat_delete(core_Mat_new1());
+    });
+    bench::add("mat/new2_delete_640x480x3", [](State &state)
+    {
+        while (state.keepRunning())
+            core_Mat_delete(core_Mat_new2(480, 640, CV_8UC3));
+    });
+    bench::add("mat/clone_640x480x3", [&f](State &state)
+    {
+        while (state.keepRunning())
+            core_Mat_delete(core_Mat_clone(&f.bgr));
+    });
+
+    // _InputArray / _OutputArray construction (one of each per argument of most wrapped functions)
+
+    bench::add("array/InputArray_new_byMat_delete", [&f](State &state)
+    {
+        while (state.keepRunning())
+            core_InputArray_delete(core_InputArray_new_byMat(&f.bgr));
+    });
+    bench::add("array/OutputArray_new_byMat_delete", [&f](State &state)
+    {
+        while (state.keepRunning())
+            core_OutputArray_delete(core_OutputArray_new_byMat(&f.bgr));
+    });
+
+    // vector marshalling
+
+    bench::add("vector/Point2f_new3_1000", [](State &state)
+    {
+        std::vector<cv::Point2f> points(1000, cv::Point2f(1, 2));
+        while (state.keepRunning())
+            vector_Point2f_delete(vector_Point2f_new3(&points[0], points.size()));
+    });
+    bench::add("vector/vector_Point_copyFlat", [&f](State &state)
+    {
+        std::vector<std::vector<cv::Point> > *contours = NULL;
+        std::vector<cv::Vec4i> *hierarchy = NULL;
+        cv::Mat image = f.binary.clone();
+        cv::_InputOutputArray io(image);
+        const MyCvPoint offset = { 0, 0 };
+        imgproc_findContours1_vector(&io, &contours, &hierarchy, cv::RETR_LIST, cv::CHAIN_APPROX_NONE, offset);
+        std::vector<cv::Point> data(vector_vector_Point_getTotalSize(contours));
+        std::vector<int> offsets(vector_vector_Point_getSize1(contours) + 1);
+        while (state.keepRunning())
+            vector_vector_Point_copyFlat(contours, data.data(), &offsets[0]);
+        vector_vector_Point_delete(contours);
+        vector_Vec4i_delete(hierarchy);
+    });
+
+    // imgcodecs
+
+    bench::add("imgcodecs/imencode_png_640x480x3", [&f](State &state)
+    {
+        cv::_InputArray *img = core_InputArray_new_byMat(&f.bgr);
+        while (state.keepRunning())
+        {
+            std::vector<uchar> *buf = vector_uchar_new1();
+            imgcodecs_imencode_vector(".png", img, buf, NULL, 0);
+            vector_uchar_delete(buf);
+        }
+        core_InputArray_delete(img);
+    });
+    bench::add("imgcodecs/imencode_jpg_640x480x3", [&f](State &state)
+    {
+        cv::_InputArray *img = core_InputArray_new_byMat(&f.bgr);
+        int params[] = { cv::IMWRITE_JPEG_QUALITY, 90 };
+        while (state.keepRunning())
+        {
+            std::vector<uchar> *buf = vector_uchar_new1();
+            imgcodecs_imencode_vector(".jpg", img, buf, params, 2);
+            vector_uchar_delete(buf);
+        }
+        core_InputArray_delete(img);
+    });
+    bench::add("imgcodecs/imdecode_png_640x480x3", [&f](State &state)
+    {
+        std::vector<uchar> png;
+        cv::imencode(".png", f.bgr, png);
+        while (state.keepRunning())
+            core_Mat_delete(imgcodecs_imdecode_vector(&png[0], png.size(), cv::IMREAD_COLOR));
+    });
+
+    // core arithmetic (argument wrappers are created per call, as Cv2.Add does)
+
+    bench::add("core/add_640x480x3", [&f](State &state)
+    {
+        cv::Mat dst;
+        while (state.keepRunning())
+        {
+            cv::_InputArray *src1 = core_InputArray_new_byMat(&f.bgr);
+            cv::_InputArray *src2 = core_InputArray_new_byMat(&f.bgr);
+            cv::_OutputArray *out = core_OutputArray_new_byMat(&dst);
+            core_add(src1, src2, out, NULL, -1);
+            core_OutputArray_delete(out);
+            core_InputArray_delete(src2);
+            core_InputArray_delete(src1);
+        }
+    });
+    bench::add("core/multiply_640x480_32f", [&f](State &state)
+    {
+        cv::Mat dst;
+        while (state.keepRunning())
+        {
+            cv::_InputArray *src1 = core_InputArray_new_byMat(&f.f32a);
+            cv::_InputArray *src2 = core_InputArray_new_byMat(&f.f32b);
+            cv::_OutputArray *out = core_OutputArray_new_byMat(&dst);
+            core_multiply(src1, src2, out, 1, -1);
+            core_OutputArray_delete(out);
+            core_InputArray_delete(src2);
+            core_InputArray_delete(src1);
+        }
+    });
+
+    // imgproc
+
+    bench::add("imgproc/GaussianBlur_5x5_640x480x3", [&f](State &state)
+    {
+        cv::Mat dst;
+        const CvSize ksize = { 5, 5 };
+        while (state.keepRunning())
+        {
+            cv::_InputArray *src = core_InputArray_new_byMat(&f.bgr);
+            cv::_OutputArray *out = core_OutputArray_new_byMat(&dst);
+            imgproc_GaussianBlur(src, out, ksize, 0, 0, cv::BORDER_DEFAULT);
+            core_OutputArray_delete(out);
+            core_InputArray_delete(src);
+        }
+    });
+    bench::add("imgproc/cvtColor_BGR2GRAY_640x480", [&f](State &state)
+    {
+        cv::Mat dst;
+        while (state.keepRunning())
+        {
+            cv::_InputArray *src = core_InputArray_new_byMat(&f.bgr);
+            cv::_OutputArray *out = core_OutputArray_new_byMat(&dst);
+            imgproc_cvtColor(src, out, cv::COLOR_BGR2GRAY, 0);
+            core_OutputArray_delete(out);
+            core_InputArray_delete(src);
+        }
+    });
+    bench::add("imgproc/findContours_640x480", [&f](State &state)
+    {
+        cv::Mat image = f.binary.clone();
+        cv::_InputOutputArray io(image);
+        const MyCvPoint offset = { 0, 0 };
+        while (state.keepRunning())
+        {
+            std::vector<std::vector<cv::Point> > *contours = NULL;
+            std::vector<cv::Vec4i> *hierarchy = NULL;
+            imgproc_findContours1_vector(&io, &contours, &hierarchy, cv::RETR_LIST, cv::CHAIN_APPROX_SIMPLE, offset);
+            vector_vector_Point_delete(contours);
+            vector_Vec4i_delete(hierarchy);
+        }
+    });
+
+    // features2d
+
+    bench::add("features2d/ORB_detect_640x480", [&f](State &state)
+    {
+        cv::Ptr<cv::ORB> *orb = features2d_ORB_create(500, 1.2f, 8, 31, 0, 2, cv::ORB::HARRIS_SCORE, 31);
+        while (state.keepRunning())
+        {
+            std::vector<cv::KeyPoint> *keypoints = vector_KeyPoint_new1();
+            features2d_Feature2D_detect_Mat1(features2d_Ptr_ORB_get(orb), &f.gray, keypoints, NULL);
+            vector_KeyPoint_delete(keypoints);
+        }
+        features2d_Ptr_ORB_delete(orb);
+    });
+
+    // dnn
+
+    const std::string prototxt = dataDir + "/tiny.prototxt";
+    bench::add("dnn/forward_tiny_32x32", [&f, prototxt](State &state)
+    {
+        cv::dnn::Net *net = dnn_readNetFromCaffe(prototxt.c_str(), NULL);
+        const MyCvSize size = { 32, 32 };
+        const MyCvScalar mean = { { 0, 0, 0, 0 } };
+        while (state.keepRunning())
+        {
+            cv::Mat *blob = dnn_blobFromImage(&f.bgr, 1 / 255.0, size, mean, 0, 0);
+            dnn_Net_setInput(net, blob, "");
+            core_Mat_delete(dnn_Net_forward1(net, NULL));
+            core_Mat_delete(blob);
+        }
+        dnn_Net_delete(net);
+    });
+}
+
+#pragma endregion
+
+int main(int argc, char **argv)
+{
+    std::string dataDir = OPENCVSHARP_BENCH_DATA_DIR;
+    for (int i = 1; i + 1 < argc; i++)
+    {
+        if (std::string(argv[i]) == "--data")
+            dataDir = argv[i + 1];
+    }
+
+    try
+    {
+        Fixture fixture;
+        registerBenchmarks(fixture, dataDir);
+
+        std::stringstream context;
+        context << "{\"opencv\": \"" << CV_VERSION << "\", \"threads\": " << cv::getNumThreads()
+                << ", \"simd\": \"" << bench::escape(cv::getCPUFeaturesLine()) << "\"}";
+        return bench::main(argc, argv, context.str());
+    }
+    catch (const std::exception &ex)
+    {
+        fprintf(stderr, "%s\n", ex.what());
+        return 2;
+    }
+}
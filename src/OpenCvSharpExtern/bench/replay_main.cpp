@@ -0,0 +1,375 @@
+// OpenCvSharpExtern_replay: re-executes a call log written by core_CallRecorder_start (my_recorder.h)
+//
+//   OpenCvSharpExtern_replay calls.log [--repeat n] [--json out.json] [--baseline baseline.json] [--threshold 0.10]
+//
+// Each recorded call is made again through the same export with the recorded scalars and input arrays
+// (or noise of the recorded shape when only hashes were recorded). Only the export call is timed.
+// The JSON output uses the format of OpenCvSharpExtern_bench, one entry per export, so two builds can be
+// compared on the same call stream with --baseline.
+
+#include <opencv2/opencv.hpp>
+#include <opencv2/core/core_c.h>
+#include <list>
+#include <map>
+#include "../my_types.h"
+#include "../my_recorder.h"
+#include "bench.h"
+
+#pragma region Exports
+
+extern "C"
+{
+    void core_Mat_delete(cv::Mat *self);
+    cv::_InputArray *core_InputArray_new_byMat(cv::Mat *mat);
+    void core_InputArray_delete(cv::_InputArray *ia);
+    cv::_OutputArray *core_OutputArray_new_byMat(cv::Mat *mat);
+    void core_OutputArray_delete(cv::_OutputArray *oa);
+    std::vector<uchar> *vector_uchar_new1();
+    void vector_uchar_delete(std::vector<uchar> *vector);
+
+    void core_add(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst, cv::_InputArray *mask, int dtype);
+    void core_subtract_InputArray2(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst, cv::_InputArray *mask, int dtype);
+    void core_multiply(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst, double scale, int dtype);
+
+    void imgproc_medianBlur(cv::_InputArray *src, cv::_OutputArray *dst, int ksize);
+    void imgproc_GaussianBlur(cv::_InputArray *src, cv::_OutputArray *dst, CvSize ksize, double sigmaX, double sigmaY, int borderType);
+    void imgproc_Canny(cv::_InputArray *src, cv::_OutputArray *edges, double threshold1, double threshold2, int apertureSize, int L2gradient);
+    void imgproc_resize(cv::_InputArray *src, cv::_OutputArray *dst, CvSize dsize, double fx, double fy, int interpolation);
+    void imgproc_warpAffine(cv::_InputArray *src, cv::_OutputArray *dst, cv::_InputArray *M, CvSize dsize,
+        int flags, int borderMode, CvScalar borderValue);
+    double imgproc_threshold(cv::_InputArray *src, cv::_OutputArray *dst, double thresh, double maxval, int type);
+    void imgproc_cvtColor(cv::_InputArray *src, cv::_OutputArray *dst, int code, int dstCn);
+
+    cv::Mat *imgcodecs_imdecode_vector(uchar *buf, size_t bufLength, int flags);
+    int imgcodecs_imencode_vector(const char *ext, cv::_InputArray *img, std::vector<uchar> *buf, int *params, int paramsLength);
+}
+
+#pragma endregion
+
+#pragma region Replay
+
+typedef CallLogReader::Call Call;
+typedef CallLogReader::Argument Argument;
+
+// Input and output arrays of one replayed call, wrapped the way the managed side wraps them
+class Arrays
+{
+public:
+    ~Arrays()
+    {
+        for (size_t i = 0; i < inputs.size(); i++)
+            core_InputArray_delete(inputs[i]);
+        for (size_t i = 0; i < outputs.size(); i++)
+            core_OutputArray_delete(outputs[i]);
+    }
+
+    cv::_InputArray *in(const Argument &arg)
+    {
+        if (arg.tag == 'n')
+            return NULL;
+        mats.push_back(CallLogReader::toMat(arg));
+        inputs.push_back(core_InputArray_new_byMat(&mats.back()));
+        return inputs.back();
+    }
+
+    cv::_OutputArray *out()
+    {
+        mats.push_back(cv::Mat());
+        outputs.push_back(core_OutputArray_new_byMat(&mats.back()));
+        return outputs.back();
+    }
+
+private:
+    std::list<cv::Mat> mats; // stable addresses
+    std::vector<cv::_InputArray*> inputs;
+    std::vector<cv::_OutputArray*> outputs;
+};
+
+static CvSize recordedSize(const Argument &width, const Argument &height)
+{
+    CvSize size;
+    size.width = width.i;
+    size.height = height.i;
+    return size;
+}
+
+// Makes the call; returns the time spent in the export [ns]
+typedef int64 (*ReplayFunction)(const Call &call);
+
+struct Replayer
+{
+    ReplayFunction function;
+    size_t argc;
+};
+
+#define TIMED(expr) \
+    const int64 start = RecordedCall::now(); \
+    expr; \
+    return RecordedCall::now() - start;
+
+static int64 replayAdd(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src1 = a.in(c.args[0]), *src2 = a.in(c.args[1]), *mask = a.in(c.args[2]);
+    cv::_OutputArray *dst = a.out();
+    TIMED(core_add(src1, src2, dst, mask, c.args[3].i))
+}
+
+static int64 replaySubtract(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src1 = a.in(c.args[0]), *src2 = a.in(c.args[1]), *mask = a.in(c.args[2]);
+    cv::_OutputArray *dst = a.out();
+    TIMED(core_subtract_InputArray2(src1, src2, dst, mask, c.args[3].i))
+}
+
+static int64 replayMultiply(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src1 = a.in(c.args[0]), *src2 = a.in(c.args[1]);
+    cv::_OutputArray *dst = a.out();
+    TIMED(core_multiply(src1, src2, dst, c.args[2].d, c.args[3].i))
+}
+
+static int64 replayMedianBlur(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src = a.in(c.args[0]);
+    cv::_OutputArray *dst = a.out();
+    TIMED(imgproc_medianBlur(src, dst, c.args[1].i))
+}
+
+static int64 replayGaussianBlur(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src = a.in(c.args[0]);
+    cv::_OutputArray *dst = a.out();
+    TIMED(imgproc_GaussianBlur(src, dst, recordedSize(c.args[1], c.args[2]), c.args[3].d, c.args[4].d, c.args[5].i))
+}
+
+static int64 replayCanny(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src = a.in(c.args[0]);
+    cv::_OutputArray *dst = a.out();
+    TIMED(imgproc_Canny(src, dst, c.args[1].d, c.args[2].d, c.args[3].i, c.args[4].i))
+}
+
+static int64 replayResize(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src = a.in(c.args[0]);
+    cv::_OutputArray *dst = a.out();
+    TIMED(imgproc_resize(src, dst, recordedSize(c.args[1], c.args[2]), c.args[3].d, c.args[4].d, c.args[5].i))
+}
+
+static int64 replayWarpAffine(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src = a.in(c.args[0]), *m = a.in(c.args[1]);
+    cv::_OutputArray *dst = a.out();
+    CvScalar borderValue;
+    for (int i = 0; i < 4; i++)
+        borderValue.val[i] = c.args[6 + i].d;
+    TIMED(imgproc_warpAffine(src, dst, m, recordedSize(c.args[2], c.args[3]), c.args[4].i, c.args[5].i, borderValue))
+}
+
+static int64 replayThreshold(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src = a.in(c.args[0]);
+    cv::_OutputArray *dst = a.out();
+    TIMED(imgproc_threshold(src, dst, c.args[1].d, c.args[2].d, c.args[3].i))
+}
+
+static int64 replayCvtColor(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *src = a.in(c.args[0]);
+    cv::_OutputArray *dst = a.out();
+    TIMED(imgproc_cvtColor(src, dst, c.args[1].i, c.args[2].i))
+}
+
+static int64 replayImdecode(const Call &c)
+{
+    std::vector<uchar> buf(c.args[0].bytes);
+    const int64 start = RecordedCall::now();
+    cv::Mat *m = imgcodecs_imdecode_vector(buf.empty() ? NULL : &buf[0], buf.size(), c.args[1].i);
+    const int64 elapsed = RecordedCall::now() - start;
+    core_Mat_delete(m);
+    return elapsed;
+}
+
+static int64 replayImencode(const Call &c)
+{
+    Arrays a;
+    cv::_InputArray *img = a.in(c.args[1]);
+    std::vector<int> params(c.args[2].ints);
+    std::vector<uchar> *buf = vector_uchar_new1();
+    const int64 start = RecordedCall::now();
+    imgcodecs_imencode_vector(c.args[0].s.c_str(), img, buf, params.empty() ? NULL : &params[0], static_cast<int>(params.size()));
+    const int64 elapsed = RecordedCall::now() - start;
+    vector_uchar_delete(buf);
+    return elapsed;
+}
+
+static std::map<std::string, Replayer> replayers()
+{
+    std::map<std::string, Replayer> m;
+    const Replayer add = { replayAdd, 4 }, subtract = { replaySubtract, 4 }, multiply = { replayMultiply, 4 },
+        medianBlur = { replayMedianBlur, 2 }, gaussianBlur = { replayGaussianBlur, 6 }, canny = { replayCanny, 5 },
+        resize = { replayResize, 6 }, warpAffine = { replayWarpAffine, 10 }, threshold = { replayThreshold, 4 },
+        cvtColor = { replayCvtColor, 3 }, imdecode = { replayImdecode, 2 }, imencode = { replayImencode, 3 };
+    m["core_add"] = add;
+    m["core_subtract_InputArray2"] = subtract;
+    m["core_multiply"] = multiply;
+    m["imgproc_medianBlur"] = medianBlur;
+    m["imgproc_GaussianBlur"] = gaussianBlur;
+    m["imgproc_Canny"] = canny;
+    m["imgproc_resize"] = resize;
+    m["imgproc_warpAffine"] = warpAffine;
+    m["imgproc_threshold"] = threshold;
+    m["imgproc_cvtColor"] = cvtColor;
+    m["imgcodecs_imdecode_vector"] = imdecode;
+    m["imgcodecs_imencode_vector"] = imencode;
+    return m;
+}
+
+#pragma endregion
+
+// operator new is not counted by the replayer
+namespace bench
+{
+    std::atomic<unsigned long long> &allocationCount()
+    {
+        static std::atomic<unsigned long long> count(0);
+        return count;
+    }
+
+    std::atomic<unsigned long long> &allocationBytes()
+    {
+        static std::atomic<unsigned long long> bytes(0);
+        return bytes;
+    }
+}
+
+struct Totals
+{
+    long long calls;
+    int64 recordedNs;
+    int64 replayedNs;
+
+    Totals()
+        : calls(0), recordedNs(0), replayedNs(0)
+    {
+    }
+};
+
+int main(int argc, char **argv)
+{
+    std::string logPath, jsonPath, baselinePath;
+    int repeat = 1;
+    double threshold = 0.10;
+    bool usage = false;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--repeat" && hasValue)
+            repeat = std::max(1, atoi(argv[++i]));
+        else if (arg == "--json" && hasValue)
+            jsonPath = argv[++i];
+        else if (arg == "--baseline" && hasValue)
+            baselinePath = argv[++i];
+        else if (arg == "--threshold" && hasValue)
+            threshold = atof(argv[++i]);
+        else if (logPath.empty() && arg[0] != '-')
+            logPath = arg;
+        else
+            usage = true;
+    }
+    if (usage || logPath.empty())
+    {
+        fprintf(stderr, "usage: %s calls.log [--repeat n] [--json out.json] [--baseline baseline.json] [--threshold 0.10]\n", argv[0]);
+        return 2;
+    }
+
+    try
+    {
+        const std::map<std::string, Replayer> table = replayers();
+        std::map<std::string, Totals> totals;
+        std::map<std::string, long long> skipped;
+        for (int pass = 0; pass < repeat; pass++)
+        {
+            CallLogReader reader(logPath);
+            Call call;
+            while (reader.next(call))
+            {
+                const std::map<std::string, Replayer>::const_iterator it = table.find(call.name);
+                if (it == table.end() || it->second.argc != call.args.size())
+                {
+                    skipped[call.name]++;
+                    continue;
+                }
+                Totals &t = totals[call.name];
+                t.calls++;
+                t.recordedNs += call.duration;
+                t.replayedNs += it->second.function(call);
+            }
+        }
+
+        std::vector<bench::Result> results;
+        Totals all;
+        printf("%-32s %10s %16s %16s %9s\n", "export", "calls", "recorded ns/call", "replayed ns/call", "ratio");
+        for (std::map<std::string, Totals>::const_iterator it = totals.begin(); it != totals.end(); ++it)
+        {
+            const Totals &t = it->second;
+            all.calls += t.calls;
+            all.recordedNs += t.recordedNs;
+            all.replayedNs += t.replayedNs;
+
+            bench::Result r = bench::Result();
+            r.name = it->first;
+            r.iterations = t.calls;
+            r.nsPerOp = static_cast<double>(t.replayedNs) / t.calls;
+            r.opsPerSec = (r.nsPerOp > 0) ? 1e9 / r.nsPerOp : 0;
+            results.push_back(r);
+            printf("%-32s %10lld %16.1f %16.1f %9.2f\n", r.name.c_str(), t.calls,
+                static_cast<double>(t.recordedNs) / t.calls, r.nsPerOp,
+                t.recordedNs > 0 ? static_cast<double>(t.replayedNs) / t.recordedNs : 0);
+        }
+        printf("\n%lld call(s): %.1f ms recorded, %.1f ms replayed\n", all.calls, all.recordedNs * 1e-6, all.replayedNs * 1e-6);
+        for (std::map<std::string, long long>::const_iterator it = skipped.begin(); it != skipped.end(); ++it)
+            printf("skipped %lld call(s) of %s (no replayer or unexpected arguments)\n", it->second, it->first.c_str());
+
+        if (!jsonPath.empty())
+        {
+            std::stringstream context;
+            context << "{\"log\": \"" << bench::escape(logPath) << "\", \"repeat\": " << repeat
+                    << ", \"opencv\": \"" << CV_VERSION << "\", \"threads\": " << cv::getNumThreads() << "}";
+            if (!bench::writeJson(jsonPath, results, context.str()))
+            {
+                fprintf(stderr, "cannot write %s\n", jsonPath.c_str());
+                return 2;
+            }
+        }
+        if (!baselinePath.empty())
+        {
+            std::vector<bench::Result> baseline;
+            if (!bench::readBaseline(baselinePath, baseline))
+            {
+                fprintf(stderr, "cannot read %s\n", baselinePath.c_str());
+                return 2;
+            }
+            const int regressions = bench::compare(baseline, results, threshold);
+            printf("\n%d regression(s) (threshold %.0f%%)\n", regressions, threshold * 100);
+            return regressions > 0 ? 1 : 0;
+        }
+        return 0;
+    }
+    catch (const std::exception &ex)
+    {
+        fprintf(stderr, "%s\n", ex.what());
+        return 2;
+    }
+}
@@ -11,11 +11,11 @@ CVAPI(cv::Ptr<BackgroundSubtractorMOG>*) bgsegm_createBackgroundSubtractorMOG(
     int history, int nmixtures,    double backgroundRatio, double noiseSigma)
 {
     cv::Ptr<BackgroundSubtractorMOG> ptr = createBackgroundSubtractorMOG(history, nmixtures, backgroundRatio, noiseSigma);
-    return new cv::Ptr<BackgroundSubtractorMOG>(ptr);
+    return trackHandle(new cv::Ptr<BackgroundSubtractorMOG>(ptr));
 }
 CVAPI(void) bgsegm_Ptr_BackgroundSubtractorMOG_delete(cv::Ptr<BackgroundSubtractorMOG> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(BackgroundSubtractorMOG*) bgsegm_Ptr_BackgroundSubtractorMOG_get(
@@ -68,11 +68,11 @@ CVAPI(cv::Ptr<BackgroundSubtractorGMG>*) bgsegm_createBackgroundSubtractorGMG(
     int initializationFrames, double decisionThreshold)
 {
     cv::Ptr<BackgroundSubtractorGMG> ptr = createBackgroundSubtractorGMG(initializationFrames, decisionThreshold);
-    return new cv::Ptr<BackgroundSubtractorGMG>(ptr);
+    return trackHandle(new cv::Ptr<BackgroundSubtractorGMG>(ptr));
 }
 CVAPI(void) bgsegm_Ptr_BackgroundSubtractorGMG_delete(cv::Ptr<BackgroundSubtractorGMG> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(BackgroundSubtractorGMG*) bgsegm_Ptr_BackgroundSubtractorGMG_get(
@@ -28,7 +28,7 @@ CVAPI(cv::Mat*) calib3d_findHomography_InputArray(cv::_InputArray *srcPoints, cv
     int method, double ransacReprojThreshold, cv::_OutputArray *mask)
 {
     cv::Mat ret = cv::findHomography(*srcPoints, *dstPoints, method, ransacReprojThreshold, entity(mask));
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 CVAPI(cv::Mat*) calib3d_findHomography_vector(cv::Point2d *srcPoints, int srcPointsLength,
     cv::Point2d *dstPoints, int dstPointsLength,
@@ -38,7 +38,7 @@ CVAPI(cv::Mat*) calib3d_findHomography_vector(cv::Point2d *srcPoints, int srcPoi
     cv::Mat dstPointsMat(dstPointsLength, 1, CV_64FC2, dstPoints);
 
     cv::Mat ret = cv::findHomography(srcPointsMat, dstPointsMat, method, ransacReprojThreshold, entity(mask));
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(void) calib3d_RQDecomp3x3_InputArray(cv::_InputArray *src, cv::_OutputArray *mtxR, cv::_OutputArray *mtxQ,
@@ -188,7 +188,7 @@ CVAPI(cv::Mat*) calib3d_initCameraMatrix2D_Mat(cv::Mat **objectPoints, int objec
         imagePointsVec[i] = *imagePoints[i];
 
     cv::Mat ret = cv::initCameraMatrix2D(objectPointsVec, imagePointsVec, cpp(imageSize), aspectRatio);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 CVAPI(cv::Mat*) calib3d_initCameraMatrix2D_array(cv::Point3d **objectPoints, int opSize1, int *opSize2,
     cv::Point2d **imagePoints, int ipSize1, int *ipSize2, MyCvSize imageSize, double aspectRatio)
@@ -201,7 +201,7 @@ CVAPI(cv::Mat*) calib3d_initCameraMatrix2D_array(cv::Point3d **objectPoints, int
         imagePointsVec[i] = std::vector<cv::Point3d>(imagePoints[i], imagePoints[i] + ipSize2[i]);
 
     cv::Mat ret = cv::initCameraMatrix2D(objectPointsVec, imagePointsVec, cpp(imageSize), aspectRatio);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(int) calib3d_findChessboardCorners_InputArray(cv::_InputArray *image, MyCvSize patternSize,
@@ -523,7 +523,7 @@ CVAPI(cv::Mat*) calib3d_getOptimalNewCameraMatrix_InputArray(
     cv::Mat mat = cv::getOptimalNewCameraMatrix(*cameraMatrix, entity(distCoeffs),
         cpp(imageSize), alpha, cpp(newImgSize), &_validPixROI, centerPrincipalPoint != 0);
     *validPixROI = c(_validPixROI);
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 CVAPI(cv::Mat*) calib3d_getOptimalNewCameraMatrix_array(
     double *cameraMatrix,
@@ -538,7 +538,7 @@ CVAPI(cv::Mat*) calib3d_getOptimalNewCameraMatrix_array(
     cv::Mat mat = cv::getOptimalNewCameraMatrix(cameraMatrixM, distCoeffsM, cpp(imageSize),
         alpha, cpp(newImgSize), &_validPixROI, centerPrincipalPoint != 0);
     *validPixROI = c(_validPixROI);
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 
 CVAPI(void) calib3d_convertPointsToHomogeneous_InputArray(cv::_InputArray *src, cv::_OutputArray *dst)
@@ -587,7 +587,7 @@ CVAPI(cv::Mat*) calib3d_findFundamentalMat_InputArray(
 {
     cv::Mat mat = cv::findFundamentalMat(
         *points1, *points2, method, param1, param2, entity(mask));
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 CVAPI(cv::Mat*) calib3d_findFundamentalMat_array(
     cv::Point2d *points1, int points1Size,
@@ -599,7 +599,7 @@ CVAPI(cv::Mat*) calib3d_findFundamentalMat_array(
     cv::Mat points2M(points2Size, 1, CV_64FC2, points2);
     cv::Mat mat = cv::findFundamentalMat(
         points1M, points2M, method, param1, param2, entity(mask));
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 
 CVAPI(void) calib3d_computeCorrespondEpilines_InputArray(
@@ -730,7 +730,7 @@ CVAPI(cv::Mat*) calib3d_estimateAffine2D(
 {
     const cv::Mat result = cv::estimateAffine2D(
         *from, *to, entity(inliers), method, ransacReprojThreshold, static_cast<size_t>(maxIters), confidence, static_cast<size_t>(refineIters));
-    return new cv::Mat(result);
+    return trackHandle(new cv::Mat(result));
 }
 
 CVAPI(cv::Mat*) calib3d_estimateAffinePartial2D(
@@ -740,7 +740,7 @@ CVAPI(cv::Mat*) calib3d_estimateAffinePartial2D(
 {
     const cv::Mat result = cv::estimateAffinePartial2D(
         *from, *to, entity(inliers), method, ransacReprojThreshold, static_cast<size_t>(maxIters), confidence, static_cast<size_t>(refineIters));
-    return new cv::Mat(result);
+    return trackHandle(new cv::Mat(result));
 }
 
 CVAPI(int) calib3d_decomposeHomographyMat(
@@ -792,7 +792,7 @@ CVAPI(cv::Mat*) calib3d_getDefaultNewCameraMatrix(
     cv::_InputArray *cameraMatrix, MyCvSize imgsize, int centerPrincipalPoint)
 {
     const cv::Mat result = cv::getDefaultNewCameraMatrix(*cameraMatrix, cpp(imgsize), centerPrincipalPoint != 0);
-    return new cv::Mat(result);
+    return trackHandle(new cv::Mat(result));
 }
 
 CVAPI(void) calib3d_undistortPoints(cv::_InputArray *src, cv::_OutputArray *dst,
@@ -837,7 +837,7 @@ CVAPI(cv::Mat*) calib3d_findEssentialMat_InputArray1(
 {
 	cv::Mat mat = cv::findEssentialMat(
 		*points1, *points2, *cameraMatrix, method, prob, threshold, entity(mask));
-	return new cv::Mat(mat);
+	return trackHandle(new cv::Mat(mat));
 }
 CVAPI(cv::Mat*) calib3d_findEssentialMat_InputArray2(
 	cv::_InputArray *points1, cv::_InputArray *points2, double focal, cv::Point2d* pp,
@@ -846,7 +846,7 @@ CVAPI(cv::Mat*) calib3d_findEssentialMat_InputArray2(
 {
 	cv::Mat mat = cv::findEssentialMat(
 		*points1, *points2, focal, *pp, method, prob, threshold, entity(mask));
-	return new cv::Mat(mat);
+	return trackHandle(new cv::Mat(mat));
 }
 
 #endif
\ No newline at end of file
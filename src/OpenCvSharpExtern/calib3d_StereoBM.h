@@ -11,13 +11,13 @@ CVAPI(cv::StereoBM*) calib3d_Ptr_StereoBM_get(
 
 CVAPI(void) calib3d_Ptr_StereoBM_delete(cv::Ptr<cv::StereoBM> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::Ptr<cv::StereoBM>*) calib3d_StereoBM_create(int numDisparities, int blockSize)
 {
     cv::Ptr<cv::StereoBM> obj = cv::StereoBM::create(numDisparities, blockSize);
-    return new cv::Ptr<cv::StereoBM>(obj);
+    return trackHandle(new cv::Ptr<cv::StereoBM>(obj));
 }
 
 CVAPI(int) calib3d_StereoBM_getPreFilterType(cv::Ptr<cv::StereoBM> *obj)
@@ -10,6 +10,20 @@ CVAPI(void) calib3d_StereoMatcher_compute(
     (*obj)->compute(*left, *right, *disparity);
 }
 
+// The job shares the matcher; do not change its parameters while the job is running
+CVAPI(cv::Ptr<NativeJob>*) calib3d_StereoMatcher_compute_job(
+    cv::Ptr<cv::StereoMatcher> *obj, cv::_InputArray *left, cv::_InputArray *right)
+{
+    const cv::Ptr<cv::StereoMatcher> matcher = *obj;
+    const cv::Mat leftMat = NativeJob::retain(left->getMat());
+    const cv::Mat rightMat = NativeJob::retain(right->getMat());
+    return newJob("calib3d_StereoMatcher_compute", [=](NativeJob &job)
+    {
+        job.results().resize(1);
+        matcher->compute(leftMat, rightMat, job.results()[0]);
+    });
+}
+
 CVAPI(int) calib3d_StereoMatcher_getMinDisparity(cv::Ptr<cv::StereoMatcher> *obj)
 {
     return (*obj)->getMinDisparity();
@@ -11,7 +11,7 @@ CVAPI(cv::StereoSGBM*) calib3d_Ptr_StereoSGBM_get(
 
 CVAPI(void) calib3d_Ptr_StereoSGBM_delete(cv::Ptr<cv::StereoSGBM> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::Ptr<cv::StereoSGBM>*) calib3d_StereoSGBM_create(
@@ -25,7 +25,7 @@ CVAPI(cv::Ptr<cv::StereoSGBM>*) calib3d_StereoSGBM_create(
         P1, P2, disp12MaxDiff,
         preFilterCap, uniquenessRatio,
         speckleWindowSize, speckleRange, mode);
-    return new cv::Ptr<cv::StereoSGBM>(obj);
+    return trackHandle(new cv::Ptr<cv::StereoSGBM>(obj));
 }
 
 CVAPI(int) calib3d_StereoSGBM_getPreFilterCap(cv::Ptr<cv::StereoSGBM> *obj)
@@ -2,14 +2,24 @@
 #include "core.h"
 
 #include "core_Algorithm.h"
+#include "core_ExportProfiler.h"
 #include "core_FileStorage.h"
+#include "core_FrameRing.h"
+#include "core_HeapCounter.h"
 #include "core_FileNode.h"
 #include "core_InputArray.h"
 #include "core_Mat.h"
+#include "core_MatAllocator.h"
 #include "core_MatExpr.h"
+#include "core_MatExprFusion.h"
+#include "core_MatKernel.h"
+#include "core_MatMapped.h"
+#include "core_MatRegion.h"
+#include "core_NativeJob.h"
 #include "core_OutputArray.h"
 #include "core_PCA.h"
 #include "core_RNG.h"
+#include "core_ReleaseQueue.h"
 #include "core_SparseMat.h"
 #include "core_SVD.h"
 #include "core_LDA.h"
\ No newline at end of file
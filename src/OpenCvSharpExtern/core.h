@@ -2,6 +2,7 @@
 #define _CPP_CORE_H_
 
 #include "include_opencv.h"
+#include "core_MatAllocator.h"
 
 #pragma region Miscellaneous
 
@@ -63,6 +64,81 @@ CVAPI(int64) core_getCPUTickCount()
     return cv::getCPUTickCount();
 }
 
+CVAPI(void) core_Trace_start(const char *path, int capacity)
+{
+    CV_Assert(path != NULL && capacity >= 0);
+    NativeTrace::instance()->start(path, static_cast<size_t>(capacity));
+}
+CVAPI(void) core_Trace_stop()
+{
+    NativeTrace::instance()->stop();
+}
+CVAPI(int) core_Trace_flush()
+{
+    return NativeTrace::instance()->flush();
+}
+CVAPI(int) core_Trace_isActive()
+{
+    return NativeTrace::instance()->isActive() ? 1 : 0;
+}
+CVAPI(void) core_Trace_beginRegion(const char *name)
+{
+    NativeTrace::instance()->beginRegion(name);
+}
+CVAPI(void) core_Trace_endRegion()
+{
+    NativeTrace::instance()->endRegion();
+}
+
+CVAPI(int) core_CallRecorder_start(const char *path, int mode)
+{
+    return CallRecorder::instance()->start(path, mode) ? 1 : 0;
+}
+CVAPI(void) core_CallRecorder_stop()
+{
+    CallRecorder::instance()->stop();
+}
+CVAPI(int) core_CallRecorder_isRecording()
+{
+    return CallRecorder::instance()->isRecording() ? 1 : 0;
+}
+CVAPI(uint64) core_CallRecorder_recordedCalls()
+{
+    return CallRecorder::instance()->recordedCalls();
+}
+CVAPI(uint64) core_CallRecorder_recordedBytes()
+{
+    return CallRecorder::instance()->recordedBytes();
+}
+
+CVAPI(int) core_HandleStats_getKindCount()
+{
+    return HANDLE_KIND_COUNT;
+}
+// Returns the number of entries written to stats (indexed by HandleKind)
+CVAPI(int) core_HandleStats_getSnapshot(NativeHandleStats *stats, int count)
+{
+    NativeHandleStats all[HANDLE_KIND_COUNT];
+    HandleRegistry::instance()->snapshot(all);
+    CountingMatAllocator *counting = CountingMatAllocator::instance();
+    if (counting->isEnabled())
+    {
+        all[HANDLE_MAT].bytes = counting->bytesInUse();
+        all[HANDLE_MAT].bytesTracked = 1;
+    }
+    const int n = std::max(0, std::min(count, static_cast<int>(HANDLE_KIND_COUNT)));
+    std::copy(all, all + n, stats);
+    return n;
+}
+CVAPI(void) core_HandleStats_setTrackBytes(int enabled)
+{
+    CountingMatAllocator::instance()->setEnabled(enabled != 0);
+}
+CVAPI(void) core_HandleStats_resetHighWater()
+{
+    HandleRegistry::instance()->resetHighWater();
+}
+
 CVAPI(int) core_checkHardwareSupport(int feature)
 {
     return cv::checkHardwareSupport(feature) ? 1 : 0;
@@ -113,9 +189,24 @@ CVAPI(int) core_setBreakOnError(int flag)
     return cv::setBreakOnError(flag != 0) ? 1 : 0;
 }
 
+// errCallback is not called for errors inside a NativeErrorScope (see dispatchError)
 CVAPI(cv::ErrorCallback) redirectError(cv::ErrorCallback errCallback, void* userdata, void** prevUserdata)
 {
-    return cv::redirectError(errCallback, userdata, prevUserdata);
+    ErrorRedirection &redirection = errorRedirection();
+    const ErrorRedirection previous = redirection;
+    redirection.callback = errCallback;
+    redirection.userdata = userdata;
+
+    void *prevData = NULL;
+    cv::ErrorCallback prev = cv::redirectError((errCallback != NULL) ? dispatchError : NULL, NULL, &prevData);
+    if (prev == dispatchError)
+    {
+        prev = previous.callback;
+        prevData = previous.userdata;
+    }
+    if (prevUserdata != NULL)
+        *prevUserdata = prevData;
+    return prev;
 }
 
 CVAPI(char*) core_format(cv::_InputArray *mtx, int fmt)
@@ -136,17 +227,33 @@ CVAPI(void) core_char_delete(char *buf)
     delete[] buf;
 }
 
+CVAPI(uint64) core_scratchVectorAllocationCount()
+{
+    return scratchVectorAllocationCount();
+}
+CVAPI(void) core_scratchVectorTrim()
+{
+    ScratchVector<cv::Mat>::trim();
+    ScratchVector<int>::trim();
+}
+
 #pragma endregion
 
 #pragma region Array Operations
 
 CVAPI(void) core_add(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst, cv::_InputArray *mask, int dtype)
 {
+    RecordedCall rec("core_add");
+    if (rec)
+        rec.array(src1).array(src2).array(mask).i32(dtype);
     cv::add(*src1, *src2, *dst, entity(mask), dtype);
 }
 
 CVAPI(void) core_subtract_InputArray2(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst, cv::_InputArray *mask, int dtype)
 {
+    RecordedCall rec("core_subtract_InputArray2");
+    if (rec)
+        rec.array(src1).array(src2).array(mask).i32(dtype);
     cv::subtract(*src1, *src2, *dst, entity(mask), dtype);
 }
 CVAPI(void) core_subtract_InputArrayScalar(cv::_InputArray *src1, MyCvScalar src2, cv::_OutputArray *dst, cv::_InputArray *mask, int dtype)
@@ -162,6 +269,9 @@ CVAPI(void) core_subtract_ScalarInputArray(MyCvScalar src1, cv::_InputArray *src
 
 CVAPI(void) core_multiply(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst, double scale, int dtype)
 {
+    RecordedCall rec("core_multiply");
+    if (rec)
+        rec.array(src1).array(src2).f64(scale).i32(dtype);
     cv::multiply(*src1, *src2, *dst, scale, dtype);
 }
 CVAPI(void) core_divide1(double scale, cv::_InputArray *src2, cv::_OutputArray *dst, int dtype)
@@ -292,27 +402,21 @@ CVAPI(void) core_reduce(cv::_InputArray *src, cv::_OutputArray *dst, int dim, in
 }
 CVAPI(void) core_merge(cv::Mat **mv, uint32 count, cv::Mat *dst)
 {
-    std::vector<cv::Mat> vec((size_t)count);
-    for (uint32 i = 0; i < count; i++)
-        vec[i] = *mv[i];
-    
-    cv::merge(vec, *dst);
+    ScratchVector<cv::Mat> vec;
+    toVec(mv, static_cast<int>(count), *vec);
+    cv::merge(*vec, *dst);
 }
 CVAPI(void) core_split(cv::Mat *src, std::vector<cv::Mat> **mv)
 {
-    *mv = new std::vector<cv::Mat>();
+    *mv = trackHandle(new std::vector<cv::Mat>());
     cv::split(*src, **mv);
 }
 CVAPI(void) core_mixChannels(cv::Mat **src, uint32 nsrcs, cv::Mat **dst, uint32 ndsts, int *fromTo, uint32 npairs)
 {
-    std::vector<cv::Mat> srcVec((size_t)nsrcs);
-    std::vector<cv::Mat> dstVec((size_t)ndsts);
-    for (uint32 i = 0; i < nsrcs; i++)
-        srcVec[i] = *(src[i]);
-    for (uint32 i = 0; i < ndsts; i++)
-        dstVec[i] = *(dst[i]);
-
-    cv::mixChannels(srcVec, dstVec, fromTo, npairs);
+    ScratchVector<cv::Mat> srcVec, dstVec;
+    toVec(src, static_cast<int>(nsrcs), *srcVec);
+    toVec(dst, static_cast<int>(ndsts), *dstVec);
+    cv::mixChannels(*srcVec, *dstVec, fromTo, npairs);
 }
 
 CVAPI(void) core_extractChannel(cv::_InputArray *src, cv::_OutputArray *dst, int coi)
@@ -334,14 +438,13 @@ CVAPI(void) core_repeat1(cv::_InputArray *src, int ny, int nx, cv::_OutputArray
 CVAPI(cv::Mat*) core_repeat2(cv::Mat *src, int ny, int nx)
 {
     cv::Mat ret = cv::repeat(*src, ny, nx);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 CVAPI(void) core_hconcat1(cv::Mat **src, uint32 nsrc, cv::_OutputArray *dst)
 {
-    std::vector<cv::Mat> srcVec((size_t)nsrc);
-    for (uint32 i = 0; i < nsrc; i++)
-        srcVec[i] = *(src[i]);
-    cv::hconcat(&srcVec[0], nsrc, *dst);
+    ScratchVector<cv::Mat> srcVec;
+    toVec(src, static_cast<int>(nsrc), *srcVec);
+    cv::hconcat(srcVec->data(), nsrc, *dst);
 }
 CVAPI(void) core_hconcat2(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst)
 {
@@ -349,10 +452,9 @@ CVAPI(void) core_hconcat2(cv::_InputArray *src1, cv::_InputArray *src2, cv::_Out
 }
 CVAPI(void) core_vconcat1(cv::Mat **src, uint32 nsrc, cv::_OutputArray *dst)
 {
-    std::vector<cv::Mat> srcVec((size_t)nsrc);
-    for (uint32 i = 0; i < nsrc; i++)
-        srcVec[i] = *(src[i]);
-    cv::vconcat(&srcVec[0], nsrc, *dst);
+    ScratchVector<cv::Mat> srcVec;
+    toVec(src, static_cast<int>(nsrc), *srcVec);
+    cv::vconcat(srcVec->data(), nsrc, *dst);
 }
 CVAPI(void) core_vconcat2(cv::_InputArray *src1, cv::_InputArray *src2, cv::_OutputArray *dst)
 {
@@ -0,0 +1,287 @@
+#ifndef _CPP_CORE_EXPORTPROFILER_H_
+#define _CPP_CORE_EXPORTPROFILER_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+
+// Per-export call counters and latency histograms.
+//
+// Built only when OPENCVSHARP_PROFILE_EXPORTS is defined (see CMakeLists.txt) with GCC/Clang on ELF
+// platforms. my_functions.h then places every CVAPI function in the "cvapi_text" section and the
+// library is compiled with -finstrument-functions; the hooks below ignore every function outside that
+// section, so helpers and nested calls are attributed to the export that called them. Inlined OpenCV and
+// standard library code gets no hooks: GCC excludes those headers, Clang instruments after inlining. Without the option nothing is instrumented and the query functions report no data.
+// The same hooks record a span per export while a timeline trace is active (my_trace.h).
+
+#define EXPORT_PROFILER_BUCKETS 32
+#define EXPORT_PROFILER_NAME_LENGTH 128
+
+extern "C"
+{
+    struct ExportProfileEntry
+    {
+        uint64 calls;
+        uint64 totalNs;
+        uint64 maxNs;
+        // histogram[0]: [0, 2) ns, histogram[i]: [2^i, 2^(i+1)) ns, the last bucket is open-ended
+        uint64 histogram[EXPORT_PROFILER_BUCKETS];
+        char name[EXPORT_PROFILER_NAME_LENGTH];
+    };
+}
+
+#ifdef OPENCVSHARP_EXPORT_PROFILING
+
+#include <chrono>
+#include <dlfcn.h>
+
+#define EXPORT_PROFILER_NOINSTR __attribute__((no_instrument_function))
+
+// bounds of the "cvapi_text" section, defined by the linker
+extern "C" char __start_cvapi_text[] __attribute__((visibility("hidden")));
+extern "C" char __stop_cvapi_text[] __attribute__((visibility("hidden")));
+
+class ExportProfiler
+{
+public:
+    // open addressing table keyed by function address; there are ~3000 exports
+    static const int Capacity = 8192;
+    // nesting depth up to which exports calling exports are timed separately
+    static const int MaxDepth = 16;
+
+    struct Slot
+    {
+        std::atomic<const void*> function;
+        std::atomic<uint64> calls;
+        std::atomic<uint64> totalNs;
+        std::atomic<uint64> maxNs;
+        std::atomic<uint64> histogram[EXPORT_PROFILER_BUCKETS];
+    };
+
+    EXPORT_PROFILER_NOINSTR static ExportProfiler *instance()
+    {
+        // never destroyed: exports may still be called during process exit
+        static ExportProfiler *profiler = new ExportProfiler();
+        return profiler;
+    }
+
+    EXPORT_PROFILER_NOINSTR static bool isExport(const void *fn)
+    {
+        const char *p = static_cast<const char*>(fn);
+        return p >= __start_cvapi_text && p < __stop_cvapi_text;
+    }
+
+    EXPORT_PROFILER_NOINSTR static int64 now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    EXPORT_PROFILER_NOINSTR static int bucketOf(uint64 ns)
+    {
+        int bucket = 0;
+        while (ns > 1 && bucket < EXPORT_PROFILER_BUCKETS - 1)
+        {
+            ns >>= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    EXPORT_PROFILER_NOINSTR bool isEnabled() const
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    EXPORT_PROFILER_NOINSTR void setEnabled(bool value)
+    {
+        enabled.store(value);
+    }
+
+    EXPORT_PROFILER_NOINSTR void record(const void *fn, uint64 ns)
+    {
+        Slot *slot = find(fn);
+        if (slot == NULL)
+            return;
+        slot->calls.fetch_add(1, std::memory_order_relaxed);
+        slot->totalNs.fetch_add(ns, std::memory_order_relaxed);
+        slot->histogram[bucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+        uint64 max = slot->maxNs.load(std::memory_order_relaxed);
+        while (ns > max && !slot->maxNs.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    // Copies the exports called since the last reset, most total time first.
+    // Returns the number of such exports, which may exceed capacity.
+    EXPORT_PROFILER_NOINSTR int entries(ExportProfileEntry *dst, int capacity)
+    {
+        std::vector<ExportProfileEntry> result;
+        for (int i = 0; i < Capacity; i++)
+        {
+            const Slot &slot = slots[i];
+            const void *fn = slot.function.load(std::memory_order_acquire);
+            if (fn == NULL || slot.calls.load(std::memory_order_relaxed) == 0)
+                continue;
+
+            ExportProfileEntry e;
+            e.calls = slot.calls.load(std::memory_order_relaxed);
+            e.totalNs = slot.totalNs.load(std::memory_order_relaxed);
+            e.maxNs = slot.maxNs.load(std::memory_order_relaxed);
+            for (int b = 0; b < EXPORT_PROFILER_BUCKETS; b++)
+                e.histogram[b] = slot.histogram[b].load(std::memory_order_relaxed);
+            nameOf(fn, e.name);
+            result.push_back(e);
+        }
+
+        std::sort(result.begin(), result.end(), [](const ExportProfileEntry &a, const ExportProfileEntry &b)
+        {
+            return a.totalNs > b.totalNs;
+        });
+        const int count = static_cast<int>(result.size());
+        if (dst != NULL)
+            std::copy(result.begin(), result.begin() + std::min(count, std::max(capacity, 0)), dst);
+        return count;
+    }
+
+    // Clears the counters. Slots stay assigned to their functions; exports without calls are not reported.
+    EXPORT_PROFILER_NOINSTR void reset()
+    {
+        for (int i = 0; i < Capacity; i++)
+        {
+            Slot &slot = slots[i];
+            slot.calls.store(0, std::memory_order_relaxed);
+            slot.totalNs.store(0, std::memory_order_relaxed);
+            slot.maxNs.store(0, std::memory_order_relaxed);
+            for (int b = 0; b < EXPORT_PROFILER_BUCKETS; b++)
+                slot.histogram[b].store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    std::atomic<bool> enabled;
+    Slot *slots;
+
+    EXPORT_PROFILER_NOINSTR ExportProfiler()
+        : enabled(false), slots(new Slot[Capacity])
+    {
+        reset();
+        for (int i = 0; i < Capacity; i++)
+            slots[i].function.store(NULL, std::memory_order_relaxed);
+    }
+
+    EXPORT_PROFILER_NOINSTR Slot *find(const void *fn)
+    {
+        const size_t hash = (reinterpret_cast<size_t>(fn) >> 4) * 0x9E3779B1u;
+        for (int probe = 0; probe < Capacity; probe++)
+        {
+            Slot &slot = slots[(hash + probe) & (Capacity - 1)];
+            const void *current = slot.function.load(std::memory_order_acquire);
+            if (current == fn)
+                return &slot;
+            if (current == NULL)
+            {
+                if (slot.function.compare_exchange_strong(current, fn, std::memory_order_acq_rel))
+                    return &slot;
+                if (current == fn) // claimed by another thread for the same function
+                    return &slot;
+            }
+        }
+        return NULL; // table full
+    }
+
+    EXPORT_PROFILER_NOINSTR static void nameOf(const void *fn, char *name)
+    {
+        Dl_info info;
+        if (dladdr(fn, &info) != 0 && info.dli_sname != NULL && info.dli_saddr == fn)
+            snprintf(name, EXPORT_PROFILER_NAME_LENGTH, "%s", info.dli_sname);
+        else
+            snprintf(name, EXPORT_PROFILER_NAME_LENGTH, "%p", fn);
+    }
+};
+
+// Start times of the exports being executed on this thread (0: not timed)
+static __thread int exportProfilerDepth = 0;
+static __thread int64 exportProfilerStart[ExportProfiler::MaxDepth];
+
+extern "C" EXPORT_PROFILER_NOINSTR void __cyg_profile_func_enter(void *fn, void *callSite)
+{
+    (void)callSite;
+    if (!ExportProfiler::isExport(fn))
+        return;
+    const int depth = exportProfilerDepth++;
+    if (depth < ExportProfiler::MaxDepth)
+    {
+        const bool timed = ExportProfiler::instance()->isEnabled() || NativeTrace::instance()->isActive();
+        exportProfilerStart[depth] = timed ? ExportProfiler::now() : 0;
+    }
+}
+
+extern "C" EXPORT_PROFILER_NOINSTR void __cyg_profile_func_exit(void *fn, void *callSite)
+{
+    (void)callSite;
+    if (!ExportProfiler::isExport(fn) || exportProfilerDepth == 0)
+        return;
+    const int depth = --exportProfilerDepth;
+    if (depth < ExportProfiler::MaxDepth && exportProfilerStart[depth] != 0)
+    {
+        const int64 start = exportProfilerStart[depth];
+        const int64 end = ExportProfiler::now();
+        ExportProfiler *profiler = ExportProfiler::instance();
+        if (profiler->isEnabled())
+            profiler->record(fn, static_cast<uint64>(std::max<int64>(end - start, 0)));
+        NativeTrace *trace = NativeTrace::instance();
+        if (trace->isActive())
+            trace->complete("api", NULL, fn, start, end);
+    }
+}
+
+#endif
+
+
+CVAPI(int) core_ExportProfiler_isAvailable()
+{
+#ifdef OPENCVSHARP_EXPORT_PROFILING
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+CVAPI(void) core_ExportProfiler_setEnabled(int enabled)
+{
+#ifdef OPENCVSHARP_EXPORT_PROFILING
+    ExportProfiler::instance()->setEnabled(enabled != 0);
+#else
+    (void)enabled;
+#endif
+}
+
+CVAPI(int) core_ExportProfiler_isEnabled()
+{
+#ifdef OPENCVSHARP_EXPORT_PROFILING
+    return ExportProfiler::instance()->isEnabled() ? 1 : 0;
+#else
+    return 0;
+#endif
+}
+
+CVAPI(int) core_ExportProfiler_getEntries(ExportProfileEntry *entries, int capacity)
+{
+#ifdef OPENCVSHARP_EXPORT_PROFILING
+    return ExportProfiler::instance()->entries(entries, capacity);
+#else
+    (void)entries;
+    (void)capacity;
+    return 0;
+#endif
+}
+
+CVAPI(void) core_ExportProfiler_reset()
+{
+#ifdef OPENCVSHARP_EXPORT_PROFILING
+    ExportProfiler::instance()->reset();
+#endif
+}
+
+#endif
@@ -7,19 +7,19 @@
 
 CVAPI(cv::FileStorage*) core_FileStorage_new1()
 {
-    return new cv::FileStorage();
+    return trackHandle(new cv::FileStorage());
 }
 CVAPI(cv::FileStorage*) core_FileStorage_new2(const char *source, int flags, const char *encoding)
 {
     std::string encodingStr;
     if (encoding != NULL)
         encodingStr = std::string(encoding);
-    return new cv::FileStorage(source, flags, encodingStr);
+    return trackHandle(new cv::FileStorage(source, flags, encodingStr));
 }
 
 CVAPI(void) core_FileStorage_delete(cv::FileStorage *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(int) core_FileStorage_open(cv::FileStorage *obj,
@@ -0,0 +1,588 @@
+#ifndef _CPP_CORE_FRAMERING_H_
+#define _CPP_CORE_FRAMERING_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include "core_MatAllocator.h"
+#include <chrono>
+#include <thread>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+extern "C"
+{
+    struct FrameRingFrameInfo
+    {
+        uint64 sequence;   // number of frames written before this one
+        int64 timestamp;   // value passed by the producer
+        int32_t type;
+        int32_t rows;
+        int32_t cols;
+        int32_t reserved;
+        uint64 step;
+        uint64 dropped;    // frames this consumer missed since its previous frame
+    };
+}
+
+// Named shared memory block; stays mapped while the FrameRing or any Mat over one of its slots uses it
+class FrameRingMapping
+{
+public:
+    void *base;
+    size_t length;
+
+    // Fails if a block of that name exists: it may belong to a live producer. A block left behind by a
+    // crashed producer has to be removed explicitly with unlink().
+    static FrameRingMapping *create(const char *name, size_t length)
+    {
+        FrameRingMapping *m = new FrameRingMapping(name, true);
+        bool exists = false;
+#ifdef _WIN32
+        m->handle = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+            static_cast<DWORD>(static_cast<uint64>(length) >> 32), static_cast<DWORD>(length), name);
+        if (m->handle != NULL && GetLastError() == ERROR_ALREADY_EXISTS)
+        {
+            CloseHandle(m->handle);
+            m->handle = NULL;
+            exists = true;
+        }
+        m->base = m->handle == NULL ? NULL : MapViewOfFile(m->handle, FILE_MAP_ALL_ACCESS, 0, 0, length);
+#else
+        const int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+        exists = fd < 0 && errno == EEXIST;
+        if (fd >= 0)
+        {
+            if (ftruncate(fd, static_cast<off_t>(length)) == 0)
+            {
+                void *p = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                m->base = p == MAP_FAILED ? NULL : p;
+            }
+            close(fd);
+        }
+#endif
+        m->length = length;
+        if (exists)
+        {
+            // not ours to remove
+            m->owner = false;
+            return m->check("Shared memory already exists: ");
+        }
+        return m->check("Cannot map shared memory ");
+    }
+
+    static FrameRingMapping *open(const char *name)
+    {
+        FrameRingMapping *m = new FrameRingMapping(name, false);
+#ifdef _WIN32
+        m->handle = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name);
+        m->base = m->handle == NULL ? NULL : MapViewOfFile(m->handle, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+        MEMORY_BASIC_INFORMATION info;
+        if (m->base != NULL && VirtualQuery(m->base, &info, sizeof(info)) != 0)
+            m->length = info.RegionSize;
+#else
+        const int fd = shm_open(name, O_RDWR, 0);
+        struct stat st;
+        if (fd >= 0)
+        {
+            if (fstat(fd, &st) == 0 && st.st_size > 0)
+            {
+                m->length = static_cast<size_t>(st.st_size);
+                void *p = mmap(NULL, m->length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                m->base = p == MAP_FAILED ? NULL : p;
+            }
+            close(fd);
+        }
+#endif
+        return m->check("Cannot map shared memory ");
+    }
+
+    // Removes the name of a block left behind by a producer which did not shut down; processes which
+    // have it mapped keep their mapping. Returns false if there was none. On Windows the block disappears
+    // with the last process using it, so there is nothing to remove.
+    static bool unlink(const char *name)
+    {
+#ifdef _WIN32
+        (void)name;
+        return false;
+#else
+        return shm_unlink(name) == 0;
+#endif
+    }
+
+    void addRef()
+    {
+        ++refCount;
+    }
+
+    void release()
+    {
+        if (--refCount == 0)
+            delete this;
+    }
+
+    // MatReleaseCallback of the slot Mats
+    static void CV_CDECL releaseCallback(void * /*data*/, void *userToken)
+    {
+        static_cast<FrameRingMapping*>(userToken)->release();
+    }
+
+private:
+    std::string name;
+    bool owner;
+    std::atomic<int> refCount;
+#ifdef _WIN32
+    HANDLE handle;
+#endif
+
+    FrameRingMapping(const char *name, bool owner)
+        : base(NULL), length(0), name(name), owner(owner), refCount(1)
+    {
+#ifdef _WIN32
+        handle = NULL;
+#endif
+    }
+
+    ~FrameRingMapping()
+    {
+#ifdef _WIN32
+        if (base != NULL)
+            UnmapViewOfFile(base);
+        if (handle != NULL)
+            CloseHandle(handle);
+#else
+        if (base != NULL)
+            munmap(base, length);
+        if (owner)
+            shm_unlink(name.c_str());
+#endif
+    }
+
+    FrameRingMapping *check(const char *error)
+    {
+        if (base != NULL)
+            return this;
+        const std::string message = error + name;
+        delete this;
+        CV_Error(cv::Error::StsError, message);
+    }
+};
+
+// Ring of fixed-size frame slots in named shared memory, written by one producer process and
+// read by up to MaxConsumers consumers (in any process) without locks.
+//
+// Every slot carries a seqlock-style version (2 * sequence + 1 while the producer writes it,
+// 2 * sequence + 2 once published). Each consumer owns a cursor in the shared header.
+// With POLICY_DROP_OLDEST the producer never waits and overwrites the oldest slot; consumers that
+// fall behind skip ahead (reported as dropped frames) and can call isValid() after processing a
+// zero-copy frame to detect that it was overwritten meanwhile. With POLICY_BLOCK the producer
+// waits until every registered consumer has released the slot it is about to reuse.
+class FrameRing
+{
+public:
+    enum
+    {
+        POLICY_DROP_OLDEST = 0,
+        POLICY_BLOCK = 1,
+        MaxConsumers = 16,
+        SlotHeaderSize = 64,
+    };
+
+    static FrameRing *create(const char *name, int slotCount, uint64 slotBytes, int policy)
+    {
+        CV_Assert(name != NULL && slotCount > 0 && slotBytes > 0);
+        CV_Assert(policy == POLICY_DROP_OLDEST || policy == POLICY_BLOCK);
+        const uint64 slotStride = alignUp(SlotHeaderSize + slotBytes, 64);
+        const uint64 dataOffset = alignUp(sizeof(Shared), 4096);
+        FrameRingMapping *mapping = FrameRingMapping::create(name,
+            static_cast<size_t>(dataOffset + slotStride * slotCount));
+
+        Shared *shared = new(mapping->base) Shared();
+        shared->slotCount = slotCount;
+        shared->policy = policy;
+        shared->slotBytes = slotBytes;
+        shared->slotStride = slotStride;
+        shared->dataOffset = dataOffset;
+        for (int i = 0; i < slotCount; i++)
+            new(slotAt(mapping, shared, i)) Slot();
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(shared->magic, magic(), sizeof(shared->magic));
+        return new FrameRing(mapping, true);
+    }
+
+    static FrameRing *open(const char *name)
+    {
+        CV_Assert(name != NULL);
+        FrameRingMapping *mapping = FrameRingMapping::open(name);
+        const Shared *shared = static_cast<const Shared*>(mapping->base);
+        if (mapping->length < sizeof(Shared) || std::memcmp(shared->magic, magic(), sizeof(shared->magic)) != 0 ||
+            shared->dataOffset + shared->slotStride * shared->slotCount > mapping->length)
+        {
+            mapping->release();
+            CV_Error(cv::Error::StsBadArg, std::string("Not a frame ring: ") + name);
+        }
+        return new FrameRing(mapping, false);
+    }
+
+    ~FrameRing()
+    {
+        if (producer)
+            shared->closed.store(1, std::memory_order_release);
+        mapping->release();
+    }
+
+    int slotCount() const { return shared->slotCount; }
+    uint64 slotBytes() const { return shared->slotBytes; }
+    int policy() const { return shared->policy; }
+    uint64 writeSequence() const { return shared->writeSeq.load(std::memory_order_acquire); }
+    bool isClosed() const { return shared->closed.load(std::memory_order_acquire) != 0; }
+
+    // Producer: waits (POLICY_BLOCK, up to timeoutMs; negative waits forever) until the next slot is free
+    // and points dst at its pixels. The frame becomes visible to consumers on commit().
+    bool beginWrite(int rows, int cols, int type, int timeoutMs, cv::Mat &dst)
+    {
+        CV_Assert(producer && !writing);
+        CV_Assert(rows >= 0 && cols >= 0);
+        const size_t step = static_cast<size_t>(cols) * CV_ELEM_SIZE(type);
+        if (static_cast<uint64>(step) * rows > shared->slotBytes)
+            CV_Error(cv::Error::StsOutOfRange, "Frame does not fit into a ring slot");
+
+        const uint64 seq = shared->writeSeq.load(std::memory_order_relaxed);
+        if (shared->policy == POLICY_BLOCK && !waitFor(timeoutMs, [&] { return slowestConsumer(seq) + shared->slotCount > seq; }))
+            return false;
+
+        Slot *slot = slotAt(mapping, shared, static_cast<int>(seq % shared->slotCount));
+        slot->version.store(2 * seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot->type = type;
+        slot->rows = rows;
+        slot->cols = cols;
+        slot->step = step;
+        dst = header(slot);
+        writing = true;
+        return true;
+    }
+
+    // Producer: publishes the slot filled since beginWrite and returns its sequence number
+    uint64 commit(int64 timestamp)
+    {
+        CV_Assert(producer && writing);
+        const uint64 seq = shared->writeSeq.load(std::memory_order_relaxed);
+        Slot *slot = slotAt(mapping, shared, static_cast<int>(seq % shared->slotCount));
+        slot->timestamp = timestamp;
+        slot->version.store(2 * seq + 2, std::memory_order_release);
+        shared->writeSeq.store(seq + 1, std::memory_order_release);
+        writing = false;
+        return seq;
+    }
+
+    // Registers a consumer starting at the next frame written; returns its id or -1 when the table is full
+    int addConsumer()
+    {
+        for (int id = 0; id < MaxConsumers; id++)
+        {
+            Consumer &c = shared->consumers[id];
+            uint32_t expected = 0;
+            if (c.active.compare_exchange_strong(expected, 2, std::memory_order_acq_rel))
+            {
+                c.readSeq.store(shared->writeSeq.load(std::memory_order_acquire), std::memory_order_relaxed);
+                c.active.store(1, std::memory_order_release); // visible to the producer only with a valid cursor
+                return id;
+            }
+        }
+        return -1;
+    }
+
+    void removeConsumer(int id)
+    {
+        consumer(id).active.store(0, std::memory_order_release);
+    }
+
+    // Consumer: waits up to timeoutMs for the frame at the consumer's cursor and points dst at it.
+    // Returns 1 on success, 0 on timeout and -1 when the producer closed the ring and every frame was read.
+    // The slot stays reserved (POLICY_BLOCK) until release(); acquiring again without release returns the same frame.
+    int acquire(int id, int timeoutMs, cv::Mat &dst, FrameRingFrameInfo &info)
+    {
+        Consumer &c = consumer(id);
+        uint64 cursor = c.readSeq.load(std::memory_order_relaxed);
+        uint64 dropped = 0;
+        int result = 0;
+        waitFor(timeoutMs, [&]
+        {
+            const uint64 written = shared->writeSeq.load(std::memory_order_acquire);
+            if (cursor >= written)
+            {
+                if (shared->closed.load(std::memory_order_acquire) == 0)
+                    return false;
+                result = -1;
+                return true;
+            }
+            if (written - cursor > static_cast<uint64>(shared->slotCount))
+            {
+                dropped += written - shared->slotCount - cursor;
+                cursor = written - shared->slotCount;
+            }
+
+            const Slot *slot = slotAt(mapping, shared, static_cast<int>(cursor % shared->slotCount));
+            const uint64 version = slot->version.load(std::memory_order_acquire);
+            if (version == 2 * cursor + 2)
+            {
+                info.sequence = cursor;
+                info.timestamp = slot->timestamp;
+                info.type = slot->type;
+                info.rows = slot->rows;
+                info.cols = slot->cols;
+                info.reserved = 0;
+                info.step = slot->step;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot->version.load(std::memory_order_relaxed) == version)
+                {
+                    result = 1;
+                    return true;
+                }
+            }
+            // overwritten while we looked at it: the next sequence is the oldest one still possibly intact
+            cursor++;
+            dropped++;
+            return false;
+        });
+
+        if (result == 1)
+        {
+            info.dropped = dropped;
+            c.readSeq.store(cursor, std::memory_order_release);
+            dst = header(slotAt(mapping, shared, static_cast<int>(cursor % shared->slotCount)));
+        }
+        else if (dropped > 0)
+        {
+            c.readSeq.store(cursor, std::memory_order_release);
+        }
+        return result;
+    }
+
+    // Consumer: hands the slot of the last acquired frame back to the producer
+    void release(int id, uint64 sequence)
+    {
+        Consumer &c = consumer(id);
+        if (c.readSeq.load(std::memory_order_relaxed) == sequence)
+            c.readSeq.store(sequence + 1, std::memory_order_release);
+    }
+
+    // True while the slot still holds the given frame (a zero-copy frame read under POLICY_DROP_OLDEST
+    // is only known to be consistent if this holds after the reads)
+    bool isValid(uint64 sequence) const
+    {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const Slot *slot = slotAt(mapping, shared, static_cast<int>(sequence % shared->slotCount));
+        return slot->version.load(std::memory_order_relaxed) == 2 * sequence + 2;
+    }
+
+private:
+    struct Consumer
+    {
+        alignas(64) std::atomic<uint32_t> active; // 0: free, 2: registering, 1: active
+        std::atomic<uint64> readSeq;              // next frame this consumer reads
+    };
+
+    struct Shared
+    {
+        char magic[8];
+        int32_t slotCount;
+        int32_t policy;
+        uint64 slotBytes;
+        uint64 slotStride;
+        uint64 dataOffset;
+        std::atomic<uint32_t> closed;
+        alignas(64) std::atomic<uint64> writeSeq;
+        Consumer consumers[MaxConsumers];
+
+        Shared() : slotCount(0), policy(0), slotBytes(0), slotStride(0), dataOffset(0), closed(0), writeSeq(0)
+        {
+            std::memset(magic, 0, sizeof(magic));
+            for (int i = 0; i < MaxConsumers; i++)
+            {
+                consumers[i].active.store(0);
+                consumers[i].readSeq.store(0);
+            }
+        }
+    };
+
+    struct Slot
+    {
+        std::atomic<uint64> version;
+        int64 timestamp;
+        int32_t type;
+        int32_t rows;
+        int32_t cols;
+        uint64 step;
+
+        Slot() : version(0), timestamp(0), type(0), rows(0), cols(0), step(0)
+        {
+        }
+    };
+
+    FrameRingMapping *mapping;
+    Shared *shared;
+    const bool producer;
+    bool writing;
+
+    FrameRing(FrameRingMapping *mapping, bool producer)
+        : mapping(mapping), shared(static_cast<Shared*>(mapping->base)), producer(producer), writing(false)
+    {
+    }
+
+    static const char *magic()
+    {
+        return "CVSHRNG1";
+    }
+
+    static uint64 alignUp(uint64 value, uint64 alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    static Slot *slotAt(const FrameRingMapping *mapping, const Shared *shared, int index)
+    {
+        return reinterpret_cast<Slot*>(static_cast<uchar*>(mapping->base) + shared->dataOffset + shared->slotStride * index);
+    }
+
+    Consumer &consumer(int id) const
+    {
+        CV_Assert(id >= 0 && id < MaxConsumers);
+        CV_Assert(shared->consumers[id].active.load(std::memory_order_relaxed) != 0);
+        return shared->consumers[id];
+    }
+
+    // Oldest cursor of the active consumers (seq itself when there are none)
+    uint64 slowestConsumer(uint64 seq) const
+    {
+        uint64 result = seq;
+        for (int id = 0; id < MaxConsumers; id++)
+        {
+            const Consumer &c = shared->consumers[id];
+            if (c.active.load(std::memory_order_acquire) == 1)
+                result = std::min(result, c.readSeq.load(std::memory_order_acquire));
+        }
+        return result;
+    }
+
+    // Zero-copy header over the slot pixels that keeps the mapping alive
+    cv::Mat header(Slot *slot) const
+    {
+        uchar *data = reinterpret_cast<uchar*>(slot) + SlotHeaderSize;
+        cv::Mat m(slot->rows, slot->cols, slot->type, data, static_cast<size_t>(slot->step));
+        mapping->addRef();
+        ExternalMatAllocator::attach(m, FrameRingMapping::releaseCallback, mapping);
+        return m;
+    }
+
+    // Polls cond with a spin / yield / sleep backoff until it holds or timeoutMs elapses
+    template<typename Cond>
+    static bool waitFor(int timeoutMs, Cond cond)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(std::max(timeoutMs, 0));
+        for (int spin = 0; ; spin++)
+        {
+            if (cond())
+                return true;
+            if (timeoutMs >= 0 && std::chrono::steady_clock::now() >= deadline)
+                return false;
+            if (spin < 64)
+                continue;
+            if (spin < 256)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+};
+
+
+CVAPI(FrameRing*) core_FrameRing_create(const char *name, int slotCount, uint64 slotBytes, int policy)
+{
+    return FrameRing::create(name, slotCount, slotBytes, policy);
+}
+
+CVAPI(FrameRing*) core_FrameRing_open(const char *name)
+{
+    return FrameRing::open(name);
+}
+
+CVAPI(int) core_FrameRing_unlink(const char *name)
+{
+    CV_Assert(name != NULL);
+    return FrameRingMapping::unlink(name) ? 1 : 0;
+}
+
+CVAPI(void) core_FrameRing_delete(FrameRing *obj)
+{
+    delete obj;
+}
+
+CVAPI(int) core_FrameRing_slotCount(FrameRing *obj)
+{
+    return obj->slotCount();
+}
+
+CVAPI(uint64) core_FrameRing_slotBytes(FrameRing *obj)
+{
+    return obj->slotBytes();
+}
+
+CVAPI(int) core_FrameRing_policy(FrameRing *obj)
+{
+    return obj->policy();
+}
+
+CVAPI(uint64) core_FrameRing_writeSequence(FrameRing *obj)
+{
+    return obj->writeSequence();
+}
+
+CVAPI(int) core_FrameRing_isClosed(FrameRing *obj)
+{
+    return obj->isClosed() ? 1 : 0;
+}
+
+CVAPI(int) core_FrameRing_beginWrite(FrameRing *obj, int rows, int cols, int type, int timeoutMs, cv::Mat *dst)
+{
+    return obj->beginWrite(rows, cols, type, timeoutMs, *dst) ? 1 : 0;
+}
+
+CVAPI(uint64) core_FrameRing_commit(FrameRing *obj, int64 timestamp)
+{
+    return obj->commit(timestamp);
+}
+
+CVAPI(int) core_FrameRing_addConsumer(FrameRing *obj)
+{
+    return obj->addConsumer();
+}
+
+CVAPI(void) core_FrameRing_removeConsumer(FrameRing *obj, int id)
+{
+    obj->removeConsumer(id);
+}
+
+CVAPI(int) core_FrameRing_acquire(FrameRing *obj, int id, int timeoutMs, cv::Mat *dst, FrameRingFrameInfo *info)
+{
+    return obj->acquire(id, timeoutMs, *dst, *info);
+}
+
+CVAPI(void) core_FrameRing_release(FrameRing *obj, int id, uint64 sequence)
+{
+    obj->release(id, sequence);
+}
+
+CVAPI(int) core_FrameRing_isValid(FrameRing *obj, uint64 sequence)
+{
+    return obj->isValid(sequence) ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef _CPP_CORE_HEAPCOUNTER_H_
+#define _CPP_CORE_HEAPCOUNTER_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include <cstdlib>
+#include <new>
+
+// Per-thread count of the heap allocations made by the code of this library: the export shims and the
+// standard library / OpenCV templates instantiated in them. Allocations made inside the OpenCV libraries
+// (Mat buffers, encoder state, ...) are not counted, nor are those of classes which the standard library
+// instantiates itself (std::string with libstdc++).
+//
+// The count comes from a replacement of the global operator new which must stay local to this library.
+// A DLL always binds its own operator new; on ELF platforms CMakeLists.txt defines OPENCVSHARP_HEAP_COUNTER
+// and links with exports.map, which keeps the C++ symbols (operator new and the template instantiations
+// calling it) out of the dynamic symbol table. Elsewhere nothing is replaced and the count is unavailable.
+// Included by core.cpp only: the replacement must be defined once in the library.
+
+#if defined(_WIN32) || defined(OPENCVSHARP_HEAP_COUNTER)
+#define OPENCVSHARP_HEAP_COUNTING
+
+#ifdef __GNUC__
+// operator new must not call the -finstrument-functions hooks (core_ExportProfiler.h), which may allocate
+#define HEAP_COUNTER_NOINSTR __attribute__((no_instrument_function))
+#else
+#define HEAP_COUNTER_NOINSTR
+#endif
+
+static uint64 &heapAllocationCount()
+{
+    static thread_local uint64 count = 0;
+    return count;
+}
+
+HEAP_COUNTER_NOINSTR static void *countedMalloc(std::size_t size)
+{
+    heapAllocationCount()++;
+    for (;;)
+    {
+        void *p = std::malloc(size == 0 ? 1 : size);
+        if (p != NULL)
+            return p;
+        const std::new_handler handler = std::get_new_handler();
+        if (handler == NULL)
+            return NULL;
+        handler();
+    }
+}
+
+HEAP_COUNTER_NOINSTR void *operator new(std::size_t size)
+{
+    void *p = countedMalloc(size);
+    if (p == NULL)
+        throw std::bad_alloc();
+    return p;
+}
+HEAP_COUNTER_NOINSTR void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+HEAP_COUNTER_NOINSTR void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    return countedMalloc(size);
+}
+HEAP_COUNTER_NOINSTR void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+    return countedMalloc(size);
+}
+
+HEAP_COUNTER_NOINSTR void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+HEAP_COUNTER_NOINSTR void operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+HEAP_COUNTER_NOINSTR void operator delete(void *p, const std::nothrow_t &) noexcept
+{
+    std::free(p);
+}
+HEAP_COUNTER_NOINSTR void operator delete[](void *p, const std::nothrow_t &) noexcept
+{
+    std::free(p);
+}
+#if defined(__cpp_sized_deallocation) || defined(_MSC_VER)
+HEAP_COUNTER_NOINSTR void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+HEAP_COUNTER_NOINSTR void operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+#endif
+
+#endif
+
+// Returns 0 if the count is not available in this build
+CVAPI(int) core_heapAllocationCount(uint64 *count)
+{
+#ifdef OPENCVSHARP_HEAP_COUNTING
+    *count = heapAllocationCount();
+    return 1;
+#else
+    *count = 0;
+    return 0;
+#endif
+}
+
+#endif
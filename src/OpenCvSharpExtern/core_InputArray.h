@@ -48,11 +48,11 @@ CVAPI(void) core_InputArray_delete_withScalar(cv::_InputArray *ia, cv::Scalar *h
 
 CVAPI(cv::Mat*) core_InputArray_getMat(cv::_InputArray *ia, int idx)
 {
-	return new cv::Mat(ia->getMat(idx));
+	return trackHandle(new cv::Mat(ia->getMat(idx)));
 }
 CVAPI(cv::Mat*) core_InputArray_getMat_(cv::_InputArray *ia, int idx)
 {
-	return new cv::Mat(ia->getMat_(idx));
+	return trackHandle(new cv::Mat(ia->getMat_(idx)));
 }
 CVAPI(cv::UMat*) core_InputArray_getUMat(cv::_InputArray *ia, int idx)
 {
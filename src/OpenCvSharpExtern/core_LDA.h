@@ -46,36 +46,36 @@ CVAPI(void) core_LDA_compute(cv::LDA *obj, cv::_InputArray *src, cv::_InputArray
 CVAPI(cv::Mat*) core_LDA_project(cv::LDA *obj, cv::_InputArray *src)
 {
     const cv::Mat mat = obj->project(*src);
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 
 CVAPI(cv::Mat*) core_LDA_reconstruct(cv::LDA *obj, cv::_InputArray *src)
 {
     const cv::Mat mat = obj->reconstruct(*src);
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 
 CVAPI(cv::Mat*) core_LDA_eigenvectors(cv::LDA *obj)
 { 
     const cv::Mat mat = obj->eigenvectors();
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 
 CVAPI(cv::Mat*) core_LDA_eigenvalues(cv::LDA *obj)
 {
     const cv::Mat mat = obj->eigenvalues();
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 
 CVAPI(cv::Mat*) core_LDA_subspaceProject(cv::_InputArray *W, cv::_InputArray *mean, cv::_InputArray *src)
 {
     const cv::Mat mat = cv::LDA::subspaceProject(*W, *mean, *src);
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 CVAPI(cv::Mat*) core_LDA_subspaceReconstruct(cv::_InputArray *W, cv::_InputArray *mean, cv::_InputArray *src)
 {
     const cv::Mat mat = cv::LDA::subspaceReconstruct(*W, *mean, *src);
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 
 #endif
\ No newline at end of file
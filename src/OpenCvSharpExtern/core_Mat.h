@@ -2,6 +2,31 @@
 #define _CPP_CORE_MAT_H_
 
 #include "include_opencv.h"
+#include "core_MatAllocator.h"
+#include "core_MatExprFusion.h"
+#include "core_ReleaseQueue.h"
+
+// Number of cv::Mat headers allocated on the native heap / constructed in caller storage by this module
+static std::atomic<uint64> matHeaderHeapCount(0);
+static std::atomic<uint64> matHeaderPlacementCount(0);
+
+// The header is constructed in place from the cv::Mat constructor arguments (no temporary, no extra
+// reference count round trip) and counted once the constructor has succeeded.
+template <typename... Args>
+static cv::Mat *newMatHeader(Args&&... args)
+{
+    cv::Mat *m = new cv::Mat(std::forward<Args>(args)...);
+    ++matHeaderHeapCount;
+    return trackHandle(m);
+}
+
+template <typename... Args>
+static cv::Mat *placementMatHeader(void *buf, Args&&... args)
+{
+    cv::Mat *m = new(buf) cv::Mat(std::forward<Args>(args)...);
+    ++matHeaderPlacementCount;
+    return m;
+}
 
 
 #pragma region Init & Release
@@ -12,52 +37,52 @@ CVAPI(uint64) core_Mat_sizeof()
 
 CVAPI(cv::Mat*) core_Mat_new1()
 {
-    return new cv::Mat();
+    return newMatHeader();
 }
 CVAPI(cv::Mat*) core_Mat_new2(int rows, int cols, int type)
 {
-    return new cv::Mat(rows, cols, type); 
+    return newMatHeader(rows, cols, type); 
 }
 CVAPI(cv::Mat*) core_Mat_new3(int rows, int cols, int type, MyCvScalar scalar)
 {
-    return new cv::Mat(rows, cols, type, cpp(scalar));
+    return newMatHeader(rows, cols, type, cpp(scalar));
 }
 CVAPI(cv::Mat*) core_Mat_new4(cv::Mat *mat, cv::Range rowRange, cv::Range colRange)
 {
-    return new cv::Mat(*mat, rowRange, colRange);
+    return newMatHeader(*mat, rowRange, colRange);
 }
 CVAPI(cv::Mat*) core_Mat_new5(cv::Mat *mat, cv::Range rowRange)
 {
-    return new cv::Mat(*mat, rowRange);
+    return newMatHeader(*mat, rowRange);
 }
 CVAPI(cv::Mat*) core_Mat_new6(cv::Mat *mat, cv::Range *ranges)
 {
-    return new cv::Mat(*mat, ranges);
+    return newMatHeader(*mat, ranges);
 }
 CVAPI(cv::Mat*) core_Mat_new7(cv::Mat *mat, MyCvRect roi)
 {
-    return new cv::Mat(*mat, cpp(roi));
+    return newMatHeader(*mat, cpp(roi));
 }
 CVAPI(cv::Mat*) core_Mat_new8(int rows, int cols, int type, void* data, size_t step)
 {
-    return new cv::Mat(rows, cols, type, data, step);
+    return newMatHeader(rows, cols, type, data, step);
 }
 CVAPI(cv::Mat*) core_Mat_new9(int ndims, const int* sizes, int type, void* data, const size_t* steps)
 {
-    return new cv::Mat(ndims, sizes, type, data, steps);
+    return newMatHeader(ndims, sizes, type, data, steps);
 }
 
 CVAPI(cv::Mat*) core_Mat_new10(int ndims, int* sizes, int type)
 {
-    return new cv::Mat(ndims, sizes, type);
+    return newMatHeader(ndims, sizes, type);
 }
 CVAPI(cv::Mat*) core_Mat_new11(int ndims, int* sizes, int type, MyCvScalar s)
 {
-    return new cv::Mat(ndims, sizes, type, cpp(s));
+    return newMatHeader(ndims, sizes, type, cpp(s));
 }
 CVAPI(cv::Mat*) core_Mat_new12(cv::Mat *mat)
 {
-	return new cv::Mat(*mat);
+	return newMatHeader(*mat);
 }
 
 CVAPI(cv::Mat*) core_Mat_new_FromIplImage(IplImage *img, int copyData)
@@ -65,9 +90,9 @@ CVAPI(cv::Mat*) core_Mat_new_FromIplImage(IplImage *img, int copyData)
     cv::Size size(img->height, img->width);
     cv::Mat m(size, CV_MAKETYPE(img->depth, img->nChannels), img->imageData, img->widthStep);
     if (copyData)
-        return new cv::Mat(m.clone());
+        return newMatHeader(m.clone());
     else
-        return new cv::Mat(m);
+        return newMatHeader(m);
 }
 
 CVAPI(cv::Mat*) core_Mat_new_FromCvMat(CvMat *mat, int copyData)
@@ -75,9 +100,26 @@ CVAPI(cv::Mat*) core_Mat_new_FromCvMat(CvMat *mat, int copyData)
     cv::Size size(mat->rows, mat->cols);
     cv::Mat m(size, mat->type, (mat->data).ptr);
     if (copyData)
-        return new cv::Mat(m.clone());
+        return newMatHeader(m.clone());
     else
-        return new cv::Mat(m);
+        return newMatHeader(m);
+}
+
+// Like core_Mat_new8 / core_Mat_new9, but the Mats sharing the returned header's data keep the
+// caller's buffer alive: callback(data, userToken) runs when the last of them is released.
+CVAPI(cv::Mat*) core_Mat_new_External8(int rows, int cols, int type, void* data, size_t step,
+    MatReleaseCallback callback, void *userToken)
+{
+    cv::Mat m(rows, cols, type, data, step);
+    ExternalMatAllocator::attach(m, callback, userToken);
+    return newMatHeader(std::move(m));
+}
+CVAPI(cv::Mat*) core_Mat_new_External9(int ndims, const int* sizes, int type, void* data, const size_t* steps,
+    MatReleaseCallback callback, void *userToken)
+{
+    cv::Mat m(ndims, sizes, type, data, steps);
+    ExternalMatAllocator::attach(m, callback, userToken);
+    return newMatHeader(std::move(m));
 }
 
 
@@ -87,16 +129,84 @@ CVAPI(void) core_Mat_release(cv::Mat *self)
 }
 CVAPI(void) core_Mat_delete(cv::Mat *self)
 {
-    delete self;
+    NativeReleaseQueue::instance()->releaseMat(self);
+}
+
+#pragma endregion
+
+#pragma region Placement
+// The *_placement functions construct the cv::Mat header inside caller-provided storage
+// (at least core_Mat_sizeof() bytes, pointer-aligned) instead of the native heap.
+// Headers created here must be released by core_Mat_placement_delete, never by core_Mat_delete.
+
+CVAPI(cv::Mat*) core_Mat_placement_new1(void *buf)
+{
+    return placementMatHeader(buf);
+}
+CVAPI(cv::Mat*) core_Mat_placement_new4(void *buf, cv::Mat *mat, cv::Range rowRange, cv::Range colRange)
+{
+    return placementMatHeader(buf, *mat, rowRange, colRange);
+}
+CVAPI(cv::Mat*) core_Mat_placement_new7(void *buf, cv::Mat *mat, MyCvRect roi)
+{
+    return placementMatHeader(buf, *mat, cpp(roi));
+}
+CVAPI(cv::Mat*) core_Mat_placement_new8(void *buf, int rows, int cols, int type, void* data, size_t step)
+{
+    return placementMatHeader(buf, rows, cols, type, data, step);
+}
+CVAPI(cv::Mat*) core_Mat_placement_new12(void *buf, cv::Mat *mat)
+{
+    return placementMatHeader(buf, *mat);
 }
 
+CVAPI(cv::Mat*) core_Mat_placement_subMat1(void *buf, cv::Mat *self, int rowStart, int rowEnd, int colStart, int colEnd)
+{
+    return placementMatHeader(buf, *self, cv::Range(rowStart, rowEnd), cv::Range(colStart, colEnd));
+}
+CVAPI(cv::Mat*) core_Mat_placement_row(void *buf, cv::Mat *self, int y)
+{
+    return placementMatHeader(buf, self->row(y));
+}
+CVAPI(cv::Mat*) core_Mat_placement_col(void *buf, cv::Mat *self, int x)
+{
+    return placementMatHeader(buf, self->col(x));
+}
+CVAPI(cv::Mat*) core_Mat_placement_rowRange(void *buf, cv::Mat *self, int startRow, int endRow)
+{
+    return placementMatHeader(buf, self->rowRange(startRow, endRow));
+}
+CVAPI(cv::Mat*) core_Mat_placement_colRange(void *buf, cv::Mat *self, int startCol, int endCol)
+{
+    return placementMatHeader(buf, self->colRange(startCol, endCol));
+}
+CVAPI(cv::Mat*) core_Mat_placement_reshape(void *buf, cv::Mat *self, int cn, int rows)
+{
+    return placementMatHeader(buf, self->reshape(cn, rows));
+}
+
+CVAPI(void) core_Mat_placement_delete(cv::Mat *self)
+{
+    self->~Mat();
+}
+
+CVAPI(void) core_Mat_headerCounts(uint64 *heap, uint64 *placement)
+{
+    *heap = matHeaderHeapCount;
+    *placement = matHeaderPlacementCount;
+}
+CVAPI(void) core_Mat_resetHeaderCounts()
+{
+    matHeaderHeapCount = 0;
+    matHeaderPlacementCount = 0;
+}
 #pragma endregion
 
 #pragma region Functions
 CVAPI(cv::Mat*) core_Mat_adjustROI(cv::Mat *self, int dtop, int dbottom, int dleft, int dright)
 {
     cv::Mat ret = self->adjustROI(dtop, dbottom, dleft, dright);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 
 CVAPI(void) core_Mat_assignTo1(cv::Mat *self, cv::Mat *m)
@@ -129,13 +239,13 @@ CVAPI(int) core_Mat_checkVector3(cv::Mat *self, int elemChannels, int depth, int
 CVAPI(cv::Mat*) core_Mat_clone(cv::Mat *self)
 {
     cv::Mat ret = self->clone();
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 
 CVAPI(cv::Mat*) core_Mat_col_toMat(cv::Mat *self, int x)
 {
     cv::Mat ret = self->col(x);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::MatExpr*) core_Mat_col_toMatExpr(cv::Mat *self, int x)
 {
@@ -151,7 +261,7 @@ CVAPI(int) core_Mat_cols(cv::Mat *self)
 CVAPI(cv::Mat*) core_Mat_colRange_toMat(cv::Mat *self, int startCol, int endCol)
 { 
     cv::Mat ret = self->colRange(startCol, endCol);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::MatExpr*) core_Mat_colRange_toMatExpr(cv::Mat *self, int startCol, int endCol)
 {
@@ -188,7 +298,7 @@ CVAPI(void) core_Mat_create2(cv::Mat *self, int ndims, const int *sizes, int typ
 CVAPI(cv::Mat*) core_Mat_cross(cv::Mat *self, cv::Mat *m)
 {
     cv::Mat ret = self->cross(*m);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 
 CVAPI(uchar*) core_Mat_data(cv::Mat *self)
@@ -218,17 +328,17 @@ CVAPI(int) core_Mat_depth(cv::Mat *self)
 CVAPI(cv::Mat*) core_Mat_diag1(cv::Mat *self)
 {
     cv::Mat ret = self->diag();
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::Mat*) core_Mat_diag2(cv::Mat *self, int d)
 {
     cv::Mat ret = self->diag(d);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::Mat*) core_Mat_diag3(cv::Mat *self)
 {
     cv::Mat ret = cv::Mat::diag(*self);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 
 CVAPI(double) core_Mat_dot(cv::Mat *self, cv::Mat *m)
@@ -261,12 +371,12 @@ CVAPI(cv::MatExpr*) core_Mat_eye(int rows, int cols, int type)
 CVAPI(cv::Mat*) core_Mat_inv1(cv::Mat *self)
 {
     cv::Mat ret = self->inv();
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::Mat*) core_Mat_inv2(cv::Mat *self, int method)
 {
     cv::Mat ret = self->inv(method);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 
 CVAPI(int) core_Mat_isContinuous(cv::Mat *self)
@@ -315,23 +425,23 @@ CVAPI(cv::MatExpr*) core_Mat_ones2(int ndims, const int *sz, int type)
 CVAPI(cv::Mat*) core_Mat_reshape1(cv::Mat *self, int cn)
 {
     cv::Mat ret = self->reshape(cn);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::Mat*) core_Mat_reshape2(cv::Mat *self, int cn, int rows)
 {
     cv::Mat ret = self->reshape(cn, rows);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::Mat*) core_Mat_reshape3(cv::Mat *self, int cn, int newndims, const int* newsz)
 {
     cv::Mat ret = self->reshape(cn, newndims, newsz);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 
 CVAPI(cv::Mat*) core_Mat_row_toMat(cv::Mat *self, int y)
 {
     cv::Mat ret = self->row(y);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::MatExpr*) core_Mat_row_toMatExpr(cv::Mat *self, int y)
 {
@@ -342,7 +452,7 @@ CVAPI(cv::MatExpr*) core_Mat_row_toMatExpr(cv::Mat *self, int y)
 CVAPI(cv::Mat*) core_Mat_rowRange_toMat(cv::Mat *self, int startRow, int endRow)
 {
     cv::Mat ret = self->rowRange(startRow, endRow);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::MatExpr*) core_Mat_rowRange_toMatExpr(cv::Mat *self, int startRow, int endRow)
 {
@@ -403,7 +513,7 @@ CVAPI(cv::Mat*) core_Mat_subMat1(cv::Mat *self, int rowStart, int rowEnd, int co
     cv::Range rowRange(rowStart, rowEnd);
     cv::Range colRange(colStart, colEnd);
     cv::Mat ret = (*self)(rowRange, colRange);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 CVAPI(cv::Mat*) core_Mat_subMat2(cv::Mat *self, int nRanges, MyCvSlice *ranges)
 {
@@ -413,13 +523,13 @@ CVAPI(cv::Mat*) core_Mat_subMat2(cv::Mat *self, int nRanges, MyCvSlice *ranges)
         rangesVec.push_back(cpp(ranges[i]));
     }
     cv::Mat ret = (*self)(&rangesVec[0]);
-    return new cv::Mat(ret);
+    return newMatHeader(ret);
 }
 
 CVAPI(cv::Mat*) core_Mat_t(cv::Mat *self)
 {
     cv::Mat expr = self->t();
-    return new cv::Mat(expr);
+    return newMatHeader(expr);
 }
 
 CVAPI(uint64) core_Mat_total(cv::Mat *self)
@@ -529,43 +639,59 @@ CVAPI(void) core_Mat_CvMat(cv::Mat *self, CvMat *outMat)
 
 CVAPI(cv::MatExpr*) core_Mat_operatorUnaryMinus(cv::Mat *mat)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::SUB, cv::Scalar::all(0), *mat));
     cv::MatExpr expr = -(*mat);
     return new cv::MatExpr(expr);
 }
 
 CVAPI(cv::MatExpr*) core_Mat_operatorAdd_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::ADD, *a, *b));
     cv::MatExpr expr = (*a) + (*b);
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorAdd_MatScalar(cv::Mat *a, MyCvScalar s)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::ADD, *a, cpp(s)));
     cv::MatExpr expr = (*a) + cpp(s);
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorAdd_ScalarMat(MyCvScalar s, cv::Mat *a)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::ADD, cpp(s), *a));
     cv::MatExpr expr = cpp(s) + (*a); 
     return new cv::MatExpr(expr);
 }
 
 CVAPI(cv::MatExpr*) core_Mat_operatorMinus_Mat(cv::Mat *a)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::SUB, cv::Scalar::all(0), *a));
     cv::MatExpr expr = -(*a);
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorSubtract_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::SUB, *a, *b));
     cv::MatExpr expr = (*a) - (*b);
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorSubtract_MatScalar(cv::Mat *a, MyCvScalar s)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::SUB, *a, cpp(s)));
     cv::MatExpr expr = (*a) - cpp(s);
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorSubtract_ScalarMat(MyCvScalar s, cv::Mat *a)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::SUB, cpp(s), *a));
     cv::MatExpr expr = cpp(s) - (*a); 
     return new cv::MatExpr(expr);
 }
@@ -577,81 +703,111 @@ CVAPI(cv::MatExpr*) core_Mat_operatorMultiply_MatMat(cv::Mat *a, cv::Mat *b)
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorMultiply_MatDouble(cv::Mat *a, double s)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::MUL, *a, cv::Scalar::all(s)));
     cv::MatExpr expr = (*a) * s;
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorMultiply_DoubleMat(double s, cv::Mat *a)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::MUL, cv::Scalar::all(s), *a));
     cv::MatExpr expr = s * (*a); 
     return new cv::MatExpr(expr);
 }
 
 CVAPI(cv::MatExpr*) core_Mat_operatorDivide_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::DIV, *a, *b));
     cv::MatExpr expr = (*a) / (*b);
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorDivide_MatDouble(cv::Mat *a, double s)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::MUL, *a, cv::Scalar::all(1. / s)));
     cv::MatExpr expr = (*a) / s;
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorDivide_DoubleMat(double s, cv::Mat *a)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::DIV, cv::Scalar::all(s), *a));
     cv::MatExpr expr = s / (*a); 
     return new cv::MatExpr(expr);
 }
 
 CVAPI(cv::MatExpr*) core_Mat_operatorAnd_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::AND, *a, *b));
     cv::MatExpr expr = (*a) & (*b);
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorAnd_MatDouble(cv::Mat *a, double s)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::AND, *a, cv::Scalar(s)));
     cv::MatExpr expr = (*a) & s;
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorAnd_DoubleMat(double s, cv::Mat *a)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::AND, cv::Scalar(s), *a));
     cv::MatExpr expr = s & (*a); 
     return new cv::MatExpr(expr);
 }
 
 CVAPI(cv::MatExpr*) core_Mat_operatorOr_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::OR, *a, *b));
     cv::MatExpr expr = (*a) | (*b);
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorOr_MatDouble(cv::Mat *a, double s)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::OR, *a, cv::Scalar(s)));
     cv::MatExpr expr = (*a) | s;
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorOr_DoubleMat(double s, cv::Mat *a)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::OR, cv::Scalar(s), *a));
     cv::MatExpr expr = s | (*a); 
     return new cv::MatExpr(expr);
 }
 
 CVAPI(cv::MatExpr*) core_Mat_operatorXor_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::XOR, *a, *b));
     cv::MatExpr expr = (*a) ^ (*b);
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorXor_MatDouble(cv::Mat *a, double s)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::XOR, *a, cv::Scalar(s)));
     cv::MatExpr expr = (*a) ^ s;
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorXor_DoubleMat(double s, cv::Mat *a)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::XOR, cv::Scalar(s), *a));
     cv::MatExpr expr = s ^ (*a); 
     return new cv::MatExpr(expr);
 }
 
 CVAPI(cv::MatExpr*) core_Mat_operatorNot(cv::Mat *a)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::unary(FusedMatExprNode::NOT, *a));
     cv::MatExpr expr = ~(*a);
     return new cv::MatExpr(expr);
 }
@@ -662,96 +818,132 @@ CVAPI(cv::MatExpr*) core_Mat_operatorNot(cv::Mat *a)
 // <
 CVAPI(cv::MatExpr*) core_Mat_operatorLT_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, *b, cv::CMP_LT));
     cv::MatExpr expr = (*a) < (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorLT_DoubleMat(double a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(cv::Scalar::all(a), *b, cv::CMP_LT));
     cv::MatExpr expr = a < (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorLT_MatDouble(cv::Mat *a, double b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, cv::Scalar::all(b), cv::CMP_LT));
     cv::MatExpr expr = (*a) < b; 
     return new cv::MatExpr(expr);
 }
 // <=
 CVAPI(cv::MatExpr*) core_Mat_operatorLE_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, *b, cv::CMP_LE));
     cv::MatExpr expr = (*a) <= (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorLE_DoubleMat(double a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(cv::Scalar::all(a), *b, cv::CMP_LE));
     cv::MatExpr expr = a <= (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorLE_MatDouble(cv::Mat *a, double b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, cv::Scalar::all(b), cv::CMP_LE));
     cv::MatExpr expr = (*a) <= b; 
     return new cv::MatExpr(expr);
 }
 // >
 CVAPI(cv::MatExpr*) core_Mat_operatorGT_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, *b, cv::CMP_GT));
     cv::MatExpr expr = (*a) > (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorGT_DoubleMat(double a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(cv::Scalar::all(a), *b, cv::CMP_GT));
     cv::MatExpr expr = a > (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorGT_MatDouble(cv::Mat *a, double b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, cv::Scalar::all(b), cv::CMP_GT));
     cv::MatExpr expr = (*a) > b; 
     return new cv::MatExpr(expr);
 }
 // >=
 CVAPI(cv::MatExpr*) core_Mat_operatorGE_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, *b, cv::CMP_GE));
     cv::MatExpr expr = (*a) >= (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorGE_DoubleMat(double a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(cv::Scalar::all(a), *b, cv::CMP_GE));
     cv::MatExpr expr = a >= (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorGE_MatDouble(cv::Mat *a, double b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, cv::Scalar::all(b), cv::CMP_GE));
     cv::MatExpr expr = (*a) >= b; 
     return new cv::MatExpr(expr);
 }
 // ==
 CVAPI(cv::MatExpr*) core_Mat_operatorEQ_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, *b, cv::CMP_EQ));
     cv::MatExpr expr = (*a) == (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorEQ_DoubleMat(double a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(cv::Scalar::all(a), *b, cv::CMP_EQ));
     cv::MatExpr expr = a == (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorEQ_MatDouble(cv::Mat *a, double b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, cv::Scalar::all(b), cv::CMP_EQ));
     cv::MatExpr expr = (*a) == b; 
     return new cv::MatExpr(expr);
 }
 // !=
 CVAPI(cv::MatExpr*) core_Mat_operatorNE_MatMat(cv::Mat *a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, *b, cv::CMP_NE));
     cv::MatExpr expr = (*a) != (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorNE_DoubleMat(double a, cv::Mat *b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(cv::Scalar::all(a), *b, cv::CMP_NE));
     cv::MatExpr expr = a != (*b); 
     return new cv::MatExpr(expr);
 }
 CVAPI(cv::MatExpr*) core_Mat_operatorNE_MatDouble(cv::Mat *a, double b)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*a, cv::Scalar::all(b), cv::CMP_NE));
     cv::MatExpr expr = (*a) != b; 
     return new cv::MatExpr(expr);
 }
@@ -760,6 +952,8 @@ CVAPI(cv::MatExpr*) core_Mat_operatorNE_MatDouble(cv::Mat *a, double b)
 
 CVAPI(cv::MatExpr*) core_abs_Mat(cv::Mat *m)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::unary(FusedMatExprNode::ABS, *m));
     cv::MatExpr ret = cv::abs(*m);
     return new cv::MatExpr(ret);
 }
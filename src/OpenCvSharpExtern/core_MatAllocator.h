@@ -0,0 +1,522 @@
+#ifndef _CPP_CORE_MATALLOCATOR_H_
+#define _CPP_CORE_MATALLOCATOR_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include <atomic>
+#include <mutex>
+#include <set>
+
+#if CV_VERSION_MAJOR > 4 || (CV_VERSION_MAJOR == 4 && CV_VERSION_MINOR >= 2)
+typedef cv::AccessFlag MatAllocatorAccessFlag;
+#else
+typedef int MatAllocatorAccessFlag;
+#endif
+
+extern "C"
+{
+    struct PooledMatAllocatorStats
+    {
+        uint64 hits;             // allocations served from a free list
+        uint64 misses;           // allocations that went to fastMalloc
+        uint64 bytesRetained;    // bytes held by the free lists
+        uint64 blocksRetained;   // blocks held by the free lists
+        uint64 bytesInUse;       // bytes of the pool-allocated blocks currently owned by Mats
+        uint64 maxBytesPerThread;
+    };
+}
+
+// cv::MatAllocator that keeps freed Mat buffers in per-thread, size-class free lists.
+// A size class is the requested size rounded up to a quarter of its power of two,
+// so a buffer can be reused by any Mat of nearly the same size.
+// Buffers are returned to the free list of the thread that releases them.
+class PooledMatAllocator : public cv::MatAllocator
+{
+public:
+    enum
+    {
+        MinClassShift = 6,      // 64 bytes
+        MaxClassShift = 30,     // 1 GiB; larger buffers are not pooled
+        NumClasses = (MaxClassShift - MinClassShift) * 4 + 1,
+    };
+
+    static PooledMatAllocator *instance()
+    {
+        // never destroyed: Mats released during process exit may still return buffers here
+        static PooledMatAllocator *pool = new PooledMatAllocator();
+        return pool;
+    }
+
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data0, size_t* step,
+        MatAllocatorAccessFlag /*flags*/, cv::UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; i--)
+        {
+            if (step)
+            {
+                if (data0 && step[i] != CV_AUTOSTEP)
+                {
+                    CV_Assert(total <= step[i]);
+                    total = step[i];
+                }
+                else
+                {
+                    step[i] = total;
+                }
+            }
+            total *= sizes[i];
+        }
+
+        cv::UMatData* u = new cv::UMatData(this);
+        u->data = u->origdata = data0 ? static_cast<uchar*>(data0) : take(total);
+        u->size = total;
+        if (data0)
+            u->flags |= cv::UMatData::USER_ALLOCATED;
+        return u;
+    }
+
+    bool allocate(cv::UMatData* u, MatAllocatorAccessFlag /*accessFlags*/, cv::UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        return u != NULL;
+    }
+
+    void deallocate(cv::UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        if (!(u->flags & cv::UMatData::USER_ALLOCATED))
+        {
+            give(u->origdata, u->size);
+            u->origdata = 0;
+        }
+        delete u;
+    }
+
+    // Frees every buffer held by the free lists of all threads
+    void trim() const
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        for (std::set<ThreadCache*>::iterator it = registry.begin(); it != registry.end(); ++it)
+            (*it)->clear();
+    }
+
+    void resetStats() const
+    {
+        hits = 0;
+        misses = 0;
+    }
+
+    void getStats(PooledMatAllocatorStats *stats) const
+    {
+        stats->hits = hits;
+        stats->misses = misses;
+        stats->bytesRetained = bytesRetained;
+        stats->blocksRetained = blocksRetained;
+        stats->bytesInUse = bytesInUse;
+        stats->maxBytesPerThread = maxBytesPerThread;
+    }
+
+    void setMaxBytesPerThread(uint64 value) const
+    {
+        maxBytesPerThread = value;
+    }
+
+private:
+    PooledMatAllocator()
+        : hits(0), misses(0), bytesRetained(0), blocksRetained(0), bytesInUse(0),
+          maxBytesPerThread((uint64)256 << 20)
+    {
+    }
+
+    struct ThreadCache
+    {
+        std::mutex mutex; // only contended by trim()
+        std::vector<uchar*> lists[NumClasses];
+        size_t bytes;
+
+        ThreadCache() : bytes(0)
+        {
+            PooledMatAllocator *pool = instance();
+            std::lock_guard<std::mutex> lock(pool->registryMutex);
+            pool->registry.insert(this);
+        }
+        ~ThreadCache()
+        {
+            PooledMatAllocator *pool = instance();
+            {
+                std::lock_guard<std::mutex> lock(pool->registryMutex);
+                pool->registry.erase(this);
+            }
+            clear();
+            destroyed() = true;
+        }
+
+        void clear()
+        {
+            PooledMatAllocator *pool = instance();
+            std::lock_guard<std::mutex> lock(mutex);
+            for (int c = 0; c < NumClasses; c++)
+            {
+                const size_t classSize = sizeOfClass(c);
+                for (size_t i = 0; i < lists[c].size(); i++)
+                {
+                    cv::fastFree(lists[c][i]);
+                    pool->bytesRetained -= classSize;
+                    pool->blocksRetained--;
+                }
+                lists[c].clear();
+            }
+            bytes = 0;
+        }
+
+        static bool &destroyed()
+        {
+            static thread_local bool value = false;
+            return value;
+        }
+    };
+
+    static ThreadCache *threadCache()
+    {
+        if (ThreadCache::destroyed())
+            return NULL;
+        static thread_local ThreadCache cache;
+        return &cache;
+    }
+
+    static int classOf(size_t size)
+    {
+        if (size <= ((size_t)1 << MinClassShift))
+            return 0;
+        int k = 0; // 2^k <= size-1 < 2^(k+1)
+        for (size_t v = size - 1; v > 1; v >>= 1)
+            k++;
+        const size_t quarter = (size_t)1 << (k - 2);
+        const int q = static_cast<int>((size + quarter - 1) / quarter); // 5..8
+        return (k - MinClassShift) * 4 + (q - 4);
+    }
+
+    static size_t sizeOfClass(int c)
+    {
+        if (c == 0)
+            return (size_t)1 << MinClassShift;
+        const int k = (c - 1) / 4 + MinClassShift;
+        const int q = (c - 1) % 4 + 5;
+        return ((size_t)1 << (k - 2)) * q;
+    }
+
+    uchar *take(size_t size) const
+    {
+        if (size > ((size_t)1 << MaxClassShift))
+        {
+            misses++;
+            return static_cast<uchar*>(cv::fastMalloc(size));
+        }
+
+        const int c = classOf(size);
+        const size_t classSize = sizeOfClass(c);
+        bytesInUse += classSize;
+
+        ThreadCache *cache = threadCache();
+        if (cache != NULL)
+        {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            std::vector<uchar*> &list = cache->lists[c];
+            if (!list.empty())
+            {
+                uchar *p = list.back();
+                list.pop_back();
+                cache->bytes -= classSize;
+                bytesRetained -= classSize;
+                blocksRetained--;
+                hits++;
+                return p;
+            }
+        }
+        misses++;
+        return static_cast<uchar*>(cv::fastMalloc(classSize));
+    }
+
+    void give(uchar *p, size_t size) const
+    {
+        if (size > ((size_t)1 << MaxClassShift))
+        {
+            cv::fastFree(p);
+            return;
+        }
+
+        const int c = classOf(size);
+        const size_t classSize = sizeOfClass(c);
+        bytesInUse -= classSize;
+
+        ThreadCache *cache = threadCache();
+        if (cache != NULL)
+        {
+            std::lock_guard<std::mutex> lock(cache->mutex);
+            if (cache->bytes + classSize <= maxBytesPerThread)
+            {
+                cache->lists[c].push_back(p);
+                cache->bytes += classSize;
+                bytesRetained += classSize;
+                blocksRetained++;
+                return;
+            }
+        }
+        cv::fastFree(p);
+    }
+
+    mutable std::atomic<uint64> hits, misses, bytesRetained, blocksRetained, bytesInUse;
+    mutable std::atomic<uint64> maxBytesPerThread;
+    mutable std::mutex registryMutex;
+    mutable std::set<ThreadCache*> registry;
+};
+
+
+// Called with the data pointer and the user token once the last Mat referencing external data is released
+typedef void (CV_CDECL *MatReleaseCallback)(void *data, void *userToken);
+
+// cv::MatAllocator that owns no memory: it lets Mats reference caller-owned buffers
+// through a refcounted UMatData and reports the release of the last reference
+// to a callback, which then gives the buffer back to its owner.
+class ExternalMatAllocator : public cv::MatAllocator
+{
+public:
+    static ExternalMatAllocator *instance()
+    {
+        // never destroyed: Mats released during process exit may still call back here
+        static ExternalMatAllocator *allocator = new ExternalMatAllocator();
+        return allocator;
+    }
+
+    // Makes m, a header over the caller's data, the first owner of that data
+    static void attach(cv::Mat &m, MatReleaseCallback callback, void *userToken)
+    {
+        CV_Assert(m.u == NULL && m.data != NULL);
+        cv::UMatData *u = new cv::UMatData(instance());
+        u->data = u->origdata = const_cast<uchar*>(m.datastart);
+        u->size = m.dataend - m.datastart;
+        u->flags |= cv::UMatData::USER_ALLOCATED;
+        u->userdata = new Owner(callback, userToken);
+        u->refcount = 1;
+        m.u = u;
+        ++liveCount();
+    }
+
+    // Returns the user token of the buffer referenced by m if it was attached with the given callback, otherwise NULL
+    static void *userToken(const cv::Mat &m, MatReleaseCallback callback)
+    {
+        if (m.u == NULL || m.u->currAllocator != instance())
+            return NULL;
+        const Owner *owner = static_cast<const Owner*>(m.u->userdata);
+        return (owner != NULL && owner->callback == callback) ? owner->userToken : NULL;
+    }
+
+    static std::atomic<uint64> &liveCount()
+    {
+        static std::atomic<uint64> value(0);
+        return value;
+    }
+
+    // Only reached when a Mat explicitly selects this allocator; new buffers come from the standard allocator
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data0, size_t* step,
+        MatAllocatorAccessFlag flags, cv::UMatUsageFlags usageFlags) const CV_OVERRIDE
+    {
+        return cv::Mat::getStdAllocator()->allocate(dims, sizes, type, data0, step, flags, usageFlags);
+    }
+
+    bool allocate(cv::UMatData* u, MatAllocatorAccessFlag /*accessFlags*/, cv::UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        return u != NULL;
+    }
+
+    void deallocate(cv::UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        Owner *owner = static_cast<Owner*>(u->userdata);
+        if (owner != NULL)
+        {
+            if (owner->callback != NULL)
+                owner->callback(u->origdata, owner->userToken);
+            delete owner;
+            --liveCount();
+        }
+        delete u;
+    }
+
+private:
+    ExternalMatAllocator()
+    {
+    }
+
+    struct Owner
+    {
+        MatReleaseCallback callback;
+        void *userToken;
+
+        Owner(MatReleaseCallback callback, void *userToken)
+            : callback(callback), userToken(userToken)
+        {
+        }
+    };
+};
+
+
+// Wrapper around the default cv::MatAllocator which counts the bytes of the Mat buffers it allocates and
+// that are not freed yet, whichever Mat (a handle, an output filled later by a function, a temporary) owns
+// them. It is the default allocator while byte tracking is on (NativeHandleStatistics.SetTrackBytes);
+// setDefaultMatAllocator changes the allocator it wraps meanwhile.
+// Each buffer keeps the allocator which allocated it in UMatData::prevAllocator and is freed by it, also
+// after tracking is switched off or the wrapped allocator has changed.
+class CountingMatAllocator : public cv::MatAllocator
+{
+public:
+    static CountingMatAllocator *instance()
+    {
+        // never destroyed: buffers allocated while tracking may be freed during process exit
+        static CountingMatAllocator *allocator = new CountingMatAllocator();
+        return allocator;
+    }
+
+    // Switches the counting on or off; buffers allocated while it was off are not counted
+    void setEnabled(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const bool installed = cv::Mat::getDefaultAllocator() == this;
+        if (enabled && !installed)
+        {
+            inner = cv::Mat::getDefaultAllocator();
+            cv::Mat::setDefaultAllocator(this);
+        }
+        else if (!enabled && installed)
+        {
+            cv::Mat::setDefaultAllocator(inner.load());
+        }
+    }
+
+    bool isEnabled() const
+    {
+        return cv::Mat::getDefaultAllocator() == this;
+    }
+
+    // The allocator of new Mats, looking through this wrapper
+    cv::MatAllocator *defaultAllocator() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return isEnabled() ? inner.load() : cv::Mat::getDefaultAllocator();
+    }
+
+    // NULL selects the standard allocator, as cv::Mat::setDefaultAllocator
+    void setDefaultAllocator(cv::MatAllocator *allocator)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (isEnabled())
+            inner = (allocator != NULL) ? allocator : cv::Mat::getStdAllocator();
+        else
+            cv::Mat::setDefaultAllocator(allocator);
+    }
+
+    uint64 bytesInUse() const
+    {
+        return bytes.load(std::memory_order_relaxed);
+    }
+
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data0, size_t* step,
+        MatAllocatorAccessFlag flags, cv::UMatUsageFlags usageFlags) const CV_OVERRIDE
+    {
+        cv::MatAllocator *a = inner.load();
+        cv::UMatData *u = a->allocate(dims, sizes, type, data0, step, flags, usageFlags);
+        if (u != NULL)
+        {
+            u->prevAllocator = a;
+            u->currAllocator = this;
+            if (!(u->flags & cv::UMatData::USER_ALLOCATED))
+                bytes.fetch_add(u->size, std::memory_order_relaxed);
+        }
+        return u;
+    }
+
+    bool allocate(cv::UMatData* u, MatAllocatorAccessFlag accessFlags, cv::UMatUsageFlags usageFlags) const CV_OVERRIDE
+    {
+        return inner.load()->allocate(u, accessFlags, usageFlags);
+    }
+
+    void deallocate(cv::UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+        if (!(u->flags & cv::UMatData::USER_ALLOCATED))
+            bytes.fetch_sub(u->size, std::memory_order_relaxed);
+        const cv::MatAllocator *a = u->prevAllocator;
+        u->currAllocator = a;
+        a->deallocate(u);
+    }
+
+private:
+    CountingMatAllocator()
+        : inner(cv::Mat::getStdAllocator()), bytes(0)
+    {
+    }
+
+    std::atomic<cv::MatAllocator*> inner;
+    mutable std::atomic<uint64> bytes;
+    mutable std::mutex mutex;
+};
+
+
+CVAPI(cv::MatAllocator*) core_PooledMatAllocator_get()
+{
+    return PooledMatAllocator::instance();
+}
+
+CVAPI(void) core_PooledMatAllocator_setGlobal(int enabled)
+{
+    CountingMatAllocator::instance()->setDefaultAllocator(enabled ? PooledMatAllocator::instance() : NULL);
+}
+CVAPI(int) core_PooledMatAllocator_isGlobal()
+{
+    return CountingMatAllocator::instance()->defaultAllocator() == PooledMatAllocator::instance() ? 1 : 0;
+}
+
+CVAPI(void) core_PooledMatAllocator_trim()
+{
+    PooledMatAllocator::instance()->trim();
+}
+CVAPI(void) core_PooledMatAllocator_reset()
+{
+    PooledMatAllocator::instance()->trim();
+    PooledMatAllocator::instance()->resetStats();
+}
+
+CVAPI(void) core_PooledMatAllocator_setMaxBytesPerThread(uint64 value)
+{
+    PooledMatAllocator::instance()->setMaxBytesPerThread(value);
+}
+CVAPI(void) core_PooledMatAllocator_getStats(PooledMatAllocatorStats *stats)
+{
+    PooledMatAllocator::instance()->getStats(stats);
+}
+
+// Selects the allocator used by the next (re)allocation of the Mat (0: default allocator, otherwise the pool)
+CVAPI(void) core_Mat_setPooledAllocator(cv::Mat *self, int pooled)
+{
+    self->allocator = pooled ? PooledMatAllocator::instance() : NULL;
+}
+CVAPI(int) core_Mat_isPooledAllocator(cv::Mat *self)
+{
+    return self->allocator == PooledMatAllocator::instance() ? 1 : 0;
+}
+
+// Number of external buffers whose release callback has not been called yet
+CVAPI(uint64) core_ExternalMatAllocator_liveCount()
+{
+    return ExternalMatAllocator::liveCount();
+}
+
+#endif
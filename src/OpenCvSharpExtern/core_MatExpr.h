@@ -2,6 +2,7 @@
 #define _CPP_CORE_MATEXPR_H_
 
 #include "include_opencv.h"
+#include "core_MatExprFusion.h"
 
 CVAPI(cv::MatExpr*) core_MatExpr_new1()
 {
@@ -19,7 +20,7 @@ CVAPI(void) core_MatExpr_delete(cv::MatExpr *self)
 CVAPI(cv::Mat*) core_MatExpr_toMat(cv::MatExpr *self)
 {
     cv::Mat ret = (*self);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 #pragma region Functions
@@ -53,7 +54,7 @@ CVAPI(cv::MatExpr*) core_MatExpr_submat(cv::MatExpr *self, int rowStart, int row
 CVAPI(cv::Mat*) core_MatExpr_cross(cv::MatExpr *self, cv::Mat *m) 
 {
     cv::Mat ret = self->cross(*m);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 CVAPI(double) core_MatExpr_dot(cv::MatExpr *self, cv::Mat *m) 
 {
@@ -102,6 +103,8 @@ CVAPI(cv::MatExpr*) core_operatorUnaryMinus_MatExpr(cv::MatExpr *e)
 }
 CVAPI(cv::MatExpr*) core_operatorUnaryNot_MatExpr(cv::MatExpr *e)
 {
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::unary(FusedMatExprNode::NOT, *e));
     cv::MatExpr expr = ~(*e);
     return new cv::MatExpr(expr);
 }
@@ -209,6 +212,130 @@ CVAPI(cv::MatExpr*) core_operatorDivide_MatExprMatExpr(cv::MatExpr *e1, cv::MatE
     cv::MatExpr ret = (*e1) / (*e2);
     return new cv::MatExpr(ret);
 }
+CVAPI(cv::MatExpr*) core_operatorAnd_MatExprMat(cv::MatExpr *e, cv::Mat *m)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::AND, *e, *m));
+    cv::MatExpr ret = cv::Mat(*e) & (*m);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorAnd_MatMatExpr(cv::Mat *m, cv::MatExpr *e)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::AND, *m, *e));
+    cv::MatExpr ret = (*m) & cv::Mat(*e);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorAnd_MatExprDouble(cv::MatExpr *e, double s)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::AND, *e, cv::Scalar(s)));
+    cv::MatExpr ret = cv::Mat(*e) & s;
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorAnd_DoubleMatExpr(double s, cv::MatExpr *e)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::AND, cv::Scalar(s), *e));
+    cv::MatExpr ret = s & cv::Mat(*e);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorAnd_MatExprMatExpr(cv::MatExpr *e1, cv::MatExpr *e2)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::AND, *e1, *e2));
+    cv::MatExpr ret = cv::Mat(*e1) & cv::Mat(*e2);
+    return new cv::MatExpr(ret);
+}
+
+CVAPI(cv::MatExpr*) core_operatorOr_MatExprMat(cv::MatExpr *e, cv::Mat *m)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::OR, *e, *m));
+    cv::MatExpr ret = cv::Mat(*e) | (*m);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorOr_MatMatExpr(cv::Mat *m, cv::MatExpr *e)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::OR, *m, *e));
+    cv::MatExpr ret = (*m) | cv::Mat(*e);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorOr_MatExprDouble(cv::MatExpr *e, double s)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::OR, *e, cv::Scalar(s)));
+    cv::MatExpr ret = cv::Mat(*e) | s;
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorOr_DoubleMatExpr(double s, cv::MatExpr *e)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::OR, cv::Scalar(s), *e));
+    cv::MatExpr ret = s | cv::Mat(*e);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorOr_MatExprMatExpr(cv::MatExpr *e1, cv::MatExpr *e2)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::OR, *e1, *e2));
+    cv::MatExpr ret = cv::Mat(*e1) | cv::Mat(*e2);
+    return new cv::MatExpr(ret);
+}
+
+CVAPI(cv::MatExpr*) core_operatorXor_MatExprMat(cv::MatExpr *e, cv::Mat *m)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::XOR, *e, *m));
+    cv::MatExpr ret = cv::Mat(*e) ^ (*m);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorXor_MatMatExpr(cv::Mat *m, cv::MatExpr *e)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::XOR, *m, *e));
+    cv::MatExpr ret = (*m) ^ cv::Mat(*e);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorXor_MatExprDouble(cv::MatExpr *e, double s)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::XOR, *e, cv::Scalar(s)));
+    cv::MatExpr ret = cv::Mat(*e) ^ s;
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorXor_DoubleMatExpr(double s, cv::MatExpr *e)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::XOR, cv::Scalar(s), *e));
+    cv::MatExpr ret = s ^ cv::Mat(*e);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_operatorXor_MatExprMatExpr(cv::MatExpr *e1, cv::MatExpr *e2)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::binary(FusedMatExprNode::XOR, *e1, *e2));
+    cv::MatExpr ret = cv::Mat(*e1) ^ cv::Mat(*e2);
+    return new cv::MatExpr(ret);
+}
+
+CVAPI(cv::MatExpr*) core_MatExpr_compareMat(cv::MatExpr *e, cv::Mat *m, int cmpop)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*e, *m, cmpop));
+    cv::Mat ret;
+    cv::compare(*e, *m, ret, cmpop);
+    return new cv::MatExpr(ret);
+}
+CVAPI(cv::MatExpr*) core_MatExpr_compareDouble(cv::MatExpr *e, double d, int cmpop)
+{
+    if (FusedMatExprOp::enabled())
+        return new cv::MatExpr(FusedMatExprOp::compare(*e, cv::Scalar::all(d), cmpop));
+    cv::Mat ret;
+    cv::compare(*e, d, ret, cmpop);
+    return new cv::MatExpr(ret);
+}
 #pragma endregion
 
 CVAPI(cv::MatExpr*) core_abs_MatExpr(cv::MatExpr *e)
@@ -0,0 +1,607 @@
+#ifndef _CPP_CORE_MATEXPRFUSION_H_
+#define _CPP_CORE_MATEXPRFUSION_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include "core_MatAllocator.h"
+#include "core_MatKernel.h"
+
+// Lazy, fused evaluation of element-wise MatExpr chains.
+//
+// While enabled, the Mat operators (+ - * / & | ^ ~ comparisons, abs) and the MatExpr operators
+// chained on them build an expression tree instead of evaluating every operator into a full-size
+// temporary. The tree is evaluated when the expression is converted to a Mat or assigned, by a
+// single MatKernel pass (float32 row blocks, universal intrinsics, parallel_for_).
+//
+// Intermediate results are saturated to the range of their type but are not rounded, so results
+// can differ by one from the eager evaluation where OpenCV rounds an intermediate temporary.
+// Operators on CV_32S / CV_64F data, bitwise operators on floating-point data and operands with
+// more than 4 channels are evaluated eagerly by the usual OpenCV functions.
+
+struct FusedMatExprNode
+{
+    enum Kind
+    {
+        LEAF, SCALAR,
+        ADD, SUB, MUL, DIV, CMP, AND, OR, XOR,
+        NOT, ABS,
+    };
+
+    int kind;
+    int type;          // result type (-1 for SCALAR)
+    cv::Size size;
+    cv::Mat mat;       // LEAF
+    cv::Scalar scalar; // SCALAR
+    double scale;      // MUL, DIV
+    int cmpop;         // CMP
+    cv::Ptr<FusedMatExprNode> left, right;
+
+    FusedMatExprNode() : kind(LEAF), type(-1), scale(1), cmpop(0) {}
+};
+
+// Keeps the root node of a fused expression inside MatExpr::c. The node is owned by the
+// UMatData of that Mat, so it follows every copy OpenCV makes of the MatExpr and is released
+// together with the last copy.
+class FusedMatExprNodeAllocator : public cv::MatAllocator
+{
+public:
+    typedef cv::Ptr<FusedMatExprNode> NodePtr;
+
+    static FusedMatExprNodeAllocator *instance()
+    {
+        static FusedMatExprNodeAllocator *allocator = new FusedMatExprNodeAllocator();
+        return allocator;
+    }
+
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data0, size_t* step,
+        MatAllocatorAccessFlag /*flags*/, cv::UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        CV_Assert(data0 == NULL);
+        size_t total = CV_ELEM_SIZE(type);
+        for (int i = dims - 1; i >= 0; i--)
+        {
+            if (step)
+                step[i] = total;
+            total *= sizes[i];
+        }
+        CV_Assert(total == sizeof(NodePtr));
+
+        cv::UMatData* u = new cv::UMatData(this);
+        u->data = u->origdata = reinterpret_cast<uchar*>(new NodePtr());
+        u->size = total;
+        return u;
+    }
+
+    bool allocate(cv::UMatData* u, MatAllocatorAccessFlag /*accessFlags*/, cv::UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        return u != NULL;
+    }
+
+    void deallocate(cv::UMatData* u) const CV_OVERRIDE
+    {
+        if (!u)
+            return;
+        delete reinterpret_cast<NodePtr*>(u->origdata);
+        delete u;
+    }
+
+    static cv::Mat hold(const NodePtr &node)
+    {
+        cv::Mat holder;
+        holder.allocator = instance();
+        holder.create(1, static_cast<int>(sizeof(NodePtr)), CV_8U);
+        *reinterpret_cast<NodePtr*>(holder.data) = node;
+        return holder;
+    }
+
+    static const NodePtr &get(const cv::Mat &holder)
+    {
+        return *reinterpret_cast<const NodePtr*>(holder.data);
+    }
+};
+
+// MatOp of the fused expressions: element-wise operators extend the tree, everything else
+// (matrix multiplication, transposition, ROI, ...) falls back to MatOp, which materializes the tree by assign().
+class FusedMatExprOp : public cv::MatOp
+{
+public:
+    typedef FusedMatExprNode Node;
+    typedef cv::Ptr<FusedMatExprNode> NodePtr;
+    typedef std::vector<MatKernel::Instruction> Program;
+
+    static const FusedMatExprOp *instance()
+    {
+        static FusedMatExprOp *op = new FusedMatExprOp();
+        return op;
+    }
+
+    static std::atomic<bool> &enabled()
+    {
+        static std::atomic<bool> value(false);
+        return value;
+    }
+
+    static bool isFused(const cv::MatExpr &e)
+    {
+        return e.op == instance();
+    }
+
+    static NodePtr node(const cv::Mat &m)
+    {
+        NodePtr n = cv::makePtr<Node>();
+        n->kind = Node::LEAF;
+        n->mat = m;
+        n->type = m.type();
+        n->size = m.size();
+        return n;
+    }
+    static NodePtr node(const cv::MatExpr &e)
+    {
+        if (isFused(e))
+            return FusedMatExprNodeAllocator::get(e.c);
+        if (e.op == identityOp())
+            return node(e.a);
+        return node(static_cast<cv::Mat>(e));
+    }
+    static NodePtr node(const cv::Scalar &s)
+    {
+        NodePtr n = cv::makePtr<Node>();
+        n->kind = Node::SCALAR;
+        n->scalar = s;
+        return n;
+    }
+
+    static cv::MatExpr makeExpr(const NodePtr &root)
+    {
+        return cv::MatExpr(instance(), 0, cv::Mat(), cv::Mat(), FusedMatExprNodeAllocator::hold(root));
+    }
+
+    template <typename T1, typename T2>
+    static cv::MatExpr binary(int kind, const T1 &a, const T2 &b, double scale = 1)
+    {
+        return makeExpr(makeBinary(kind, node(a), node(b), scale, 0));
+    }
+    template <typename T1, typename T2>
+    static cv::MatExpr compare(const T1 &a, const T2 &b, int cmpop)
+    {
+        return makeExpr(makeBinary(Node::CMP, node(a), node(b), 1, cmpop));
+    }
+    template <typename T>
+    static cv::MatExpr unary(int kind, const T &a)
+    {
+        const NodePtr arg = node(a);
+        NodePtr n = cv::makePtr<Node>();
+        n->kind = kind;
+        n->type = arg->type;
+        n->size = arg->size;
+        n->left = arg;
+        return makeExpr(n);
+    }
+
+    void assign(const cv::MatExpr& expr, cv::Mat& m, int type = -1) const CV_OVERRIDE
+    {
+        const NodePtr &root = FusedMatExprNodeAllocator::get(expr.c);
+        if (type == -1 || type == root->type)
+        {
+            evaluate(root, m);
+            return;
+        }
+        cv::Mat temp;
+        evaluate(root, temp);
+        temp.convertTo(m, type);
+    }
+
+    void add(const cv::MatExpr& e1, const cv::MatExpr& e2, cv::MatExpr& res) const CV_OVERRIDE
+    {
+        res = binary(Node::ADD, e1, e2);
+    }
+    void add(const cv::MatExpr& e, const cv::Scalar& s, cv::MatExpr& res) const CV_OVERRIDE
+    {
+        res = binary(Node::ADD, e, s);
+    }
+    void subtract(const cv::MatExpr& e1, const cv::MatExpr& e2, cv::MatExpr& res) const CV_OVERRIDE
+    {
+        res = binary(Node::SUB, e1, e2);
+    }
+    void subtract(const cv::Scalar& s, const cv::MatExpr& e, cv::MatExpr& res) const CV_OVERRIDE
+    {
+        res = binary(Node::SUB, s, e);
+    }
+    void multiply(const cv::MatExpr& e1, const cv::MatExpr& e2, cv::MatExpr& res, double scale = 1) const CV_OVERRIDE
+    {
+        res = binary(Node::MUL, e1, e2, scale);
+    }
+    void multiply(const cv::MatExpr& e, double s, cv::MatExpr& res) const CV_OVERRIDE
+    {
+        res = binary(Node::MUL, e, cv::Scalar::all(s));
+    }
+    void divide(const cv::MatExpr& e1, const cv::MatExpr& e2, cv::MatExpr& res, double scale = 1) const CV_OVERRIDE
+    {
+        res = binary(Node::DIV, e1, e2, scale);
+    }
+    void divide(double s, const cv::MatExpr& e, cv::MatExpr& res) const CV_OVERRIDE
+    {
+        res = binary(Node::DIV, cv::Scalar::all(s), e);
+    }
+    void abs(const cv::MatExpr& e, cv::MatExpr& res) const CV_OVERRIDE
+    {
+        res = unary(Node::ABS, e);
+    }
+
+    cv::Size size(const cv::MatExpr& expr) const CV_OVERRIDE
+    {
+        return FusedMatExprNodeAllocator::get(expr.c)->size;
+    }
+    int type(const cv::MatExpr& expr) const CV_OVERRIDE
+    {
+        return FusedMatExprNodeAllocator::get(expr.c)->type;
+    }
+
+private:
+    FusedMatExprOp() {}
+
+    static const cv::MatOp *identityOp()
+    {
+        static const cv::MatOp *op = cv::MatExpr(cv::Mat()).op;
+        return op;
+    }
+
+    static NodePtr makeBinary(int kind, NodePtr l, NodePtr r, double scale, int cmpop)
+    {
+        CV_Assert(l->kind != Node::SCALAR || r->kind != Node::SCALAR);
+        // the scalar is kept on the right, except for the non-commutative s - e and s / e
+        if (l->kind == Node::SCALAR && kind != Node::SUB && kind != Node::DIV)
+        {
+            std::swap(l, r);
+            if (kind == Node::CMP)
+                cmpop = swapCmp(cmpop);
+        }
+        if (l->kind != Node::SCALAR && r->kind != Node::SCALAR && (l->size != r->size || l->type != r->type))
+        {
+            CV_Error(cv::Error::StsUnmatchedSizes,
+                "The operation is neither 'array op array' (where arrays have the same size and type), "
+                "nor 'array op scalar', nor 'scalar op array'");
+        }
+
+        const Node &arg = (l->kind == Node::SCALAR) ? *r : *l;
+        NodePtr n = cv::makePtr<Node>();
+        n->kind = kind;
+        n->type = (kind == Node::CMP) ? CV_MAKETYPE(CV_8U, CV_MAT_CN(arg.type)) : arg.type;
+        n->size = arg.size;
+        n->scale = scale;
+        n->cmpop = cmpop;
+        n->left = l;
+        n->right = r;
+        return n;
+    }
+
+    static int swapCmp(int cmpop)
+    {
+        switch (cmpop)
+        {
+        case cv::CMP_LT: return cv::CMP_GT;
+        case cv::CMP_LE: return cv::CMP_GE;
+        case cv::CMP_GT: return cv::CMP_LT;
+        case cv::CMP_GE: return cv::CMP_LE;
+        default: return cmpop;
+        }
+    }
+
+    static bool isFusableType(int type)
+    {
+        const int depth = CV_MAT_DEPTH(type);
+        return (depth < CV_32S || depth == CV_32F) && CV_MAT_CN(type) <= MatKernel::MaxChannels;
+    }
+    static bool isIntegerDepth(int type)
+    {
+        return CV_MAT_DEPTH(type) < CV_32S;
+    }
+
+    // whether the operator itself can be run by MatKernel (operands are handled by reduce())
+    static bool isFusable(const Node &n)
+    {
+        if (n.kind == Node::LEAF || n.kind == Node::SCALAR)
+            return true;
+        const Node &arg = (n.left->kind == Node::SCALAR) ? *n.right : *n.left;
+        if (!isFusableType(n.type) || !isFusableType(arg.type))
+            return false;
+        if ((n.kind == Node::AND || n.kind == Node::OR || n.kind == Node::XOR || n.kind == Node::NOT) && !isIntegerDepth(arg.type))
+            return false;
+        const Node *operands[] = { n.left.get(), n.right.get() };
+        for (int i = 0; i < 2; i++)
+        {
+            if (operands[i] != NULL && operands[i]->kind == Node::LEAF && operands[i]->mat.dims > 2)
+                return false;
+        }
+        return true;
+    }
+
+    static void evaluate(const NodePtr &n, cv::Mat &dst)
+    {
+        if (n->kind == Node::LEAF)
+            dst = n->mat;
+        else if (!isFusable(*n))
+            evaluateEager(*n, dst);
+        else
+            run(*reduce(n), dst);
+    }
+
+    // Rewrites the tree so that one MatKernel can run it: operands that cannot be fused, or that
+    // would exceed the input / stack limits of MatKernel, are evaluated separately into leaves.
+    static NodePtr reduce(const NodePtr &n)
+    {
+        if (n->kind == Node::LEAF || n->kind == Node::SCALAR)
+            return n;
+        if (!isFusable(*n))
+        {
+            cv::Mat m;
+            evaluateEager(*n, m);
+            return node(m);
+        }
+
+        // nodes may be shared with other expressions, so the rewritten tree is a copy
+        NodePtr r = cv::makePtr<Node>(*n);
+        r->left = reduce(n->left);
+        if (n->right)
+            r->right = reduce(n->right);
+
+        for (;;)
+        {
+            const int inputs = countInputs(*r);
+            const int depth = stackDepth(*r);
+            if (inputs <= MatKernel::MaxInputs && depth <= MatKernel::MaxStackDepth)
+                return r;
+
+            bool right;
+            if (inputs > MatKernel::MaxInputs)
+                right = r->right && countInputs(*r->right) > countInputs(*r->left);
+            else
+                right = r->right && stackDepth(*r->right) + 1 >= stackDepth(*r->left);
+            NodePtr &operand = right ? r->right : r->left;
+            cv::Mat m;
+            run(*operand, m);
+            operand = node(m);
+        }
+    }
+
+    static void run(const Node &n, cv::Mat &dst)
+    {
+        if (n.kind == Node::LEAF)
+        {
+            dst = n.mat;
+            return;
+        }
+        std::vector<cv::Mat> inputs;
+        std::vector<Program> programs(CV_MAT_CN(n.type));
+        for (size_t c = 0; c < programs.size(); c++)
+            emit(n, static_cast<int>(c), inputs, programs[c]);
+
+        const MatKernel kernel(programs, static_cast<int>(inputs.size()));
+        kernel.run(inputs, dst, n.type);
+    }
+
+    static void evaluateEager(const Node &n, cv::Mat &dst)
+    {
+        cv::Mat a, b;
+        if (n.left->kind != Node::SCALAR)
+            evaluate(n.left, a);
+        if (n.right && n.right->kind != Node::SCALAR)
+            evaluate(n.right, b);
+        const cv::_InputArray src1 = (n.left->kind == Node::SCALAR) ? cv::_InputArray(n.left->scalar) : cv::_InputArray(a);
+        const cv::_InputArray src2 = (n.right && n.right->kind == Node::SCALAR) ? cv::_InputArray(n.right->scalar) : cv::_InputArray(b);
+
+        switch (n.kind)
+        {
+        case Node::ADD: cv::add(src1, src2, dst); break;
+        case Node::SUB: cv::subtract(src1, src2, dst); break;
+        case Node::MUL: cv::multiply(src1, src2, dst, n.scale); break;
+        case Node::DIV:
+            if (n.left->kind == Node::SCALAR)
+                cv::divide(n.left->scalar[0] * n.scale, b, dst);
+            else
+                cv::divide(src1, src2, dst, n.scale);
+            break;
+        case Node::CMP: cv::compare(src1, src2, dst, n.cmpop); break;
+        case Node::AND: cv::bitwise_and(src1, src2, dst); break;
+        case Node::OR: cv::bitwise_or(src1, src2, dst); break;
+        case Node::XOR: cv::bitwise_xor(src1, src2, dst); break;
+        case Node::NOT: cv::bitwise_not(a, dst); break;
+        case Node::ABS: dst = cv::abs(a); break;
+        default: CV_Error(cv::Error::StsInternal, "FusedMatExpr: unknown node");
+        }
+    }
+
+    static int findInput(std::vector<cv::Mat> &inputs, const cv::Mat &m)
+    {
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            const cv::Mat &in = inputs[i];
+            if (in.data == m.data && in.step[0] == m.step[0] && in.type() == m.type() && in.size() == m.size())
+                return static_cast<int>(i);
+        }
+        inputs.push_back(m);
+        return static_cast<int>(inputs.size()) - 1;
+    }
+
+    static int countInputs(const Node &n)
+    {
+        std::vector<cv::Mat> inputs;
+        collectInputs(n, inputs);
+        return static_cast<int>(inputs.size());
+    }
+    static void collectInputs(const Node &n, std::vector<cv::Mat> &inputs)
+    {
+        if (n.kind == Node::LEAF)
+            findInput(inputs, n.mat);
+        if (n.left)
+            collectInputs(*n.left, inputs);
+        if (n.right)
+            collectInputs(*n.right, inputs);
+    }
+
+    // stack slots used by emit()
+    static int stackDepth(const Node &n)
+    {
+        if (n.kind == Node::LEAF || n.kind == Node::SCALAR)
+            return 1;
+        int depth = std::max(stackDepth(*n.left), 2);
+        if (n.right)
+            depth = std::max(depth, stackDepth(*n.right) + 1);
+        return depth;
+    }
+
+    static void push(Program &code, int op, int input = 0, int channel = 0, float value = 0)
+    {
+        MatKernel::Instruction ins = { op, input, channel, value };
+        code.push_back(ins);
+    }
+    static void pushConst(Program &code, double value)
+    {
+        push(code, MatKernel::OP_CONST, 0, 0, static_cast<float>(value));
+    }
+
+    // Like cv::bitwise_and etc., which convert a scalar operand to the depth of the array first
+    // (m & 300 is m & 255 on 8U, m & -1 is m & 0)
+    static void emitBitwiseOperand(const Node &n, int depth, int c, std::vector<cv::Mat> &inputs, Program &code)
+    {
+        if (n.kind != Node::SCALAR)
+        {
+            emit(n, c, inputs, code);
+            return;
+        }
+        const double v = n.scalar[c];
+        switch (depth)
+        {
+        case CV_8U: pushConst(code, cv::saturate_cast<uchar>(v)); break;
+        case CV_8S: pushConst(code, cv::saturate_cast<schar>(v)); break;
+        case CV_16U: pushConst(code, cv::saturate_cast<ushort>(v)); break;
+        case CV_16S: pushConst(code, cv::saturate_cast<short>(v)); break;
+        default: pushConst(code, v); break;
+        }
+    }
+
+    static void emit(const Node &n, int c, std::vector<cv::Mat> &inputs, Program &code)
+    {
+        switch (n.kind)
+        {
+        case Node::LEAF:
+            push(code, MatKernel::OP_LOAD, findInput(inputs, n.mat), n.mat.channels() == 1 ? 0 : c);
+            return;
+        case Node::SCALAR:
+            pushConst(code, n.scalar[c]);
+            return;
+
+        case Node::CMP:
+            emit(*n.left, c, inputs, code);
+            emit(*n.right, c, inputs, code);
+            push(code, cmpOpCode(n.cmpop));
+            pushConst(code, 255);
+            push(code, MatKernel::OP_MUL);
+            return;
+        case Node::AND:
+        case Node::OR:
+        case Node::XOR:
+            emitBitwiseOperand(*n.left, CV_MAT_DEPTH(n.type), c, inputs, code);
+            emitBitwiseOperand(*n.right, CV_MAT_DEPTH(n.type), c, inputs, code);
+            push(code, n.kind == Node::AND ? MatKernel::OP_BAND : n.kind == Node::OR ? MatKernel::OP_BOR : MatKernel::OP_BXOR);
+            return;
+        case Node::NOT:
+            // ~x == x ^ (all bits of the type)
+            emit(*n.left, c, inputs, code);
+            pushConst(code, CV_MAT_DEPTH(n.type) == CV_8U ? 255 : CV_MAT_DEPTH(n.type) == CV_16U ? 65535 : -1);
+            push(code, MatKernel::OP_BXOR);
+            return;
+
+        case Node::ABS:
+            emit(*n.left, c, inputs, code);
+            push(code, MatKernel::OP_ABS);
+            break;
+        case Node::ADD:
+        case Node::SUB:
+            emit(*n.left, c, inputs, code);
+            emit(*n.right, c, inputs, code);
+            push(code, n.kind == Node::ADD ? MatKernel::OP_ADD : MatKernel::OP_SUB);
+            break;
+        case Node::MUL:
+            emit(*n.left, c, inputs, code);
+            emit(*n.right, c, inputs, code);
+            push(code, MatKernel::OP_MUL);
+            if (n.scale != 1)
+            {
+                pushConst(code, n.scale);
+                push(code, MatKernel::OP_MUL);
+            }
+            break;
+        case Node::DIV:
+            emit(*n.left, c, inputs, code);
+            if (n.scale != 1)
+            {
+                pushConst(code, n.scale);
+                push(code, MatKernel::OP_MUL);
+            }
+            emit(*n.right, c, inputs, code);
+            // integer division by zero gives 0 in OpenCV
+            push(code, isIntegerDepth(n.type) ? MatKernel::OP_DIVZ : MatKernel::OP_DIV);
+            break;
+        default:
+            CV_Error(cv::Error::StsInternal, "FusedMatExpr: unknown node");
+        }
+
+        // saturate the intermediate result to its type
+        double lo, hi;
+        if (depthRange(CV_MAT_DEPTH(n.type), lo, hi))
+        {
+            pushConst(code, lo);
+            push(code, MatKernel::OP_MAX);
+            pushConst(code, hi);
+            push(code, MatKernel::OP_MIN);
+        }
+    }
+
+    static int cmpOpCode(int cmpop)
+    {
+        switch (cmpop)
+        {
+        case cv::CMP_LT: return MatKernel::OP_LT;
+        case cv::CMP_LE: return MatKernel::OP_LE;
+        case cv::CMP_GT: return MatKernel::OP_GT;
+        case cv::CMP_GE: return MatKernel::OP_GE;
+        case cv::CMP_EQ: return MatKernel::OP_EQ;
+        case cv::CMP_NE: return MatKernel::OP_NE;
+        default: break;
+        }
+        CV_Error(cv::Error::StsBadArg, "FusedMatExpr: unknown comparison");
+        return -1;
+    }
+
+    static bool depthRange(int depth, double &lo, double &hi)
+    {
+        switch (depth)
+        {
+        case CV_8U: lo = 0; hi = 255; return true;
+        case CV_8S: lo = -128; hi = 127; return true;
+        case CV_16U: lo = 0; hi = 65535; return true;
+        case CV_16S: lo = -32768; hi = 32767; return true;
+        default: return false;
+        }
+    }
+
+};
+
+
+CVAPI(void) core_MatExpr_setFusedEvaluation(int enabled)
+{
+    FusedMatExprOp::enabled() = (enabled != 0);
+}
+CVAPI(int) core_MatExpr_getFusedEvaluation()
+{
+    return FusedMatExprOp::enabled() ? 1 : 0;
+}
+
+CVAPI(int) core_MatExpr_isFused(cv::MatExpr *self)
+{
+    return FusedMatExprOp::isFused(*self) ? 1 : 0;
+}
+
+#endif
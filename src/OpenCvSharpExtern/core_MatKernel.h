@@ -0,0 +1,752 @@
+#ifndef _CPP_CORE_MATKERNEL_H_
+#define _CPP_CORE_MATKERNEL_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include <opencv2/core/hal/intrin.hpp>
+#include <cctype>
+#include <list>
+#include <map>
+#include <mutex>
+
+// Per-element expression kernel (native replacement of Mat.ForEach callbacks).
+//
+// An expression such as "a * 0.5 + b" or "a.z; a.y; a.x" is compiled once into a small
+// stack bytecode and evaluated natively over 1-4 input Mats of the same size.
+// ';' separates the expressions of the output channels; a single expression is applied to every channel.
+//
+//  inputs    : a, b, c, d  (optionally with channel: a.x a.y a.z a.w or a.0 .. a.3;
+//              without channel the current output channel is read, or channel 0 for 1-channel inputs)
+//  operators : + - * /  unary - !  < <= > >= == !=  && ||  cond ? x : y
+//  functions : min(x,y) max(x,y) abs(x) sqrt(x) clamp(x,lo,hi) select(cond,x,y)
+//              bitand(x,y) bitor(x,y) bitxor(x,y)  (on the values rounded to int32)
+//
+// Evaluation is done in float32 on row blocks (universal intrinsics), rows are distributed by
+// cv::parallel_for_, and results are stored to the destination depth with saturate_cast.
+
+class MatKernel
+{
+public:
+    enum OpCode
+    {
+        OP_LOAD, OP_CONST,
+        OP_ADD, OP_SUB, OP_MUL, OP_DIV, OP_MIN, OP_MAX,
+        OP_LT, OP_LE, OP_GT, OP_GE, OP_EQ, OP_NE, OP_AND, OP_OR,
+        OP_BAND, OP_BOR, OP_BXOR,
+        OP_DIVZ, // a / b, or 0 when b == 0 (OpenCV integer division); not available in expressions
+        OP_NEG, OP_NOT, OP_ABS, OP_SQRT,
+        OP_SELECT,
+    };
+
+    struct Instruction
+    {
+        int op;
+        int input;   // OP_LOAD
+        int channel; // OP_LOAD; -1 = current output channel
+        float value; // OP_CONST
+    };
+
+    enum
+    {
+        MaxInputs = 4,
+        MaxChannels = 4,
+        MaxStackDepth = 32,
+        MaxNesting = 256,   // recursion depth of the parser (parentheses, unary operators, ?:)
+        BlockSize = 256,
+    };
+
+    explicit MatKernel(const std::string &expression)
+        : expression_(expression), numInputs_(0)
+    {
+        Parser parser(expression, *this);
+        parser.parseAll();
+    }
+
+    // Builds a kernel from already compiled per-channel programs (used by the MatExpr fusion)
+    MatKernel(const std::vector<std::vector<Instruction> > &programs, int numInputs)
+        : programs_(programs), numInputs_(numInputs)
+    {
+        CV_Assert(!programs_.empty() && programs_.size() <= (size_t)MaxChannels);
+        CV_Assert(numInputs_ >= 0 && numInputs_ <= MaxInputs);
+    }
+
+    const std::string &expression() const { return expression_; }
+    int numInputs() const { return numInputs_; }
+    int numPrograms() const { return static_cast<int>(programs_.size()); }
+
+    void run(const std::vector<cv::Mat> &inputs, cv::Mat &dst, int dstType) const
+    {
+        CV_Assert(!inputs.empty() && inputs.size() <= (size_t)MaxInputs);
+        if ((int)inputs.size() < numInputs_)
+            CV_Error(cv::Error::StsBadArg, "MatKernel: the expression refers to more inputs than were given");
+
+        const cv::Size size = inputs[0].size();
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            CV_Assert(inputs[i].dims <= 2 && inputs[i].size() == size);
+            CV_Assert(inputs[i].channels() <= MaxChannels);
+            CV_Assert(inputs[i].depth() <= CV_64F);
+        }
+
+        const int dstCn = CV_MAT_CN(dstType);
+        CV_Assert(dstCn <= MaxChannels);
+        if (numPrograms() != 1 && numPrograms() != dstCn)
+            CV_Error(cv::Error::StsBadArg, "MatKernel: the number of expressions must be 1 or the number of destination channels");
+
+        // resolve the channel each LOAD reads for each output channel
+        std::vector<std::vector<Instruction> > resolved(dstCn);
+        for (int c = 0; c < dstCn; c++)
+        {
+            resolved[c] = programs_[numPrograms() == 1 ? 0 : c];
+            for (size_t i = 0; i < resolved[c].size(); i++)
+            {
+                Instruction &ins = resolved[c][i];
+                if (ins.op != OP_LOAD)
+                    continue;
+                const int inCn = inputs[ins.input].channels();
+                if (ins.channel < 0)
+                    ins.channel = (inCn == 1) ? 0 : c;
+                if (ins.channel >= inCn)
+                    CV_Error(cv::Error::StsOutOfRange, "MatKernel: channel index exceeds the channels of the input");
+            }
+        }
+
+        // src keeps its own headers, so dst may be one of the inputs
+        std::vector<cv::Mat> src(inputs);
+        dst.create(size, dstType);
+        Invoker invoker(resolved, src, dst);
+        tracedParallelFor("MatKernel", cv::Range(0, size.height), invoker,
+            static_cast<double>(size.area()) / (1 << 16));
+    }
+
+private:
+    std::string expression_;
+    std::vector<std::vector<Instruction> > programs_;
+    int numInputs_;
+
+    class Parser
+    {
+    public:
+        Parser(const std::string &s, MatKernel &k) : src(s), pos(0), kernel(k), depth(0), maxDepth(0), nesting(0) {}
+
+        void parseAll()
+        {
+            do
+            {
+                code.clear();
+                depth = maxDepth = 0;
+                parseTernary();
+                if (maxDepth > MaxStackDepth)
+                    fail("expression is too deeply nested");
+                kernel.programs_.push_back(code);
+                skipSpaces();
+            } while (accept(';') && !atEnd());
+            if (!atEnd())
+                fail("unexpected character");
+            if ((int)kernel.programs_.size() > MaxChannels)
+                fail("too many channel expressions");
+        }
+
+    private:
+        const std::string &src;
+        size_t pos;
+        MatKernel &kernel;
+        std::vector<Instruction> code;
+        int depth, maxDepth;
+        int nesting;
+
+        // Bounds the recursion of the parser, which follows the nesting of the expression: the stack depth
+        // check of parseAll only runs after parsing, and misses e.g. "----a" or "((((a))))".
+        class Nested
+        {
+        public:
+            explicit Nested(Parser &p) : parser(p)
+            {
+                if (++parser.nesting > MaxNesting)
+                    parser.fail("expression is too deeply nested");
+            }
+            ~Nested()
+            {
+                parser.nesting--;
+            }
+        private:
+            Parser &parser;
+            Nested(const Nested &);
+            Nested &operator=(const Nested &);
+        };
+
+        void fail(const char *msg) const
+        {
+            std::ostringstream ss;
+            ss << "MatKernel: " << msg << " at position " << pos << " in \"" << src << "\"";
+            CV_Error(cv::Error::StsParseError, ss.str());
+        }
+
+        void skipSpaces()
+        {
+            while (pos < src.size() && std::isspace(static_cast<uchar>(src[pos])))
+                pos++;
+        }
+        bool atEnd()
+        {
+            skipSpaces();
+            return pos >= src.size();
+        }
+        bool accept(const char *token)
+        {
+            skipSpaces();
+            const size_t len = std::strlen(token);
+            if (src.compare(pos, len, token) != 0)
+                return false;
+            pos += len;
+            return true;
+        }
+        bool accept(char c)
+        {
+            skipSpaces();
+            if (pos < src.size() && src[pos] == c)
+            {
+                pos++;
+                return true;
+            }
+            return false;
+        }
+        void expect(char c)
+        {
+            if (!accept(c))
+            {
+                std::string msg = std::string("'") + c + "' expected";
+                fail(msg.c_str());
+            }
+        }
+
+        void emit(int op, int input = 0, int channel = 0, float value = 0)
+        {
+            Instruction ins = { op, input, channel, value };
+            code.push_back(ins);
+            if (op == OP_LOAD || op == OP_CONST)
+                depth++;
+            else if (op == OP_SELECT)
+                depth -= 2;
+            else if (op < OP_NEG)
+                depth--;
+            maxDepth = std::max(maxDepth, depth);
+        }
+
+        void parseTernary()
+        {
+            Nested nested(*this);
+            parseOr();
+            if (accept('?'))
+            {
+                parseTernary();
+                expect(':');
+                parseTernary();
+                emit(OP_SELECT);
+            }
+        }
+        void parseOr()
+        {
+            parseAnd();
+            while (accept("||"))
+            {
+                parseAnd();
+                emit(OP_OR);
+            }
+        }
+        void parseAnd()
+        {
+            parseComparison();
+            while (accept("&&"))
+            {
+                parseComparison();
+                emit(OP_AND);
+            }
+        }
+        void parseComparison()
+        {
+            parseAdditive();
+            for (;;)
+            {
+                int op;
+                if (accept("<=")) op = OP_LE;
+                else if (accept(">=")) op = OP_GE;
+                else if (accept("==")) op = OP_EQ;
+                else if (accept("!=")) op = OP_NE;
+                else if (accept('<')) op = OP_LT;
+                else if (accept('>')) op = OP_GT;
+                else break;
+                parseAdditive();
+                emit(op);
+            }
+        }
+        void parseAdditive()
+        {
+            parseTerm();
+            for (;;)
+            {
+                if (accept('+')) { parseTerm(); emit(OP_ADD); }
+                else if (accept('-')) { parseTerm(); emit(OP_SUB); }
+                else break;
+            }
+        }
+        void parseTerm()
+        {
+            parseUnary();
+            for (;;)
+            {
+                if (accept('*')) { parseUnary(); emit(OP_MUL); }
+                else if (accept('/')) { parseUnary(); emit(OP_DIV); }
+                else break;
+            }
+        }
+        void parseUnary()
+        {
+            Nested nested(*this);
+            if (accept('-')) { parseUnary(); emit(OP_NEG); }
+            else if (accept('+')) { parseUnary(); }
+            else if (accept('!')) { parseUnary(); emit(OP_NOT); }
+            else parsePrimary();
+        }
+
+        void parseArguments(int count)
+        {
+            expect('(');
+            for (int i = 0; i < count; i++)
+            {
+                if (i > 0)
+                    expect(',');
+                parseTernary();
+            }
+            expect(')');
+        }
+
+        void parsePrimary()
+        {
+            Nested nested(*this);
+            skipSpaces();
+            if (accept('('))
+            {
+                parseTernary();
+                expect(')');
+                return;
+            }
+            if (pos < src.size() && (std::isdigit(static_cast<uchar>(src[pos])) || src[pos] == '.'))
+            {
+                const char *begin = src.c_str() + pos;
+                char *end = NULL;
+                const double value = std::strtod(begin, &end);
+                if (end == begin)
+                    fail("invalid number");
+                pos += end - begin;
+                emit(OP_CONST, 0, 0, static_cast<float>(value));
+                return;
+            }
+
+            std::string ident;
+            while (pos < src.size() && (std::isalnum(static_cast<uchar>(src[pos])) || src[pos] == '_'))
+                ident += src[pos++];
+            if (ident.empty())
+                fail("operand expected");
+
+            if (ident.size() == 1 && ident[0] >= 'a' && ident[0] < 'a' + MaxInputs)
+            {
+                const int input = ident[0] - 'a';
+                int channel = -1;
+                if (accept('.'))
+                {
+                    const char c = (pos < src.size()) ? src[pos++] : '\0';
+                    switch (c)
+                    {
+                    case 'x': case '0': channel = 0; break;
+                    case 'y': case '1': channel = 1; break;
+                    case 'z': case '2': channel = 2; break;
+                    case 'w': case '3': channel = 3; break;
+                    default: fail("channel selector must be one of x y z w 0 1 2 3");
+                    }
+                }
+                kernel.numInputs_ = std::max(kernel.numInputs_, input + 1);
+                emit(OP_LOAD, input, channel);
+            }
+            else if (ident == "min") { parseArguments(2); emit(OP_MIN); }
+            else if (ident == "max") { parseArguments(2); emit(OP_MAX); }
+            else if (ident == "abs") { parseArguments(1); emit(OP_ABS); }
+            else if (ident == "sqrt") { parseArguments(1); emit(OP_SQRT); }
+            else if (ident == "bitand") { parseArguments(2); emit(OP_BAND); }
+            else if (ident == "bitor") { parseArguments(2); emit(OP_BOR); }
+            else if (ident == "bitxor") { parseArguments(2); emit(OP_BXOR); }
+            else if (ident == "select") { parseArguments(3); emit(OP_SELECT); }
+            else if (ident == "clamp")
+            {
+                // clamp(x, lo, hi) = min(max(x, lo), hi)
+                expect('(');
+                parseTernary();
+                expect(',');
+                parseTernary();
+                emit(OP_MAX);
+                expect(',');
+                parseTernary();
+                emit(OP_MIN);
+                expect(')');
+            }
+            else
+            {
+                fail("unknown identifier");
+            }
+        }
+    };
+
+    struct Add { static float f(float a, float b) { return a + b; } };
+    struct Sub { static float f(float a, float b) { return a - b; } };
+    struct Mul { static float f(float a, float b) { return a * b; } };
+    struct Div { static float f(float a, float b) { return a / b; } };
+    struct DivZ { static float f(float a, float b) { return b != 0 ? a / b : 0.f; } };
+    struct Min { static float f(float a, float b) { return std::min(a, b); } };
+    struct Max { static float f(float a, float b) { return std::max(a, b); } };
+    struct Lt { static float f(float a, float b) { return a < b ? 1.f : 0.f; } };
+    struct Le { static float f(float a, float b) { return a <= b ? 1.f : 0.f; } };
+    struct Gt { static float f(float a, float b) { return a > b ? 1.f : 0.f; } };
+    struct Ge { static float f(float a, float b) { return a >= b ? 1.f : 0.f; } };
+    struct Eq { static float f(float a, float b) { return a == b ? 1.f : 0.f; } };
+    struct Ne { static float f(float a, float b) { return a != b ? 1.f : 0.f; } };
+    struct And { static float f(float a, float b) { return (a != 0 && b != 0) ? 1.f : 0.f; } };
+    struct Or { static float f(float a, float b) { return (a != 0 || b != 0) ? 1.f : 0.f; } };
+    struct BAnd { static float f(float a, float b) { return static_cast<float>(cvRound(a) & cvRound(b)); } };
+    struct BOr { static float f(float a, float b) { return static_cast<float>(cvRound(a) | cvRound(b)); } };
+    struct BXor { static float f(float a, float b) { return static_cast<float>(cvRound(a) ^ cvRound(b)); } };
+    struct Neg { static float f(float a) { return -a; } };
+    struct Not { static float f(float a) { return a == 0 ? 1.f : 0.f; } };
+    struct Abs { static float f(float a) { return std::abs(a); } };
+    struct Sqrt { static float f(float a) { return std::sqrt(a); } };
+
+#if CV_SIMD
+    typedef cv::v_float32 vf;
+    static vf one() { return cv::vx_setall_f32(1.f); }
+    static vf zero() { return cv::vx_setzero_f32(); }
+    static vf v(Add, const vf &a, const vf &b) { return a + b; }
+    static vf v(Sub, const vf &a, const vf &b) { return a - b; }
+    static vf v(Mul, const vf &a, const vf &b) { return a * b; }
+    static vf v(Div, const vf &a, const vf &b) { return a / b; }
+    static vf v(DivZ, const vf &a, const vf &b) { return cv::v_select(b != zero(), a / b, zero()); }
+    static vf v(Min, const vf &a, const vf &b) { return cv::v_min(a, b); }
+    static vf v(Max, const vf &a, const vf &b) { return cv::v_max(a, b); }
+    static vf v(Lt, const vf &a, const vf &b) { return (a < b) & one(); }
+    static vf v(Le, const vf &a, const vf &b) { return (a <= b) & one(); }
+    static vf v(Gt, const vf &a, const vf &b) { return (a > b) & one(); }
+    static vf v(Ge, const vf &a, const vf &b) { return (a >= b) & one(); }
+    static vf v(Eq, const vf &a, const vf &b) { return (a == b) & one(); }
+    static vf v(Ne, const vf &a, const vf &b) { return (a != b) & one(); }
+    static vf v(And, const vf &a, const vf &b) { return ((a != zero()) & (b != zero())) & one(); }
+    static vf v(Or, const vf &a, const vf &b) { return ((a != zero()) | (b != zero())) & one(); }
+    static vf v(BAnd, const vf &a, const vf &b) { return cv::v_cvt_f32(cv::v_round(a) & cv::v_round(b)); }
+    static vf v(BOr, const vf &a, const vf &b) { return cv::v_cvt_f32(cv::v_round(a) | cv::v_round(b)); }
+    static vf v(BXor, const vf &a, const vf &b) { return cv::v_cvt_f32(cv::v_round(a) ^ cv::v_round(b)); }
+    static vf v(Neg, const vf &a) { return zero() - a; }
+    static vf v(Not, const vf &a) { return (a == zero()) & one(); }
+    static vf v(Abs, const vf &a) { return cv::v_abs(a); }
+    static vf v(Sqrt, const vf &a) { return cv::v_sqrt(a); }
+#endif
+
+    template <typename TOp>
+    static void binary(const float *a, const float *b, float *dst, int n)
+    {
+        int i = 0;
+#if CV_SIMD
+        for (; i <= n - vf::nlanes; i += vf::nlanes)
+            cv::v_store(dst + i, v(TOp(), cv::vx_load(a + i), cv::vx_load(b + i)));
+#endif
+        for (; i < n; i++)
+            dst[i] = TOp::f(a[i], b[i]);
+    }
+
+    template <typename TOp>
+    static void unary(const float *a, float *dst, int n)
+    {
+        int i = 0;
+#if CV_SIMD
+        for (; i <= n - vf::nlanes; i += vf::nlanes)
+            cv::v_store(dst + i, v(TOp(), cv::vx_load(a + i)));
+#endif
+        for (; i < n; i++)
+            dst[i] = TOp::f(a[i]);
+    }
+
+    static void select(const float *c, const float *a, const float *b, float *dst, int n)
+    {
+        int i = 0;
+#if CV_SIMD
+        for (; i <= n - vf::nlanes; i += vf::nlanes)
+            cv::v_store(dst + i, cv::v_select(cv::vx_load(c + i) != zero(), cv::vx_load(a + i), cv::vx_load(b + i)));
+#endif
+        for (; i < n; i++)
+            dst[i] = (c[i] != 0) ? a[i] : b[i];
+    }
+
+    template <typename T>
+    static void loadChannel(const uchar *row, int cn, int channel, int x0, int n, float *dst)
+    {
+        const T *p = reinterpret_cast<const T*>(row) + (size_t)x0 * cn + channel;
+        for (int i = 0; i < n; i++, p += cn)
+            dst[i] = static_cast<float>(*p);
+    }
+
+    template <typename T>
+    static void storeChannel(const float *src, int n, uchar *row, int cn, int channel, int x0)
+    {
+        T *p = reinterpret_cast<T*>(row) + (size_t)x0 * cn + channel;
+        for (int i = 0; i < n; i++, p += cn)
+            *p = cv::saturate_cast<T>(src[i]);
+    }
+
+    typedef void(*LoadFunc)(const uchar*, int, int, int, int, float*);
+    typedef void(*StoreFunc)(const float*, int, uchar*, int, int, int);
+
+    static LoadFunc getLoadFunc(int depth)
+    {
+        static const LoadFunc funcs[] = {
+            loadChannel<uchar>, loadChannel<schar>, loadChannel<ushort>, loadChannel<short>,
+            loadChannel<int>, loadChannel<float>, loadChannel<double>,
+        };
+        return funcs[depth];
+    }
+    static StoreFunc getStoreFunc(int depth)
+    {
+        static const StoreFunc funcs[] = {
+            storeChannel<uchar>, storeChannel<schar>, storeChannel<ushort>, storeChannel<short>,
+            storeChannel<int>, storeChannel<float>, storeChannel<double>,
+        };
+        return funcs[depth];
+    }
+
+    class Invoker : public cv::ParallelLoopBody
+    {
+    public:
+        Invoker(const std::vector<std::vector<Instruction> > &programs,
+            const std::vector<cv::Mat> &src, cv::Mat &dst)
+            : programs(programs), src(src), dst(dst)
+        {
+        }
+
+        void operator()(const cv::Range &range) const CV_OVERRIDE
+        {
+            const int nInputs = static_cast<int>(src.size());
+            const int dstCn = dst.channels();
+            const int cols = dst.cols;
+
+            // channel buffers (converted inputs), one temporary per stack slot, and constants
+            int nConst = 0;
+            bool used[MaxInputs][MaxChannels] = {};
+            for (size_t c = 0; c < programs.size(); c++)
+            {
+                for (size_t i = 0; i < programs[c].size(); i++)
+                {
+                    const Instruction &ins = programs[c][i];
+                    if (ins.op == OP_LOAD)
+                        used[ins.input][ins.channel] = true;
+                    else if (ins.op == OP_CONST)
+                        nConst++;
+                }
+            }
+            const int nBuffers = MaxInputs * MaxChannels + MaxStackDepth + nConst;
+            cv::AutoBuffer<float> buffer((size_t)nBuffers * BlockSize);
+            float *channels = buffer.data();
+            float *temps = channels + MaxInputs * MaxChannels * BlockSize;
+            float *consts = temps + MaxStackDepth * BlockSize;
+
+            // constant buffers are filled once; they are addressed in program order
+            std::vector<std::vector<const float*> > constPtrs(programs.size());
+            {
+                float *p = consts;
+                for (size_t c = 0; c < programs.size(); c++)
+                {
+                    for (size_t i = 0; i < programs[c].size(); i++)
+                    {
+                        if (programs[c][i].op != OP_CONST)
+                            continue;
+                        std::fill(p, p + BlockSize, programs[c][i].value);
+                        constPtrs[c].push_back(p);
+                        p += BlockSize;
+                    }
+                }
+            }
+
+            std::vector<LoadFunc> loads(nInputs);
+            for (int k = 0; k < nInputs; k++)
+                loads[k] = getLoadFunc(src[k].depth());
+            const StoreFunc store = getStoreFunc(dst.depth());
+
+            const float *stack[MaxStackDepth];
+            for (int y = range.start; y < range.end; y++)
+            {
+                uchar *dstRow = dst.ptr(y);
+                for (int x0 = 0; x0 < cols; x0 += BlockSize)
+                {
+                    const int n = std::min<int>(BlockSize, cols - x0);
+
+                    for (int k = 0; k < nInputs; k++)
+                    {
+                        const uchar *row = src[k].ptr(y);
+                        const int cn = src[k].channels();
+                        for (int ch = 0; ch < cn; ch++)
+                        {
+                            if (used[k][ch])
+                                loads[k](row, cn, ch, x0, n, channels + (k * MaxChannels + ch) * BlockSize);
+                        }
+                    }
+
+                    for (int c = 0; c < dstCn; c++)
+                    {
+                        const std::vector<Instruction> &code = programs[c];
+                        int sp = 0, ci = 0;
+                        for (size_t i = 0; i < code.size(); i++)
+                        {
+                            const Instruction &ins = code[i];
+                            float *out;
+                            switch (ins.op)
+                            {
+                            case OP_LOAD:
+                                stack[sp++] = channels + (ins.input * MaxChannels + ins.channel) * BlockSize;
+                                break;
+                            case OP_CONST:
+                                stack[sp++] = constPtrs[c][ci++];
+                                break;
+                            case OP_SELECT:
+                                out = temps + (sp - 3) * BlockSize;
+                                select(stack[sp - 3], stack[sp - 2], stack[sp - 1], out, n);
+                                sp -= 2;
+                                stack[sp - 1] = out;
+                                break;
+                            case OP_NEG: case OP_NOT: case OP_ABS: case OP_SQRT:
+                                out = temps + (sp - 1) * BlockSize;
+                                runUnary(ins.op, stack[sp - 1], out, n);
+                                stack[sp - 1] = out;
+                                break;
+                            default:
+                                out = temps + (sp - 2) * BlockSize;
+                                runBinary(ins.op, stack[sp - 2], stack[sp - 1], out, n);
+                                sp--;
+                                stack[sp - 1] = out;
+                                break;
+                            }
+                        }
+                        store(stack[0], n, dstRow, dstCn, c, x0);
+                    }
+                }
+            }
+        }
+
+    private:
+        const std::vector<std::vector<Instruction> > &programs;
+        const std::vector<cv::Mat> &src;
+        cv::Mat &dst;
+
+        static void runBinary(int op, const float *a, const float *b, float *dst, int n)
+        {
+            switch (op)
+            {
+            case OP_ADD: binary<Add>(a, b, dst, n); break;
+            case OP_SUB: binary<Sub>(a, b, dst, n); break;
+            case OP_MUL: binary<Mul>(a, b, dst, n); break;
+            case OP_DIV: binary<Div>(a, b, dst, n); break;
+            case OP_DIVZ: binary<DivZ>(a, b, dst, n); break;
+            case OP_MIN: binary<Min>(a, b, dst, n); break;
+            case OP_MAX: binary<Max>(a, b, dst, n); break;
+            case OP_LT: binary<Lt>(a, b, dst, n); break;
+            case OP_LE: binary<Le>(a, b, dst, n); break;
+            case OP_GT: binary<Gt>(a, b, dst, n); break;
+            case OP_GE: binary<Ge>(a, b, dst, n); break;
+            case OP_EQ: binary<Eq>(a, b, dst, n); break;
+            case OP_NE: binary<Ne>(a, b, dst, n); break;
+            case OP_AND: binary<And>(a, b, dst, n); break;
+            case OP_OR: binary<Or>(a, b, dst, n); break;
+            case OP_BAND: binary<BAnd>(a, b, dst, n); break;
+            case OP_BOR: binary<BOr>(a, b, dst, n); break;
+            case OP_BXOR: binary<BXor>(a, b, dst, n); break;
+            default: CV_Error(cv::Error::StsInternal, "MatKernel: unknown opcode");
+            }
+        }
+        static void runUnary(int op, const float *a, float *dst, int n)
+        {
+            switch (op)
+            {
+            case OP_NEG: unary<Neg>(a, dst, n); break;
+            case OP_NOT: unary<Not>(a, dst, n); break;
+            case OP_ABS: unary<Abs>(a, dst, n); break;
+            case OP_SQRT: unary<Sqrt>(a, dst, n); break;
+            default: CV_Error(cv::Error::StsInternal, "MatKernel: unknown opcode");
+            }
+        }
+    };
+};
+
+#pragma region Cache
+
+// Compiled kernels by expression, least recently used first dropped: expressions with embedded constants
+// would otherwise grow the cache without limit
+static const size_t matKernelCacheCapacity = 256;
+static std::mutex matKernelCacheMutex;
+static std::list<std::string> matKernelCacheOrder; // most recently used first
+static std::map<std::string, std::pair<cv::Ptr<MatKernel>, std::list<std::string>::iterator> > matKernelCache;
+
+static cv::Ptr<MatKernel> getMatKernel(const std::string &expression)
+{
+    std::lock_guard<std::mutex> lock(matKernelCacheMutex);
+    const auto it = matKernelCache.find(expression);
+    if (it != matKernelCache.end())
+    {
+        matKernelCacheOrder.splice(matKernelCacheOrder.begin(), matKernelCacheOrder, it->second.second);
+        return it->second.first;
+    }
+    cv::Ptr<MatKernel> kernel = cv::makePtr<MatKernel>(expression);
+    if (matKernelCache.size() >= matKernelCacheCapacity)
+    {
+        matKernelCache.erase(matKernelCacheOrder.back());
+        matKernelCacheOrder.pop_back();
+    }
+    matKernelCacheOrder.push_front(expression);
+    matKernelCache[expression] = std::make_pair(kernel, matKernelCacheOrder.begin());
+    return kernel;
+}
+
+#pragma endregion
+
+
+CVAPI(cv::Ptr<MatKernel>*) core_MatKernel_new(const char *expression)
+{
+    return clone(getMatKernel(expression));
+}
+CVAPI(void) core_MatKernel_delete(cv::Ptr<MatKernel> *obj)
+{
+    deleteHandle(obj);
+}
+
+CVAPI(int) core_MatKernel_numInputs(cv::Ptr<MatKernel> *obj)
+{
+    return (*obj)->numInputs();
+}
+CVAPI(int) core_MatKernel_numPrograms(cv::Ptr<MatKernel> *obj)
+{
+    return (*obj)->numPrograms();
+}
+
+CVAPI(void) core_MatKernel_run(cv::Ptr<MatKernel> *obj, cv::Mat **inputs, int inputsLength, cv::Mat *dst, int dstType)
+{
+    ScratchVector<cv::Mat> inputsVec;
+    toVec(inputs, inputsLength, *inputsVec);
+    (*obj)->run(*inputsVec, *dst, dstType);
+}
+
+CVAPI(uint64) core_MatKernel_cacheSize()
+{
+    std::lock_guard<std::mutex> lock(matKernelCacheMutex);
+    return matKernelCache.size();
+}
+CVAPI(void) core_MatKernel_clearCache()
+{
+    std::lock_guard<std::mutex> lock(matKernelCacheMutex);
+    matKernelCache.clear();
+    matKernelCacheOrder.clear();
+}
+
+#endif
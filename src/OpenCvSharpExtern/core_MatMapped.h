@@ -0,0 +1,258 @@
+#ifndef _CPP_CORE_MATMAPPED_H_
+#define _CPP_CORE_MATMAPPED_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include "core_Mat.h"
+#include "core_MatAllocator.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+extern "C"
+{
+    // Layout of a file-backed Mat: this header at offset 0, the pixels (rows * step bytes) at dataOffset
+    struct MappedMatHeader
+    {
+        char magic[8];      // "CVSHMAT1"
+        int32_t rows;
+        int32_t cols;
+        int32_t type;
+        int32_t reserved;
+        uint64 step;        // bytes per row
+        uint64 dataOffset;  // page aligned
+    };
+}
+
+// Memory mapping of a whole file; owned by the Mats that reference its pixels through ExternalMatAllocator
+// and unmapped when the last of them is released. The OS pages the pixels in as they are touched.
+class MappedMatFile
+{
+public:
+    enum
+    {
+        DataOffset = 4096,
+    };
+
+    static const char *magic()
+    {
+        return "CVSHMAT1";
+    }
+
+    // Creates (or truncates) path with room for a rows x cols Mat of the given type and maps it read-write
+    static cv::Mat create(const char *path, int rows, int cols, int type)
+    {
+        CV_Assert(rows > 0 && cols > 0);
+        MappedMatHeader header;
+        std::memcpy(header.magic, magic(), sizeof(header.magic));
+        header.rows = rows;
+        header.cols = cols;
+        header.type = CV_MAT_TYPE(type);
+        header.reserved = 0;
+        header.step = static_cast<uint64>(cols) * CV_ELEM_SIZE(type);
+        header.dataOffset = DataOffset;
+
+        MappedMatFile *file = map(path, true, header.dataOffset + header.step * rows);
+        std::memcpy(file->base, &header, sizeof(header));
+        return file->toMat(header);
+    }
+
+    // Maps an existing file created by create()
+    static cv::Mat open(const char *path, bool writable)
+    {
+        MappedMatFile *file = map(path, writable, 0);
+        MappedMatHeader header;
+        const bool valid = file->length >= sizeof(header) &&
+            (std::memcpy(&header, file->base, sizeof(header)), std::memcmp(header.magic, magic(), sizeof(header.magic)) == 0) &&
+            header.rows > 0 && header.cols > 0 && header.type == CV_MAT_TYPE(header.type) &&
+            header.step >= static_cast<uint64>(header.cols) * CV_ELEM_SIZE(header.type) &&
+            header.dataOffset >= sizeof(header) && header.dataOffset <= file->length &&
+            // rows * step <= length - dataOffset, without a product that could wrap around
+            header.step <= (file->length - header.dataOffset) / static_cast<uint64>(header.rows);
+        if (!valid)
+        {
+            unmap(file->base, file);
+            CV_Error(cv::Error::StsBadArg, std::string("Not a mapped Mat file: ") + path);
+        }
+        return file->toMat(header);
+    }
+
+    static MappedMatFile *of(const cv::Mat &m)
+    {
+        return static_cast<MappedMatFile*>(ExternalMatAllocator::userToken(m, unmap));
+    }
+
+    // Writes the dirty pages under the Mat's pixels (which may be an ROI) back to the file
+    static bool flush(const cv::Mat &m)
+    {
+        MappedMatFile *file = of(m);
+        if (file == NULL)
+            return false;
+        if (!file->writable || m.empty())
+            return true;
+
+        CV_Assert(m.dims <= 2);
+        // from the page of the first pixel to the end of the last row of the ROI
+        const size_t page = pageSize();
+        uchar *start = m.data;
+        const uchar *end = m.data + (m.rows - 1) * m.step[0] + m.cols * m.elemSize();
+        uchar *alignedStart = static_cast<uchar*>(file->base) +
+            (static_cast<size_t>(start - static_cast<uchar*>(file->base)) / page) * page;
+        const size_t length = static_cast<size_t>(end - alignedStart);
+#ifdef _WIN32
+        if (!FlushViewOfFile(alignedStart, length) || !FlushFileBuffers(file->file))
+            CV_Error(cv::Error::StsError, "FlushViewOfFile failed");
+#else
+        if (msync(alignedStart, length, MS_SYNC) != 0)
+            CV_Error(cv::Error::StsError, "msync failed");
+#endif
+        return true;
+    }
+
+private:
+    void *base;
+    size_t length;
+    bool writable;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE mapping;
+#endif
+
+    MappedMatFile()
+        : base(NULL), length(0), writable(false)
+    {
+    }
+
+    cv::Mat toMat(const MappedMatHeader &header)
+    {
+        cv::Mat m(header.rows, header.cols, header.type,
+            static_cast<uchar*>(base) + header.dataOffset, static_cast<size_t>(header.step));
+        ExternalMatAllocator::attach(m, unmap, this);
+        return m;
+    }
+
+    static size_t pageSize()
+    {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwAllocationGranularity;
+#else
+        return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    // newLength > 0 creates / resizes the file
+    static MappedMatFile *map(const char *path, bool writable, uint64 newLength)
+    {
+        CV_Assert(path != NULL);
+        MappedMatFile *self = new MappedMatFile();
+        self->writable = writable;
+        std::string error;
+#ifdef _WIN32
+        self->file = CreateFileA(path,
+            writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+            writable ? FILE_SHARE_READ : (FILE_SHARE_READ | FILE_SHARE_WRITE), NULL,
+            newLength > 0 ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        LARGE_INTEGER size;
+        if (self->file == INVALID_HANDLE_VALUE)
+        {
+            error = "cannot open ";
+        }
+        else
+        {
+            if (newLength > 0)
+                size.QuadPart = static_cast<LONGLONG>(newLength);
+            else if (!GetFileSizeEx(self->file, &size))
+                size.QuadPart = 0;
+            self->length = static_cast<size_t>(size.QuadPart);
+            self->mapping = self->length == 0 ? NULL : CreateFileMappingA(self->file, NULL,
+                writable ? PAGE_READWRITE : PAGE_READONLY, size.HighPart, size.LowPart, NULL);
+            self->base = self->mapping == NULL ? NULL :
+                MapViewOfFile(self->mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, 0);
+            if (self->base == NULL)
+            {
+                error = "cannot map ";
+                if (self->mapping != NULL)
+                    CloseHandle(self->mapping);
+                CloseHandle(self->file);
+            }
+        }
+#else
+        const int fd = ::open(path, writable ? (O_RDWR | (newLength > 0 ? O_CREAT | O_TRUNC : 0)) : O_RDONLY, 0644);
+        struct stat st;
+        if (fd < 0)
+        {
+            error = "cannot open ";
+        }
+        else
+        {
+            if (newLength > 0 && ftruncate(fd, static_cast<off_t>(newLength)) != 0)
+                error = "cannot resize ";
+            else if (fstat(fd, &st) != 0)
+                error = "cannot stat ";
+            else
+                self->length = static_cast<size_t>(st.st_size);
+
+            if (error.empty())
+            {
+                void *p = self->length == 0 ? MAP_FAILED : mmap(NULL, self->length,
+                    writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+                if (p == MAP_FAILED)
+                    error = "cannot map ";
+                else
+                    self->base = p;
+            }
+            ::close(fd); // the mapping keeps its own reference to the file
+        }
+#endif
+        if (!error.empty())
+        {
+            delete self;
+            CV_Error(cv::Error::StsError, error + path);
+        }
+        return self;
+    }
+
+    static void CV_CDECL unmap(void * /*data*/, void *userToken)
+    {
+        MappedMatFile *self = static_cast<MappedMatFile*>(userToken);
+#ifdef _WIN32
+        UnmapViewOfFile(self->base);
+        CloseHandle(self->mapping);
+        CloseHandle(self->file);
+#else
+        munmap(self->base, self->length);
+#endif
+        delete self;
+    }
+};
+
+
+// Creates (or overwrites) a file holding a rows x cols Mat and returns a read-write Mat over its mapping
+CVAPI(cv::Mat*) core_Mat_new_MappedCreate(const char *path, int rows, int cols, int type)
+{
+    return newMatHeader(MappedMatFile::create(path, rows, cols, type));
+}
+// Maps a file written by core_Mat_new_MappedCreate; writing to a read-only mapping is an access violation
+CVAPI(cv::Mat*) core_Mat_new_MappedOpen(const char *path, int writable)
+{
+    return newMatHeader(MappedMatFile::open(path, writable != 0));
+}
+
+// Returns 0 if the Mat does not reference a mapped file
+CVAPI(int) core_Mat_flushMapped(cv::Mat *self)
+{
+    return MappedMatFile::flush(*self) ? 1 : 0;
+}
+CVAPI(int) core_Mat_isMapped(cv::Mat *self)
+{
+    return MappedMatFile::of(*self) != NULL ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,155 @@
+#ifndef _CPP_CORE_MATREGION_H_
+#define _CPP_CORE_MATREGION_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+
+// Copies a rectangle of a Mat to or from a caller-owned strided buffer in one call.
+// The buffer may have another depth (buffer = mat * alpha + beta, saturated; the inverse
+// direction uses mat = buffer * alpha + beta) and its channels may be a reordered subset
+// of the Mat channels: buffer channel i corresponds to Mat channel channelOrder[i].
+// The per-row work is done by convertTo / mixChannels, which use the vectorized HAL paths,
+// and large regions are split into row stripes run by cv::parallel_for_.
+class MatRegionCopyInvoker : public cv::ParallelLoopBody
+{
+public:
+    enum
+    {
+        StripeBytes = 1 << 16, // approximate amount of buffer data handled by one stripe / scratch chunk
+    };
+
+    MatRegionCopyInvoker(const cv::Mat &mat, const cv::Mat &buffer, bool toBuffer,
+        double alpha, double beta, const std::vector<int> &fromTo)
+        : mat(mat), buffer(buffer), toBuffer(toBuffer), alpha(alpha), beta(beta), fromTo(fromTo)
+    {
+    }
+
+    void operator()(const cv::Range &range) const CV_OVERRIDE
+    {
+        if (fromTo.empty())
+        {
+            if (toBuffer)
+            {
+                cv::Mat dst = buffer.rowRange(range.start, range.end);
+                mat.rowRange(range.start, range.end).convertTo(dst, buffer.depth(), alpha, beta);
+            }
+            else
+            {
+                cv::Mat dst = mat.rowRange(range.start, range.end);
+                buffer.rowRange(range.start, range.end).convertTo(dst, mat.depth(), alpha, beta);
+            }
+            return;
+        }
+
+        // The depth conversion always runs on the buffer's channel layout, so a scratch
+        // image of the Mat depth with the buffer's channels sits between the two steps.
+        const bool convert = buffer.depth() != mat.depth() || alpha != 1 || beta != 0;
+        const size_t rowBytes = std::max<size_t>(buffer.cols * buffer.elemSize(), 1);
+        const int chunkRows = static_cast<int>(std::max<size_t>(StripeBytes / rowBytes, 1));
+        cv::Mat scratch;
+        for (int y = range.start; y < range.end; y += chunkRows)
+        {
+            const int y1 = std::min(y + chunkRows, range.end);
+            cv::Mat m = mat.rowRange(y, y1);
+            cv::Mat b = buffer.rowRange(y, y1);
+            cv::Mat mid = b;
+            if (convert)
+            {
+                scratch.create(y1 - y, buffer.cols, CV_MAKETYPE(mat.depth(), buffer.channels()));
+                mid = scratch;
+            }
+
+            if (toBuffer)
+            {
+                cv::mixChannels(&m, 1, &mid, 1, &fromTo[0], fromTo.size() / 2);
+                if (convert)
+                    mid.convertTo(b, buffer.depth(), alpha, beta);
+            }
+            else
+            {
+                if (convert)
+                    b.convertTo(mid, mat.depth(), alpha, beta);
+                cv::mixChannels(&mid, 1, &m, 1, &fromTo[0], fromTo.size() / 2);
+            }
+        }
+    }
+
+    static void run(cv::Mat *self, MyCvRect roi, void *buf, size_t bufStep, int bufType,
+        double alpha, double beta, const int *channelOrder, int channelOrderLength, bool toBuffer)
+    {
+        CV_Assert(self->dims <= 2);
+        CV_Assert(roi.x >= 0 && roi.y >= 0 && roi.width >= 0 && roi.height >= 0 &&
+            roi.width <= self->cols - roi.x && roi.height <= self->rows - roi.y);
+        if (roi.width == 0 || roi.height == 0)
+            return;
+        CV_Assert(buf != NULL);
+
+        const int matCn = self->channels();
+        const int bufCn = CV_MAT_CN(bufType);
+        std::vector<int> fromTo;
+        if (channelOrder != NULL)
+        {
+            CV_Assert(channelOrderLength == bufCn);
+            bool identity = bufCn == matCn;
+            for (int i = 0; i < bufCn; i++)
+            {
+                CV_Assert(channelOrder[i] >= 0 && channelOrder[i] < matCn);
+                identity = identity && channelOrder[i] == i;
+                if (toBuffer)
+                {
+                    fromTo.push_back(channelOrder[i]);
+                    fromTo.push_back(i);
+                }
+                else
+                {
+                    fromTo.push_back(i);
+                    fromTo.push_back(channelOrder[i]);
+                }
+            }
+            if (identity)
+                fromTo.clear();
+        }
+        else
+        {
+            CV_Assert(bufCn == matCn);
+        }
+
+        const cv::Mat mat = (*self)(cpp(roi));
+        const cv::Mat buffer(roi.height, roi.width, bufType, buf, bufStep); // 0 is Mat::AUTO_STEP
+
+        const MatRegionCopyInvoker invoker(mat, buffer, toBuffer, alpha, beta, fromTo);
+        const size_t bytes = std::max(mat.total() * mat.elemSize(), buffer.total() * buffer.elemSize());
+        const int stripes = static_cast<int>(std::min<size_t>(bytes / StripeBytes, roi.height));
+        if (stripes > 1)
+            tracedParallelFor("MatRegion", cv::Range(0, roi.height), invoker, stripes);
+        else
+            invoker(cv::Range(0, roi.height));
+    }
+
+private:
+    const cv::Mat mat;
+    const cv::Mat buffer;
+    const bool toBuffer;
+    const double alpha, beta;
+    const std::vector<int> fromTo;
+};
+
+
+// Copies the roi of the Mat to buf (rows bufStep bytes apart, 0: packed) as bufType.
+// channelOrder may be NULL, in which case bufType must have the Mat's channel count.
+CVAPI(void) core_Mat_getRegion(cv::Mat *self, MyCvRect roi, void *buf, size_t bufStep, int bufType,
+    double alpha, double beta, const int *channelOrder, int channelOrderLength)
+{
+    MatRegionCopyInvoker::run(self, roi, buf, bufStep, bufType, alpha, beta, channelOrder, channelOrderLength, true);
+}
+
+// Writes buf (bufType, rows bufStep bytes apart, 0: packed) to the roi of the Mat.
+// Mat channels not listed in channelOrder are left unchanged.
+CVAPI(void) core_Mat_setRegion(cv::Mat *self, MyCvRect roi, void *buf, size_t bufStep, int bufType,
+    double alpha, double beta, const int *channelOrder, int channelOrderLength)
+{
+    MatRegionCopyInvoker::run(self, roi, buf, bufStep, bufType, alpha, beta, channelOrder, channelOrderLength, false);
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef _CPP_CORE_NATIVEJOB_H_
+#define _CPP_CORE_NATIVEJOB_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+
+// Jobs are created by the *_job exports of the modules (e.g. photo_fastNlMeansDenoising_job)
+
+#pragma region NativeJob
+
+CVAPI(void) core_Ptr_NativeJob_delete(cv::Ptr<NativeJob> *obj)
+{
+    deleteHandle(obj);
+}
+
+CVAPI(int) core_NativeJob_submit(cv::Ptr<NativeJob> *obj, int priority, NativeJobCallback callback, void *userData)
+{
+    return NativeJobQueue::instance()->submit(*obj, priority, callback, userData) ? 1 : 0;
+}
+
+CVAPI(void) core_NativeJob_cancel(cv::Ptr<NativeJob> *obj)
+{
+    NativeJobQueue::instance()->cancel(*obj);
+}
+
+CVAPI(int) core_NativeJob_status(cv::Ptr<NativeJob> *obj)
+{
+    return (*obj)->status();
+}
+
+CVAPI(int) core_NativeJob_wait(cv::Ptr<NativeJob> *obj, int timeoutMs)
+{
+    return (*obj)->wait(timeoutMs) ? 1 : 0;
+}
+
+CVAPI(int) core_NativeJob_resultCode(cv::Ptr<NativeJob> *obj)
+{
+    CV_Assert((*obj)->status() == NATIVE_JOB_COMPLETED);
+    return (*obj)->resultCode();
+}
+
+CVAPI(int) core_NativeJob_resultCount(cv::Ptr<NativeJob> *obj)
+{
+    CV_Assert((*obj)->status() == NATIVE_JOB_COMPLETED);
+    return static_cast<int>((*obj)->results().size());
+}
+
+CVAPI(cv::Mat*) core_NativeJob_result(cv::Ptr<NativeJob> *obj, int index)
+{
+    CV_Assert((*obj)->status() == NATIVE_JOB_COMPLETED);
+    const std::vector<cv::Mat> &results = (*obj)->results();
+    CV_Assert(index >= 0 && static_cast<size_t>(index) < results.size());
+    return trackHandle(new cv::Mat(results[index]));
+}
+
+CVAPI(void) core_NativeJob_error(cv::Ptr<NativeJob> *obj, char *buf, int bufLength)
+{
+    copyString((*obj)->error(), buf, bufLength);
+}
+
+#pragma endregion
+
+#pragma region NativeJobQueue
+
+CVAPI(void) core_NativeJobQueue_configure(int workers, int capacity)
+{
+    NativeJobQueue::instance()->configure(workers, capacity);
+}
+
+CVAPI(int) core_NativeJobQueue_queued()
+{
+    return NativeJobQueue::instance()->queued();
+}
+
+CVAPI(int) core_NativeJobQueue_running()
+{
+    return NativeJobQueue::instance()->running();
+}
+
+#pragma endregion
+
+#endif
@@ -36,7 +36,7 @@ CVAPI(void) core_OutputArray_delete(cv::_OutputArray *oa)
 CVAPI(cv::Mat*) core_OutputArray_getMat(cv::_OutputArray *oa)
 {
     cv::Mat &mat = oa->getMatRef();
-    return new cv::Mat(mat);
+    return trackHandle(new cv::Mat(mat));
 }
 
 CVAPI(MyCvScalar) core_OutputArray_getScalar(cv::_OutputArray *oa)
@@ -54,7 +54,7 @@ CVAPI(void) core_OutputArray_getVectorOfMat(cv::_OutputArray *oa, std::vector<cv
     vector->resize(temp.size());
     for (size_t i = 0; i < temp.size(); i++)
     {
-        (*vector)[i] = new cv::Mat(temp[i]);
+        (*vector)[i] = trackHandle(new cv::Mat(temp[i]));
     }
 }
 
@@ -33,7 +33,7 @@ CVAPI(void) core_PCA_computeVar(cv::PCA *obj, cv::_InputArray *data, cv::_InputA
 CVAPI(cv::Mat*) core_PCA_project1(cv::PCA *obj, cv::_InputArray *vec)
 {
     cv::Mat ret = obj->project(*vec);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 //! projects vector from the original space to the principal components subspace
 CVAPI(void) core_PCA_project2(cv::PCA *obj, cv::_InputArray *vec, cv::_OutputArray *result)
@@ -44,7 +44,7 @@ CVAPI(void) core_PCA_project2(cv::PCA *obj, cv::_InputArray *vec, cv::_OutputArr
 CVAPI(cv::Mat*) core_PCA_backProject1(cv::PCA *obj, cv::_InputArray *vec)
 {
     cv::Mat ret = obj->backProject(*vec);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 //! reconstructs the original vector from the projection
 CVAPI(void) core_PCA_backProject2(cv::PCA *obj, cv::_InputArray *vec, cv::_OutputArray *result)
@@ -55,17 +55,17 @@ CVAPI(void) core_PCA_backProject2(cv::PCA *obj, cv::_InputArray *vec, cv::_Outpu
 //!< eigenvectors of the covariation matrix
 CVAPI(cv::Mat*) core_PCA_eigenvectors(cv::PCA *obj)
 {
-    return new cv::Mat(obj->eigenvectors);
+    return trackHandle(new cv::Mat(obj->eigenvectors));
 }
 //!< eigenvalues of the covariation matrix
 CVAPI(cv::Mat*) core_PCA_eigenvalues(cv::PCA *obj)
 {
-    return new cv::Mat(obj->eigenvalues);
+    return trackHandle(new cv::Mat(obj->eigenvalues));
 }
 //!< mean value subtracted before the projection and added after the back projection
 CVAPI(cv::Mat*) core_PCA_mean(cv::PCA *obj)
 {
-    return new cv::Mat(obj->mean);
+    return trackHandle(new cv::Mat(obj->mean));
 }
 
 #endif
\ No newline at end of file
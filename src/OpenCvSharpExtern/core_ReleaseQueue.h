@@ -0,0 +1,271 @@
+#ifndef _CPP_CORE_RELEASEQUEUE_H_
+#define _CPP_CORE_RELEASEQUEUE_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+extern "C"
+{
+    struct NativeReleaseQueueStats
+    {
+        uint64 depth;           // objects waiting for or being released by the worker thread
+        uint64 bytesPending;    // buffer bytes held by these objects
+        uint64 deferred;        // objects handed to the worker thread so far
+        uint64 released;        // objects released by the worker thread so far
+        uint64 thresholdBytes;
+        int32_t enabled;
+        int32_t reserved;
+    };
+}
+
+// Releases native objects that own large buffers on a background thread, so that the thread which
+// drops the last reference (e.g. the .NET finalizer thread) does not pay for freeing the memory.
+// Disabled by default; objects below the byte threshold are always released immediately.
+// A deferred release runs everything the last reference triggers on the worker thread: the release callback
+// of a Mat over an external buffer (ExternalMatAllocator) is called from that thread, and a PooledMatAllocator
+// buffer goes to the free lists of that thread (bounded by the per-thread limit of the pool), not to those of
+// the thread which dropped the reference.
+class NativeReleaseQueue
+{
+public:
+    typedef void (*Deleter)(void *obj);
+
+    static NativeReleaseQueue *instance()
+    {
+        // never destroyed: handles may still be released during process exit
+        static NativeReleaseQueue *queue = new NativeReleaseQueue();
+        return queue;
+    }
+
+    void release(Deleter deleter, void *obj, size_t bytes)
+    {
+        if (obj == NULL)
+            return;
+        if (!enabled.load(std::memory_order_relaxed) || bytes == 0 || bytes < thresholdBytes.load(std::memory_order_relaxed))
+        {
+            deleter(obj);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!workerStarted)
+            {
+                std::thread(&NativeReleaseQueue::run, this).detach();
+                workerStarted = true;
+            }
+            const Item item = { deleter, obj, bytes };
+            items.push_back(item);
+            bytesPending += bytes;
+            deferred++;
+        }
+        wake.notify_one();
+    }
+
+    void releaseMat(cv::Mat *m)
+    {
+        untrackHandle(m);
+        release(deleteMat, m, m == NULL ? 0 : ownedBytes(*m));
+    }
+
+    void releaseMatVector(std::vector<cv::Mat> *v)
+    {
+        untrackHandle(v);
+        size_t bytes = 0;
+        if (v != NULL)
+        {
+            for (size_t i = 0; i < v->size(); i++)
+                bytes += ownedBytes((*v)[i]);
+        }
+        release(deleteMatVector, v, bytes);
+    }
+
+    void releaseByteVector(std::vector<uchar> *v)
+    {
+        untrackHandle(v);
+        release(deleteByteVector, v, v == NULL ? 0 : v->capacity());
+    }
+
+    // Waits until every deferred object has been released
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        drained.wait(lock, [this] { return items.empty() && busy == 0; });
+    }
+
+    void setEnabled(bool value)
+    {
+        enabled.store(value);
+    }
+
+    void setThresholdBytes(uint64 value)
+    {
+        thresholdBytes.store(value);
+    }
+
+    NativeReleaseQueueStats stats()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        NativeReleaseQueueStats s;
+        s.depth = items.size() + busy;
+        s.bytesPending = bytesPending;
+        s.deferred = deferred;
+        s.released = released;
+        s.thresholdBytes = thresholdBytes.load();
+        s.enabled = enabled.load() ? 1 : 0;
+        s.reserved = 0;
+        return s;
+    }
+
+    // Bytes freed when m is released: the size of its buffer if m holds the only reference to it
+    static size_t ownedBytes(const cv::Mat &m)
+    {
+        const cv::UMatData *u = m.u;
+        if (u == NULL || u->refcount != 1)
+            return 0;
+        return u->size;
+    }
+
+private:
+    struct Item
+    {
+        Deleter deleter;
+        void *obj;
+        size_t bytes;
+    };
+
+    std::atomic<bool> enabled;
+    std::atomic<uint64> thresholdBytes;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable drained;
+    std::deque<Item> items;
+    size_t busy;
+    uint64 bytesPending;
+    uint64 deferred;
+    uint64 released;
+    bool workerStarted;
+
+    NativeReleaseQueue()
+        : enabled(false), thresholdBytes(1 << 20), busy(0), bytesPending(0), deferred(0), released(0), workerStarted(false)
+    {
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;)
+        {
+            wake.wait(lock, [this] { return !items.empty(); });
+            const Item item = items.front();
+            items.pop_front();
+            busy++;
+            lock.unlock();
+            try
+            {
+                NativeErrorScope errors;
+                item.deleter(item.obj);
+            }
+            catch (...)
+            {
+                // nobody to report to; the object is gone either way
+            }
+            lock.lock();
+            busy--;
+            bytesPending -= item.bytes;
+            released++;
+            if (items.empty() && busy == 0)
+                drained.notify_all();
+        }
+    }
+
+    static void deleteMat(void *obj)
+    {
+        delete static_cast<cv::Mat*>(obj);
+    }
+
+    static void deleteMatVector(void *obj)
+    {
+        delete static_cast<std::vector<cv::Mat>*>(obj);
+    }
+
+    static void deleteByteVector(void *obj)
+    {
+        delete static_cast<std::vector<uchar>*>(obj);
+    }
+};
+
+
+#pragma region deleteMany
+
+CVAPI(void) core_Mat_deleteMany(cv::Mat **handles, int count)
+{
+    NativeReleaseQueue *queue = NativeReleaseQueue::instance();
+    for (int i = 0; i < count; i++)
+        queue->releaseMat(handles[i]);
+}
+
+CVAPI(void) core_MatExpr_deleteMany(cv::MatExpr **handles, int count)
+{
+    for (int i = 0; i < count; i++)
+        delete handles[i];
+}
+
+CVAPI(void) core_InputArray_deleteMany(cv::_InputArray **handles, int count)
+{
+    for (int i = 0; i < count; i++)
+        delete handles[i];
+}
+
+CVAPI(void) core_OutputArray_deleteMany(cv::_OutputArray **handles, int count)
+{
+    for (int i = 0; i < count; i++)
+        delete handles[i];
+}
+
+CVAPI(void) vector_uchar_deleteMany(std::vector<uchar> **handles, int count)
+{
+    NativeReleaseQueue *queue = NativeReleaseQueue::instance();
+    for (int i = 0; i < count; i++)
+        queue->releaseByteVector(handles[i]);
+}
+
+CVAPI(void) vector_Mat_deleteMany(std::vector<cv::Mat> **handles, int count)
+{
+    NativeReleaseQueue *queue = NativeReleaseQueue::instance();
+    for (int i = 0; i < count; i++)
+        queue->releaseMatVector(handles[i]);
+}
+
+#pragma endregion
+
+#pragma region NativeReleaseQueue
+
+CVAPI(void) core_NativeReleaseQueue_setEnabled(int enabled)
+{
+    NativeReleaseQueue::instance()->setEnabled(enabled != 0);
+}
+
+CVAPI(void) core_NativeReleaseQueue_setThresholdBytes(uint64 value)
+{
+    NativeReleaseQueue::instance()->setThresholdBytes(value);
+}
+
+CVAPI(void) core_NativeReleaseQueue_getStats(NativeReleaseQueueStats *stats)
+{
+    *stats = NativeReleaseQueue::instance()->stats();
+}
+
+CVAPI(void) core_NativeReleaseQueue_flush()
+{
+    NativeReleaseQueue::instance()->flush();
+}
+
+#pragma endregion
+
+#endif
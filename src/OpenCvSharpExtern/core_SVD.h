@@ -51,15 +51,15 @@ CVAPI(void) core_SVD_static_solveZ(cv::_InputArray *src, cv::_OutputArray *dst)
 
 CVAPI(cv::Mat*) core_SVD_u(cv::SVD *obj)
 {
-    return new cv::Mat(obj->u);
+    return trackHandle(new cv::Mat(obj->u));
 }
 CVAPI(cv::Mat*) core_SVD_w(cv::SVD *obj)
 {
-    return new cv::Mat(obj->w);
+    return trackHandle(new cv::Mat(obj->w));
 }
 CVAPI(cv::Mat*) core_SVD_vt(cv::SVD *obj)
 {
-    return new cv::Mat(obj->vt);
+    return trackHandle(new cv::Mat(obj->vt));
 }
 
 #endif
\ No newline at end of file
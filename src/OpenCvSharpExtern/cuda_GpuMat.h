@@ -114,7 +114,7 @@ CVAPI(GpuMat*) cuda_GpuMat_opRange2(GpuMat *src, CvSlice rowRange, CvSlice colRa
 CVAPI(cv::Mat*) cuda_GpuMat_opToMat(GpuMat *src)
 {
     cv::Mat m = (cv::Mat)(*src);
-    return new cv::Mat(m);
+    return trackHandle(new cv::Mat(m));
 }
 CVAPI(GpuMat*) cuda_GpuMat_opToGpuMat(cv::Mat *src)
 {
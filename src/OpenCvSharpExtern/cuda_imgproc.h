@@ -40,7 +40,7 @@ CVAPI(cv::Ptr<cv::cuda::CLAHE>*) cuda_imgproc_createCLAHE(double clipLimit, MyCv
 
 CVAPI(void) cuda_imgproc_Ptr_CLAHE_delete(cv::Ptr<cv::cuda::CLAHE>* obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 CVAPI(cv::cuda::CLAHE*) cuda_imgproc_Ptr_CLAHE_get(cv::Ptr<cv::cuda::CLAHE>* obj)
@@ -76,7 +76,7 @@ CVAPI(void) cuda_imgproc_histRange_0(cv::_InputArray* src, cv::_OutputArray* his
 CVAPI(cv::Ptr<CannyEdgeDetector>*) cuda_imgproc_createCannyEdgeDetector(double low_thresh, double high_thresh, int apperture_size, bool L2gradient)
 {
 	cv::Ptr<CannyEdgeDetector> ptr = cv::cuda::createCannyEdgeDetector(low_thresh, high_thresh, apperture_size, L2gradient);
-	return new cv::Ptr<CannyEdgeDetector>(ptr);
+	return trackHandle(new cv::Ptr<CannyEdgeDetector>(ptr));
 }
 
 CVAPI(void) cuda_imgproc_CannyEdgeDetector_detect(CannyEdgeDetector *obj, cv::_InputArray *image, cv::_OutputArray *edges, Stream* stream)
@@ -86,7 +86,7 @@ CVAPI(void) cuda_imgproc_CannyEdgeDetector_detect(CannyEdgeDetector *obj, cv::_I
 
 CVAPI(void) cuda_imgproc_Ptr_CannyEdgeDetector_delete(cv::Ptr<CannyEdgeDetector> *obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 CVAPI(CannyEdgeDetector*) cuda_imgproc_Ptr_CannyEdgeDetector_get(cv::Ptr<CannyEdgeDetector> *ptr)
@@ -135,7 +135,7 @@ CVAPI(void) cuda_imgproc_CannyEdgeDetector_setL2Gradient(CannyEdgeDetector* ptr,
 CVAPI(cv::Ptr<HoughLinesDetector>*) cuda_imgproc_createHoughLinesDetector(float rho, float theta, int threshold, bool doSort, int maxLines)
 {
 	cv::Ptr<HoughLinesDetector> ptr = cv::cuda::createHoughLinesDetector(rho, theta, threshold, doSort, maxLines);
-	return new cv::Ptr<HoughLinesDetector>(ptr);
+	return trackHandle(new cv::Ptr<HoughLinesDetector>(ptr));
 }
 
 CVAPI(void) cuda_imgproc_HoughLinesDetector_detect(HoughLinesDetector* obj, cv::_InputArray* src, cv::_OutputArray* lines, Stream* stream)
@@ -153,7 +153,7 @@ CVAPI(void) cuda_imgproc_HoughLinesDetector_downloadResults(HoughLinesDetector*
 
 CVAPI(void) cuda_imgproc_Ptr_HoughLinesDetector_delete(cv::Ptr<HoughLinesDetector>* obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 CVAPI(HoughLinesDetector*) cuda_imgproc_Ptr_HoughLinesDetector_get(cv::Ptr<HoughLinesDetector>* ptr)
@@ -211,7 +211,7 @@ CVAPI(void) cuda_imgproc_HoughLinesDetector_setMaxLines(HoughLinesDetector* ptr,
 CVAPI(cv::Ptr<HoughSegmentDetector>*) cuda_imgproc_createHoughSegmentDetector(float rho, float theta, int minLineLength, int maxLineGap, int maxLines)
 {
 	cv::Ptr<HoughSegmentDetector> ptr = cv::cuda::createHoughSegmentDetector(rho, theta, minLineLength, maxLineGap, maxLines);
-	return new cv::Ptr<HoughSegmentDetector>(ptr);
+	return trackHandle(new cv::Ptr<HoughSegmentDetector>(ptr));
 }
 
 CVAPI(void) cuda_imgproc_HoughSegmentDetector_detect(HoughSegmentDetector* obj, cv::_InputArray* src, cv::_OutputArray* lines, Stream* stream)
@@ -230,7 +230,7 @@ CVAPI(void) cuda_imgproc_HoughSegmentDetector_downloadResults(HoughSegmentDetect
 
 CVAPI(void) cuda_imgproc_Ptr_HoughSegmentDetector_delete(cv::Ptr<HoughSegmentDetector>* obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 CVAPI(HoughSegmentDetector*) cuda_imgproc_Ptr_HoughSegmentDetector_get(cv::Ptr<HoughSegmentDetector>* ptr)
@@ -288,7 +288,7 @@ CVAPI(void) cuda_imgproc_HoughSegmentDetector_setMaxLines(HoughSegmentDetector*
 CVAPI(cv::Ptr<HoughCirclesDetector>*) cuda_imgproc_createHoughCirclesDetector(float dp, float minDist, int cannyThreshold, int votesThreshold, int minRadius, int maxRadius, int maxCircles)
 {
 	cv::Ptr<HoughCirclesDetector> ptr = cv::cuda::createHoughCirclesDetector(dp, minDist, cannyThreshold, votesThreshold, minRadius, maxRadius, maxCircles);
-	return new cv::Ptr<HoughCirclesDetector>(ptr);
+	return trackHandle(new cv::Ptr<HoughCirclesDetector>(ptr));
 }
 
 CVAPI(void) cuda_imgproc_HoughCirclesDetector_detect(HoughCirclesDetector* obj, cv::_InputArray* src, cv::_OutputArray* circles, Stream* stream)
@@ -307,7 +307,7 @@ CVAPI(void) cuda_imgproc_HoughCirclesDetector_downloadResults(HoughCirclesDetect
 
 CVAPI(void) cuda_imgproc_Ptr_HoughCirclesDetector_delete(cv::Ptr<HoughCirclesDetector>* obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 CVAPI(HoughCirclesDetector*) cuda_imgproc_Ptr_HoughCirclesDetector_get(cv::Ptr<HoughCirclesDetector>* ptr)
@@ -383,13 +383,13 @@ CVAPI(void) cuda_imgproc_HoughCirclesDetector_setMaxCircles(HoughCirclesDetector
 CVAPI(cv::Ptr<CornernessCriteria>*) cuda_imgproc_createHarrisCorner(int srcType, int blockSize, int ksize, double k, int borderType)
 {
 	cv::Ptr<CornernessCriteria> ptr = cv::cuda::createHarrisCorner(srcType, blockSize, ksize, k, borderType);
-	return new cv::Ptr<CornernessCriteria>(ptr);
+	return trackHandle(new cv::Ptr<CornernessCriteria>(ptr));
 }
 
 CVAPI(cv::Ptr<CornernessCriteria>*) cuda_imgproc_createMinEigenValCorner(int srcType, int blockSize, int ksize, int borderType)
 {
 	cv::Ptr<CornernessCriteria> ptr = cv::cuda::createMinEigenValCorner(srcType, blockSize, ksize, borderType);
-	return new cv::Ptr<CornernessCriteria>(ptr);
+	return trackHandle(new cv::Ptr<CornernessCriteria>(ptr));
 }
 
 CVAPI(void) cuda_imgproc_HoughCirclesDetector_compute(CornernessCriteria* obj, cv::_InputArray* src, cv::_OutputArray* dst, Stream* stream)
@@ -399,7 +399,7 @@ CVAPI(void) cuda_imgproc_HoughCirclesDetector_compute(CornernessCriteria* obj, c
 
 CVAPI(void) cuda_imgproc_Ptr_CornernessCriteria_delete(cv::Ptr<CornernessCriteria>* obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 CVAPI(CornernessCriteria*) cuda_imgproc_Ptr_CornernessCriteria_get(cv::Ptr<CornernessCriteria>* ptr)
@@ -413,7 +413,7 @@ CVAPI(cv::Ptr<CornersDetector>*) cuda_imgproc_createGoodFeaturesToTrackDetector(
 	int blockSize, bool useHarrisDetector, double harrisK)
 {
 	cv::Ptr<CornersDetector> ptr = cv::cuda::createGoodFeaturesToTrackDetector(srcType, maxCorners, qualityLevel, minDistance, blockSize, useHarrisDetector, harrisK);
-	return new cv::Ptr<CornersDetector>(ptr);
+	return trackHandle(new cv::Ptr<CornersDetector>(ptr));
 }
 
 CVAPI(void) cuda_imgproc_CornersDetector_detect(CornersDetector* obj, cv::_InputArray* image, cv::_OutputArray* corners, cv::_InputArray* mask, Stream* stream)
@@ -435,7 +435,7 @@ CVAPI(void) cuda_imgproc_CornersDetector_downloadResults(HoughCirclesDetector* o
 
 CVAPI(void) cuda_imgproc_Ptr_CornersDetector_delete(cv::Ptr<CornersDetector>* obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 CVAPI(CornersDetector*) cuda_imgproc_Ptr_CornersDetector_get(cv::Ptr<CornersDetector>* ptr)
@@ -465,7 +465,7 @@ CVAPI(void) cuda_imgproc_meanShiftSegmentation(cv::_InputArray* src, cv::_Output
 CVAPI(cv::Ptr<TemplateMatching>*) cuda_imgproc_createTemplateMatching(int srcType, int method, MyCvSize user_block_size)
 {
 	cv::Ptr<TemplateMatching> ptr = cv::cuda::createTemplateMatching(srcType, method, cpp(user_block_size));
-	return new cv::Ptr<TemplateMatching>(ptr);
+	return trackHandle(new cv::Ptr<TemplateMatching>(ptr));
 }
 
 CVAPI(void) cuda_imgproc_TemplateMatching_match(TemplateMatching* obj, cv::_InputArray* image, cv::_OutputArray* templ, cv::_OutputArray* result, Stream* stream)
@@ -475,7 +475,7 @@ CVAPI(void) cuda_imgproc_TemplateMatching_match(TemplateMatching* obj, cv::_Inpu
 
 CVAPI(void) cuda_imgproc_Ptr_TemplateMatching_delete(cv::Ptr<TemplateMatching>* obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 CVAPI(TemplateMatching*) cuda_imgproc_Ptr_TemplateMatching_get(cv::Ptr<TemplateMatching>* ptr)
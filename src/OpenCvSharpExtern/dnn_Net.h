@@ -5,12 +5,12 @@
 
 CVAPI(cv::dnn::Net*) dnn_Net_new()
 {
-	return new cv::dnn::Net;
+	return trackHandle(new cv::dnn::Net);
 }
 
 CVAPI(void) dnn_Net_delete(cv::dnn::Net* net)
 {
-	delete net;
+	deleteHandle(net);
 }
 
 CVAPI(int) dnn_Net_empty(cv::dnn::Net* net)
@@ -53,29 +53,29 @@ CVAPI(cv::Mat*) dnn_Net_forward1(cv::dnn::Net* net, const char *outputName)
 {
 	const cv::String outputNameStr = (outputName == nullptr) ? cv::String() : cv::String(outputName);
 	const auto ret = net->forward(outputNameStr);
-	return new cv::Mat(ret);
+	return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(void) dnn_Net_forward2(
 	cv::dnn::Net* net, cv::Mat **outputBlobs, int outputBlobsLength, const char *outputName)
 {
 	const auto outputNameStr = (outputName == nullptr) ? cv::String() : cv::String(outputName);
-	std::vector<cv::Mat> outputBlobsVec;
-	toVec(outputBlobs, outputBlobsLength, outputBlobsVec);
+	ScratchVector<cv::Mat> outputBlobsVec;
+	toVec(outputBlobs, outputBlobsLength, *outputBlobsVec);
 
-	net->forward(outputBlobsVec, outputNameStr);
+	net->forward(*outputBlobsVec, outputNameStr);
 
     for (int i = 0; i < outputBlobsLength; i++)
     {
-        *outputBlobs[i] = outputBlobsVec[i];
+        *outputBlobs[i] = (*outputBlobsVec)[i];
     }
 }
 
 CVAPI(void) dnn_Net_forward3(
 	cv::dnn::Net* net, cv::Mat **outputBlobs, int outputBlobsLength, const char **outBlobNames, int outBlobNamesLength)
 {
-	std::vector<cv::Mat> outputBlobsVec;
-	toVec(outputBlobs, outputBlobsLength, outputBlobsVec);
+	ScratchVector<cv::Mat> outputBlobsVec;
+	toVec(outputBlobs, outputBlobsLength, *outputBlobsVec);
 
 	std::vector<cv::String> outBlobNamesVec(outBlobNamesLength);
 	for (int i = 0; i < outBlobNamesLength; i++)
@@ -83,14 +83,34 @@ CVAPI(void) dnn_Net_forward3(
 		outBlobNamesVec[i] = outBlobNames[i];
 	}
 
-	net->forward(outputBlobsVec, outBlobNamesVec);
+	net->forward(*outputBlobsVec, outBlobNamesVec);
 
     for (int i = 0; i < outputBlobsLength; i++)
     {
-        *outputBlobs[i] = outputBlobsVec[i];
+        *outputBlobs[i] = (*outputBlobsVec)[i];
     }
 }
 
+// Runs the forward pass with the inputs set by setInput, producing the outputs of outBlobNames (or of the
+// last layer if empty). The job shares the network; do not use it elsewhere while the job is running
+CVAPI(cv::Ptr<NativeJob>*) dnn_Net_forward_job(cv::dnn::Net* net, const char **outBlobNames, int outBlobNamesLength)
+{
+	const cv::dnn::Net shared = *net;
+	std::vector<cv::String> outBlobNamesVec(outBlobNamesLength);
+	for (int i = 0; i < outBlobNamesLength; i++)
+	{
+		outBlobNamesVec[i] = outBlobNames[i];
+	}
+	return newJob("dnn_Net_forward", [=](NativeJob &job)
+	{
+		cv::dnn::Net n = shared;
+		if (outBlobNamesVec.empty())
+			job.results().push_back(n.forward());
+		else
+			n.forward(job.results(), outBlobNamesVec);
+	});
+}
+
 CVAPI(void) dnn_Net_setHalideScheduler(cv::dnn::Net* net, const char *scheduler)
 {
     net->setHalideScheduler(scheduler);
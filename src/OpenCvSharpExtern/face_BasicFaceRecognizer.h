@@ -61,7 +61,7 @@ CVAPI(BasicFaceRecognizer*) face_Ptr_BasicFaceRecognizer_get(cv::Ptr<BasicFaceRe
 }
 CVAPI(void) face_Ptr_BasicFaceRecognizer_delete(cv::Ptr<BasicFaceRecognizer> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 #endif
\ No newline at end of file
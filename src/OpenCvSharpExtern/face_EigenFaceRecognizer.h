@@ -20,7 +20,7 @@ CVAPI(EigenFaceRecognizer*) face_Ptr_EigenFaceRecognizer_get(cv::Ptr<EigenFaceRe
 }
 CVAPI(void) face_Ptr_EigenFaceRecognizer_delete(cv::Ptr<EigenFaceRecognizer> *obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 #endif
\ No newline at end of file
@@ -84,7 +84,7 @@ CVAPI(FaceRecognizer*) face_Ptr_FaceRecognizer_get(cv::Ptr<FaceRecognizer> *obj)
 }
 CVAPI(void) face_Ptr_FaceRecognizer_delete(cv::Ptr<FaceRecognizer> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 #endif
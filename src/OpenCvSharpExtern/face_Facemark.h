@@ -77,7 +77,7 @@ CVAPI(FacemarkLBF*) face_Ptr_FacemarkLBF_get(cv::Ptr<FacemarkLBF> *obj)
 
 CVAPI(void) face_Ptr_FacemarkLBF_delete(cv::Ptr<FacemarkLBF> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 #pragma region Params
@@ -280,7 +280,7 @@ CVAPI(FacemarkAAM*) face_Ptr_FacemarkAAM_get(cv::Ptr<FacemarkAAM> *obj)
 
 CVAPI(void) face_Ptr_FacemarkAAM_delete(cv::Ptr<FacemarkAAM> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 #pragma region Params
@@ -20,7 +20,7 @@ CVAPI(FisherFaceRecognizer*) face_Ptr_FisherFaceRecognizer_get(cv::Ptr<FisherFac
 }
 CVAPI(void) face_Ptr_FisherFaceRecognizer_delete(cv::Ptr<FisherFaceRecognizer> *obj)
 {
-	delete obj;
+	deleteHandle(obj);
 }
 
 #endif
\ No newline at end of file
@@ -77,7 +77,7 @@ CVAPI(LBPHFaceRecognizer*) face_Ptr_LBPHFaceRecognizer_get(cv::Ptr<LBPHFaceRecog
 }
 CVAPI(void) face_Ptr_LBPHFaceRecognizer_delete(cv::Ptr<LBPHFaceRecognizer> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 
@@ -11,11 +11,11 @@ CVAPI(cv::Ptr<cv::AKAZE>*) features2d_AKAZE_create(
     cv::Ptr<cv::AKAZE> ptr = cv::AKAZE::create(
         static_cast<cv::AKAZE::DescriptorType>(descriptor_type), descriptor_size, descriptor_channels,
         threshold, nOctaves, nOctaveLayers, static_cast<cv::KAZE::DiffusivityType>(diffusivity));
-    return new cv::Ptr<cv::AKAZE>(ptr);
+    return trackHandle(new cv::Ptr<cv::AKAZE>(ptr));
 }
 CVAPI(void) features2d_Ptr_AKAZE_delete(cv::Ptr<cv::AKAZE> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::AKAZE*) features2d_Ptr_AKAZE_get(cv::Ptr<cv::AKAZE> *ptr)
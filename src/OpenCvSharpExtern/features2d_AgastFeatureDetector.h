@@ -21,12 +21,12 @@ CVAPI(cv::Ptr<cv::AgastFeatureDetector>*) features2d_AgastFeatureDetector_create
 {
     cv::Ptr<cv::AgastFeatureDetector> ptr = cv::AgastFeatureDetector::create(
         threshold, nonmaxSuppression != 0, static_cast<cv::AgastFeatureDetector::DetectorType>(type));
-    return new cv::Ptr<cv::AgastFeatureDetector>(ptr);
+    return trackHandle(new cv::Ptr<cv::AgastFeatureDetector>(ptr));
 }
 
 CVAPI(void) features2d_Ptr_AgastFeatureDetector_delete(cv::Ptr<cv::AgastFeatureDetector> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::AgastFeatureDetector*) features2d_Ptr_AgastFeatureDetector_get(cv::Ptr<cv::AgastFeatureDetector> *ptr)
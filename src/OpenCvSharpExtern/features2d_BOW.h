@@ -43,12 +43,12 @@ CVAPI(void) features2d_BOWKMeansTrainer_delete(cv::BOWKMeansTrainer *obj)
 CVAPI(cv::Mat*) features2d_BOWKMeansTrainer_cluster1(cv::BOWKMeansTrainer *obj)
 {
     cv::Mat m = obj->cluster();
-    return new cv::Mat(m);
+    return trackHandle(new cv::Mat(m));
 }
 CVAPI(cv::Mat*) features2d_BOWKMeansTrainer_cluster2(cv::BOWKMeansTrainer *obj, cv::Mat *descriptors)
 {
     cv::Mat m = obj->cluster(*descriptors);
-    return new cv::Mat(m);
+    return trackHandle(new cv::Mat(m));
 }
 
 // BOWImgDescriptorExtractor
@@ -96,7 +96,7 @@ CVAPI(void) features2d_BOWImgDescriptorExtractor_setVocabulary(cv::BOWImgDescrip
 CVAPI(cv::Mat*) features2d_BOWImgDescriptorExtractor_getVocabulary(cv::BOWImgDescriptorExtractor *obj)
 {
     cv::Mat m = obj->getVocabulary();
-    return new cv::Mat(m);
+    return trackHandle(new cv::Mat(m));
 }
 
 CVAPI(void) features2d_BOWImgDescriptorExtractor_compute11(
@@ -7,7 +7,7 @@
 CVAPI(cv::Ptr<cv::BRISK>*) features2d_BRISK_create1(int thresh, int octaves, float patternScale)
 {
     cv::Ptr<cv::BRISK> ptr = cv::BRISK::create(thresh, octaves, patternScale);
-    return new cv::Ptr<cv::BRISK>(ptr);
+    return trackHandle(new cv::Ptr<cv::BRISK>(ptr));
 }
 CVAPI(cv::Ptr<cv::BRISK>*) features2d_BRISK_create2(
     float *radiusList, int radiusListLength, int *numberList, int numberListLength,
@@ -23,12 +23,12 @@ CVAPI(cv::Ptr<cv::BRISK>*) features2d_BRISK_create2(
         indexChangeVec = std::vector<int>();
 
     cv::Ptr<cv::BRISK> ptr = cv::BRISK::create(radiusListVec, numberListVec, dMax, dMin, indexChangeVec);
-    return new cv::Ptr<cv::BRISK>(ptr);
+    return trackHandle(new cv::Ptr<cv::BRISK>(ptr));
 }
 
 CVAPI(void) features2d_Ptr_BRISK_delete(cv::Ptr<cv::BRISK> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::BRISK*) features2d_Ptr_BRISK_get(cv::Ptr<cv::BRISK> *ptr)
@@ -58,52 +58,31 @@ CVAPI(void) features2d_DescriptorMatcher_match2(
     cv::DescriptorMatcher *obj, cv::Mat *queryDescriptors, std::vector<cv::DMatch> *matches,
     cv::Mat **masks, int masksSize)
 {
-    std::vector<cv::Mat> masksVal;
-    if (masksSize != 0)
-    {
-        masksVal = std::vector<cv::Mat>(masksSize);
-        for (int i = 0; i < masksSize; i++)
-        {
-            masksVal[i] = *(masks[i]);
-        }
-    }
-    obj->match(*queryDescriptors, *matches, masksVal);
+    ScratchVector<cv::Mat> masksVal;
+    toVec(masks, masksSize, *masksVal);
+    obj->match(*queryDescriptors, *matches, *masksVal);
 }
 CVAPI(void) features2d_DescriptorMatcher_knnMatch2(
     cv::DescriptorMatcher *obj, cv::Mat *queryDescriptors, std::vector<std::vector<cv::DMatch> > *matches, 
     int k, cv::Mat **masks, int masksSize, int compactResult)
 {
-    std::vector<cv::Mat> masksVal;
-    if (masksSize != 0)
-    {
-        masksVal = std::vector<cv::Mat>(masksSize);
-        for (int i = 0; i < masksSize; i++)
-        {
-            masksVal[i] = *(masks[i]);
-        }
-    }
-    obj->knnMatch(*queryDescriptors, *matches, k, masksVal, compactResult != 0);
+    ScratchVector<cv::Mat> masksVal;
+    toVec(masks, masksSize, *masksVal);
+    obj->knnMatch(*queryDescriptors, *matches, k, *masksVal, compactResult != 0);
 }
 CVAPI(void) features2d_DescriptorMatcher_radiusMatch2(
     cv::DescriptorMatcher *obj, cv::Mat *queryDescriptors, std::vector<std::vector<cv::DMatch> > *matches, 
     float maxDistance, cv::Mat **masks, int masksSize, int compactResult)
 {
-    std::vector<cv::Mat> masksVal;
-    if (masksSize != 0)
-    {
-        masksVal = std::vector<cv::Mat>(masksSize);
-        for (int i = 0; i < masksSize; i++)
-        {
-            masksVal[i] = *(masks[i]);
-        }
-    }
-    obj->radiusMatch(*queryDescriptors, *matches, maxDistance, masksVal, compactResult != 0);
+    ScratchVector<cv::Mat> masksVal;
+    toVec(masks, masksSize, *masksVal);
+    obj->radiusMatch(*queryDescriptors, *matches, maxDistance, *masksVal, compactResult != 0);
 }
 
 CVAPI(cv::Ptr<cv::DescriptorMatcher>*) features2d_DescriptorMatcher_create(const char *descriptorMatcherType)
 {
     cv::Ptr<cv::DescriptorMatcher> ret = cv::DescriptorMatcher::create(descriptorMatcherType);
-    return new cv::Ptr<cv::DescriptorMatcher>(ret);
+    return trackHandle(new cv::Ptr<cv::DescriptorMatcher>(ret));
 }
 
 CVAPI(cv::DescriptorMatcher*) features2d_Ptr_DescriptorMatcher_get(cv::Ptr<cv::DescriptorMatcher> *ptr)
@@ -112,7 +91,7 @@ CVAPI(cv::DescriptorMatcher*) features2d_Ptr_DescriptorMatcher_get(cv::Ptr<cv::D
 }
 CVAPI(void) features2d_Ptr_DescriptorMatcher_delete(cv::Ptr<cv::DescriptorMatcher> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 #pragma endregion
@@ -138,7 +117,7 @@ CVAPI(cv::BFMatcher*) features2d_Ptr_BFMatcher_get(cv::Ptr<cv::BFMatcher> *ptr)
 }
 CVAPI(void) features2d_Ptr_BFMatcher_delete(cv::Ptr<cv::BFMatcher> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 #pragma endregion
@@ -196,7 +175,7 @@ CVAPI(cv::FlannBasedMatcher*) features2d_Ptr_FlannBasedMatcher_get(cv::Ptr<cv::F
 }
 CVAPI(void) features2d_Ptr_FlannBasedMatcher_delete(cv::Ptr<cv::FlannBasedMatcher> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 #pragma endregion
@@ -18,11 +18,11 @@ CVAPI(cv::Ptr<cv::FastFeatureDetector>*) features2d_FastFeatureDetector_create(
     int threshold, int nonmaxSuppression)
 {
     cv::Ptr<cv::FastFeatureDetector> ptr = cv::FastFeatureDetector::create(threshold, nonmaxSuppression != 0);
-    return new cv::Ptr<cv::FastFeatureDetector>(ptr);
+    return trackHandle(new cv::Ptr<cv::FastFeatureDetector>(ptr));
 }
 CVAPI(void) features2d_Ptr_FastFeatureDetector_delete(cv::Ptr<cv::FastFeatureDetector> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::FastFeatureDetector*) features2d_Ptr_FastFeatureDetector_get(cv::Ptr<cv::FastFeatureDetector> *ptr)
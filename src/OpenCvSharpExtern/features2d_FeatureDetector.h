@@ -11,7 +11,7 @@ CVAPI(cv::Feature2D*) features2d_Ptr_Feature2D_get(cv::Ptr<cv::Feature2D>* ptr)
 }
 CVAPI(void) features2d_Ptr_Feature2D_delete(cv::Ptr<cv::Feature2D>* ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(void) features2d_Feature2D_detect_Mat1(
@@ -115,7 +115,7 @@ CVAPI(cv::DenseFeatureDetector*) features2d_Ptr_DenseFeatureDetector_get(cv::Ptr
 }
 CVAPI(void) features2d_Ptr_DenseFeatureDetector_delete(cv::Ptr<cv::DenseFeatureDetector> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 #pragma endregion
@@ -11,11 +11,11 @@ CVAPI(cv::Ptr<cv::GFTTDetector>*) features2d_GFTTDetector_create(
     cv::Ptr<cv::GFTTDetector> ptr = cv::GFTTDetector::create(
         maxCorners, qualityLevel, minDistance,
         blockSize, useHarrisDetector != 0, k);
-    return new cv::Ptr<cv::GFTTDetector>(ptr);
+    return trackHandle(new cv::Ptr<cv::GFTTDetector>(ptr));
 }
 CVAPI(void) features2d_Ptr_GFTTDetector_delete(cv::Ptr<cv::GFTTDetector> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::GFTTDetector*) features2d_Ptr_GFTTDetector_get(cv::Ptr<cv::GFTTDetector> *ptr)
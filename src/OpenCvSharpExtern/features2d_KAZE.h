@@ -11,11 +11,11 @@ CVAPI(cv::Ptr<cv::KAZE>*) features2d_KAZE_create(
     cv::Ptr<cv::KAZE> ptr = cv::KAZE::create(
         extended, upright, threshold,
         nOctaves, nOctaveLayers, static_cast<cv::KAZE::DiffusivityType>(diffusivity));
-    return new cv::Ptr<cv::KAZE>(ptr);
+    return trackHandle(new cv::Ptr<cv::KAZE>(ptr));
 }
 CVAPI(void) features2d_Ptr_KAZE_delete(cv::Ptr<cv::KAZE> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::KAZE*) features2d_Ptr_KAZE_get(cv::Ptr<cv::KAZE> *ptr)
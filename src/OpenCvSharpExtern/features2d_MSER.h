@@ -10,11 +10,11 @@ CVAPI(cv::Ptr<cv::MSER>*) features2d_MSER_create(int delta, int minArea, int max
 {
     cv::Ptr<cv::MSER> ptr = cv::MSER::create(delta, minArea, maxArea, maxVariation, minDiversity, maxEvolution,
         areaThreshold, minMargin, edgeBlurSize);
-    return new cv::Ptr<cv::MSER>(ptr);
+    return trackHandle(new cv::Ptr<cv::MSER>(ptr));
 }
 CVAPI(void) features2d_Ptr_MSER_delete(cv::Ptr<cv::MSER> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(void) features2d_MSER_detectRegions(
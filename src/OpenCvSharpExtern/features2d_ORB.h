@@ -10,11 +10,11 @@ CVAPI(cv::Ptr<cv::ORB>*) features2d_ORB_create(
 {
     cv::Ptr<cv::ORB> ptr = cv::ORB::create(
         nFeatures, scaleFactor, nlevels, edgeThreshold, firstLevel, wtaK, static_cast<cv::ORB::ScoreType>(scoreType), patchSize);
-    return new cv::Ptr<cv::ORB>(ptr);
+    return trackHandle(new cv::Ptr<cv::ORB>(ptr));
 }
 CVAPI(void) features2d_Ptr_ORB_delete(cv::Ptr<cv::ORB> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::ORB*) features2d_Ptr_ORB_get(cv::Ptr<cv::ORB> *ptr)
@@ -55,11 +55,11 @@ CVAPI(cv::Ptr<cv::SimpleBlobDetector>*) features2d_SimpleBlobDetector_create(
         p2.maxConvexity = p->maxConvexity;
     }
     cv::Ptr<cv::SimpleBlobDetector> ptr = cv::SimpleBlobDetector::create(p2);
-    return new cv::Ptr<cv::SimpleBlobDetector>(ptr);
+    return trackHandle(new cv::Ptr<cv::SimpleBlobDetector>(ptr));
 }
 CVAPI(void) features2d_Ptr_SimpleBlobDetector_delete(cv::Ptr<cv::SimpleBlobDetector> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::SimpleBlobDetector*) features2d_Ptr_SimpleBlobDetector_get(cv::Ptr<cv::SimpleBlobDetector> *ptr)
@@ -16,13 +16,11 @@ CVAPI(void) flann_Index_delete(cv::flann::Index* obj)
 }
 CVAPI(void) flann_Index_knnSearch1(cv::flann::Index* obj, float* queries, int queries_length, int* indices, float* dists, int knn, cv::flann::SearchParams* params)
 {
-    std::vector<float> queries_vec(queries_length);
-    std::vector<int> indices_vec(knn);
-    std::vector<float> dists_vec(knn);
-    memcpy(&queries_vec[0], queries, sizeof(float) * queries_length);
-    obj->knnSearch(queries_vec, indices_vec, dists_vec, knn, *params);
-    memcpy(indices, &indices_vec[0], sizeof(int) * knn);
-    memcpy(dists, &dists_vec[0], sizeof(float) * knn);
+    // headers over the caller's arrays; knnSearch writes the results in place
+    const cv::Mat queries_mat(1, queries_length, CV_32FC1, queries);
+    cv::Mat indices_mat(1, knn, CV_32SC1, indices);
+    cv::Mat dists_mat(1, knn, CV_32FC1, dists);
+    obj->knnSearch(queries_mat, indices_mat, dists_mat, knn, *params);
 }
 CVAPI(void) flann_Index_knnSearch2(cv::flann::Index* obj, cv::Mat* queries, cv::Mat* indices, cv::Mat* dists, int knn, cv::flann::SearchParams* params)
 {
@@ -16,7 +16,7 @@ CVAPI(void) flann_IndexParams_delete(cv::flann::IndexParams *obj)
 
 CVAPI(cv::Ptr<cv::flann::IndexParams>*) flann_Ptr_IndexParams_new()
 {
-    return new cv::Ptr<cv::flann::IndexParams>(new cv::flann::IndexParams);
+    return trackHandle(new cv::Ptr<cv::flann::IndexParams>(new cv::flann::IndexParams));
 }
 CVAPI(cv::flann::IndexParams*) flann_Ptr_IndexParams_get(
     cv::Ptr<cv::flann::IndexParams> *ptr)
@@ -25,7 +25,7 @@ CVAPI(cv::flann::IndexParams*) flann_Ptr_IndexParams_get(
 }
 CVAPI(void) flann_Ptr_IndexParams_delete(cv::Ptr<cv::flann::IndexParams> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(void) flann_IndexParams_getString(cv::flann::IndexParams *obj, const char *key, const char *defaultVal, char *result)
@@ -84,7 +84,7 @@ CVAPI(void) flann_LinearIndexParams_delete(cv::flann::LinearIndexParams* obj)
 }
 CVAPI(cv::Ptr<cv::flann::LinearIndexParams>*) flann_Ptr_LinearIndexParams_new()
 {
-    return new cv::Ptr<cv::flann::LinearIndexParams>(new cv::flann::LinearIndexParams);
+    return trackHandle(new cv::Ptr<cv::flann::LinearIndexParams>(new cv::flann::LinearIndexParams));
 }
 CVAPI(cv::flann::LinearIndexParams*) flann_Ptr_LinearIndexParams_get(
     cv::Ptr<cv::flann::LinearIndexParams> *ptr)
@@ -93,7 +93,7 @@ CVAPI(cv::flann::LinearIndexParams*) flann_Ptr_LinearIndexParams_get(
 }
 CVAPI(void) flann_Ptr_LinearIndexParams_delete(cv::Ptr<cv::flann::LinearIndexParams> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 // cv::flann::KDTreeIndexParams
@@ -107,7 +107,7 @@ CVAPI(void) flann_KDTreeIndexParams_delete(cv::flann::KDTreeIndexParams* obj)
 }
 CVAPI(cv::Ptr<cv::flann::KDTreeIndexParams>*) flann_Ptr_KDTreeIndexParams_new(int trees)
 {
-    return new cv::Ptr<cv::flann::KDTreeIndexParams>(new cv::flann::KDTreeIndexParams(trees));
+    return trackHandle(new cv::Ptr<cv::flann::KDTreeIndexParams>(new cv::flann::KDTreeIndexParams(trees)));
 }
 CVAPI(cv::flann::KDTreeIndexParams*) flann_Ptr_KDTreeIndexParams_get(
     cv::Ptr<cv::flann::KDTreeIndexParams> *ptr)
@@ -116,7 +116,7 @@ CVAPI(cv::flann::KDTreeIndexParams*) flann_Ptr_KDTreeIndexParams_get(
 }
 CVAPI(void) flann_Ptr_KDTreeIndexParams_delete(cv::Ptr<cv::flann::KDTreeIndexParams> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 // cv::flann::KMeansIndexParams
@@ -130,7 +130,7 @@ CVAPI(void) flann_KMeansIndexParams_delete(cv::flann::KMeansIndexParams* obj)
 }
 CVAPI(cv::Ptr<cv::flann::KMeansIndexParams>*) flann_Ptr_KMeansIndexParams_new(int branching, int iterations, cvflann::flann_centers_init_t centers_init, float cb_index)
 {
-    return new cv::Ptr<cv::flann::KMeansIndexParams>(new cv::flann::KMeansIndexParams(branching, iterations, centers_init, cb_index));
+    return trackHandle(new cv::Ptr<cv::flann::KMeansIndexParams>(new cv::flann::KMeansIndexParams(branching, iterations, centers_init, cb_index)));
 }
 CVAPI(cv::flann::KMeansIndexParams*) flann_Ptr_KMeansIndexParams_get(
     cv::Ptr<cv::flann::KMeansIndexParams> *ptr)
@@ -139,7 +139,7 @@ CVAPI(cv::flann::KMeansIndexParams*) flann_Ptr_KMeansIndexParams_get(
 }
 CVAPI(void) flann_Ptr_KMeansIndexParams_delete(cv::Ptr<cv::flann::KMeansIndexParams> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 // cv::flann::LshIndexParams
@@ -153,7 +153,7 @@ CVAPI(void) flann_LshIndexParams_delete(cv::flann::LshIndexParams* obj)
 }
 CVAPI(cv::Ptr<cv::flann::LshIndexParams>*) flann_Ptr_LshIndexParams_new(int table_number, int key_size, int multi_probe_level)
 {
-    return new cv::Ptr<cv::flann::LshIndexParams>(new cv::flann::LshIndexParams(table_number, key_size, multi_probe_level));
+    return trackHandle(new cv::Ptr<cv::flann::LshIndexParams>(new cv::flann::LshIndexParams(table_number, key_size, multi_probe_level)));
 }
 CVAPI(cv::flann::LshIndexParams*) flann_Ptr_LshIndexParams_get(
     cv::Ptr<cv::flann::LshIndexParams> *ptr)
@@ -162,7 +162,7 @@ CVAPI(cv::flann::LshIndexParams*) flann_Ptr_LshIndexParams_get(
 }
 CVAPI(void) flann_Ptr_LshIndexParams_delete(cv::Ptr<cv::flann::LshIndexParams> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 // cv::flann::CompositeIndexParams
@@ -176,7 +176,7 @@ CVAPI(void) flann_CompositeIndexParams_delete(cv::flann::CompositeIndexParams* o
 }
 CVAPI(cv::Ptr<cv::flann::CompositeIndexParams>*) flann_Ptr_CompositeIndexParams_new(int trees, int branching, int iterations, cvflann::flann_centers_init_t centers_init, float cb_index)
 {
-    return new cv::Ptr<cv::flann::CompositeIndexParams>(new cv::flann::CompositeIndexParams(trees, branching, iterations, centers_init, cb_index));
+    return trackHandle(new cv::Ptr<cv::flann::CompositeIndexParams>(new cv::flann::CompositeIndexParams(trees, branching, iterations, centers_init, cb_index)));
 }
 CVAPI(cv::flann::CompositeIndexParams*) flann_Ptr_CompositeIndexParams_get(
     cv::Ptr<cv::flann::CompositeIndexParams> *ptr)
@@ -185,7 +185,7 @@ CVAPI(cv::flann::CompositeIndexParams*) flann_Ptr_CompositeIndexParams_get(
 }
 CVAPI(void) flann_Ptr_CompositeIndexParams_delete(cv::Ptr<cv::flann::CompositeIndexParams> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 // cv::flann::AutotunedIndexParams
@@ -199,7 +199,7 @@ CVAPI(void) flann_AutotunedIndexParams_delete(cv::flann::AutotunedIndexParams* o
 }
 CVAPI(cv::Ptr<cv::flann::AutotunedIndexParams>*) flann_Ptr_AutotunedIndexParams_new(float target_precision, float build_weight, float memory_weight, float sample_fraction)
 {
-    return new cv::Ptr<cv::flann::AutotunedIndexParams>(new cv::flann::AutotunedIndexParams(target_precision, build_weight, memory_weight, sample_fraction));
+    return trackHandle(new cv::Ptr<cv::flann::AutotunedIndexParams>(new cv::flann::AutotunedIndexParams(target_precision, build_weight, memory_weight, sample_fraction)));
 }
 CVAPI(cv::flann::AutotunedIndexParams*) flann_Ptr_AutotunedIndexParams_get(
     cv::Ptr<cv::flann::AutotunedIndexParams> *ptr)
@@ -208,7 +208,7 @@ CVAPI(cv::flann::AutotunedIndexParams*) flann_Ptr_AutotunedIndexParams_get(
 }
 CVAPI(void) flann_Ptr_AutotunedIndexParams_delete(cv::Ptr<cv::flann::AutotunedIndexParams> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 // cv::flann::SavedIndexParams
@@ -222,7 +222,7 @@ CVAPI(void) flann_SavedIndexParams_delete(cv::flann::SavedIndexParams* obj)
 }
 CVAPI(cv::Ptr<cv::flann::SavedIndexParams>*) flann_Ptr_SavedIndexParams_new(const char* filename)
 {
-    return new cv::Ptr<cv::flann::SavedIndexParams>(new cv::flann::SavedIndexParams(filename));
+    return trackHandle(new cv::Ptr<cv::flann::SavedIndexParams>(new cv::flann::SavedIndexParams(filename)));
 }
 CVAPI(cv::flann::SavedIndexParams*) flann_Ptr_SavedIndexParams_get(
     cv::Ptr<cv::flann::SavedIndexParams> *ptr)
@@ -231,7 +231,7 @@ CVAPI(cv::flann::SavedIndexParams*) flann_Ptr_SavedIndexParams_get(
 }
 CVAPI(void) flann_Ptr_SavedIndexParams_delete(cv::Ptr<cv::flann::SavedIndexParams> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 // cv::flann::SearchParams
@@ -245,7 +245,7 @@ CVAPI(void) flann_SearchParams_delete(cv::flann::SearchParams* obj)
 }
 CVAPI(cv::Ptr<cv::flann::SearchParams>*) flann_Ptr_SearchParams_new(int checks, float eps, int sorted)
 {
-    return new cv::Ptr<cv::flann::SearchParams>(new cv::flann::SearchParams(checks, eps, (sorted != 0)));
+    return trackHandle(new cv::Ptr<cv::flann::SearchParams>(new cv::flann::SearchParams(checks, eps, (sorted != 0))));
 }
 CVAPI(cv::flann::SearchParams*) flann_Ptr_SearchParams_get(
     cv::Ptr<cv::flann::SearchParams> *ptr)
@@ -254,7 +254,7 @@ CVAPI(cv::flann::SearchParams*) flann_Ptr_SearchParams_get(
 }
 CVAPI(void) flann_Ptr_SearchParams_delete(cv::Ptr<cv::flann::SearchParams> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1 @@
+#include "gapi.h"
\ No newline at end of file
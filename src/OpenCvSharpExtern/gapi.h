@@ -0,0 +1,324 @@
+#ifndef _CPP_GAPI_H_
+#define _CPP_GAPI_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+
+enum GapiArithmOp
+{
+    GAPI_ADD = 0,
+    GAPI_SUB = 1,
+    GAPI_MUL = 2,
+    GAPI_DIV = 3,
+    GAPI_ABSDIFF = 4,
+    GAPI_MIN = 5,
+    GAPI_MAX = 6,
+    GAPI_AND = 7,
+    GAPI_OR = 8,
+    GAPI_XOR = 9,
+};
+
+enum GapiBackend
+{
+    GAPI_BACKEND_CPU = 0,
+    GAPI_BACKEND_FLUID = 1, // Fluid kernels where available (fused, line-based execution), CPU kernels otherwise
+};
+
+// Graph under construction; the managed side refers to its nodes by index
+struct GapiGraph
+{
+    std::vector<cv::GMat> nodes;
+    std::vector<int> inputs;
+    std::vector<int> outputs;
+
+    int add(const cv::GMat &node)
+    {
+        nodes.push_back(node);
+        return static_cast<int>(nodes.size()) - 1;
+    }
+
+    const cv::GMat &at(int node) const
+    {
+        if (node < 0 || static_cast<size_t>(node) >= nodes.size())
+            CV_Error(cv::Error::StsOutOfRange, "invalid G-API graph node");
+        return nodes[node];
+    }
+};
+
+// Graph compiled for the metadata (size, depth, channels) of its inputs
+struct GapiCompiled
+{
+    cv::GCompiled compiled;
+    std::vector<cv::GMatDesc> inputDescs;
+    std::vector<cv::GMatDesc> outputDescs;
+};
+
+static cv::GMat gapiCvtColor(const cv::GMat &src, int code)
+{
+    switch (code)
+    {
+    case cv::COLOR_RGB2GRAY: return cv::gapi::RGB2Gray(src);
+    case cv::COLOR_BGR2GRAY: return cv::gapi::BGR2Gray(src);
+    case cv::COLOR_RGB2YUV: return cv::gapi::RGB2YUV(src);
+    case cv::COLOR_YUV2RGB: return cv::gapi::YUV2RGB(src);
+    case cv::COLOR_BGR2YUV: return cv::gapi::BGR2YUV(src);
+    case cv::COLOR_YUV2BGR: return cv::gapi::YUV2BGR(src);
+    case cv::COLOR_RGB2Lab: return cv::gapi::RGB2Lab(src);
+    case cv::COLOR_BGR2Luv: return cv::gapi::BGR2LUV(src);
+    case cv::COLOR_Luv2BGR: return cv::gapi::LUV2BGR(src);
+    default:
+        CV_Error(cv::Error::StsNotImplemented, "this color conversion is not available in G-API");
+    }
+}
+
+#pragma region GapiGraph
+
+CVAPI(GapiGraph*) gapi_Graph_new()
+{
+    return new GapiGraph;
+}
+
+CVAPI(void) gapi_Graph_delete(GapiGraph *obj)
+{
+    delete obj;
+}
+
+CVAPI(int) gapi_Graph_input(GapiGraph *obj)
+{
+    const int node = obj->add(cv::GMat());
+    obj->inputs.push_back(node);
+    return node;
+}
+
+CVAPI(void) gapi_Graph_output(GapiGraph *obj, int node)
+{
+    obj->at(node);
+    obj->outputs.push_back(node);
+}
+
+CVAPI(int) gapi_Graph_cvtColor(GapiGraph *obj, int src, int code)
+{
+    return obj->add(gapiCvtColor(obj->at(src), code));
+}
+
+CVAPI(int) gapi_Graph_resize(GapiGraph *obj, int src, MyCvSize dsize, double fx, double fy, int interpolation)
+{
+    return obj->add(cv::gapi::resize(obj->at(src), cpp(dsize), fx, fy, interpolation));
+}
+
+CVAPI(int) gapi_Graph_blur(GapiGraph *obj, int src, MyCvSize ksize, MyCvPoint anchor, int borderType)
+{
+    return obj->add(cv::gapi::blur(obj->at(src), cpp(ksize), cpp(anchor), borderType));
+}
+
+CVAPI(int) gapi_Graph_gaussianBlur(GapiGraph *obj, int src, MyCvSize ksize, double sigmaX, double sigmaY, int borderType)
+{
+    return obj->add(cv::gapi::gaussianBlur(obj->at(src), cpp(ksize), sigmaX, sigmaY, borderType));
+}
+
+CVAPI(int) gapi_Graph_medianBlur(GapiGraph *obj, int src, int ksize)
+{
+    return obj->add(cv::gapi::medianBlur(obj->at(src), ksize));
+}
+
+CVAPI(int) gapi_Graph_filter2D(GapiGraph *obj, int src, int ddepth, cv::Mat *kernel, MyCvPoint anchor,
+    MyCvScalar delta, int borderType)
+{
+    return obj->add(cv::gapi::filter2D(obj->at(src), ddepth, kernel->clone(), cpp(anchor), cpp(delta), borderType));
+}
+
+CVAPI(int) gapi_Graph_sobel(GapiGraph *obj, int src, int ddepth, int dx, int dy, int ksize,
+    double scale, double delta, int borderType)
+{
+    return obj->add(cv::gapi::Sobel(obj->at(src), ddepth, dx, dy, ksize, scale, delta, borderType));
+}
+
+CVAPI(int) gapi_Graph_canny(GapiGraph *obj, int src, double threshold1, double threshold2, int apertureSize, int L2gradient)
+{
+    return obj->add(cv::gapi::Canny(obj->at(src), threshold1, threshold2, apertureSize, L2gradient != 0));
+}
+
+CVAPI(int) gapi_Graph_erode(GapiGraph *obj, int src, cv::Mat *kernel, MyCvPoint anchor, int iterations, int borderType)
+{
+    return obj->add(cv::gapi::erode(obj->at(src), kernel->clone(), cpp(anchor), iterations, borderType));
+}
+
+CVAPI(int) gapi_Graph_dilate(GapiGraph *obj, int src, cv::Mat *kernel, MyCvPoint anchor, int iterations, int borderType)
+{
+    return obj->add(cv::gapi::dilate(obj->at(src), kernel->clone(), cpp(anchor), iterations, borderType));
+}
+
+CVAPI(int) gapi_Graph_threshold(GapiGraph *obj, int src, double thresh, double maxval, int type)
+{
+    return obj->add(cv::gapi::threshold(obj->at(src), cv::GScalar(cv::Scalar::all(thresh)), cv::GScalar(cv::Scalar::all(maxval)), type));
+}
+
+// scale is used by GAPI_MUL and GAPI_DIV, ddepth by GAPI_ADD, GAPI_SUB, GAPI_MUL and GAPI_DIV
+CVAPI(int) gapi_Graph_arithm(GapiGraph *obj, int op, int src1, int src2, double scale, int ddepth)
+{
+    const cv::GMat a = obj->at(src1);
+    const cv::GMat b = obj->at(src2);
+    switch (op)
+    {
+    case GAPI_ADD: return obj->add(cv::gapi::add(a, b, ddepth));
+    case GAPI_SUB: return obj->add(cv::gapi::sub(a, b, ddepth));
+    case GAPI_MUL: return obj->add(cv::gapi::mul(a, b, scale, ddepth));
+    case GAPI_DIV: return obj->add(cv::gapi::div(a, b, scale, ddepth));
+    case GAPI_ABSDIFF: return obj->add(cv::gapi::absDiff(a, b));
+    case GAPI_MIN: return obj->add(cv::gapi::min(a, b));
+    case GAPI_MAX: return obj->add(cv::gapi::max(a, b));
+    case GAPI_AND: return obj->add(cv::gapi::bitwise_and(a, b));
+    case GAPI_OR: return obj->add(cv::gapi::bitwise_or(a, b));
+    case GAPI_XOR: return obj->add(cv::gapi::bitwise_xor(a, b));
+    default:
+        CV_Error(cv::Error::StsBadArg, "unknown G-API arithmetic operation");
+    }
+}
+
+// Arithmetic with a constant: GAPI_ADD, GAPI_SUB, GAPI_MUL, GAPI_DIV (scale) and GAPI_ABSDIFF
+CVAPI(int) gapi_Graph_arithmC(GapiGraph *obj, int op, int src, MyCvScalar value, double scale, int ddepth)
+{
+    const cv::GMat a = obj->at(src);
+    const cv::GScalar constant(cpp(value));
+    switch (op)
+    {
+    case GAPI_ADD: return obj->add(cv::gapi::addC(a, constant, ddepth));
+    case GAPI_SUB: return obj->add(cv::gapi::subC(a, constant, ddepth));
+    case GAPI_MUL: return obj->add(cv::gapi::mulC(a, constant, ddepth));
+    case GAPI_DIV: return obj->add(cv::gapi::divC(a, constant, scale, ddepth));
+    case GAPI_ABSDIFF: return obj->add(cv::gapi::absDiffC(a, constant));
+    default:
+        CV_Error(cv::Error::StsBadArg, "unsupported G-API arithmetic operation with a constant");
+    }
+}
+
+CVAPI(int) gapi_Graph_addWeighted(GapiGraph *obj, int src1, double alpha, int src2, double beta, double gamma, int ddepth)
+{
+    return obj->add(cv::gapi::addWeighted(obj->at(src1), alpha, obj->at(src2), beta, gamma, ddepth));
+}
+
+CVAPI(int) gapi_Graph_bitwiseNot(GapiGraph *obj, int src)
+{
+    return obj->add(cv::gapi::bitwise_not(obj->at(src)));
+}
+
+CVAPI(int) gapi_Graph_convertTo(GapiGraph *obj, int src, int rdepth, double alpha, double beta)
+{
+    return obj->add(cv::gapi::convertTo(obj->at(src), rdepth, alpha, beta));
+}
+
+CVAPI(void) gapi_Graph_split3(GapiGraph *obj, int src, int *dst)
+{
+    const std::tuple<cv::GMat, cv::GMat, cv::GMat> planes = cv::gapi::split3(obj->at(src));
+    dst[0] = obj->add(std::get<0>(planes));
+    dst[1] = obj->add(std::get<1>(planes));
+    dst[2] = obj->add(std::get<2>(planes));
+}
+
+CVAPI(int) gapi_Graph_merge3(GapiGraph *obj, int src1, int src2, int src3)
+{
+    return obj->add(cv::gapi::merge3(obj->at(src1), obj->at(src2), obj->at(src3)));
+}
+
+// Compiles the graph for inputs like samples (only their size, depth and channels are used)
+CVAPI(GapiCompiled*) gapi_Graph_compile(GapiGraph *obj, cv::Mat **samples, int samplesLength, int backend)
+{
+    if (obj->inputs.empty() || obj->outputs.empty())
+        CV_Error(cv::Error::StsBadArg, "the G-API graph needs at least one input and one output");
+    if (samplesLength != static_cast<int>(obj->inputs.size()))
+        CV_Error(cv::Error::StsBadArg, "one sample is needed per G-API graph input");
+
+    std::vector<cv::GMat> ins, outs;
+    for (size_t i = 0; i < obj->inputs.size(); i++)
+        ins.push_back(obj->nodes[obj->inputs[i]]);
+    for (size_t i = 0; i < obj->outputs.size(); i++)
+        outs.push_back(obj->nodes[obj->outputs[i]]);
+    cv::GComputation computation(ins, outs);
+
+    std::vector<cv::GMatDesc> inputDescs;
+    cv::GMetaArgs metas;
+    for (int i = 0; i < samplesLength; i++)
+    {
+        inputDescs.push_back(cv::descr_of(*samples[i]));
+        metas.push_back(cv::GMetaArg(inputDescs.back()));
+    }
+
+    cv::GCompiled compiled;
+    if (backend == GAPI_BACKEND_FLUID)
+    {
+        const cv::gapi::GKernelPackage fluid = cv::gapi::combine(
+            cv::gapi::core::fluid::kernels(), cv::gapi::imgproc::fluid::kernels(), cv::unite_policy::KEEP);
+        compiled = computation.compile(std::move(metas), cv::compile_args(fluid));
+    }
+    else
+    {
+        compiled = computation.compile(std::move(metas));
+    }
+
+    GapiCompiled *ret = new GapiCompiled;
+    ret->compiled = compiled;
+    ret->inputDescs = inputDescs;
+    const cv::GMetaArgs &outMetas = compiled.outMetas();
+    for (size_t i = 0; i < outMetas.size(); i++)
+        ret->outputDescs.push_back(cv::util::get<cv::GMatDesc>(outMetas[i]));
+    return ret;
+}
+
+#pragma endregion
+
+#pragma region GapiCompiled
+
+CVAPI(void) gapi_Compiled_delete(GapiCompiled *obj)
+{
+    delete obj;
+}
+
+CVAPI(int) gapi_Compiled_inputCount(GapiCompiled *obj)
+{
+    return static_cast<int>(obj->inputDescs.size());
+}
+
+CVAPI(int) gapi_Compiled_outputCount(GapiCompiled *obj)
+{
+    return static_cast<int>(obj->outputDescs.size());
+}
+
+// Output metadata: size, type
+CVAPI(void) gapi_Compiled_outputDesc(GapiCompiled *obj, int index, MyCvSize *size, int *type)
+{
+    CV_Assert(index >= 0 && static_cast<size_t>(index) < obj->outputDescs.size());
+    const cv::GMatDesc &d = obj->outputDescs[index];
+    *size = c(d.size);
+    *type = CV_MAKETYPE(d.depth, d.chan);
+}
+
+// Runs the graph. The outputs are (re)allocated only if their size or type differs from the compiled
+// output metadata, so passing the same Mats for every frame runs without allocations.
+CVAPI(void) gapi_Compiled_apply(GapiCompiled *obj, cv::Mat **inputs, int inputsLength, cv::Mat **outputs, int outputsLength)
+{
+    if (inputsLength != static_cast<int>(obj->inputDescs.size()) || outputsLength != static_cast<int>(obj->outputDescs.size()))
+        CV_Error(cv::Error::StsBadArg, "wrong number of inputs or outputs for the compiled G-API graph");
+
+    ScratchVector<cv::Mat> ins;
+    for (int i = 0; i < inputsLength; i++)
+    {
+        if (!(cv::descr_of(*inputs[i]) == obj->inputDescs[i]))
+            CV_Error(cv::Error::StsUnmatchedSizes, "the input does not match the metadata the G-API graph was compiled for");
+        ins->push_back(*inputs[i]);
+    }
+
+    ScratchVector<cv::Mat> outs;
+    for (int i = 0; i < outputsLength; i++)
+    {
+        const cv::GMatDesc &d = obj->outputDescs[i];
+        outputs[i]->create(d.size, CV_MAKETYPE(d.depth, d.chan));
+        outs->push_back(*outputs[i]);
+    }
+
+    obj->compiled(*ins, *outs);
+}
+
+#pragma endregion
+
+#endif
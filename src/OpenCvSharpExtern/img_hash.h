@@ -25,7 +25,7 @@ CVAPI(cv::Ptr<cv::img_hash::AverageHash>*) img_hash_AverageHash_create()
 
 CVAPI(void) img_hash_Ptr_AverageHash_delete(cv::Ptr<cv::img_hash::AverageHash> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::img_hash::AverageHash*) img_hash_Ptr_AverageHash_get(cv::Ptr<cv::img_hash::AverageHash> *ptr)
@@ -43,7 +43,7 @@ CVAPI(cv::Ptr<cv::img_hash::BlockMeanHash>*) img_hash_BlockMeanHash_create(const
 
 CVAPI(void) img_hash_Ptr_BlockMeanHash_delete(cv::Ptr<cv::img_hash::BlockMeanHash> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::img_hash::BlockMeanHash*) img_hash_Ptr_BlockMeanHash_get(cv::Ptr<cv::img_hash::BlockMeanHash> *ptr)
@@ -73,7 +73,7 @@ CVAPI(cv::Ptr<cv::img_hash::ColorMomentHash>*) img_hash_ColorMomentHash_create()
 
 CVAPI(void) img_hash_Ptr_ColorMomentHash_delete(cv::Ptr<cv::img_hash::ColorMomentHash> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::img_hash::ColorMomentHash*) img_hash_Ptr_ColorMomentHash_get(cv::Ptr<cv::img_hash::ColorMomentHash> *ptr)
@@ -91,7 +91,7 @@ CVAPI(cv::Ptr<cv::img_hash::MarrHildrethHash>*) img_hash_MarrHildrethHash_create
 
 CVAPI(void) img_hash_Ptr_MarrHildrethHash_delete(cv::Ptr<cv::img_hash::MarrHildrethHash> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::img_hash::MarrHildrethHash*) img_hash_Ptr_MarrHildrethHash_get(cv::Ptr<cv::img_hash::MarrHildrethHash> *ptr)
@@ -124,7 +124,7 @@ CVAPI(cv::Ptr<cv::img_hash::PHash>*) img_hash_PHash_create()
 
 CVAPI(void) img_hash_Ptr_PHash_delete(cv::Ptr<cv::img_hash::PHash> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::img_hash::PHash*) img_hash_Ptr_PHash_get(cv::Ptr<cv::img_hash::PHash> *ptr)
@@ -142,7 +142,7 @@ CVAPI(cv::Ptr<cv::img_hash::RadialVarianceHash>*) img_hash_RadialVarianceHash_cr
 
 CVAPI(void) img_hash_Ptr_RadialVarianceHash_delete(cv::Ptr<cv::img_hash::RadialVarianceHash> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::img_hash::RadialVarianceHash*) img_hash_Ptr_RadialVarianceHash_get(cv::Ptr<cv::img_hash::RadialVarianceHash> *ptr)
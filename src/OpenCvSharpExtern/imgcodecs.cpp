@@ -1 +1,7 @@
-#include "imgcodecs.h"
\ No newline at end of file
+// ReSharper disable CppUnusedIncludeDirective
+#include "imgcodecs.h"
+#include "imgcodecs_Batch.h"
+#include "imgcodecs_ImageEncoder.h"
+#include "imgcodecs_ReducedDecode.h"
+#include "imgcodecs_MultiPage.h"
+#include "imgcodecs_ImageLoader.h"
\ No newline at end of file
@@ -6,7 +6,7 @@
 CVAPI(cv::Mat*) imgcodecs_imread(const char *filename, int flags)
 {
     cv::Mat ret = cv::imread(filename, flags);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(int) imgcodecs_imreadmulti(const char *filename, std::vector<cv::Mat> *mats, int flags)
@@ -16,42 +16,46 @@ CVAPI(int) imgcodecs_imreadmulti(const char *filename, std::vector<cv::Mat> *mat
 
 CVAPI(int) imgcodecs_imwrite(const char *filename, cv::Mat *img, int *params, int paramsLength)
 {
-    std::vector<int> paramsVec;
-    paramsVec.assign(params, params + paramsLength);
-    return cv::imwrite(filename, *img, paramsVec) ? 1 : 0;
+    ScratchVector<int> paramsVec;
+    return cv::imwrite(filename, *img, paramsVec.assign(params, paramsLength)) ? 1 : 0;
 }
 
 CVAPI(int) imgcodecs_imwrite_multi(const char *filename, std::vector<cv::Mat> *img, int *params, int paramsLength)
 {
-    std::vector<int> paramsVec;
-    paramsVec.assign(params, params + paramsLength);
-    return cv::imwrite(filename, *img, paramsVec) ? 1 : 0;
+    ScratchVector<int> paramsVec;
+    return cv::imwrite(filename, *img, paramsVec.assign(params, paramsLength)) ? 1 : 0;
 }
 
 CVAPI(cv::Mat*) imgcodecs_imdecode_Mat(cv::Mat *buf, int flags)
 {
     cv::Mat ret = cv::imdecode(*buf, flags);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 CVAPI(cv::Mat*) imgcodecs_imdecode_vector(uchar *buf, size_t bufLength, int flags)
 {
+    RecordedCall rec("imgcodecs_imdecode_vector");
+    if (rec)
+        rec.blob(buf, bufLength).i32(flags);
     std::vector<uchar> bufVec(buf, buf + bufLength);
     cv::Mat ret = cv::imdecode(bufVec, flags);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 CVAPI(cv::Mat*) imgcodecs_imdecode_InputArray(cv::_InputArray *buf, int flags)
 {
     cv::Mat ret = cv::imdecode(*buf, flags);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(int) imgcodecs_imencode_vector(const char *ext, cv::_InputArray *img,
     std::vector<uchar> *buf, int *params, int paramsLength)
 {
-    std::vector<int> paramsVec;
+    RecordedCall rec("imgcodecs_imencode_vector");
+    if (rec)
+        rec.str(ext).array(img).ints(params, params == NULL ? 0 : paramsLength);
+    ScratchVector<int> paramsVec;
     if (params != NULL)
-        paramsVec = std::vector<int>(params, params + paramsLength);
-    return cv::imencode(ext, *img, *buf, paramsVec) ? 1 : 0;
+        paramsVec.assign(params, paramsLength);
+    return cv::imencode(ext, *img, *buf, *paramsVec) ? 1 : 0;
 }
 
 
@@ -0,0 +1,109 @@
+#ifndef _CPP_IMGCODECS_BATCH_H_
+#define _CPP_IMGCODECS_BATCH_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include <functional>
+
+// Decoding and encoding of many images in one call. The items are independent, so they are spread over
+// the cv::parallel_for_ pool; a failing item is reported in its result and does not stop the others.
+
+enum ImageBatchStatus
+{
+    IMAGE_BATCH_OK = 0,
+    IMAGE_BATCH_FAILED = 1,     // the codec did not produce a result (unknown format, corrupt data)
+    IMAGE_BATCH_ERROR = 2,      // an exception was thrown
+    IMAGE_BATCH_TOO_SMALL = 3,  // the result did not fit into the space provided by the caller
+};
+
+// Outcome of one item, returned to the managed side as an array
+struct ImageBatchResult
+{
+    int status;
+    int reserved;
+    double milliseconds;        // time spent on the item
+};
+
+class ImageBatch
+{
+public:
+    // Processes one item and returns its ImageBatchStatus
+    typedef std::function<int(int index)> ItemFunc;
+
+    // Runs item(0 .. count-1) on up to maxConcurrency threads (<= 0: one task per item)
+    static void run(const char *name, int count, int maxConcurrency, const ItemFunc &item, ImageBatchResult *results)
+    {
+        CV_Assert(count >= 0);
+        if (count == 0)
+            return;
+        const double nstripes = (maxConcurrency > 0) ? std::min(maxConcurrency, count) : count;
+        tracedParallelFor(name, cv::Range(0, count), Invoker(item, results), nstripes);
+    }
+
+private:
+    class Invoker : public cv::ParallelLoopBody
+    {
+    public:
+        Invoker(const ItemFunc &item, ImageBatchResult *results)
+            : item(item), results(results)
+        {
+        }
+
+        void operator()(const cv::Range &range) const CV_OVERRIDE
+        {
+            // also on the pool threads, so errors are caught here rather than sent to the managed handler
+            NativeErrorScope errors;
+            for (int i = range.start; i < range.end; i++)
+            {
+                const int64 start = cv::getTickCount();
+                int status;
+                try
+                {
+                    status = item(i);
+                }
+                catch (...)
+                {
+                    status = IMAGE_BATCH_ERROR;
+                }
+                results[i].status = status;
+                results[i].reserved = 0;
+                results[i].milliseconds = (cv::getTickCount() - start) * 1000. / cv::getTickFrequency();
+            }
+        }
+
+    private:
+        const ItemFunc &item;
+        ImageBatchResult *results;
+    };
+};
+
+// Decodes bufs[i] (bufLengths[i] bytes, read in place) into *dst[i]. A destination which already has the
+// size and type of the decoded image is written in place; otherwise it is reallocated. Failed items leave
+// an empty destination.
+CVAPI(void) imgcodecs_imdecode_batch(
+    uchar **bufs, int64 *bufLengths, int count, int flags, cv::Mat **dst, int maxConcurrency, ImageBatchResult *results)
+{
+    ImageBatch::run("imdecode_batch", count, maxConcurrency, [=](int i)
+    {
+        cv::Mat &out = *dst[i];
+        if (bufs[i] == NULL || bufLengths[i] <= 0 || bufLengths[i] > INT_MAX)
+        {
+            out.release();
+            return IMAGE_BATCH_FAILED;
+        }
+        const cv::Mat buf(1, static_cast<int>(bufLengths[i]), CV_8UC1, bufs[i]);
+        try
+        {
+            cv::imdecode(buf, flags, &out);
+        }
+        catch (...)
+        {
+            out.release();
+            throw;
+        }
+        return out.empty() ? IMAGE_BATCH_FAILED : IMAGE_BATCH_OK;
+    }, results);
+}
+
+#endif
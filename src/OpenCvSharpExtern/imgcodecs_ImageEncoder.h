@@ -0,0 +1,163 @@
+#ifndef _CPP_IMGCODECS_IMAGEENCODER_H_
+#define _CPP_IMGCODECS_IMAGEENCODER_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include "imgcodecs_Batch.h"
+#include <atomic>
+#include <mutex>
+
+// Encoding session: cv::imencode with a fixed format and parameters, into output buffers which are kept
+// between calls. The buffers are reserved from the sizes of the recent results, so the codecs (which
+// append to the output as they go) do not have to grow them while encoding.
+class ImageEncoder
+{
+public:
+    ImageEncoder(const char *ext, const int *params, int paramsLength)
+        : ext(ext), sizeHint_(0)
+    {
+        if (params != NULL)
+            this->params.assign(params, params + paramsLength);
+        if (!cv::haveImageWriter(cv::String("x") + ext))
+            CV_Error(cv::Error::StsBadArg, "no encoder available for this file extension");
+    }
+
+    // Encodes into the buffer of the session, which is valid until the next call.
+    // Not to be called concurrently; encodeBatch may run at the same time.
+    bool encode(cv::InputArray img)
+    {
+        return encode(img, buffer);
+    }
+
+    const std::vector<uchar> &result() const
+    {
+        return buffer;
+    }
+
+    // Encodes images[i] into dst[i] (dstCapacity[i] bytes) in parallel. dstLength[i] receives the encoded
+    // size, also when it exceeded the capacity (IMAGE_BATCH_TOO_SMALL), so that the caller can retry.
+    void encodeBatch(cv::Mat **images, int count, uchar **dst, const int64 *dstCapacity, int64 *dstLength,
+        int maxConcurrency, ImageBatchResult *results)
+    {
+        ImageBatch::run("imencode_batch", count, maxConcurrency, [=](int i)
+        {
+            dstLength[i] = 0;
+            std::vector<uchar> *buf = acquire();
+            try
+            {
+                int status = IMAGE_BATCH_FAILED;
+                if (encode(*images[i], *buf))
+                {
+                    dstLength[i] = static_cast<int64>(buf->size());
+                    status = IMAGE_BATCH_TOO_SMALL;
+                    if (dstLength[i] <= dstCapacity[i])
+                    {
+                        if (!buf->empty())
+                            memcpy(dst[i], &(*buf)[0], buf->size());
+                        status = IMAGE_BATCH_OK;
+                    }
+                }
+                release(buf);
+                return status;
+            }
+            catch (...)
+            {
+                release(buf);
+                throw;
+            }
+        }, results);
+    }
+
+    // Expected size of the next result [bytes]
+    size_t sizeHint() const
+    {
+        return sizeHint_.load(std::memory_order_relaxed);
+    }
+
+    ~ImageEncoder()
+    {
+        for (size_t i = 0; i < spare.size(); i++)
+            delete spare[i];
+    }
+
+private:
+    const cv::String ext;
+    std::vector<int> params;
+    std::vector<uchar> buffer;
+    // maximum of the recent result sizes, decaying by 1/8 per result
+    std::atomic<size_t> sizeHint_;
+    // scratch buffers of encodeBatch, one per concurrently encoded image
+    std::mutex spareMutex;
+    std::vector<std::vector<uchar>*> spare;
+
+    ImageEncoder(const ImageEncoder &);
+    ImageEncoder &operator=(const ImageEncoder &);
+
+    bool encode(cv::InputArray img, std::vector<uchar> &buf)
+    {
+        // keeps the capacity
+        buf.clear();
+        const size_t hint = sizeHint();
+        buf.reserve(hint + hint / 8);
+        if (!cv::imencode(ext, img, buf, params))
+            return false;
+
+        const size_t decayed = hint - hint / 8;
+        sizeHint_.store(std::max(buf.size(), decayed), std::memory_order_relaxed);
+        return true;
+    }
+
+    std::vector<uchar> *acquire()
+    {
+        {
+            std::lock_guard<std::mutex> lock(spareMutex);
+            if (!spare.empty())
+            {
+                std::vector<uchar> *buf = spare.back();
+                spare.pop_back();
+                return buf;
+            }
+        }
+        return new std::vector<uchar>();
+    }
+
+    void release(std::vector<uchar> *buf)
+    {
+        std::lock_guard<std::mutex> lock(spareMutex);
+        spare.push_back(buf);
+    }
+};
+
+CVAPI(ImageEncoder*) imgcodecs_ImageEncoder_new(const char *ext, int *params, int paramsLength)
+{
+    return new ImageEncoder(ext, params, paramsLength);
+}
+
+CVAPI(void) imgcodecs_ImageEncoder_delete(ImageEncoder *obj)
+{
+    delete obj;
+}
+
+// data / length: the result, valid until the next call or the deletion of the encoder
+CVAPI(int) imgcodecs_ImageEncoder_encode(ImageEncoder *obj, cv::_InputArray *img, uchar **data, int64 *length)
+{
+    const bool ok = obj->encode(*img);
+    const std::vector<uchar> &buf = obj->result();
+    *data = (ok && !buf.empty()) ? const_cast<uchar*>(&buf[0]) : NULL;
+    *length = ok ? static_cast<int64>(buf.size()) : 0;
+    return ok ? 1 : 0;
+}
+
+CVAPI(void) imgcodecs_ImageEncoder_encodeBatch(ImageEncoder *obj, cv::Mat **images, int count,
+    uchar **dst, int64 *dstCapacity, int64 *dstLength, int maxConcurrency, ImageBatchResult *results)
+{
+    obj->encodeBatch(images, count, dst, dstCapacity, dstLength, maxConcurrency, results);
+}
+
+CVAPI(int64) imgcodecs_ImageEncoder_sizeHint(ImageEncoder *obj)
+{
+    return static_cast<int64>(obj->sizeHint());
+}
+
+#endif
@@ -0,0 +1,247 @@
+#ifndef _CPP_IMGCODECS_IMAGELOADER_H_
+#define _CPP_IMGCODECS_IMAGELOADER_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include "imgcodecs_Batch.h"
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+// Prefetching loader for a list of image files: decoder threads read, decode and optionally resize and convert
+// the files ahead of the consumer into a bounded queue, so that I/O and decoding overlap the processing of the
+// previous images. The files are started in list order. The queue holds at most maxQueued images (decoded or
+// being decoded) and stops taking new files once the decoded images reach maxQueuedBytes (which the images being
+// decoded at that moment may still exceed), so a slow consumer holds back the decoders.
+
+enum ImageLoaderPop
+{
+    IMAGE_LOADER_END = -1,      // every image has been taken
+    IMAGE_LOADER_TIMEOUT = 0,
+    IMAGE_LOADER_ITEM = 1,
+};
+
+struct ImageLoaderOptions
+{
+    int64 maxQueuedBytes;       // <= 0: no limit
+    int maxQueued;              // <= 0: twice the number of threads
+    int threads;                // <= 0: the number of CPUs
+    int flags;                  // cv::ImreadModes
+    MyCvSize size;              // resized to this size unless it is empty
+    int interpolation;
+    int colorConversion;        // cv::ColorConversionCodes applied after resizing, < 0: none
+    int ordered;                // nonzero: images are taken in list order, otherwise as they become ready
+    int reserved;
+};
+
+class ImageLoader
+{
+public:
+    ImageLoader(const std::vector<std::string> &files, const ImageLoaderOptions &options)
+        : files(files), options(options), started(0), taken(0), nextOut(0), inFlight(0), readyBytes(0), stopping(false)
+    {
+        int threads = options.threads > 0 ? options.threads : std::max(1, cv::getNumberOfCPUs());
+        threads = std::max(1, std::min(threads, static_cast<int>(files.size())));
+        maxQueued = options.maxQueued > 0 ? static_cast<size_t>(options.maxQueued) : static_cast<size_t>(threads) * 2;
+        try
+        {
+            for (int i = 0; i < threads; i++)
+                workers.push_back(std::thread(&ImageLoader::work, this));
+        }
+        catch (...)
+        {
+            stop();
+            throw;
+        }
+    }
+
+    // Stops the decoders after their current image and discards the queue
+    ~ImageLoader()
+    {
+        stop();
+    }
+
+    const std::vector<std::string> &fileNames() const
+    {
+        return files;
+    }
+
+    // Takes the next image (ownership moves to dst) with its index in the file list and its ImageBatchStatus;
+    // images which could not be loaded are returned empty. A negative timeout waits forever.
+    int pop(int timeoutMs, cv::Mat &dst, int &index, int &status)
+    {
+        index = -1;
+        status = IMAGE_BATCH_OK;
+        std::unique_lock<std::mutex> lock(mutex);
+        if (taken == files.size())
+            return IMAGE_LOADER_END;
+        const auto isReady = [this] { return options.ordered ? ready.count(nextOut) != 0 : !ready.empty(); };
+        if (timeoutMs < 0)
+            available.wait(lock, isReady);
+        else if (!available.wait_for(lock, std::chrono::milliseconds(timeoutMs), isReady))
+            return IMAGE_LOADER_TIMEOUT;
+
+        const std::map<int, Item>::iterator it = options.ordered ? ready.find(nextOut) : ready.begin();
+        index = it->first;
+        status = it->second.status;
+        dst = it->second.image;
+        readyBytes -= it->second.bytes;
+        ready.erase(it);
+        taken++;
+        nextOut++;
+        lock.unlock();
+        space.notify_all();
+        return IMAGE_LOADER_ITEM;
+    }
+
+    // Number of decoded images waiting in the queue, and their size [bytes]
+    void queued(int &count, int64 &bytes)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        count = static_cast<int>(ready.size());
+        bytes = static_cast<int64>(readyBytes);
+    }
+
+private:
+    struct Item
+    {
+        cv::Mat image;
+        int status;
+        size_t bytes;
+    };
+
+    const std::vector<std::string> files;
+    const ImageLoaderOptions options;
+    size_t maxQueued;
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable available;  // an image was added to ready
+    std::condition_variable space;      // an image was taken, or stopping
+    std::map<int, Item> ready;
+    size_t started;     // files handed to the decoders
+    size_t taken;
+    int nextOut;        // index of the next image in list order
+    size_t inFlight;
+    size_t readyBytes;
+    bool stopping;
+
+    ImageLoader(const ImageLoader &);
+    ImageLoader &operator=(const ImageLoader &);
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        space.notify_all();
+        for (size_t i = 0; i < workers.size(); i++)
+            workers[i].join();
+    }
+
+    // Files are started in list order, so in ordered mode the next image is always decoded or being decoded
+    // and the limits cannot stall the consumer
+    bool hasRoom() const
+    {
+        return ready.size() + inFlight < maxQueued
+            && (options.maxQueuedBytes <= 0 || readyBytes < static_cast<size_t>(options.maxQueuedBytes));
+    }
+
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;)
+        {
+            space.wait(lock, [this] { return stopping || started == files.size() || hasRoom(); });
+            if (stopping || started == files.size())
+                return;
+            const int index = static_cast<int>(started++);
+            inFlight++;
+            lock.unlock();
+
+            Item item;
+            load(index, item);
+
+            lock.lock();
+            inFlight--;
+            readyBytes += item.bytes;
+            ready.insert(std::make_pair(index, item));
+            available.notify_all();
+        }
+    }
+
+    void load(int index, Item &item) const
+    {
+        TraceSpan span("imageloader", "load", index, index + 1);
+        NativeErrorScope errors;
+        item.status = IMAGE_BATCH_ERROR;
+        item.bytes = 0;
+        try
+        {
+            cv::Mat image = cv::imread(files[index], options.flags);
+            if (image.empty())
+            {
+                item.status = IMAGE_BATCH_FAILED;
+                return;
+            }
+            const cv::Size size = cpp(options.size);
+            if (size.width > 0 && size.height > 0 && size != image.size())
+            {
+                cv::Mat resized;
+                cv::resize(image, resized, size, 0, 0, options.interpolation);
+                image = resized;
+            }
+            if (options.colorConversion >= 0)
+            {
+                cv::Mat converted;
+                cv::cvtColor(image, converted, options.colorConversion);
+                image = converted;
+            }
+            item.image = image;
+            item.bytes = image.total() * image.elemSize();
+            item.status = IMAGE_BATCH_OK;
+        }
+        catch (...)
+        {
+            item.image.release();
+        }
+    }
+};
+
+CVAPI(ImageLoader*) imgcodecs_ImageLoader_new(const char **files, int count, ImageLoaderOptions options)
+{
+    CV_Assert(count >= 0 && (files != NULL || count == 0));
+    return new ImageLoader(std::vector<std::string>(files, files + count), options);
+}
+
+CVAPI(ImageLoader*) imgcodecs_ImageLoader_newGlob(const char *pattern, int recursive, ImageLoaderOptions options)
+{
+    std::vector<cv::String> files;
+    cv::glob(pattern, files, recursive != 0);
+    return new ImageLoader(std::vector<std::string>(files.begin(), files.end()), options);
+}
+
+CVAPI(void) imgcodecs_ImageLoader_delete(ImageLoader *obj)
+{
+    delete obj;
+}
+
+CVAPI(void) imgcodecs_ImageLoader_fileNames(ImageLoader *obj, std::vector<std::string> *result)
+{
+    *result = obj->fileNames();
+}
+
+CVAPI(int) imgcodecs_ImageLoader_pop(ImageLoader *obj, int timeoutMs, cv::Mat *dst, int *index, int *status)
+{
+    return obj->pop(timeoutMs, *dst, *index, *status);
+}
+
+CVAPI(void) imgcodecs_ImageLoader_queued(ImageLoader *obj, int *count, int64 *bytes)
+{
+    obj->queued(*count, *bytes);
+}
+
+#endif
@@ -0,0 +1,391 @@
+#ifndef _CPP_IMGCODECS_MULTIPAGE_H_
+#define _CPP_IMGCODECS_MULTIPAGE_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include <fstream>
+#include <set>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Page-at-a-time access to multi-page TIFF files, which cv::imreadmulti / cv::imwrite only handle as a whole.
+//
+// OpenCV decodes the first image directory (IFD) of a TIFF. The reader maps the file copy-on-write, walks the
+// IFD chain once, and decodes page i by pointing the first-IFD offset of its private copy of the header at
+// IFD i; only the pages of the file that page i uses are read. The writer encodes every page as a single-page
+// TIFF with cv::imencode, relocates the offsets in it and appends it to the file, linked from the previous page.
+
+// Byte order of a TIFF file. Only classic TIFF (32-bit offsets) is handled: the TIFF decoder of OpenCV does
+// not accept BigTIFF.
+struct TiffLayout
+{
+    bool bigEndian;
+    bool bigTiff;   // recognized so that it can be rejected
+
+    static bool parse(const uchar *buf, size_t length, TiffLayout &layout)
+    {
+        if (length < 8)
+            return false;
+        if (buf[0] == 'I' && buf[1] == 'I')
+            layout.bigEndian = false;
+        else if (buf[0] == 'M' && buf[1] == 'M')
+            layout.bigEndian = true;
+        else
+            return false;
+        const uint64 version = layout.read(buf + 2, 2);
+        layout.bigTiff = (version == 43);
+        return version == 42 || version == 43;
+    }
+
+    uint64 read(const uchar *p, int bytes) const
+    {
+        uint64 value = 0;
+        for (int i = 0; i < bytes; i++)
+            value |= static_cast<uint64>(p[bigEndian ? i : bytes - 1 - i]) << (8 * (bytes - 1 - i));
+        return value;
+    }
+
+    void write(uchar *p, uint64 value, int bytes) const
+    {
+        for (int i = 0; i < bytes; i++)
+            p[bigEndian ? bytes - 1 - i : i] = static_cast<uchar>(value >> (8 * i));
+    }
+
+    // Size of one value of a TIFF field type, 0 if unknown
+    static int typeSize(uint64 type)
+    {
+        switch (type)
+        {
+        case 1: case 2: case 6: case 7: return 1;   // BYTE, ASCII, SBYTE, UNDEFINED
+        case 3: case 8: return 2;                   // SHORT, SSHORT
+        case 4: case 9: case 11: case 13: return 4; // LONG, SLONG, FLOAT, IFD
+        case 5: case 10: case 12: return 8;         // RATIONAL, SRATIONAL, DOUBLE
+        default: return 0;
+        }
+    }
+};
+
+class ImagePageReader
+{
+public:
+    explicit ImagePageReader(const char *path)
+        : base(NULL), length(0)
+    {
+        map(path);
+        TiffLayout layout;
+        if (TiffLayout::parse(base, length, layout))
+        {
+            if (layout.bigTiff)
+            {
+                // the destructor does not run when the constructor throws
+                unmap();
+                CV_Error(cv::Error::StsNotImplemented, std::string("BigTIFF is not supported: ") + path);
+            }
+            this->layout = layout;
+            walk();
+        }
+    }
+
+    ~ImagePageReader()
+    {
+        unmap();
+    }
+
+    // Files which are not TIFF have a single page
+    int pageCount() const
+    {
+        return pages.empty() ? 1 : static_cast<int>(pages.size());
+    }
+
+    // Decodes one page into dst, which is reused when it already has the size and type of the page.
+    // Returns false (and releases dst) if the page cannot be decoded.
+    bool read(int index, int flags, cv::Mat &dst)
+    {
+        if (index < 0 || index >= pageCount())
+            CV_Error(cv::Error::StsOutOfRange, "page index out of range");
+        if (!pages.empty())
+            layout.write(base + 4, pages[index], 4);
+        const cv::Mat buf(1, static_cast<int>(length), CV_8UC1, base);
+        cv::imdecode(buf, flags, &dst);
+        return !dst.empty();
+    }
+
+private:
+    uchar *base;
+    size_t length;
+    TiffLayout layout;
+    std::vector<uint64> pages;  // IFD offsets
+
+    ImagePageReader(const ImagePageReader &);
+    ImagePageReader &operator=(const ImagePageReader &);
+
+    // Collects the IFD offsets; a damaged chain ends at the last valid directory
+    void walk()
+    {
+        std::set<uint64> seen;
+        uint64 offset = layout.read(base + 4, 4);
+        while (offset != 0 && offset + 2 <= length && seen.insert(offset).second)
+        {
+            const uint64 next = offset + 2 + layout.read(base + offset, 2) * 12;
+            if (next + 4 > length)
+                break;
+            pages.push_back(offset);
+            offset = layout.read(base + next, 4);
+        }
+    }
+
+    void unmap()
+    {
+        if (base == NULL)
+            return;
+#ifdef _WIN32
+        UnmapViewOfFile(base);
+#else
+        munmap(base, length);
+#endif
+        base = NULL;
+    }
+
+    void map(const char *path)
+    {
+        CV_Assert(path != NULL);
+        std::string error;
+#ifdef _WIN32
+        const HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        LARGE_INTEGER size;
+        if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &size))
+        {
+            error = "cannot open ";
+        }
+        else if (size.QuadPart <= 0 || size.QuadPart > INT_MAX)
+        {
+            error = "empty or too large (2 GB or more): ";
+        }
+        else
+        {
+            length = static_cast<size_t>(size.QuadPart);
+            // the view keeps its own references to the mapping and the file
+            const HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+            if (mapping != NULL)
+            {
+                base = static_cast<uchar*>(MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0));
+                CloseHandle(mapping);
+            }
+            if (base == NULL)
+                error = "cannot map ";
+        }
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+#else
+        const int fd = ::open(path, O_RDONLY);
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st) != 0)
+        {
+            error = "cannot open ";
+        }
+        else if (st.st_size <= 0 || st.st_size > INT_MAX)
+        {
+            error = "empty or too large (2 GB or more): ";
+        }
+        else
+        {
+            length = static_cast<size_t>(st.st_size);
+            void *p = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)
+                error = "cannot map ";
+            else
+                base = static_cast<uchar*>(p);
+        }
+        if (fd >= 0)
+            ::close(fd);
+#endif
+        if (!error.empty())
+            CV_Error(cv::Error::StsError, error + path);
+    }
+};
+
+class ImagePageWriter
+{
+public:
+    ImagePageWriter(const char *path, const int *params, int paramsLength)
+        : file(path, std::ios::binary | std::ios::out | std::ios::trunc), position(0), link(4), pages(0)
+    {
+        CV_Assert(path != NULL);
+        if (!file)
+            CV_Error(cv::Error::StsError, std::string("cannot create ") + path);
+        if (params != NULL)
+            this->params.assign(params, params + paramsLength);
+    }
+
+    int pageCount() const
+    {
+        return pages;
+    }
+
+    // Appends a page; only one encoded page is held in memory at a time
+    void write(const cv::Mat &page)
+    {
+        CV_Assert(file.is_open());
+        buffer.clear();
+        if (!cv::imencode(".tiff", page, buffer, params))
+            CV_Error(cv::Error::StsError, "cannot encode the page as TIFF");
+        TiffLayout l;
+        if (!TiffLayout::parse(&buffer[0], buffer.size(), l) || l.bigTiff)
+            CV_Error(cv::Error::StsNotImplemented, "unexpected TIFF layout from the encoder");
+        if (pages > 0 && l.bigEndian != layout.bigEndian)
+            CV_Error(cv::Error::StsNotImplemented, "pages with different byte orders");
+
+        // the page (without its header) is stored at start, after the header of the file if this is the first
+        // page; directories start on a word boundary. Nothing is written until the page has been validated,
+        // so a page which fails leaves the file as it was.
+        const uint64 end = pages == 0 ? 8 : position;
+        const uint64 start = end + end % 2;
+        const uint64 delta = start - 8;
+        if (start + buffer.size() - 8 > UINT_MAX)
+            CV_Error(cv::Error::StsOutOfRange, "the file would exceed the 4 GB limit of TIFF");
+        uint64 ifd, next;
+        relocate(l, delta, ifd, next);
+
+        if (pages == 0)
+        {
+            layout = l;
+            // the header; its first-IFD offset is set below
+            file.write(reinterpret_cast<const char*>(&buffer[0]), 8);
+        }
+        if (start != end)
+            file.put(0);
+        file.write(reinterpret_cast<const char*>(&buffer[8]), static_cast<std::streamsize>(buffer.size() - 8));
+        position = start + buffer.size() - 8;
+
+        // links the header or the previous page to this one
+        uchar offset[4];
+        layout.write(offset, ifd + delta, 4);
+        file.seekp(static_cast<std::streamoff>(link));
+        file.write(reinterpret_cast<const char*>(offset), 4);
+        file.seekp(0, std::ios::end);
+        link = next + delta;
+        pages++;
+
+        if (!file)
+            CV_Error(cv::Error::StsError, "cannot write the page");
+    }
+
+    void close()
+    {
+        if (!file.is_open())
+            return;
+        file.close();
+        if (file.fail())
+            CV_Error(cv::Error::StsError, "cannot close the file");
+    }
+
+private:
+    std::ofstream file;
+    std::vector<int> params;
+    std::vector<uchar> buffer;
+    TiffLayout layout;
+    uint64 position;    // end of the file
+    uint64 link;        // position of the offset of the next IFD, 0 in the file
+    int pages;
+
+    ImagePageWriter(const ImagePageWriter &);
+    ImagePageWriter &operator=(const ImagePageWriter &);
+
+    // Adds delta to the offsets in the single-page TIFF in buffer: those of the values stored outside
+    // the IFD entries, and the strip / tile offsets. ifd, next: positions of the IFD and of its next-IFD offset.
+    void relocate(const TiffLayout &l, uint64 delta, uint64 &ifd, uint64 &next)
+    {
+        uchar *b = &buffer[0];
+        const uint64 size = buffer.size();
+        ifd = l.read(b + 4, 4);
+        if (ifd < 8 || ifd + 2 > size)
+            CV_Error(cv::Error::StsParseError, "invalid TIFF directory offset");
+        const uint64 entries = l.read(b + ifd, 2);
+        next = ifd + 2 + entries * 12;
+        if (next + 4 > size)
+            CV_Error(cv::Error::StsParseError, "truncated TIFF directory");
+
+        for (uint64 e = ifd + 2; e < next; e += 12)
+        {
+            const uint64 tag = l.read(b + e, 2);
+            const int typeSize = TiffLayout::typeSize(l.read(b + e + 2, 2));
+            const uint64 count = l.read(b + e + 4, 4);
+            // SubIFDs, EXIF, GPS and interoperability directories would need relocating as well
+            if (typeSize == 0 || tag == 330 || tag == 34665 || tag == 34853 || tag == 40965)
+                CV_Error(cv::Error::StsNotImplemented, "unsupported TIFF field");
+
+            uint64 values = e + 8;
+            if (count * typeSize > 4)
+            {
+                values = l.read(b + e + 8, 4);
+                if (values + count * typeSize > size)
+                    CV_Error(cv::Error::StsParseError, "invalid TIFF field offset");
+                l.write(b + e + 8, values + delta, 4);
+            }
+            // StripOffsets, TileOffsets
+            if (tag == 273 || tag == 324)
+            {
+                for (uint64 i = 0; i < count; i++)
+                {
+                    const uint64 value = l.read(b + values + i * typeSize, typeSize) + delta;
+                    if (value >> (8 * typeSize) != 0)
+                        CV_Error(cv::Error::StsNotImplemented, "strip offsets stored as SHORT");
+                    l.write(b + values + i * typeSize, value, typeSize);
+                }
+            }
+        }
+    }
+};
+
+CVAPI(ImagePageReader*) imgcodecs_ImagePageReader_new(const char *filename)
+{
+    return new ImagePageReader(filename);
+}
+
+CVAPI(void) imgcodecs_ImagePageReader_delete(ImagePageReader *obj)
+{
+    delete obj;
+}
+
+CVAPI(int) imgcodecs_ImagePageReader_pageCount(ImagePageReader *obj)
+{
+    return obj->pageCount();
+}
+
+CVAPI(int) imgcodecs_ImagePageReader_read(ImagePageReader *obj, int index, int flags, cv::Mat *dst)
+{
+    return obj->read(index, flags, *dst) ? 1 : 0;
+}
+
+CVAPI(ImagePageWriter*) imgcodecs_ImagePageWriter_new(const char *filename, int *params, int paramsLength)
+{
+    return new ImagePageWriter(filename, params, paramsLength);
+}
+
+CVAPI(void) imgcodecs_ImagePageWriter_delete(ImagePageWriter *obj)
+{
+    delete obj;
+}
+
+CVAPI(int) imgcodecs_ImagePageWriter_pageCount(ImagePageWriter *obj)
+{
+    return obj->pageCount();
+}
+
+CVAPI(void) imgcodecs_ImagePageWriter_write(ImagePageWriter *obj, cv::Mat *page)
+{
+    obj->write(*page);
+}
+
+CVAPI(void) imgcodecs_ImagePageWriter_close(ImagePageWriter *obj)
+{
+    obj->close();
+}
+
+#endif
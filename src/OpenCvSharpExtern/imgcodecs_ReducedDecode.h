@@ -0,0 +1,263 @@
+#ifndef _CPP_IMGCODECS_REDUCEDDECODE_H_
+#define _CPP_IMGCODECS_REDUCEDDECODE_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include "imgcodecs_Batch.h"
+#include <fstream>
+
+// Decoding for thumbnails and crops. A JPEG is scaled by 1/2, 1/4 or 1/8 while it is decoded (IMREAD_REDUCED_*,
+// DCT-domain scaling in libjpeg), by the largest factor which keeps the result at least as large as the
+// requested size; the remainder is done by a final INTER_AREA resize. The factor is chosen from the frame
+// header, which is parsed before decoding. Other formats are decoded at full resolution and resized.
+//
+// A region of interest is cut out of the (reduced) decoded image: OpenCV cannot skip the rest of the image
+// while decoding, but the reduction still applies to the region's target size and only the region is kept.
+
+struct ImageDecodeStats
+{
+    int reduction;          // 1, 2, 4 or 8: the factor the codec scaled by while decoding
+    int reserved;
+    MyCvSize fullSize;      // size of the encoded image (before EXIF orientation for JPEG)
+    MyCvSize decodedSize;   // size produced by the codec
+    double decodeMs;
+    double resizeMs;        // crop and final resize
+    double baselineMs;      // full-resolution decode, crop and resize when measured, -1 otherwise
+};
+
+class ReducedDecoder
+{
+public:
+    // Frame size from the SOFn segment of a JPEG; false if buf is not a JPEG or has no frame header
+    static bool jpegSize(const uchar *buf, size_t length, cv::Size &size)
+    {
+        if (length < 4 || buf[0] != 0xFF || buf[1] != 0xD8)
+            return false;
+        size_t i = 2;
+        while (i + 4 <= length)
+        {
+            if (buf[i] != 0xFF)
+                return false;
+            const int marker = buf[i + 1];
+            if (marker == 0xFF)
+            {
+                // fill byte
+                i++;
+                continue;
+            }
+            if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8))
+            {
+                // markers without a segment
+                i += 2;
+                continue;
+            }
+            if (marker == 0xD9 || marker == 0xDA)
+                return false;
+            const size_t segmentLength = (buf[i + 2] << 8) | buf[i + 3];
+            if (segmentLength < 2)
+                return false;
+            // SOF0..SOF15 except DHT (C4), JPG (C8) and DAC (CC)
+            if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+            {
+                if (i + 9 > length)
+                    return false;
+                size.height = (buf[i + 5] << 8) | buf[i + 6];
+                size.width = (buf[i + 7] << 8) | buf[i + 8];
+                return size.width > 0 && size.height > 0;
+            }
+            i += 2 + segmentLength;
+        }
+        return false;
+    }
+
+    // maxSize: the result fits into it, keeping the aspect ratio (a zero component leaves that side free;
+    // the image is never enlarged). roi: in the coordinates of the full-resolution image after EXIF
+    // orientation, empty for the whole image. Returns false if the image could not be decoded.
+    static bool decode(const cv::Mat &buf, int flags, cv::Size maxSize, cv::Rect roi, bool measureBaseline,
+        cv::Mat &dst, ImageDecodeStats &stats)
+    {
+        CV_Assert(maxSize.width >= 0 && maxSize.height >= 0);
+        const ImageDecodeStats init = { 1, 0, { 0, 0 }, { 0, 0 }, 0, 0, -1 };
+        stats = init;
+        const bool hasRoi = roi.width > 0 && roi.height > 0;
+
+        cv::Size full;
+        const bool isJpeg = jpegSize(buf.data, buf.total() * buf.elemSize(), full);
+        const int mode = flags & ~cv::IMREAD_IGNORE_ORIENTATION;
+        int reduction = 1;
+        if (isJpeg && (mode == cv::IMREAD_GRAYSCALE || mode == cv::IMREAD_COLOR))
+        {
+            // the orientation is not known before decoding, so both are allowed for
+            const double scale = hasRoi ? fitScale(roi.size(), maxSize)
+                : std::max(fitScale(full, maxSize), fitScale(cv::Size(full.height, full.width), maxSize));
+            while (reduction < 8 && 1. / (reduction * 2) >= scale)
+                reduction *= 2;
+        }
+        stats.reduction = reduction;
+
+        int64 start = cv::getTickCount();
+        const cv::Mat decoded = cv::imdecode(buf, flags | reducedFlag(reduction));
+        stats.decodeMs = elapsedMs(start);
+        if (decoded.empty())
+        {
+            dst.release();
+            return false;
+        }
+        stats.decodedSize = c(decoded.size());
+        stats.fullSize = c(isJpeg ? full : decoded.size());
+
+        // the full-resolution size after orientation
+        cv::Size oriented = decoded.size();
+        if (reduction > 1)
+            oriented = ((decoded.cols >= decoded.rows) == (full.width >= full.height)) ? full : cv::Size(full.height, full.width);
+
+        start = cv::getTickCount();
+        finish(decoded, reduction, oriented, maxSize, roi, hasRoi, dst);
+        stats.resizeMs = elapsedMs(start);
+
+        if (measureBaseline)
+        {
+            cv::Mat baseline;
+            start = cv::getTickCount();
+            finish(cv::imdecode(buf, flags), 1, oriented, maxSize, roi, hasRoi, baseline);
+            stats.baselineMs = elapsedMs(start);
+        }
+        return true;
+    }
+
+    static bool readFile(const char *filename, std::vector<uchar> &buf)
+    {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file)
+            return false;
+        file.seekg(0, std::ios::end);
+        const std::streamoff length = file.tellg();
+        if (length <= 0 || length > INT_MAX)
+            return false;
+        file.seekg(0, std::ios::beg);
+        buf.resize(static_cast<size_t>(length));
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&buf[0]), length));
+    }
+
+private:
+    static int reducedFlag(int reduction)
+    {
+        switch (reduction)
+        {
+        case 2: return cv::IMREAD_REDUCED_GRAYSCALE_2;
+        case 4: return cv::IMREAD_REDUCED_GRAYSCALE_4;
+        case 8: return cv::IMREAD_REDUCED_GRAYSCALE_8;
+        default: return 0;
+        }
+    }
+
+    // Largest scale at which size fits into maxSize
+    static double fitScale(cv::Size size, cv::Size maxSize)
+    {
+        double scale = DBL_MAX;
+        if (maxSize.width > 0)
+            scale = std::min(scale, static_cast<double>(maxSize.width) / size.width);
+        if (maxSize.height > 0)
+            scale = std::min(scale, static_cast<double>(maxSize.height) / size.height);
+        return scale;
+    }
+
+    static double elapsedMs(int64 start)
+    {
+        return (cv::getTickCount() - start) * 1000. / cv::getTickFrequency();
+    }
+
+    // Crops roi (full-resolution coordinates) out of an image decoded with the reduction factor and
+    // resizes it to its fitted size
+    static void finish(const cv::Mat &decoded, int reduction, cv::Size oriented, cv::Size maxSize,
+        cv::Rect roi, bool hasRoi, cv::Mat &dst)
+    {
+        cv::Mat region = decoded;
+        cv::Size regionSize = oriented;
+        if (hasRoi)
+        {
+            roi &= cv::Rect(cv::Point(), oriented);
+            if (roi.empty())
+                CV_Error(cv::Error::StsOutOfRange, "roi is outside of the image");
+            regionSize = roi.size();
+            const int x1 = roi.x / reduction, y1 = roi.y / reduction;
+            const int x2 = (roi.x + roi.width + reduction - 1) / reduction;
+            const int y2 = (roi.y + roi.height + reduction - 1) / reduction;
+            region = decoded(cv::Rect(x1, y1, x2 - x1, y2 - y1) & cv::Rect(cv::Point(), decoded.size()));
+        }
+
+        const double scale = std::min(1., fitScale(regionSize, maxSize));
+        const cv::Size target(
+            std::max(1, cvRound(regionSize.width * scale)), std::max(1, cvRound(regionSize.height * scale)));
+        if (target != region.size())
+            cv::resize(region, dst, target, 0, 0, cv::INTER_AREA);
+        else if (hasRoi)
+            region.copyTo(dst);
+        else
+            dst = region;
+    }
+};
+
+CVAPI(int) imgcodecs_imread_reduced(const char *filename, int flags, MyCvSize maxSize, MyCvRect roi,
+    int measureBaseline, cv::Mat *dst, ImageDecodeStats *stats)
+{
+    std::vector<uchar> buf;
+    ImageDecodeStats s;
+    if (!ReducedDecoder::readFile(filename, buf))
+    {
+        dst->release();
+        return 0;
+    }
+    const bool ok = ReducedDecoder::decode(
+        cv::Mat(1, static_cast<int>(buf.size()), CV_8UC1, &buf[0]), flags, cpp(maxSize), cpp(roi), measureBaseline != 0, *dst, s);
+    if (stats != NULL)
+        *stats = s;
+    return ok ? 1 : 0;
+}
+
+CVAPI(int) imgcodecs_imdecode_reduced(uchar *buf, int64 bufLength, int flags, MyCvSize maxSize, MyCvRect roi,
+    int measureBaseline, cv::Mat *dst, ImageDecodeStats *stats)
+{
+    CV_Assert(buf != NULL && bufLength > 0 && bufLength <= INT_MAX);
+    ImageDecodeStats s;
+    const bool ok = ReducedDecoder::decode(
+        cv::Mat(1, static_cast<int>(bufLength), CV_8UC1, buf), flags, cpp(maxSize), cpp(roi), measureBaseline != 0, *dst, s);
+    if (stats != NULL)
+        *stats = s;
+    return ok ? 1 : 0;
+}
+
+
+// imgcodecs_imdecode_batch with reduced decoding; rois and stats may be NULL
+CVAPI(void) imgcodecs_imdecode_batch_reduced(uchar **bufs, int64 *bufLengths, int count, int flags, MyCvSize maxSize,
+    MyCvRect *rois, cv::Mat **dst, int maxConcurrency, ImageBatchResult *results, ImageDecodeStats *stats)
+{
+    ImageBatch::run("imdecode_batch_reduced", count, maxConcurrency, [=](int i)
+    {
+        cv::Mat &out = *dst[i];
+        if (bufs[i] == NULL || bufLengths[i] <= 0 || bufLengths[i] > INT_MAX)
+        {
+            out.release();
+            return IMAGE_BATCH_FAILED;
+        }
+        const MyCvRect noRoi = { 0, 0, 0, 0 };
+        ImageDecodeStats s;
+        bool ok;
+        try
+        {
+            ok = ReducedDecoder::decode(cv::Mat(1, static_cast<int>(bufLengths[i]), CV_8UC1, bufs[i]), flags,
+                cpp(maxSize), cpp(rois != NULL ? rois[i] : noRoi), false, out, s);
+        }
+        catch (...)
+        {
+            out.release();
+            throw;
+        }
+        if (stats != NULL)
+            stats[i] = s;
+        return ok ? IMAGE_BATCH_OK : IMAGE_BATCH_FAILED;
+    }, results);
+}
+
+#endif
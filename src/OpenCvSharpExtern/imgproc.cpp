@@ -3,4 +3,5 @@
 #include "imgproc_Subdiv2D.h"
 #include "imgproc_CLAHE.h"
 #include "imgproc_LineIterator.h"
-#include "imgproc_GeneralizedHough.h"
\ No newline at end of file
+#include "imgproc_GeneralizedHough.h"
+#include "imgproc_TiledFilter.h"
\ No newline at end of file
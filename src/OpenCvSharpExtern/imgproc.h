@@ -8,7 +8,7 @@
 CVAPI(cv::Mat*) imgproc_getGaussianKernel(int ksize, double sigma, int ktype)
 {
     cv::Mat ret = cv::getGaussianKernel(ksize, sigma, ktype);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(void) imgproc_getDerivKernels(cv::_OutputArray *kx, cv::_OutputArray *ky,
@@ -21,23 +21,29 @@ CVAPI(cv::Mat*) imgproc_getGaborKernel(MyCvSize ksize, double sigma, double thet
     double lambd, double gamma, double psi, int ktype)
 {
     cv::Mat ret = cv::getGaborKernel(cpp(ksize), sigma, theta, lambd, gamma, psi, ktype);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(cv::Mat*) imgproc_getStructuringElement(int shape, MyCvSize ksize, MyCvPoint anchor)
 {
     cv::Mat ret = cv::getStructuringElement(shape, cpp(ksize), cpp(anchor));
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(void) imgproc_medianBlur(cv::_InputArray *src, cv::_OutputArray *dst, int ksize)
 {
+    RecordedCall rec("imgproc_medianBlur");
+    if (rec)
+        rec.array(src).i32(ksize);
     cv::medianBlur(*src, *dst, ksize);
 }
 
 CVAPI(void) imgproc_GaussianBlur(cv::_InputArray *src, cv::_OutputArray *dst, 
     CvSize ksize, double sigmaX, double sigmaY, int borderType)
 {
+    RecordedCall rec("imgproc_GaussianBlur");
+    if (rec)
+        rec.array(src).i32(ksize.width).i32(ksize.height).f64(sigmaX).f64(sigmaY).i32(borderType);
     cv::GaussianBlur(*src, *dst, ksize, sigmaX, sigmaY, borderType);
 }
 
@@ -99,6 +105,9 @@ CVAPI(void) imgproc_Laplacian(cv::_InputArray *src, cv::_OutputArray *dst, int d
 CVAPI(void) imgproc_Canny(cv::_InputArray *src, cv::_OutputArray *edges,
     double threshold1, double threshold2, int apertureSize, int L2gradient)
 {
+    RecordedCall rec("imgproc_Canny");
+    if (rec)
+        rec.array(src).f64(threshold1).f64(threshold2).i32(apertureSize).i32(L2gradient);
     cv::Canny(*src, *edges, threshold1, threshold2, apertureSize, L2gradient != 0);
 }
 
@@ -178,12 +187,22 @@ CVAPI(void) imgproc_morphologyEx(cv::_InputArray *src, cv::_OutputArray *dst, in
 
 CVAPI(void) imgproc_resize(cv::_InputArray* src, cv::_OutputArray* dst, CvSize dsize, double fx, double fy, int interpolation)
 {
+    RecordedCall rec("imgproc_resize");
+    if (rec)
+        rec.array(src).i32(dsize.width).i32(dsize.height).f64(fx).f64(fy).i32(interpolation);
     cv::resize(*src, *dst, dsize, fx, fy, interpolation);
 }
 
 CVAPI(void) imgproc_warpAffine(cv::_InputArray* src, cv::_OutputArray* dst, cv::_InputArray* M, CvSize dsize, 
     int flags, int borderMode, CvScalar borderValue)
 {
+    RecordedCall rec("imgproc_warpAffine");
+    if (rec)
+    {
+        rec.array(src).array(M).i32(dsize.width).i32(dsize.height).i32(flags).i32(borderMode);
+        for (int i = 0; i < 4; i++)
+            rec.f64(borderValue.val[i]);
+    }
     cv::warpAffine(*src, *dst, *M, dsize, flags, borderMode, borderValue);
 }
 
@@ -215,7 +234,7 @@ CVAPI(void) imgproc_convertMaps(cv::_InputArray* map1, cv::_InputArray* map2, cv
 CVAPI(cv::Mat*) imgproc_getRotationMatrix2D(MyCvPoint2D32f center, double angle, double scale)
 {
     cv::Mat ret = cv::getRotationMatrix2D(cpp(center), angle, scale);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 
 }
 CVAPI(void) imgproc_invertAffineTransform(cv::_InputArray* M, cv::_OutputArray *iM)
@@ -226,23 +245,23 @@ CVAPI(void) imgproc_invertAffineTransform(cv::_InputArray* M, cv::_OutputArray *
 CVAPI(cv::Mat*) imgproc_getPerspectiveTransform1(cv::Point2f *src, cv::Point2f *dst)
 {
     cv::Mat ret = cv::getPerspectiveTransform(src, dst);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 CVAPI(cv::Mat*) imgproc_getPerspectiveTransform2(cv::_InputArray *src, cv::_InputArray *dst)
 {
     cv::Mat ret = cv::getPerspectiveTransform(*src, *dst);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(cv::Mat*) imgproc_getAffineTransform1(cv::Point2f *src, cv::Point2f *dst)
 {
     cv::Mat ret = cv::getAffineTransform(src, dst);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 CVAPI(cv::Mat*) imgproc_getAffineTransform2(cv::_InputArray *src, cv::_InputArray *dst)
 {
     cv::Mat ret = cv::getAffineTransform(*src, *dst);
-    return new cv::Mat(ret);
+    return trackHandle(new cv::Mat(ret));
 }
 
 CVAPI(void) imgproc_getRectSubPix(cv::_InputArray *image, CvSize patchSize, MyCvPoint2D32f center, cv::_OutputArray *patch, int patchType)
@@ -317,6 +336,9 @@ CVAPI(void) imgproc_createHanningWindow(cv::_OutputArray *dst, CvSize winSize, i
 CVAPI(double) imgproc_threshold(cv::_InputArray *src, cv::_OutputArray *dst,
     double thresh, double maxval, int type)
 {
+    RecordedCall rec("imgproc_threshold");
+    if (rec)
+        rec.array(src).f64(thresh).f64(maxval).i32(type);
     return cv::threshold(*src, *dst, thresh, maxval, type);
 }
 CVAPI(void) imgproc_adaptiveThreshold(cv::_InputArray *src, cv::_OutputArray *dst,
@@ -421,6 +443,9 @@ CVAPI(int) imgproc_floodFill2(cv::_InputOutputArray *image, cv::_InputOutputArra
 
 CVAPI(void) imgproc_cvtColor(cv::_InputArray *src, cv::_OutputArray *dst, int code, int dstCn)
 {
+    RecordedCall rec("imgproc_cvtColor");
+    if (rec)
+        rec.array(src).i32(code).i32(dstCn);
     cv::cvtColor(*src, *dst, code, dstCn); 
 }
 
@@ -452,26 +477,26 @@ CVAPI(int) imgproc_connectedComponentsWithStats(cv::_InputArray *image, cv::_Out
 CVAPI(void) imgproc_findContours1_vector(cv::_InputOutputArray *image, std::vector<std::vector<cv::Point> > **contours,
     std::vector<cv::Vec4i> **hierarchy, int mode, int method, MyCvPoint offset)
 {
-    *contours = new std::vector<std::vector<cv::Point> >;
-    *hierarchy = new std::vector<cv::Vec4i>;
+    *contours = trackHandle(new std::vector<std::vector<cv::Point> >);
+    *hierarchy = trackHandle(new std::vector<cv::Vec4i>);
     cv::findContours(*image, **contours, **hierarchy, mode, method, cpp(offset));
 }
 CVAPI(void) imgproc_findContours1_OutputArray(cv::_InputOutputArray *image, std::vector<cv::Mat> **contours,
     cv::_OutputArray *hierarchy, int mode, int method, CvPoint offset)
 {
-    *contours = new std::vector<cv::Mat>;
+    *contours = trackHandle(new std::vector<cv::Mat>);
     cv::findContours(*image, **contours, *hierarchy, mode, method, offset);
 }
 CVAPI(void) imgproc_findContours2_vector(cv::_InputOutputArray *image, std::vector<std::vector<cv::Point> > **contours,
     int mode, int method, CvPoint offset)
 {
-    *contours = new std::vector<std::vector<cv::Point> >;
+    *contours = trackHandle(new std::vector<std::vector<cv::Point> >);
     cv::findContours(*image, **contours, mode, method, offset);
 }
 CVAPI(void) imgproc_findContours2_OutputArray(cv::_InputOutputArray *image, std::vector<cv::Mat> **contours,
     int mode, int method, CvPoint offset)
 {
-    *contours = new std::vector<cv::Mat>;
+    *contours = trackHandle(new std::vector<cv::Mat>);
     cv::findContours(*image, **contours, mode, method, offset);
 }
 
@@ -482,13 +507,13 @@ CVAPI(void) imgproc_approxPolyDP_InputArray(cv::_InputArray *curve, cv::_OutputA
 CVAPI(void) imgproc_approxPolyDP_Point(cv::Point *curve, int curveLength, std::vector<cv::Point> **approxCurve, double epsilon, int closed)
 {
     cv::Mat_<cv::Point> curveMat(curveLength, 1, curve);
-    *approxCurve = new std::vector<cv::Point>;
+    *approxCurve = trackHandle(new std::vector<cv::Point>);
     cv::approxPolyDP(curveMat, **approxCurve, epsilon, closed != 0);
 }
 CVAPI(void) imgproc_approxPolyDP_Point2f(cv::Point2f *curve, int curveLength, std::vector<cv::Point2f> **approxCurve, double epsilon, int closed)
 {
     cv::Mat_<cv::Point2f> curveMat(curveLength, 1, curve);
-    *approxCurve = new std::vector<cv::Point2f>;
+    *approxCurve = trackHandle(new std::vector<cv::Point2f>);
     cv::approxPolyDP(curveMat, **approxCurve, epsilon, closed != 0);
 }
 
@@ -598,25 +623,25 @@ CVAPI(void) imgproc_convexHull_InputArray(cv::_InputArray *points, cv::_OutputAr
 CVAPI(void) imgproc_convexHull_Point_ReturnsPoints(cv::Point *points, int pointsLength, std::vector<cv::Point> **hull, int clockwise)
 {
     cv::Mat_<cv::Point> pointsMat(pointsLength, 1, points);
-    *hull = new std::vector<cv::Point>;
+    *hull = trackHandle(new std::vector<cv::Point>);
     cv::convexHull(pointsMat, **hull, clockwise != 0, true);
 }
 CVAPI(void) imgproc_convexHull_Point2f_ReturnsPoints(cv::Point2f *points, int pointsLength, std::vector<cv::Point2f> **hull, int clockwise)
 {
     cv::Mat_<cv::Point2f> pointsMat(pointsLength, 1, points);
-    *hull = new std::vector<cv::Point2f>;
+    *hull = trackHandle(new std::vector<cv::Point2f>);
     cv::convexHull(pointsMat, **hull, clockwise != 0, true);
 }
 CVAPI(void) imgproc_convexHull_Point_ReturnsIndices(cv::Point *points, int pointsLength, std::vector<int> **hull, int clockwise)
 {
     cv::Mat_<cv::Point> pointsMat(pointsLength, 1, points);
-    *hull = new std::vector<int>;
+    *hull = trackHandle(new std::vector<int>);
     cv::convexHull(pointsMat, **hull, clockwise != 0, false);
 }
 CVAPI(void) imgproc_convexHull_Point2f_ReturnsIndices(cv::Point2f *points, int pointsLength, std::vector<int> **hull, int clockwise)
 {
     cv::Mat_<cv::Point2f> pointsMat(pointsLength, 1, points);
-    *hull = new std::vector<int>;
+    *hull = trackHandle(new std::vector<int>);
     cv::convexHull(pointsMat, **hull, clockwise != 0, false);
 }
 
@@ -630,7 +655,7 @@ CVAPI(void) imgproc_convexityDefects_Point(cv::Point *contour, int contourLength
 {
     cv::Mat_<cv::Point> contourMat(contourLength, 1, contour);
     cv::Mat_<int> convexHullMat(convexHullLength, 1,  convexHull);
-    *convexityDefects = new std::vector<cv::Vec4i>;
+    *convexityDefects = trackHandle(new std::vector<cv::Vec4i>);
     cv::convexityDefects(contourMat, convexHullMat, **convexityDefects);
 }
 CVAPI(void) imgproc_convexityDefects_Point2f(cv::Point2f *contour, int contourLength, int *convexHull, int convexHullLength,
@@ -638,7 +663,7 @@ CVAPI(void) imgproc_convexityDefects_Point2f(cv::Point2f *contour, int contourLe
 {
     cv::Mat_<cv::Point2f> contourMat(contourLength, 1, contour);
     cv::Mat_<int> convexHullMat(convexHullLength, 1, convexHull);
-    *convexityDefects = new std::vector<cv::Vec4i>;
+    *convexityDefects = trackHandle(new std::vector<cv::Vec4i>);
     cv::convexityDefects(contourMat, convexHullMat, **convexityDefects);
 }
 
@@ -667,7 +692,7 @@ CVAPI(float) imgproc_intersectConvexConvex_Point(cv::Point *p1, int p1Length, cv
 {
     cv::Mat_<cv::Point> p1Vec(p1Length, 1, p1);
     cv::Mat_<cv::Point> p2Vec(p2Length, 1, p2);
-    *p12 = new std::vector<cv::Point>;
+    *p12 = trackHandle(new std::vector<cv::Point>);
     return cv::intersectConvexConvex(p1Vec, p2Vec, **p12, handleNested != 0);
 }
 CVAPI(float) imgproc_intersectConvexConvex_Point2f(cv::Point2f *p1, int p1Length, cv::Point2f *p2, int p2Length,
@@ -675,7 +700,7 @@ CVAPI(float) imgproc_intersectConvexConvex_Point2f(cv::Point2f *p1, int p1Length
 {
     cv::Mat_<cv::Point2f> p1Vec(p1Length, 1, p1);
     cv::Mat_<cv::Point2f> p2Vec(p2Length, 1, p2);
-    *p12 = new std::vector<cv::Point2f>;
+    *p12 = trackHandle(new std::vector<cv::Point2f>);
     return cv::intersectConvexConvex(p1Vec, p2Vec, **p12, handleNested != 0);
 }
 
@@ -78,7 +78,7 @@ CVAPI(int) imgproc_GeneralizedHough_getMaxBufferSize(cv::GeneralizedHough *obj)
 CVAPI(cv::Ptr<cv::GeneralizedHoughBallard>*) imgproc_createGeneralizedHoughBallard()
 {
     cv::Ptr<cv::GeneralizedHoughBallard> ptr = cv::createGeneralizedHoughBallard();
-    return new cv::Ptr<cv::GeneralizedHoughBallard>(ptr);
+    return trackHandle(new cv::Ptr<cv::GeneralizedHoughBallard>(ptr));
 }
 CVAPI(cv::GeneralizedHoughBallard*) imgproc_Ptr_GeneralizedHoughBallard_get(
     cv::Ptr<cv::GeneralizedHoughBallard> *obj)
@@ -87,7 +87,7 @@ CVAPI(cv::GeneralizedHoughBallard*) imgproc_Ptr_GeneralizedHoughBallard_get(
 }
 CVAPI(void) imgproc_Ptr_GeneralizedHoughBallard_delete(cv::Ptr<cv::GeneralizedHoughBallard> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(void) imgproc_GeneralizedHoughBallard_setLevels(cv::GeneralizedHoughBallard *obj, int val)
@@ -114,7 +114,7 @@ CVAPI(int) imgproc_GeneralizedHoughBallard_getVotesThreshold(cv::GeneralizedHoug
 CVAPI(cv::Ptr<cv::GeneralizedHoughGuil>*) imgproc_createGeneralizedHoughGuil()
 {
     cv::Ptr<cv::GeneralizedHoughGuil> ptr = cv::createGeneralizedHoughGuil();
-    return new cv::Ptr<cv::GeneralizedHoughGuil>(ptr);
+    return trackHandle(new cv::Ptr<cv::GeneralizedHoughGuil>(ptr));
 }
 CVAPI(cv::GeneralizedHoughGuil*) imgproc_Ptr_GeneralizedHoughGuil_get(
     cv::Ptr<cv::GeneralizedHoughGuil> *obj)
@@ -123,7 +123,7 @@ CVAPI(cv::GeneralizedHoughGuil*) imgproc_Ptr_GeneralizedHoughGuil_get(
 }
 CVAPI(void) imgproc_Ptr_GeneralizedHoughGuil_delete(cv::Ptr<cv::GeneralizedHoughGuil> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 
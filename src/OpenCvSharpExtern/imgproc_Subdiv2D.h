@@ -46,12 +46,12 @@ CVAPI(int) imgproc_Subdiv2D_findNearest(cv::Subdiv2D *obj, CvPoint2D32f pt, CvPo
 }
 CVAPI(void) imgproc_Subdiv2D_getEdgeList(cv::Subdiv2D *obj, std::vector<cv::Vec4f> **edgeList)
 {
-    *edgeList = new std::vector<cv::Vec4f>();
+    *edgeList = trackHandle(new std::vector<cv::Vec4f>());
     obj->getEdgeList(**edgeList);
 }
 CVAPI(void) imgproc_Subdiv2D_getTriangleList(cv::Subdiv2D *obj, std::vector<cv::Vec6f> **triangleList)
 {
-    *triangleList = new std::vector<cv::Vec6f>();
+    *triangleList = trackHandle(new std::vector<cv::Vec6f>());
     obj->getTriangleList(**triangleList);
 }
 CVAPI(void) imgproc_Subdiv2D_getVoronoiFacetList(cv::Subdiv2D *obj, int *idx, int idxCount,
@@ -60,8 +60,8 @@ CVAPI(void) imgproc_Subdiv2D_getVoronoiFacetList(cv::Subdiv2D *obj, int *idx, in
     std::vector<int> idxVec;
     if (idx != NULL)
         idxVec = std::vector<int>(idx, idx + idxCount);
-    *facetList = new std::vector<std::vector<cv::Point2f> >();
-    *facetCenters = new std::vector<cv::Point2f>();
+    *facetList = trackHandle(new std::vector<std::vector<cv::Point2f> >());
+    *facetCenters = trackHandle(new std::vector<cv::Point2f>());
     obj->getVoronoiFacetList(idxVec, **facetList, **facetCenters);
 }
 
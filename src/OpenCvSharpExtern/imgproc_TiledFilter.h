@@ -0,0 +1,382 @@
+#ifndef _CPP_IMGPROC_TILEDFILTER_H_
+#define _CPP_IMGPROC_TILEDFILTER_H_
+
+// ReSharper disable CppNonInlineFunctionDefinitionInHeaderFile
+
+#include "include_opencv.h"
+#include <functional>
+
+// Runs a neighborhood filter over an arbitrarily large image tile by tile, so that the working
+// memory depends on the tile size and not on the image (the source may be a memory mapped Mat).
+//
+// A filter is a chain of steps (or the saturated difference of two chains, for the morphological
+// gradient / top hat / black hat). Every step is an OpenCV call made with BORDER_ISOLATED on the
+// step's target region enlarged by the step's halo and clipped to the image. Where the region was
+// clipped, OpenCV extrapolates across the real image edge just like the whole-image call; on the
+// other sides the pixels whose neighborhood was cut off are cropped away. Every output pixel is thus
+// computed from the same input pixels by the same code as in the whole-image call.
+class TiledFilter
+{
+public:
+    typedef std::function<void(const cv::Mat&, cv::Mat&)> StepFunc;
+
+    struct Step
+    {
+        StepFunc func;
+        int haloX, haloY;
+    };
+
+    TiledFilter()
+        : subtract(false), alignment(1)
+    {
+    }
+
+    // Appends a step that reads up to haloX / haloY pixels away from each output pixel
+    void add(const StepFunc &func, int haloX, int haloY, bool secondChain = false)
+    {
+        CV_Assert(haloX >= 0 && haloY >= 0);
+        Step step = { func, haloX, haloY };
+        (secondChain ? chain2 : chain1).push_back(step);
+    }
+
+    // Makes the result chain1(src) - chain2(src) (saturated); an empty chain stands for src itself
+    void setSubtract(bool value)
+    {
+        subtract = value;
+    }
+
+    // Tile origins become multiples of this value (for position dependent operations such as demosaicing)
+    void setAlignment(int value)
+    {
+        CV_Assert(value > 0);
+        alignment = value;
+    }
+
+    // Distance from an output pixel to the farthest source pixel it depends on
+    cv::Size halo() const
+    {
+        cv::Size h1 = halo(chain1), h2 = halo(chain2);
+        return cv::Size(std::max(h1.width, h2.width), std::max(h1.height, h2.height));
+    }
+
+    // Computes the filter of src into dst. At most as many tiles as fit into memoryBudget
+    // (bytes, 0: no limit) are processed at the same time.
+    void apply(const cv::Mat &src, cv::OutputArray dst, cv::Size tileSize, int64 memoryBudget) const
+    {
+        CV_Assert(!src.empty() && src.dims <= 2);
+        CV_Assert(tileSize.width > 0 && tileSize.height > 0);
+        CV_Assert(!chain1.empty() || !chain2.empty());
+
+        // Tiles narrower than the halo would let the extrapolation at the image edge reach
+        // beyond the clipped input, so they are enlarged.
+        const cv::Size h = halo();
+        tileSize.width = std::min(alignUp(std::max(tileSize.width, h.width)), src.cols);
+        tileSize.height = std::min(alignUp(std::max(tileSize.height, h.height)), src.rows);
+        const int tilesX = (src.cols + tileSize.width - 1) / tileSize.width;
+        const int tilesY = (src.rows + tileSize.height - 1) / tileSize.height;
+        const int numTiles = tilesX * tilesY;
+
+        // The first tile tells the output type
+        const cv::Rect firstRect = tileRect(0, tilesX, tileSize, src.size());
+        const cv::Mat first = processTile(src, firstRect);
+        if (first.size() != firstRect.size())
+            CV_Error(cv::Error::StsNotImplemented, "Operations that change the image size cannot be tiled");
+        dst.create(src.size(), first.type());
+        cv::Mat out = dst.getMat();
+        if ((h.width > 0 || h.height > 0) && out.datastart < src.dataend && src.datastart < out.dataend)
+            CV_Error(cv::Error::StsBadArg, "dst must not share memory with src");
+        first.copyTo(out(firstRect));
+        if (numTiles == 1)
+            return;
+
+        int concurrency = numTiles - 1;
+        if (memoryBudget > 0)
+        {
+            const size_t enlarged = static_cast<size_t>(tileSize.width + 2 * h.width) * (tileSize.height + 2 * h.height);
+            const size_t elemSize = std::max(src.elemSize(), out.elemSize());
+            const size_t steps = chain1.size() + chain2.size() + 1;
+            const int64 perTile = static_cast<int64>(enlarged * elemSize * steps);
+            concurrency = static_cast<int>(std::max<int64>(1, std::min<int64>(concurrency, memoryBudget / perTile)));
+        }
+
+        const Invoker invoker(*this, src, out, tilesX, tileSize);
+        tracedParallelFor("TiledFilter", cv::Range(1, numTiles), invoker, concurrency);
+    }
+
+private:
+    std::vector<Step> chain1, chain2;
+    bool subtract;
+    int alignment;
+
+    int alignUp(int value) const
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    static cv::Size halo(const std::vector<Step> &chain)
+    {
+        cv::Size h(0, 0);
+        for (size_t i = 0; i < chain.size(); i++)
+        {
+            h.width += chain[i].haloX;
+            h.height += chain[i].haloY;
+        }
+        return h;
+    }
+
+    static cv::Rect tileRect(int index, int tilesX, cv::Size tileSize, cv::Size imageSize)
+    {
+        const cv::Rect r((index % tilesX) * tileSize.width, (index / tilesX) * tileSize.height,
+            tileSize.width, tileSize.height);
+        return r & cv::Rect(0, 0, imageSize.width, imageSize.height);
+    }
+
+    static cv::Rect enlarge(const cv::Rect &r, int x, int y)
+    {
+        return cv::Rect(r.x - x, r.y - y, r.width + 2 * x, r.height + 2 * y);
+    }
+
+    static cv::Mat runChain(const std::vector<Step> &chain, const cv::Mat &src, const cv::Rect &rect)
+    {
+        const cv::Rect image(0, 0, src.cols, src.rows);
+
+        // targets[k]: region of the image whose step-k output is needed
+        std::vector<cv::Rect> targets(chain.size());
+        cv::Rect target = rect;
+        for (size_t k = chain.size(); k-- > 0;)
+        {
+            targets[k] = target;
+            target = enlarge(target, chain[k].haloX, chain[k].haloY) & image;
+        }
+
+        cv::Mat cur = src(target);
+        cv::Rect curRect = target;
+        for (size_t k = 0; k < chain.size(); k++)
+        {
+            cv::Mat out;
+            chain[k].func(cur, out);
+            cur = out(targets[k] - curRect.tl());
+            curRect = targets[k];
+        }
+        return cur;
+    }
+
+    cv::Mat processTile(const cv::Mat &src, const cv::Rect &rect) const
+    {
+        cv::Mat a = runChain(chain1, src, rect);
+        if (!subtract)
+            return a;
+        cv::Mat b = runChain(chain2, src, rect);
+        cv::Mat diff;
+        cv::subtract(a, b, diff);
+        return diff;
+    }
+
+    class Invoker : public cv::ParallelLoopBody
+    {
+    public:
+        Invoker(const TiledFilter &filter, const cv::Mat &src, const cv::Mat &dst, int tilesX, cv::Size tileSize)
+            : filter(filter), src(src), dst(dst), tilesX(tilesX), tileSize(tileSize)
+        {
+        }
+
+        void operator()(const cv::Range &range) const CV_OVERRIDE
+        {
+            for (int i = range.start; i < range.end; i++)
+            {
+                const cv::Rect rect = tileRect(i, tilesX, tileSize, src.size());
+                cv::Mat target = dst(rect);
+                filter.processTile(src, rect).copyTo(target);
+            }
+        }
+
+    private:
+        const TiledFilter &filter;
+        const cv::Mat src;
+        const cv::Mat dst;
+        const int tilesX;
+        const cv::Size tileSize;
+    };
+};
+
+static int tiledFilterHalo(int ksize, int anchor)
+{
+    if (anchor < 0)
+        anchor = ksize / 2;
+    return std::max(anchor, ksize - 1 - anchor);
+}
+
+static int tiledFilterGaussianHalo(int ksize, double sigma)
+{
+    // the kernel size OpenCV derives from sigma for floating point images (larger than for 8U)
+    if (ksize <= 0)
+        ksize = cvRound(sigma * 4 * 2 + 1) | 1;
+    return ksize / 2;
+}
+
+
+CVAPI(void) imgproc_TiledFilter_delete(TiledFilter *obj)
+{
+    delete obj;
+}
+
+CVAPI(void) imgproc_TiledFilter_apply(TiledFilter *obj, cv::_InputArray *src, cv::_OutputArray *dst,
+    MyCvSize tileSize, int64 memoryBudget)
+{
+    obj->apply(src->getMat(), *dst, cpp(tileSize), memoryBudget);
+}
+
+CVAPI(MyCvSize) imgproc_TiledFilter_halo(TiledFilter *obj)
+{
+    return c(obj->halo());
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_GaussianBlur(MyCvSize ksize, double sigmaX, double sigmaY, int borderType)
+{
+    const cv::Size k = cpp(ksize);
+    const double sy = sigmaY > 0 ? sigmaY : sigmaX;
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &d) { cv::GaussianBlur(s, d, k, sigmaX, sigmaY, borderType | cv::BORDER_ISOLATED); },
+        tiledFilterGaussianHalo(k.width, sigmaX), tiledFilterGaussianHalo(k.height, sy));
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_boxFilter(int ddepth, MyCvSize ksize, MyCvPoint anchor, int normalize, int borderType)
+{
+    const cv::Size k = cpp(ksize);
+    const cv::Point a = cpp(anchor);
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &d) { cv::boxFilter(s, d, ddepth, k, a, normalize != 0, borderType | cv::BORDER_ISOLATED); },
+        tiledFilterHalo(k.width, a.x), tiledFilterHalo(k.height, a.y));
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_medianBlur(int ksize)
+{
+    // medianBlur replicates the border of whatever Mat it is given
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &d) { cv::medianBlur(s, d, ksize); }, ksize / 2, ksize / 2);
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_bilateralFilter(int d, double sigmaColor, double sigmaSpace, int borderType)
+{
+    const int radius = d > 0 ? d / 2 : cvRound(sigmaSpace * 1.5);
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &dst) { cv::bilateralFilter(s, dst, d, sigmaColor, sigmaSpace, borderType | cv::BORDER_ISOLATED); },
+        radius, radius);
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_filter2D(int ddepth, cv::_InputArray *kernel, MyCvPoint anchor, double delta, int borderType)
+{
+    const cv::Mat k = kernel->getMat().clone();
+    const cv::Point a = cpp(anchor);
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &d) { cv::filter2D(s, d, ddepth, k, a, delta, borderType | cv::BORDER_ISOLATED); },
+        tiledFilterHalo(k.cols, a.x), tiledFilterHalo(k.rows, a.y));
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_sepFilter2D(int ddepth, cv::_InputArray *kernelX, cv::_InputArray *kernelY,
+    MyCvPoint anchor, double delta, int borderType)
+{
+    const cv::Mat kx = kernelX->getMat().clone();
+    const cv::Mat ky = kernelY->getMat().clone();
+    const cv::Point a = cpp(anchor);
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &d) { cv::sepFilter2D(s, d, ddepth, kx, ky, a, delta, borderType | cv::BORDER_ISOLATED); },
+        tiledFilterHalo(static_cast<int>(kx.total()), a.x), tiledFilterHalo(static_cast<int>(ky.total()), a.y));
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_Sobel(int ddepth, int dx, int dy, int ksize, double scale, double delta, int borderType)
+{
+    // ksize 1 uses a 3-tap kernel in one direction, CV_SCHARR (-1) a 3x3 one
+    const int radius = std::max(ksize, 3) / 2;
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &d) { cv::Sobel(s, d, ddepth, dx, dy, ksize, scale, delta, borderType | cv::BORDER_ISOLATED); },
+        radius, radius);
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_Scharr(int ddepth, int dx, int dy, double scale, double delta, int borderType)
+{
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &d) { cv::Scharr(s, d, ddepth, dx, dy, scale, delta, borderType | cv::BORDER_ISOLATED); },
+        1, 1);
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_Laplacian(int ddepth, int ksize, double scale, double delta, int borderType)
+{
+    const int radius = std::max(ksize, 3) / 2;
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &d) { cv::Laplacian(s, d, ddepth, ksize, scale, delta, borderType | cv::BORDER_ISOLATED); },
+        radius, radius);
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_morphologyEx(int op, cv::_InputArray *kernel, MyCvPoint anchor, int iterations,
+    int borderType, MyCvScalar borderValue)
+{
+    cv::Mat k = kernel == NULL ? cv::Mat() : kernel->getMat().clone();
+    if (k.empty())
+        k = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(3, 3));
+    cv::Point a = cpp(anchor);
+    if (a.x < 0)
+        a.x = k.cols / 2;
+    if (a.y < 0)
+        a.y = k.rows / 2;
+    const cv::Scalar value = cpp(borderValue);
+    // Like cv::erode / cv::dilate, a rectangular kernel applied n times becomes one larger kernel
+    if (iterations > 1 && cv::countNonZero(k) == k.rows * k.cols)
+    {
+        a = cv::Point(a.x * iterations, a.y * iterations);
+        k = cv::getStructuringElement(cv::MORPH_RECT, cv::Size(
+            k.cols + (iterations - 1) * (k.cols - 1), k.rows + (iterations - 1) * (k.rows - 1)), a);
+        iterations = 1;
+    }
+    const int haloX = tiledFilterHalo(k.cols, a.x), haloY = tiledFilterHalo(k.rows, a.y);
+    const int border = borderType | cv::BORDER_ISOLATED;
+    const TiledFilter::StepFunc erode = [=](const cv::Mat &s, cv::Mat &d) { cv::erode(s, d, k, a, 1, border, value); };
+    const TiledFilter::StepFunc dilate = [=](const cv::Mat &s, cv::Mat &d) { cv::dilate(s, d, k, a, 1, border, value); };
+
+    TiledFilter *f = new TiledFilter();
+    // each iteration re-extrapolates the image border, so it is a step of its own
+    const auto repeat = [&](const TiledFilter::StepFunc &func, bool secondChain)
+    {
+        for (int i = 0; i < std::max(iterations, 1); i++)
+            f->add(func, haloX, haloY, secondChain);
+    };
+    switch (op)
+    {
+    case cv::MORPH_ERODE: repeat(erode, false); break;
+    case cv::MORPH_DILATE: repeat(dilate, false); break;
+    case cv::MORPH_OPEN: repeat(erode, false); repeat(dilate, false); break;
+    case cv::MORPH_CLOSE: repeat(dilate, false); repeat(erode, false); break;
+    case cv::MORPH_GRADIENT: repeat(dilate, false); repeat(erode, true); f->setSubtract(true); break;
+    case cv::MORPH_TOPHAT: repeat(erode, true); repeat(dilate, true); f->setSubtract(true); break;
+    case cv::MORPH_BLACKHAT: repeat(dilate, false); repeat(erode, false); f->setSubtract(true); break;
+    default:
+        delete f;
+        CV_Error(cv::Error::StsNotImplemented, "Unsupported morphological operation for tiled processing");
+    }
+    return f;
+}
+
+CVAPI(TiledFilter*) imgproc_TiledFilter_new_cvtColor(int code, int dstCn)
+{
+    // Demosaicing (COLOR_Bayer*, including the VNG / EA variants) reads a 5x5 neighborhood
+    // and depends on the parity of the pixel position; every other conversion is per pixel.
+    const bool bayer = (code >= 46 && code <= 49) || (code >= 62 && code <= 65) ||
+        (code >= 86 && code <= 89) || (code >= 135 && code <= 142);
+    const int radius = bayer ? 4 : 0;
+    TiledFilter *f = new TiledFilter();
+    f->add([=](const cv::Mat &s, cv::Mat &d) { cv::cvtColor(s, d, code, dstCn); }, radius, radius);
+    if (bayer)
+        f->setAlignment(2);
+    return f;
+}
+
+#endif
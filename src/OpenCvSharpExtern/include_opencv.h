@@ -24,6 +24,11 @@
 #include <opencv2/superres/optical_flow.hpp>
 #include <opencv2/stitching.hpp>
 #include <opencv2/video.hpp>
+#include <opencv2/gapi.hpp>
+#include <opencv2/gapi/core.hpp>
+#include <opencv2/gapi/imgproc.hpp>
+#include <opencv2/gapi/fluid/core.hpp>
+#include <opencv2/gapi/fluid/imgproc.hpp>
 
 // opencv_contrib
 #include <opencv2/aruco.hpp>
@@ -48,6 +53,7 @@
 #include <cstdio>
 #include <cstring>
 #include <cstdlib>
+#include <atomic>
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -55,7 +61,19 @@
 // Additional types
 #include "my_types.h"
 
+// Accounting of the objects handed out as handles
+#include "my_handles.h"
+
 // Additional functions
 #include "my_functions.h"
 
+// Tracing of native calls
+#include "my_trace.h"
+
+// Recording of native call sequences
+#include "my_recorder.h"
+
+// Asynchronous execution of long-running calls
+#include "my_jobs.h"
+
 #endif
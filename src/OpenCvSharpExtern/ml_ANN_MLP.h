@@ -26,7 +26,7 @@ CVAPI(void) ml_ANN_MLP_setLayerSizes(cv::ml::ANN_MLP *obj, cv::_InputArray *_lay
 
 CVAPI(cv::Mat*) ml_ANN_MLP_getLayerSizes(cv::ml::ANN_MLP *obj)
 {
-    return new cv::Mat(obj->getLayerSizes());
+    return trackHandle(new cv::Mat(obj->getLayerSizes()));
 }
 
 
@@ -104,19 +104,19 @@ CVAPI(void) ml_ANN_MLP_setRpropDWMax(cv::ml::ANN_MLP *obj, double val)
 
 CVAPI(cv::Mat*) ml_ANN_MLP_getWeights(cv::ml::ANN_MLP *obj, int layerIdx)
 {
-    return new cv::Mat(obj->getWeights(layerIdx));
+    return trackHandle(new cv::Mat(obj->getWeights(layerIdx)));
 }
 
 
 CVAPI(cv::Ptr<cv::ml::ANN_MLP>*) ml_ANN_MLP_create()
 {
     const auto ptr = cv::ml::ANN_MLP::create();
-    return new cv::Ptr<cv::ml::ANN_MLP>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::ANN_MLP>(ptr));
 }
 
 CVAPI(void) ml_Ptr_ANN_MLP_delete(cv::Ptr<cv::ml::ANN_MLP> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ml::ANN_MLP*) ml_Ptr_ANN_MLP_get(cv::Ptr<cv::ml::ANN_MLP> *obj)
@@ -127,14 +127,14 @@ CVAPI(cv::ml::ANN_MLP*) ml_Ptr_ANN_MLP_get(cv::Ptr<cv::ml::ANN_MLP> *obj)
 CVAPI(cv::Ptr<cv::ml::ANN_MLP>*) ml_ANN_MLP_load(const char *filePath)
 {
     const auto ptr = cv::ml::ANN_MLP::load(filePath);
-    return new cv::Ptr<cv::ml::ANN_MLP>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::ANN_MLP>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::ml::ANN_MLP>*) ml_ANN_MLP_loadFromString(const char *strModel)
 {
     const auto objname = cv::ml::ANN_MLP::create()->getDefaultName();
     const auto ptr = cv::Algorithm::loadFromString<cv::ml::ANN_MLP>(strModel, objname);
-    return new cv::Ptr<cv::ml::ANN_MLP>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::ANN_MLP>(ptr));
 }
 
 #endif
@@ -35,12 +35,12 @@ CVAPI(void) ml_Boost_setWeightTrimRate(cv::ml::Boost *obj, double val)
 CVAPI(cv::Ptr<cv::ml::Boost>*) ml_Boost_create()
 {
     const auto ptr = cv::ml::Boost::create();
-    return new cv::Ptr<cv::ml::Boost>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::Boost>(ptr));
 }
 
 CVAPI(void) ml_Ptr_Boost_delete(cv::Ptr<cv::ml::Boost> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ml::Boost*) ml_Ptr_Boost_get(cv::Ptr<cv::ml::Boost>* obj)
@@ -51,14 +51,14 @@ CVAPI(cv::ml::Boost*) ml_Ptr_Boost_get(cv::Ptr<cv::ml::Boost>* obj)
 CVAPI(cv::Ptr<cv::ml::Boost>*) ml_Boost_load(const char *filePath)
 {
     const auto ptr = cv::Algorithm::load<cv::ml::Boost>(filePath);
-    return new cv::Ptr<cv::ml::Boost>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::Boost>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::ml::Boost>*) ml_Boost_loadFromString(const char *strModel)
 {
     const auto objname = cv::ml::Boost::create()->getDefaultName();
     const auto ptr = cv::Algorithm::loadFromString<cv::ml::Boost>(strModel, objname);
-    return new cv::Ptr<cv::ml::Boost>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::Boost>(ptr));
 }
 
 #endif
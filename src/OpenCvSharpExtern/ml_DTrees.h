@@ -152,7 +152,7 @@ CVAPI(void) ml_DTrees_setRegressionAccuracy(cv::ml::DTrees *obj, float val)
 CVAPI(cv::Mat*) ml_DTrees_getPriors(cv::ml::DTrees *obj)
 {
     cv::Mat m = obj->getPriors();
-    return new cv::Mat(m);
+    return trackHandle(new cv::Mat(m));
 }
 CVAPI(void) ml_DTrees_setPriors(cv::ml::DTrees *obj, cv::Mat *val)
 {
@@ -208,12 +208,12 @@ CVAPI(void) ml_DTrees_getSubsets(cv::ml::DTrees *obj, std::vector<int> *result)
 CVAPI(cv::Ptr<cv::ml::DTrees>*) ml_DTrees_create()
 {
     const auto  ptr = cv::ml::DTrees::create();
-    return new cv::Ptr<cv::ml::DTrees>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::DTrees>(ptr));
 }
 
 CVAPI(void) ml_Ptr_DTrees_delete(cv::Ptr<cv::ml::DTrees> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ml::DTrees*) ml_Ptr_DTrees_get(cv::Ptr<cv::ml::DTrees> *obj)
@@ -224,14 +224,14 @@ CVAPI(cv::ml::DTrees*) ml_Ptr_DTrees_get(cv::Ptr<cv::ml::DTrees> *obj)
 CVAPI(cv::Ptr<cv::ml::DTrees>*) ml_DTrees_load(const char *filePath)
 {
     const auto ptr = cv::Algorithm::load<cv::ml::DTrees>(filePath);
-    return new cv::Ptr<cv::ml::DTrees>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::DTrees>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::ml::DTrees>*) ml_DTrees_loadFromString(const char *strModel)
 {
     const auto objname = cv::ml::DTrees::create()->getDefaultName();
     const auto  ptr = cv::Algorithm::loadFromString<cv::ml::DTrees>(strModel, objname);
-    return new cv::Ptr<cv::ml::DTrees>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::DTrees>(ptr));
 }
 
 #endif
@@ -34,13 +34,13 @@ CVAPI(void) ml_EM_setTermCriteria(cv::ml::EM *obj, MyCvTermCriteria val)
 CVAPI(cv::Mat*) ml_EM_getWeights(cv::ml::EM *obj)
 {
     cv::Mat m = obj->getWeights();
-    return new cv::Mat(m);
+    return trackHandle(new cv::Mat(m));
 }
 
 CVAPI(cv::Mat*) ml_EM_getMeans(cv::ml::EM *obj)
 {
     cv::Mat m = obj->getMeans();
-    return new cv::Mat(m);
+    return trackHandle(new cv::Mat(m));
 }
 
 CVAPI(void) ml_EM_getCovs(cv::ml::EM *obj, std::vector<cv::Mat*> *covs)
@@ -50,7 +50,7 @@ CVAPI(void) ml_EM_getCovs(cv::ml::EM *obj, std::vector<cv::Mat*> *covs)
     covs->resize(raw.size());
     for (size_t i = 0; i < raw.size(); i++)
     {
-        covs->at(i) = new cv::Mat(raw[i]);
+        covs->at(i) = trackHandle(new cv::Mat(raw[i]));
     }
 }
 
@@ -109,12 +109,12 @@ CVAPI(int) ml_EM_trainM(
 CVAPI(cv::Ptr<cv::ml::EM>*) ml_EM_create()
 {
     const auto obj = cv::ml::EM::create();
-    return new cv::Ptr<cv::ml::EM>(obj);
+    return trackHandle(new cv::Ptr<cv::ml::EM>(obj));
 }
 
 CVAPI(void) ml_Ptr_EM_delete(cv::Ptr<cv::ml::EM> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ml::EM*) ml_Ptr_EM_get(cv::Ptr<cv::ml::EM> *obj)
@@ -125,14 +125,14 @@ CVAPI(cv::ml::EM*) ml_Ptr_EM_get(cv::Ptr<cv::ml::EM> *obj)
 CVAPI(cv::Ptr<cv::ml::EM>*) ml_EM_load(const char *filePath)
 {
     const auto ptr = cv::Algorithm::load<cv::ml::EM>(filePath);
-    return new cv::Ptr<cv::ml::EM>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::EM>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::ml::EM>*) ml_EM_loadFromString(const char *strModel)
 {
     const auto objname = cv::ml::EM::create()->getDefaultName();
     const auto ptr = cv::Algorithm::loadFromString<cv::ml::EM>(strModel, objname);
-    return new cv::Ptr<cv::ml::EM>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::EM>(ptr));
 }
 
 #endif
@@ -52,12 +52,12 @@ CVAPI(float) ml_KNearest_findNearest(cv::ml::KNearest *obj, cv::_InputArray *sam
 CVAPI(cv::Ptr<cv::ml::KNearest>*) ml_KNearest_create()
 {
     const auto  ptr = cv::ml::KNearest::create();
-    return new cv::Ptr<cv::ml::KNearest>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::KNearest>(ptr));
 }
 
 CVAPI(void) ml_Ptr_KNearest_delete(cv::Ptr<cv::ml::KNearest> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ml::KNearest*) ml_Ptr_KNearest_get(cv::Ptr<cv::ml::KNearest>* obj)
@@ -68,14 +68,14 @@ CVAPI(cv::ml::KNearest*) ml_Ptr_KNearest_get(cv::Ptr<cv::ml::KNearest>* obj)
 CVAPI(cv::Ptr<cv::ml::KNearest>*) ml_KNearest_load(const char *filePath)
 {
     const auto  ptr = cv::Algorithm::load<cv::ml::KNearest>(filePath);
-    return new cv::Ptr<cv::ml::KNearest>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::KNearest>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::ml::KNearest>*) ml_KNearest_loadFromString(const char *strModel)
 {
     const auto objname = cv::ml::KNearest::create()->getDefaultName();
     const auto  ptr = cv::Algorithm::loadFromString<cv::ml::KNearest>(strModel, objname);
-    return new cv::Ptr<cv::ml::KNearest>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::KNearest>(ptr));
 }
 
 #endif
@@ -67,19 +67,19 @@ CVAPI(float) ml_LogisticRegression_predict(
 
 CVAPI(cv::Mat*) ml_LogisticRegression_get_learnt_thetas(cv::ml::LogisticRegression *obj)
 {
-    return new cv::Mat(obj->get_learnt_thetas());
+    return trackHandle(new cv::Mat(obj->get_learnt_thetas()));
 }
 
 
 CVAPI(cv::Ptr<cv::ml::LogisticRegression>*) ml_LogisticRegression_create()
 {
     const auto ptr = cv::ml::LogisticRegression::create();
-    return new cv::Ptr<cv::ml::LogisticRegression>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::LogisticRegression>(ptr));
 }
 
 CVAPI(void) ml_Ptr_LogisticRegression_delete(cv::Ptr<cv::ml::LogisticRegression> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ml::LogisticRegression*) ml_Ptr_LogisticRegression_get(cv::Ptr<cv::ml::LogisticRegression> *obj)
@@ -90,14 +90,14 @@ CVAPI(cv::ml::LogisticRegression*) ml_Ptr_LogisticRegression_get(cv::Ptr<cv::ml:
 CVAPI(cv::Ptr<cv::ml::LogisticRegression>*) ml_LogisticRegression_load(const char *filePath)
 {
     const auto ptr = cv::Algorithm::load<cv::ml::LogisticRegression>(filePath);
-    return new cv::Ptr<cv::ml::LogisticRegression>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::LogisticRegression>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::ml::LogisticRegression>*) ml_LogisticRegression_loadFromString(const char *strModel)
 {
     const auto objname = cv::ml::LogisticRegression::create()->getDefaultName();
     const auto ptr = cv::Algorithm::loadFromString<cv::ml::LogisticRegression>(strModel, objname);
-    return new cv::Ptr<cv::ml::LogisticRegression>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::LogisticRegression>(ptr));
 }
 
 #endif
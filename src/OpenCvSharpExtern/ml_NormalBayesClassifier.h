@@ -14,12 +14,12 @@ CVAPI(float) ml_NormalBayesClassifier_predictProb(
 CVAPI(cv::Ptr<cv::ml::NormalBayesClassifier>*) ml_NormalBayesClassifier_create()
 {
     const auto ptr = cv::ml::NormalBayesClassifier::create();
-    return new cv::Ptr<cv::ml::NormalBayesClassifier>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::NormalBayesClassifier>(ptr));
 }
 
 CVAPI(void) ml_Ptr_NormalBayesClassifier_delete(cv::Ptr<cv::ml::NormalBayesClassifier> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ml::NormalBayesClassifier*) ml_Ptr_NormalBayesClassifier_get(
@@ -31,14 +31,14 @@ CVAPI(cv::ml::NormalBayesClassifier*) ml_Ptr_NormalBayesClassifier_get(
 CVAPI(cv::Ptr<cv::ml::NormalBayesClassifier>*) ml_NormalBayesClassifier_load(const char *filePath)
 {
     const auto  ptr = cv::Algorithm::load<cv::ml::NormalBayesClassifier>(filePath);
-    return new cv::Ptr<cv::ml::NormalBayesClassifier>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::NormalBayesClassifier>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::ml::NormalBayesClassifier>*) ml_NormalBayesClassifier_loadFromString(const char *strModel)
 {
     const auto objname = cv::ml::NormalBayesClassifier::create()->getDefaultName();
     const auto ptr = cv::Algorithm::loadFromString<cv::ml::NormalBayesClassifier>(strModel, objname);
-    return new cv::Ptr<cv::ml::NormalBayesClassifier>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::NormalBayesClassifier>(ptr));
 }
 
 #endif
@@ -33,18 +33,18 @@ CVAPI(void) ml_RTrees_setTermCriteria(cv::ml::RTrees *obj, MyCvTermCriteria val)
 
 CVAPI(cv::Mat*) ml_RTrees_getVarImportance(cv::ml::RTrees *obj)
 {
-    return new cv::Mat(obj->getVarImportance());
+    return trackHandle(new cv::Mat(obj->getVarImportance()));
 }
 
 CVAPI(cv::Ptr<cv::ml::RTrees>*) ml_RTrees_create()
 {
     const auto ptr = cv::ml::RTrees::create();
-    return new cv::Ptr<cv::ml::RTrees>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::RTrees>(ptr));
 }
 
 CVAPI(void) ml_Ptr_RTrees_delete(cv::Ptr<cv::ml::RTrees> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ml::RTrees*) ml_Ptr_RTrees_get(cv::Ptr<cv::ml::RTrees> *obj)
@@ -55,14 +55,14 @@ CVAPI(cv::ml::RTrees*) ml_Ptr_RTrees_get(cv::Ptr<cv::ml::RTrees> *obj)
 CVAPI(cv::Ptr<cv::ml::RTrees>*) ml_RTrees_load(const char *filePath)
 {
     const auto ptr = cv::Algorithm::load<cv::ml::RTrees>(filePath);
-    return new cv::Ptr<cv::ml::RTrees>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::RTrees>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::ml::RTrees>*) ml_RTrees_loadFromString(const char *strModel)
 {
     const auto objname = cv::ml::RTrees::create()->getDefaultName();
     const auto ptr = cv::Algorithm::loadFromString<cv::ml::RTrees>(strModel, objname);
-    return new cv::Ptr<cv::ml::RTrees>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::RTrees>(ptr));
 }
 
 #endif
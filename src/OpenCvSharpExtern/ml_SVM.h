@@ -70,7 +70,7 @@ CVAPI(void) ml_SVM_setNu(cv::ml::SVM *obj, double val)
 
 CVAPI(cv::Mat*) ml_SVM_getClassWeights(cv::ml::SVM *obj)
 {
-    return new cv::Mat(obj->getClassWeights());
+    return trackHandle(new cv::Mat(obj->getClassWeights()));
 }
 CVAPI(void) ml_SVM_setClassWeights(cv::ml::SVM *obj, cv::Mat *val)
 {
@@ -98,7 +98,7 @@ CVAPI(void) ml_SVM_setKernel(cv::ml::SVM *obj, int kernelType)
 
 CVAPI(cv::Mat*) ml_SVM_getSupportVectors(cv::ml::SVM *obj)
 {
-    return new cv::Mat(obj->getSupportVectors());
+    return trackHandle(new cv::Mat(obj->getSupportVectors()));
 }
 
 CVAPI(double) ml_SVM_getDecisionFunction(
@@ -118,12 +118,12 @@ CVAPI(ParamGridStruct) ml_SVM_getDefaultGrid(int param_id)
 CVAPI(cv::Ptr<cv::ml::SVM>*) ml_SVM_create()
 {
     cv::Ptr<cv::ml::SVM> ptr = cv::ml::SVM::create();
-    return new cv::Ptr<cv::ml::SVM>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::SVM>(ptr));
 }
 
 CVAPI(void) ml_Ptr_SVM_delete(cv::Ptr<cv::ml::SVM> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ml::SVM*) ml_Ptr_SVM_get(cv::Ptr<cv::ml::SVM>* obj)
@@ -134,14 +134,14 @@ CVAPI(cv::ml::SVM*) ml_Ptr_SVM_get(cv::Ptr<cv::ml::SVM>* obj)
 CVAPI(cv::Ptr<cv::ml::SVM>*) ml_SVM_load(const char *filePath)
 {
     const auto ptr = cv::ml::SVM::load(filePath);
-    return new cv::Ptr<cv::ml::SVM>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::SVM>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::ml::SVM>*) ml_SVM_loadFromString(const char *strModel)
 {
     const auto objname = cv::ml::SVM::create()->getDefaultName();
     const auto ptr = cv::Algorithm::loadFromString<cv::ml::SVM>(strModel, objname);
-    return new cv::Ptr<cv::ml::SVM>(ptr);
+    return trackHandle(new cv::Ptr<cv::ml::SVM>(ptr));
 }
 
 #endif
@@ -40,6 +40,67 @@ static int p(T obj, const std::string &caption = "MessageBox")
 #  define CVAPI(rettype) CV_EXTERN_C CV_EXPORTS rettype CV_CDECL
 #endif
 
+// Export profiling (core_ExportProfiler.h): every export goes to the "cvapi_text" section so that
+// the -finstrument-functions hooks can tell exports from the helpers they call.
+#if defined(OPENCVSHARP_PROFILE_EXPORTS) && defined(__GNUC__) && defined(__ELF__)
+#  define OPENCVSHARP_EXPORT_PROFILING
+#  undef CVAPI
+#  define CVAPI(rettype) CV_EXTERN_C CV_EXPORTS __attribute__((section("cvapi_text"))) rettype CV_CDECL
+#endif
+
+// Error handling on native worker threads (job queue, batch and loader threads).
+// The error callback of the managed side throws a managed exception, which cannot unwind through the native
+// frames of a thread without managed frames (nor be caught by their catch blocks). redirectError therefore
+// registers dispatchError with OpenCV, which passes errors on to the callback of the caller except while a
+// NativeErrorScope is active on the current thread; cv::error then throws cv::Exception, for the worker to catch.
+// (inline, not static: the state must be shared by all translation units)
+struct ErrorRedirection
+{
+    cv::ErrorCallback callback;
+    void *userdata;
+};
+
+inline ErrorRedirection &errorRedirection()
+{
+    static ErrorRedirection redirection = { NULL, NULL };
+    return redirection;
+}
+
+inline bool &nativeErrorScopeActive()
+{
+    static thread_local bool active = false;
+    return active;
+}
+
+class NativeErrorScope
+{
+public:
+    NativeErrorScope()
+        : previous(nativeErrorScopeActive())
+    {
+        nativeErrorScopeActive() = true;
+    }
+
+    ~NativeErrorScope()
+    {
+        nativeErrorScopeActive() = previous;
+    }
+
+private:
+    const bool previous;
+
+    NativeErrorScope(const NativeErrorScope &);
+    NativeErrorScope &operator=(const NativeErrorScope &);
+};
+
+inline int CV_CDECL dispatchError(int status, const char *funcName, const char *errMsg, const char *fileName, int line, void *)
+{
+    const ErrorRedirection &redirection = errorRedirection();
+    if (nativeErrorScopeActive() || redirection.callback == NULL)
+        return 0;
+    return redirection.callback(status, funcName, errMsg, fileName, line, redirection.userdata);
+}
+
 
 
 static cv::_InputArray entity(cv::_InputArray *obj)
@@ -74,7 +135,7 @@ static cv::cuda::Stream entity(cv::cuda::Stream *obj)
 template <typename T>
 static cv::Ptr<T> *clone(const cv::Ptr<T> &ptr)
 {
-    return new cv::Ptr<T>(ptr);
+    return trackHandle(new cv::Ptr<T>(ptr));
 }
 
 static void copyString(const char *src, char *dst, int dstLength)
@@ -148,4 +209,92 @@ static void toVec(
     }
 }
 
+// Number of heap allocations made by ScratchVector on the calling thread (new pooled vectors and capacity growth)
+// (inline, not static: the counter must be shared by all translation units)
+inline uint64 &scratchVectorAllocationCount()
+{
+    static thread_local uint64 count = 0;
+    return count;
+}
+
+// std::vector borrowed from a thread-local pool for the temporaries of one call (argument lists built
+// from caller pointers etc.). The vector is cleared when the ScratchVector goes out of scope, which
+// releases e.g. Mat references, but it keeps its capacity, so steady-state calls do not allocate.
+// Nested scopes borrow different vectors.
+template <typename T>
+class ScratchVector
+{
+public:
+    ScratchVector()
+    {
+        std::vector<std::vector<T>*> &free = pool().items;
+        if (free.empty())
+        {
+            vec = new std::vector<T>();
+            scratchVectorAllocationCount()++;
+        }
+        else
+        {
+            vec = free.back();
+            free.pop_back();
+        }
+        capacity = vec->capacity();
+    }
+
+    ~ScratchVector()
+    {
+        if (vec->capacity() != capacity)
+            scratchVectorAllocationCount()++;
+        vec->clear();
+        pool().items.push_back(vec);
+    }
+
+    std::vector<T> &operator*() { return *vec; }
+    std::vector<T> *operator->() { return vec; }
+
+    std::vector<T> &assign(const T *data, size_t length)
+    {
+        if (length > 0)
+            vec->assign(data, data + length);
+        return *vec;
+    }
+
+    // Frees the pooled vectors of the calling thread
+    static void trim()
+    {
+        pool().clear();
+    }
+
+private:
+    struct Pool
+    {
+        std::vector<std::vector<T>*> items;
+
+        void clear()
+        {
+            for (size_t i = 0; i < items.size(); i++)
+                delete items[i];
+            items.clear();
+            items.shrink_to_fit();
+        }
+
+        ~Pool()
+        {
+            clear();
+        }
+    };
+
+    std::vector<T> *vec;
+    size_t capacity;
+
+    static Pool &pool()
+    {
+        static thread_local Pool p;
+        return p;
+    }
+
+    ScratchVector(const ScratchVector&);
+    ScratchVector &operator=(const ScratchVector&);
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,170 @@
+// Accounting of the live native objects handed out as handles
+
+#ifndef _MY_HANDLES_H_
+#define _MY_HANDLES_H_
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
+enum HandleKind
+{
+    HANDLE_MAT = 0,
+    HANDLE_VECTOR = 1,
+    HANDLE_ALGORITHM = 2,   // cv::Ptr of a cv::Algorithm subclass
+    HANDLE_OTHER_PTR = 3,   // any other cv::Ptr
+    HANDLE_FILESTORAGE = 4,
+    HANDLE_VIDEOCAPTURE = 5,
+    HANDLE_NET = 6,
+    HANDLE_KIND_COUNT = 7,
+};
+
+extern "C"
+{
+    struct NativeHandleStats
+    {
+        int64 live;             // created and not yet deleted
+        int64 highWater;        // maximum of live since start or resetHighWater
+        uint64 created;
+        uint64 deleted;
+        uint64 bytes;           // Mat only: see CountingMatAllocator
+        int32_t bytesTracked;
+        int32_t reserved;
+    };
+}
+
+// What a handle type is counted as
+template <typename T>
+struct HandleTraits;
+
+template <>
+struct HandleTraits<cv::Mat>
+{
+    static const HandleKind kind = HANDLE_MAT;
+};
+
+template <typename T>
+struct HandleTraits<std::vector<T> >
+{
+    static const HandleKind kind = HANDLE_VECTOR;
+};
+
+template <typename T>
+struct HandleTraits<cv::Ptr<T> >
+{
+    static const HandleKind kind = std::is_base_of<cv::Algorithm, T>::value ? HANDLE_ALGORITHM : HANDLE_OTHER_PTR;
+};
+
+#define DEFINE_OPAQUE_HANDLE_TRAITS(type, handleKind) \
+    template <> \
+    struct HandleTraits<type> \
+    { \
+        static const HandleKind kind = handleKind; \
+    };
+
+DEFINE_OPAQUE_HANDLE_TRAITS(cv::FileStorage, HANDLE_FILESTORAGE)
+DEFINE_OPAQUE_HANDLE_TRAITS(cv::VideoCapture, HANDLE_VIDEOCAPTURE)
+DEFINE_OPAQUE_HANDLE_TRAITS(cv::dnn::Net, HANDLE_NET)
+
+// Counts the handles created and deleted by the shims, per kind (a few relaxed atomic operations per handle).
+// The bytes of Mat buffers are not measured here but by CountingMatAllocator (core_MatAllocator.h), where
+// the buffers are allocated and freed.
+class HandleRegistry
+{
+public:
+
+    static HandleRegistry *instance()
+    {
+        // never destroyed: handles may still be released during process exit
+        static HandleRegistry *registry = new HandleRegistry();
+        return registry;
+    }
+
+    void add(HandleKind kind)
+    {
+        Counters &c = counters[kind];
+        c.created.fetch_add(1, std::memory_order_relaxed);
+        const int64 live = c.live.fetch_add(1, std::memory_order_relaxed) + 1;
+        int64 high = c.highWater.load(std::memory_order_relaxed);
+        while (live > high && !c.highWater.compare_exchange_weak(high, live, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void remove(HandleKind kind)
+    {
+        Counters &c = counters[kind];
+        c.deleted.fetch_add(1, std::memory_order_relaxed);
+        c.live.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    void resetHighWater()
+    {
+        for (int k = 0; k < HANDLE_KIND_COUNT; k++)
+            counters[k].highWater.store(counters[k].live.load());
+    }
+
+    // Fills the counts of stats[0 .. HANDLE_KIND_COUNT); bytes are left 0 and not tracked
+    void snapshot(NativeHandleStats *stats) const
+    {
+        for (int k = 0; k < HANDLE_KIND_COUNT; k++)
+        {
+            NativeHandleStats &s = stats[k];
+            s.live = counters[k].live.load();
+            s.highWater = counters[k].highWater.load();
+            s.created = counters[k].created.load();
+            s.deleted = counters[k].deleted.load();
+            s.bytes = 0;
+            s.bytesTracked = 0;
+            s.reserved = 0;
+        }
+    }
+
+private:
+    struct Counters
+    {
+        std::atomic<int64> live;
+        std::atomic<int64> highWater;
+        std::atomic<uint64> created;
+        std::atomic<uint64> deleted;
+    };
+
+    Counters counters[HANDLE_KIND_COUNT];
+
+    HandleRegistry()
+    {
+        for (int k = 0; k < HANDLE_KIND_COUNT; k++)
+        {
+            counters[k].live.store(0);
+            counters[k].highWater.store(0);
+            counters[k].created.store(0);
+            counters[k].deleted.store(0);
+        }
+    }
+};
+
+// Counts an object which is returned to the caller as a handle
+template <typename T>
+static T *trackHandle(T *obj)
+{
+    if (obj != NULL)
+        HandleRegistry::instance()->add(HandleTraits<T>::kind);
+    return obj;
+}
+
+// Counts the release of a handle; the caller deletes the object
+template <typename T>
+static void untrackHandle(T *obj)
+{
+    if (obj != NULL)
+        HandleRegistry::instance()->remove(HandleTraits<T>::kind);
+}
+template <typename T>
+static void deleteHandle(T *obj)
+{
+    untrackHandle(obj);
+    delete obj;
+}
+
+#endif
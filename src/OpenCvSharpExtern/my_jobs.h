@@ -0,0 +1,332 @@
+// Asynchronous execution of long-running native calls
+
+#ifndef _MY_JOBS_H_
+#define _MY_JOBS_H_
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum NativeJobStatus
+{
+    NATIVE_JOB_CREATED = 0,
+    NATIVE_JOB_QUEUED = 1,
+    NATIVE_JOB_RUNNING = 2,
+    NATIVE_JOB_COMPLETED = 3,
+    NATIVE_JOB_FAILED = 4,      // the operation threw; see NativeJob::error
+    NATIVE_JOB_CANCELLED = 5,
+};
+
+// Called once per submitted job, on the worker thread which finished it (or on the thread which
+// cancelled it while it was queued), after wait() has been released
+typedef void (CV_CDECL *NativeJobCallback)(int status, void *userData);
+
+// Thrown by NativeJob::checkCancelled to leave the body of a cancelled job
+struct NativeJobCancelled
+{
+};
+
+// One operation with its inputs captured at creation. The outputs are kept in the job (results())
+// and read by the caller after completion, so no caller-owned object is written asynchronously.
+class NativeJob
+{
+public:
+    typedef std::function<void(NativeJob &job)> Body;
+
+    NativeJob(const char *name, const Body &body)
+        : name(name), body(body), status_(NATIVE_JOB_CREATED), cancelRequested(false), resultCode_(0),
+          callback(NULL), userData(NULL)
+    {
+    }
+
+    const char *jobName() const
+    {
+        return name;
+    }
+
+    int status()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return status_;
+    }
+
+    // For the body: returns at the points where the operation can be abandoned, unless cancelled
+    void checkCancelled() const
+    {
+        if (cancelRequested.load(std::memory_order_relaxed))
+            throw NativeJobCancelled();
+    }
+
+    // Returns true when the job has finished (in any state) within timeoutMs; a negative timeout waits forever
+    bool wait(int timeoutMs)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        const auto finished = [this] { return isFinished(status_); };
+        if (timeoutMs < 0)
+        {
+            done.wait(lock, finished);
+            return true;
+        }
+        return done.wait_for(lock, std::chrono::milliseconds(timeoutMs), finished);
+    }
+
+    std::vector<cv::Mat> &results()
+    {
+        return results_;
+    }
+
+    int resultCode() const
+    {
+        return resultCode_;
+    }
+
+    void setResultCode(int value)
+    {
+        resultCode_ = value;
+    }
+
+    std::string error()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return error_;
+    }
+
+    // Inputs are shared with the caller when they are reference counted; borrowed buffers (e.g. Mats
+    // over managed memory) are copied, since the caller may release them before the job runs.
+    static cv::Mat retain(const cv::Mat &m)
+    {
+        return (m.u == NULL) ? m.clone() : m;
+    }
+
+    static bool isFinished(int status)
+    {
+        return status >= NATIVE_JOB_COMPLETED;
+    }
+
+private:
+    friend class NativeJobQueue;
+
+    const char *name;
+    Body body;
+    std::mutex mutex;
+    std::condition_variable done;
+    int status_;
+    std::atomic<bool> cancelRequested;
+    std::vector<cv::Mat> results_;
+    int resultCode_;
+    std::string error_;
+    NativeJobCallback callback;
+    void *userData;
+
+    NativeJob(const NativeJob &);
+    NativeJob &operator=(const NativeJob &);
+
+    // Returns false unless the job was still waiting in the queue (from)
+    bool transition(int from, int to)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (status_ != from)
+            return false;
+        status_ = to;
+        return true;
+    }
+
+    void run()
+    {
+        // errors become cv::Exception, caught below
+        NativeErrorScope errors;
+        int status = NATIVE_JOB_COMPLETED;
+        std::string message;
+        try
+        {
+            TraceSpan span("job", name);
+            checkCancelled();
+            body(*this);
+        }
+        catch (const NativeJobCancelled &)
+        {
+            status = NATIVE_JOB_CANCELLED;
+        }
+        catch (const std::exception &e)
+        {
+            status = NATIVE_JOB_FAILED;
+            message = e.what();
+        }
+        catch (...)
+        {
+            status = NATIVE_JOB_FAILED;
+            message = "unknown exception";
+        }
+        if (status != NATIVE_JOB_COMPLETED)
+            results_.clear();
+        finish(status, message);
+    }
+
+    void finish(int status, const std::string &message)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            status_ = status;
+            error_ = message;
+        }
+        done.notify_all();
+        if (callback != NULL)
+            callback(status, userData);
+    }
+};
+
+// Bounded priority queue of NativeJobs executed by a small pool of worker threads, separate from the
+// cv::parallel_for_ pool which the jobs themselves use
+class NativeJobQueue
+{
+public:
+    static NativeJobQueue *instance()
+    {
+        // never destroyed: jobs may still finish during process exit
+        static NativeJobQueue *queue = new NativeJobQueue();
+        return queue;
+    }
+
+    // Returns false (and leaves the job untouched) if the queue is full or the job was already submitted
+    bool submit(const cv::Ptr<NativeJob> &job, int priority, NativeJobCallback callback, void *userData)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (pending.size() >= capacity)
+            return false;
+        if (!job->transition(NATIVE_JOB_CREATED, NATIVE_JOB_QUEUED))
+            return false;
+        job->callback = callback;
+        job->userData = userData;
+        const Entry e = { priority, sequence++, job };
+        pending.insert(e);
+        while (startedWorkers < workerCount)
+        {
+            std::thread(&NativeJobQueue::work, this, startedWorkers).detach();
+            startedWorkers++;
+        }
+        wake.notify_one();
+        return true;
+    }
+
+    // Cancels a queued job immediately; a running job stops at its next cancellation point.
+    // A job which has not been submitted or has finished is left as it is.
+    void cancel(const cv::Ptr<NativeJob> &job)
+    {
+        {
+            // the queue lock orders this with submit and with the start of the job in work()
+            std::lock_guard<std::mutex> lock(mutex);
+            {
+                std::lock_guard<std::mutex> jobLock(job->mutex);
+                if (job->status_ != NATIVE_JOB_QUEUED && job->status_ != NATIVE_JOB_RUNNING)
+                    return;
+                job->cancelRequested.store(true);
+            }
+            for (std::set<Entry>::iterator it = pending.begin(); it != pending.end(); ++it)
+            {
+                if (it->job == job)
+                {
+                    pending.erase(it);
+                    break;
+                }
+            }
+            if (!job->transition(NATIVE_JOB_QUEUED, NATIVE_JOB_CANCELLED))
+                return;
+        }
+        job->finish(NATIVE_JOB_CANCELLED, std::string());
+    }
+
+    void configure(int workers, int maxQueued)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (workers > 0)
+            workerCount = workers;
+        if (maxQueued > 0)
+            capacity = static_cast<size_t>(maxQueued);
+        // surplus workers exit when they wake up
+        wake.notify_all();
+    }
+
+    int queued()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return static_cast<int>(pending.size());
+    }
+
+    int running()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return active;
+    }
+
+private:
+    struct Entry
+    {
+        int priority;
+        uint64 sequence;
+        cv::Ptr<NativeJob> job;
+
+        // higher priority first, then in submission order
+        bool operator<(const Entry &other) const
+        {
+            if (priority != other.priority)
+                return priority > other.priority;
+            return sequence < other.sequence;
+        }
+    };
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::set<Entry> pending;
+    uint64 sequence;
+    size_t capacity;
+    int workerCount;
+    int startedWorkers;
+    int active;
+
+    NativeJobQueue()
+        : sequence(0), capacity(256), workerCount(std::max(1, std::min(4, cv::getNumberOfCPUs() / 2))),
+          startedWorkers(0), active(0)
+    {
+    }
+
+    void work(int index)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;)
+        {
+            // surplus workers retire from the highest index down, so the indices stay contiguous
+            const auto retire = [this, index] { return index >= workerCount && index == startedWorkers - 1; };
+            wake.wait(lock, [this, index, &retire] { return (index < workerCount && !pending.empty()) || retire(); });
+            if (retire())
+            {
+                startedWorkers--;
+                wake.notify_all();
+                return;
+            }
+            const cv::Ptr<NativeJob> job = pending.begin()->job;
+            pending.erase(pending.begin());
+            if (!job->transition(NATIVE_JOB_QUEUED, NATIVE_JOB_RUNNING))
+                continue;
+            active++;
+            lock.unlock();
+            job->run();
+            lock.lock();
+            active--;
+        }
+    }
+};
+
+// Creates the handle of a job which is not submitted yet
+static cv::Ptr<NativeJob> *newJob(const char *name, const NativeJob::Body &body)
+{
+    return trackHandle(new cv::Ptr<NativeJob>(cv::makePtr<NativeJob>(name, body)));
+}
+
+#endif
@@ -0,0 +1,440 @@
+// Recording of native call sequences for offline replay
+
+#ifndef _MY_RECORDER_H_
+#define _MY_RECORDER_H_
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Log format (native byte order):
+//   "OCSRLOG1"
+//   records: uint32 size (of the rest of the record), uint16 name length, name,
+//            int64 duration [ns], uint8 argument count, arguments
+// Arguments start with a tag:
+//   'i' int32, 'd' double, 's' uint32 length + chars, 'I' uint32 count + int32s, 'b' uint64 length + bytes,
+//   'n' absent (NULL) array,
+//   'M' array: int32 type, int32 dims, int32 sizes[dims], uint64 hash, uint8 hasData [, uint64 length + bytes]
+// Output arrays are not recorded; the replayer lets every call allocate them.
+
+#define CALL_LOG_MAGIC "OCSRLOG1"
+
+enum CallRecorderMode
+{
+    CALL_RECORDER_HASHES = 0,   // array shapes and content hashes only; the replayer synthesizes the contents
+    CALL_RECORDER_CONTENTS = 1, // array contents as well
+};
+
+// Arrays up to this size (parameters such as a transformation matrix or a kernel) are stored with their
+// contents in every mode: noise would not be a meaningful value for them
+#define CALL_LOG_SMALL_ARRAY_BYTES 4096
+
+// 64-bit hash of the array contents (not a cryptographic hash; identifies identical inputs)
+static uint64 callLogHash(const cv::Mat &m)
+{
+    uint64 h = 0x9E3779B97F4A7C15ULL ^ static_cast<uint64>(m.type());
+    const cv::Mat c = m.isContinuous() ? m : m.clone();
+    const uchar *p = c.ptr();
+    const size_t n = c.total() * c.elemSize();
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        uint64 w;
+        memcpy(&w, p + i, 8);
+        h = (h ^ w) * 0x100000001B3ULL;
+        h ^= h >> 29;
+    }
+    for (; i < n; i++)
+        h = (h ^ p[i]) * 0x100000001B3ULL;
+    return h ^ n;
+}
+
+// Writes the calls of the instrumented exports to a log file while recording is active
+class CallRecorder
+{
+public:
+    static CallRecorder *instance()
+    {
+        // never destroyed: exports may still be called during process exit
+        static CallRecorder *recorder = new CallRecorder();
+        return recorder;
+    }
+
+    bool isRecording() const
+    {
+        return recording.load(std::memory_order_relaxed);
+    }
+
+    int mode() const
+    {
+        return mode_;
+    }
+
+    bool start(const std::string &path, int mode)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        close();
+        fp = fopen(path.c_str(), "wb");
+        if (fp == NULL)
+            return false;
+        fwrite(CALL_LOG_MAGIC, 1, 8, fp);
+        mode_ = mode;
+        calls = 0;
+        bytes = 8;
+        recording.store(true);
+        return true;
+    }
+
+    void stop()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        recording.store(false);
+        close();
+    }
+
+    void write(const std::vector<uchar> &record)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (fp == NULL)
+            return;
+        const uint32_t size = static_cast<uint32_t>(record.size());
+        fwrite(&size, sizeof(size), 1, fp);
+        fwrite(record.data(), 1, record.size(), fp);
+        calls++;
+        bytes += sizeof(size) + record.size();
+    }
+
+    uint64 recordedCalls()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return calls;
+    }
+
+    uint64 recordedBytes()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return bytes;
+    }
+
+private:
+    std::atomic<bool> recording;
+    std::mutex mutex;
+    FILE *fp;
+    int mode_;
+    uint64 calls;
+    uint64 bytes;
+
+    CallRecorder()
+        : recording(false), fp(NULL), mode_(CALL_RECORDER_HASHES), calls(0), bytes(0)
+    {
+    }
+
+    void close()
+    {
+        if (fp != NULL)
+            fclose(fp);
+        fp = NULL;
+    }
+};
+
+// Records one call of an export: construct it first, add the inputs, and the record (with the
+// duration of the rest of the export) is written when it goes out of scope.
+//
+//     RecordedCall rec("imgproc_cvtColor");
+//     if (rec)
+//         rec.array(src).i32(code).i32(dstCn);
+class RecordedCall
+{
+public:
+    explicit RecordedCall(const char *name)
+        : active(CallRecorder::instance()->isRecording()), argc(0), start(0)
+    {
+        if (!active)
+            return;
+        const uint16_t length = static_cast<uint16_t>(strlen(name));
+        put(length);
+        record.insert(record.end(), name, name + length);
+        put(static_cast<int64>(0)); // duration, patched in the destructor
+        argcOffset = record.size();
+        record.push_back(0);
+        started(); // a call without arguments is timed from here
+    }
+
+    ~RecordedCall()
+    {
+        if (!active)
+            return;
+        const int64 duration = now() - start;
+        memcpy(&record[argcOffset - sizeof(int64)], &duration, sizeof(int64));
+        record[argcOffset] = argc;
+        CallRecorder::instance()->write(record);
+    }
+
+    operator bool() const
+    {
+        return active;
+    }
+
+    RecordedCall &i32(int value)
+    {
+        return tag('i').put(static_cast<int32_t>(value)).started();
+    }
+
+    RecordedCall &f64(double value)
+    {
+        return tag('d').put(value).started();
+    }
+
+    RecordedCall &str(const char *value)
+    {
+        const uint32_t length = static_cast<uint32_t>(value == NULL ? 0 : strlen(value));
+        tag('s').put(length);
+        record.insert(record.end(), value, value + length);
+        return started();
+    }
+
+    RecordedCall &ints(const int *values, int count)
+    {
+        tag('I').put(static_cast<uint32_t>(count));
+        for (int i = 0; i < count; i++)
+            put(static_cast<int32_t>(values[i]));
+        return started();
+    }
+
+    RecordedCall &blob(const uchar *data, size_t length)
+    {
+        tag('b').put(static_cast<uint64>(length));
+        record.insert(record.end(), data, data + length);
+        return started();
+    }
+
+    RecordedCall &array(const cv::_InputArray *arr)
+    {
+        if (arr == NULL || arr->empty())
+            return tag('n').started();
+
+        const cv::Mat m = arr->getMat();
+        tag('M').put(static_cast<int32_t>(m.type())).put(static_cast<int32_t>(m.dims));
+        for (int i = 0; i < m.dims; i++)
+            put(static_cast<int32_t>(m.size[i]));
+        put(callLogHash(m));
+        const size_t length = m.total() * m.elemSize();
+        const bool contents = length <= CALL_LOG_SMALL_ARRAY_BYTES ||
+            CallRecorder::instance()->mode() == CALL_RECORDER_CONTENTS;
+        record.push_back(contents ? 1 : 0);
+        if (contents)
+        {
+            const cv::Mat c = m.isContinuous() ? m : m.clone();
+            put(static_cast<uint64>(length));
+            record.insert(record.end(), c.ptr(), c.ptr() + length);
+        }
+        return started();
+    }
+
+    static int64 now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    bool active;
+    std::vector<uchar> record;
+    size_t argcOffset;
+    uchar argc;
+    int64 start;
+
+    RecordedCall(const RecordedCall &);
+    RecordedCall &operator=(const RecordedCall &);
+
+    RecordedCall &tag(char t)
+    {
+        record.push_back(static_cast<uchar>(t));
+        argc++;
+        return *this;
+    }
+
+    template <typename T>
+    RecordedCall &put(const T &value)
+    {
+        const uchar *p = reinterpret_cast<const uchar*>(&value);
+        record.insert(record.end(), p, p + sizeof(T));
+        return *this;
+    }
+
+    // the duration excludes the time spent copying the inputs into the record
+    RecordedCall &started()
+    {
+        start = now();
+        return *this;
+    }
+};
+
+// Reads a log written by CallRecorder (used by OpenCvSharpExtern_replay)
+class CallLogReader
+{
+public:
+    struct Argument
+    {
+        char tag;
+        int32_t i;
+        double d;
+        std::string s;
+        std::vector<int> ints;
+        std::vector<uchar> bytes;  // 'b' and array contents
+        int type;
+        std::vector<int> sizes;
+        uint64 hash;
+        bool hasData;
+    };
+
+    struct Call
+    {
+        std::string name;
+        int64 duration;
+        std::vector<Argument> args;
+    };
+
+    explicit CallLogReader(const std::string &path)
+        : fp(fopen(path.c_str(), "rb"))
+    {
+        char magic[8];
+        if (fp == NULL || fread(magic, 1, 8, fp) != 8 || memcmp(magic, CALL_LOG_MAGIC, 8) != 0)
+        {
+            // the destructor does not run when the constructor throws
+            if (fp != NULL)
+                fclose(fp);
+            fp = NULL;
+            CV_Error(cv::Error::StsBadArg, "not a call log: " + path);
+        }
+    }
+
+    ~CallLogReader()
+    {
+        if (fp != NULL)
+            fclose(fp);
+    }
+
+    // Returns false at the end of the log
+    bool next(Call &call)
+    {
+        uint32_t size;
+        if (fread(&size, sizeof(size), 1, fp) != 1)
+            return false;
+        buffer.resize(size);
+        if (size > 0 && fread(&buffer[0], 1, size, fp) != size)
+            CV_Error(cv::Error::StsParseError, "truncated call log");
+        pos = 0;
+
+        const uint16_t nameLength = get<uint16_t>();
+        call.name.assign(reinterpret_cast<const char*>(take(nameLength)), nameLength);
+        call.duration = get<int64>();
+        const int argc = get<uchar>();
+        call.args.resize(argc);
+        for (int a = 0; a < argc; a++)
+        {
+            Argument &arg = call.args[a];
+            arg.tag = static_cast<char>(get<uchar>());
+            switch (arg.tag)
+            {
+            case 'i':
+                arg.i = get<int32_t>();
+                break;
+            case 'd':
+                arg.d = get<double>();
+                break;
+            case 's':
+            {
+                const uint32_t length = get<uint32_t>();
+                arg.s.assign(reinterpret_cast<const char*>(take(length)), length);
+                break;
+            }
+            case 'I':
+            {
+                arg.ints.resize(get<uint32_t>());
+                for (size_t i = 0; i < arg.ints.size(); i++)
+                    arg.ints[i] = get<int32_t>();
+                break;
+            }
+            case 'b':
+            {
+                const size_t length = static_cast<size_t>(get<uint64>());
+                const uchar *p = take(length);
+                arg.bytes.assign(p, p + length);
+                break;
+            }
+            case 'n':
+                break;
+            case 'M':
+            {
+                arg.type = get<int32_t>();
+                arg.sizes.resize(get<int32_t>());
+                for (size_t i = 0; i < arg.sizes.size(); i++)
+                    arg.sizes[i] = get<int32_t>();
+                arg.hash = get<uint64>();
+                arg.hasData = get<uchar>() != 0;
+                arg.bytes.clear();
+                if (arg.hasData)
+                {
+                    const size_t length = static_cast<size_t>(get<uint64>());
+                    const uchar *p = take(length);
+                    arg.bytes.assign(p, p + length);
+                }
+                break;
+            }
+            default:
+                CV_Error(cv::Error::StsParseError, "unknown argument tag in call log");
+            }
+        }
+        return true;
+    }
+
+    // The recorded contents of an 'M' argument, or deterministic noise of the recorded shape seeded by its hash
+    static cv::Mat toMat(const Argument &arg)
+    {
+        if (arg.tag != 'M')
+            return cv::Mat();
+        cv::Mat m(static_cast<int>(arg.sizes.size()), arg.sizes.data(), arg.type);
+        if (arg.hasData && arg.bytes.size() == m.total() * m.elemSize())
+            memcpy(m.ptr(), arg.bytes.data(), arg.bytes.size());
+        else
+        {
+            cv::Mat flat(1, static_cast<int>(m.total() * m.channels()), CV_MAKETYPE(m.depth(), 1), m.ptr());
+            cv::RNG rng(arg.hash);
+            rng.fill(flat, cv::RNG::UNIFORM, 0, 256);
+        }
+        return m;
+    }
+
+private:
+    FILE *fp;
+    std::vector<uchar> buffer;
+    size_t pos;
+
+    CallLogReader(const CallLogReader &);
+    CallLogReader &operator=(const CallLogReader &);
+
+    const uchar *take(size_t length)
+    {
+        if (pos + length > buffer.size())
+            CV_Error(cv::Error::StsParseError, "truncated call record");
+        const uchar *p = buffer.data() + pos;
+        pos += length;
+        return p;
+    }
+
+    template <typename T>
+    T get()
+    {
+        T value;
+        memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+};
+
+#endif
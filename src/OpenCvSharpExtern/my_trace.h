@@ -0,0 +1,283 @@
+// Timeline tracing of native calls
+
+#ifndef _MY_TRACE_H_
+#define _MY_TRACE_H_
+
+#include <opencv2/opencv.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#ifdef OPENCVSHARP_EXPORT_PROFILING
+#include <dlfcn.h>
+#endif
+
+// Records spans into memory while active and writes them as Chrome trace-event JSON
+// (chrome://tracing, ui.perfetto.dev) on flush. Spans come from
+// - every export, in builds with export profiling (core_ExportProfiler.h),
+// - named regions opened by the caller (core_Trace_beginRegion / endRegion),
+// - the tasks of parallel_for_ loops run through tracedParallelFor.
+class NativeTrace
+{
+public:
+    struct Event
+    {
+        const char *name;       // interned or static; NULL: resolve function
+        const void *function;
+        const char *category;
+        int64 start;            // ns since start()
+        int64 duration;
+        int rangeStart;         // task range of parallel_for_ spans (rangeStart < rangeEnd)
+        int rangeEnd;
+        unsigned int thread;
+        char phase;             // 'X': complete, 'B': begin, 'E': end
+    };
+
+    static NativeTrace *instance()
+    {
+        // never destroyed: spans may still be recorded during process exit
+        static NativeTrace *trace = new NativeTrace();
+        return trace;
+    }
+
+    bool isActive() const
+    {
+        return active.load(std::memory_order_relaxed);
+    }
+
+    // Discards the recorded events and starts recording; flush() writes to path
+    void start(const std::string &path, size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        this->path = path;
+        this->capacity = capacity;
+        events.clear();
+        dropped = 0;
+        origin = now();
+        active.store(true);
+    }
+
+    // Stops recording; the recorded events are kept for flush()
+    void stop()
+    {
+        active.store(false);
+    }
+
+    // Writes every event recorded since start(). Returns the number of events written, -1 if the file cannot be written.
+    int flush()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        FILE *fp = fopen(path.c_str(), "w");
+        if (fp == NULL)
+            return -1;
+
+        fprintf(fp, "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"droppedEvents\":%llu},\"traceEvents\":[\n",
+            static_cast<unsigned long long>(dropped));
+        fprintf(fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"OpenCvSharpExtern\"}}");
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            const Event &e = events[i];
+            std::string name = (e.name != NULL) ? std::string(e.name) : functionName(e.function);
+            fprintf(fp, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"%c\",\"pid\":1,\"tid\":%u,\"ts\":%.3f",
+                escape(name).c_str(), e.category, e.phase, e.thread, e.start / 1000.0);
+            if (e.phase == 'X')
+                fprintf(fp, ",\"dur\":%.3f", e.duration / 1000.0);
+            if (e.rangeStart < e.rangeEnd)
+                fprintf(fp, ",\"args\":{\"begin\":%d,\"end\":%d}", e.rangeStart, e.rangeEnd);
+            fputc('}', fp);
+        }
+        fprintf(fp, "\n]}\n");
+        const bool ok = ferror(fp) == 0;
+        fclose(fp);
+        return ok ? static_cast<int>(events.size()) : -1;
+    }
+
+    // Records a span which ran from start to end (values of now())
+    void complete(const char *category, const char *name, const void *function, int64 start, int64 end,
+        int rangeStart = 0, int rangeEnd = 0)
+    {
+        Event e;
+        e.name = name;
+        e.function = function;
+        e.category = category;
+        e.start = start;
+        e.duration = end - start;
+        e.rangeStart = rangeStart;
+        e.rangeEnd = rangeEnd;
+        e.phase = 'X';
+        add(e);
+    }
+
+    // Opens a region on the calling thread; regions nest and are closed by endRegion() on the same thread
+    void beginRegion(const std::string &name)
+    {
+        Event e = Event();
+        e.name = intern(name);
+        e.category = "region";
+        e.start = now();
+        e.phase = 'B';
+        add(e);
+    }
+
+    void endRegion()
+    {
+        Event e = Event();
+        e.name = "";
+        e.category = "region";
+        e.start = now();
+        e.phase = 'E';
+        add(e);
+    }
+
+    static int64 now()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+private:
+    std::atomic<bool> active;
+    std::mutex mutex;
+    std::vector<Event> events;
+    std::set<std::string> names;
+    std::string path;
+    size_t capacity;
+    uint64 dropped;
+    int64 origin;
+
+    NativeTrace()
+        : active(false), capacity(0), dropped(0), origin(0)
+    {
+    }
+
+    void add(Event &e)
+    {
+        e.thread = threadId();
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!active.load(std::memory_order_relaxed))
+            return;
+        if (events.size() >= capacity)
+        {
+            dropped++;
+            return;
+        }
+        e.start -= origin;
+        events.push_back(e);
+    }
+
+    const char *intern(const std::string &name)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return names.insert(name).first->c_str();
+    }
+
+    // Small sequential ids instead of OS thread ids, numbered in order of the first recorded span
+    static unsigned int threadId()
+    {
+        static std::atomic<unsigned int> next(1);
+        static thread_local unsigned int id = 0;
+        if (id == 0)
+            id = next.fetch_add(1);
+        return id;
+    }
+
+    static std::string functionName(const void *function)
+    {
+        char buf[32];
+#ifdef OPENCVSHARP_EXPORT_PROFILING
+        Dl_info info;
+        if (dladdr(function, &info) != 0 && info.dli_sname != NULL && info.dli_saddr == function)
+            return info.dli_sname;
+#endif
+        snprintf(buf, sizeof(buf), "%p", function);
+        return buf;
+    }
+
+    static std::string escape(const std::string &s)
+    {
+        std::string ret;
+        for (size_t i = 0; i < s.size(); i++)
+        {
+            const unsigned char c = static_cast<unsigned char>(s[i]);
+            if (c == '"' || c == '\\')
+            {
+                ret += '\\';
+                ret += static_cast<char>(c);
+            }
+            else if (c < 0x20)
+            {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", c);
+                ret += buf;
+            }
+            else
+            {
+                ret += static_cast<char>(c);
+            }
+        }
+        return ret;
+    }
+};
+
+// Records the lifetime of the object as a span, if tracing was active when it was created
+class TraceSpan
+{
+public:
+    TraceSpan(const char *category, const char *name, int rangeStart = 0, int rangeEnd = 0)
+        : category(category), name(name), rangeStart(rangeStart), rangeEnd(rangeEnd),
+          start(NativeTrace::instance()->isActive() ? NativeTrace::now() : 0)
+    {
+    }
+
+    ~TraceSpan()
+    {
+        if (start != 0)
+            NativeTrace::instance()->complete(category, name, NULL, start, NativeTrace::now(), rangeStart, rangeEnd);
+    }
+
+private:
+    const char *category;
+    const char *name;
+    int rangeStart, rangeEnd;
+    int64 start;
+
+    TraceSpan(const TraceSpan &);
+    TraceSpan &operator=(const TraceSpan &);
+};
+
+// cv::parallel_for_ which records one "task" span per range executed by a worker while tracing is active
+static void tracedParallelFor(const char *name, const cv::Range &range, const cv::ParallelLoopBody &body, double nstripes = -1.)
+{
+    class TracedBody : public cv::ParallelLoopBody
+    {
+    public:
+        TracedBody(const char *name, const cv::ParallelLoopBody &body)
+            : name(name), body(body)
+        {
+        }
+
+        void operator()(const cv::Range &r) const CV_OVERRIDE
+        {
+            TraceSpan span("task", name, r.start, r.end);
+            body(r);
+        }
+
+    private:
+        const char *name;
+        const cv::ParallelLoopBody &body;
+    };
+
+    if (!NativeTrace::instance()->isActive())
+    {
+        cv::parallel_for_(range, body, nstripes);
+        return;
+    }
+    TraceSpan span("parallel_for", name, range.start, range.end);
+    cv::parallel_for_(range, TracedBody(name, body), nstripes);
+}
+
+#endif
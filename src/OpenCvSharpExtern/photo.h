@@ -22,6 +22,28 @@ CVAPI(void) photo_fastNlMeansDenoisingColored(cv::_InputArray *src, cv::_OutputA
     cv::fastNlMeansDenoisingColored(*src, *dst, h, hColor, templateWindowSize, searchWindowSize);
 }
 
+CVAPI(cv::Ptr<NativeJob>*) photo_fastNlMeansDenoising_job(cv::_InputArray *src, float h,
+    int templateWindowSize, int searchWindowSize)
+{
+    const cv::Mat srcMat = NativeJob::retain(src->getMat());
+    return newJob("photo_fastNlMeansDenoising", [=](NativeJob &job)
+    {
+        job.results().resize(1);
+        cv::fastNlMeansDenoising(srcMat, job.results()[0], h, templateWindowSize, searchWindowSize);
+    });
+}
+
+CVAPI(cv::Ptr<NativeJob>*) photo_fastNlMeansDenoisingColored_job(cv::_InputArray *src,
+    float h, float hColor, int templateWindowSize, int searchWindowSize)
+{
+    const cv::Mat srcMat = NativeJob::retain(src->getMat());
+    return newJob("photo_fastNlMeansDenoisingColored", [=](NativeJob &job)
+    {
+        job.results().resize(1);
+        cv::fastNlMeansDenoisingColored(srcMat, job.results()[0], h, hColor, templateWindowSize, searchWindowSize);
+    });
+}
+
 CVAPI(void) photo_fastNlMeansDenoisingMulti(cv::_InputArray ** srcImgs, int srcImgsLength, 
     cv::_OutputArray *dst, int imgToDenoiseIndex, int temporalWindowSize,
     float h, int templateWindowSize, int searchWindowSize)
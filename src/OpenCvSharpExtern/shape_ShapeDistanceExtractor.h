@@ -15,7 +15,7 @@ CVAPI(float) shape_ShapeDistanceExtractor_computeDistance(
 CVAPI(void) shape_Ptr_ShapeContextDistanceExtractor_delete(
     cv::Ptr<cv::ShapeContextDistanceExtractor> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 CVAPI(cv::ShapeContextDistanceExtractor*) shape_Ptr_ShapeContextDistanceExtractor_get(
     cv::Ptr<cv::ShapeContextDistanceExtractor> *obj)
@@ -176,7 +176,7 @@ CVAPI(cv::Ptr<cv::ShapeContextDistanceExtractor>*) shape_createShapeContextDista
 {
     cv::Ptr<cv::ShapeContextDistanceExtractor> p = cv::createShapeContextDistanceExtractor(
         nAngularBins, nRadialBins, innerRadius, outerRadius, iterations);
-    return new cv::Ptr<cv::ShapeContextDistanceExtractor>(p);
+    return trackHandle(new cv::Ptr<cv::ShapeContextDistanceExtractor>(p));
 }
 
 #pragma endregion
@@ -186,7 +186,7 @@ CVAPI(cv::Ptr<cv::ShapeContextDistanceExtractor>*) shape_createShapeContextDista
 CVAPI(void) shape_Ptr_HausdorffDistanceExtractor_delete(
     cv::Ptr<cv::HausdorffDistanceExtractor> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 CVAPI(cv::HausdorffDistanceExtractor*) shape_Ptr_HausdorffDistanceExtractor_get(
     cv::Ptr<cv::HausdorffDistanceExtractor> *obj)
@@ -223,7 +223,7 @@ CVAPI(cv::Ptr<cv::HausdorffDistanceExtractor>*) shape_createHausdorffDistanceExt
 {
     cv::Ptr<cv::HausdorffDistanceExtractor> p = cv::createHausdorffDistanceExtractor(
         distanceFlag, rankProp);
-    return new cv::Ptr<cv::HausdorffDistanceExtractor>(p);
+    return trackHandle(new cv::Ptr<cv::HausdorffDistanceExtractor>(p));
 }
 
 #pragma endregion
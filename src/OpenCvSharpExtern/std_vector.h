@@ -11,26 +11,80 @@ static void copyFromVectorToArray(std::vector<std::vector<T> > *src, T **dst)
     for (size_t i = 0; i < src->size(); ++i)
     {
         const auto& srcI = src->at(i);
-        const auto dstI = dst[i];
-        for (size_t j = 0; j < srcI.size(); ++j)
-        {
-            dstI[j] = srcI[j];
-        }
+        std::copy(srcI.begin(), srcI.end(), dst[i]);
     }
 }
 
+template <typename T>
+static size_t getTotalSizeOfVector(std::vector<std::vector<T> > *src)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < src->size(); ++i)
+        total += (*src)[i].size();
+    return total;
+}
+
+// CSR export: the rows are stored back to back in data (getTotalSizeOfVector elements) and
+// offsets (size() + 1 entries) receives the index of the first element of every row followed by the total.
+template <typename T>
+static void copyFromVectorToFlatArray(std::vector<std::vector<T> > *src, T *data, int *offsets)
+{
+    // checked before anything is written: every offset must fit in an int
+    CV_Assert(getTotalSizeOfVector(src) <= static_cast<size_t>(INT_MAX));
+    size_t offset = 0;
+    for (size_t i = 0; i < src->size(); ++i)
+    {
+        const auto& srcI = (*src)[i];
+        offsets[i] = static_cast<int>(offset);
+        if (!srcI.empty())
+            memcpy(data + offset, &srcI[0], sizeof(T) * srcI.size());
+        offset += srcI.size();
+    }
+    offsets[src->size()] = static_cast<int>(offset);
+}
+
+// Storage moved out of a std::vector by vector_*_detach; owned by the caller until vector_detached_delete.
+class DetachedVectorBase
+{
+public:
+    virtual ~DetachedVectorBase() {}
+};
+
+template <typename T>
+class DetachedVector : public DetachedVectorBase
+{
+public:
+    std::vector<T> storage;
+};
+
+// Takes over the elements of src in O(1) (src becomes empty) and returns their address and count
+template <typename T>
+static DetachedVectorBase *detachVector(std::vector<T> *src, T **data, size_t *size)
+{
+    DetachedVector<T> *detached = new DetachedVector<T>();
+    detached->storage.swap(*src);
+    *data = detached->storage.empty() ? NULL : &detached->storage[0];
+    *size = detached->storage.size();
+    return detached;
+}
+
+CVAPI(void) vector_detached_delete(DetachedVectorBase *obj)
+{
+    delete obj;
+}
+
 #pragma region uchar
 CVAPI(std::vector<uchar>*) vector_uchar_new1()
 {
-    return new std::vector<uchar>;
+    return trackHandle(new std::vector<uchar>);
 }
 CVAPI(std::vector<uchar>*) vector_uchar_new2(size_t size)
 {
-    return new std::vector<uchar>(size);
+    return trackHandle(new std::vector<uchar>(size));
 }
 CVAPI(std::vector<uchar>*) vector_uchar_new3(uchar* data, size_t dataLength)
 {
-    return new std::vector<uchar>(data, data + dataLength);
+    return trackHandle(new std::vector<uchar>(data, data + dataLength));
 }
 CVAPI(size_t) vector_uchar_getSize(std::vector<uchar>* vector)
 {
@@ -45,24 +99,28 @@ CVAPI(void) vector_vector_uchar_copy(std::vector<uchar> *vector, uchar *dst)
     const size_t length = sizeof(uchar)* vector->size();
     memcpy(dst, &(vector->at(0)), length);
 }
+CVAPI(DetachedVectorBase*) vector_uchar_detach(std::vector<uchar> *vector, uchar **data, size_t *size)
+{
+    return detachVector(vector, data, size);
+}
 CVAPI(void) vector_uchar_delete(std::vector<uchar>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region char
 CVAPI(std::vector<char>*) vector_char_new1()
 {
-    return new std::vector<char>;
+    return trackHandle(new std::vector<char>);
 }
 CVAPI(std::vector<char>*) vector_char_new2(size_t size)
 {
-    return new std::vector<char>(size);
+    return trackHandle(new std::vector<char>(size));
 }
 CVAPI(std::vector<char>*) vector_char_new3(char* data, size_t dataLength)
 {
-    return new std::vector<char>(data, data + dataLength);
+    return trackHandle(new std::vector<char>(data, data + dataLength));
 }
 CVAPI(size_t) vector_char_getSize(std::vector<char>* vector)
 {
@@ -79,22 +137,22 @@ CVAPI(void) vector_vector_char_copy(std::vector<char> *vector, char *dst)
 }
 CVAPI(void) vector_char_delete(std::vector<char>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region int
 CVAPI(std::vector<int>*) vector_int32_new1()
 {
-    return new std::vector<int>;
+    return trackHandle(new std::vector<int>);
 }
 CVAPI(std::vector<int>*) vector_int32_new2(size_t size)
 {
-    return new std::vector<int>(size);
+    return trackHandle(new std::vector<int>(size));
 }
 CVAPI(std::vector<int>*) vector_int32_new3(int* data, size_t dataLength)
 {
-    return new std::vector<int>(data, data + dataLength);
+    return trackHandle(new std::vector<int>(data, data + dataLength));
 }
 CVAPI(size_t) vector_int32_getSize(std::vector<int>* vector)
 {
@@ -106,22 +164,22 @@ CVAPI(int*) vector_int32_getPointer(std::vector<int>* vector)
 }
 CVAPI(void) vector_int32_delete(std::vector<int>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region float
 CVAPI(std::vector<float>*) vector_float_new1()
 {
-    return new std::vector<float>;
+    return trackHandle(new std::vector<float>);
 }
 CVAPI(std::vector<float>*) vector_float_new2(size_t size)
 {
-    return new std::vector<float>(size);
+    return trackHandle(new std::vector<float>(size));
 }
 CVAPI(std::vector<float>*) vector_float_new3(float* data, size_t dataLength)
 {
-    return new std::vector<float>(data, data + dataLength);
+    return trackHandle(new std::vector<float>(data, data + dataLength));
 }
 CVAPI(size_t) vector_float_getSize(std::vector<float>* vector)
 {
@@ -133,22 +191,22 @@ CVAPI(float*) vector_float_getPointer(std::vector<float>* vector)
 }
 CVAPI(void) vector_float_delete(std::vector<float>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region double
 CVAPI(std::vector<double>*) vector_double_new1()
 {
-    return new std::vector<double>;
+    return trackHandle(new std::vector<double>);
 }
 CVAPI(std::vector<double>*) vector_double_new2(size_t size)
 {
-    return new std::vector<double>(size);
+    return trackHandle(new std::vector<double>(size));
 }
 CVAPI(std::vector<double>*) vector_double_new3(double* data, size_t dataLength)
 {
-    return new std::vector<double>(data, data + dataLength);
+    return trackHandle(new std::vector<double>(data, data + dataLength));
 }
 CVAPI(size_t) vector_double_getSize(std::vector<double>* vector)
 {
@@ -160,22 +218,22 @@ CVAPI(double*) vector_double_getPointer(std::vector<double>* vector)
 }
 CVAPI(void) vector_double_delete(std::vector<double>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Vec2f
 CVAPI(std::vector<cv::Vec2f>*) vector_Vec2f_new1()
 {
-    return new std::vector<cv::Vec2f>;
+    return trackHandle(new std::vector<cv::Vec2f>);
 }
 CVAPI(std::vector<cv::Vec2f>*) vector_Vec2f_new2(size_t size)
 {
-    return new std::vector<cv::Vec2f>(size);
+    return trackHandle(new std::vector<cv::Vec2f>(size));
 }
 CVAPI(std::vector<cv::Vec2f>*) vector_Vec2f_new3(cv::Vec2f* data, size_t dataLength)
 {
-    return new std::vector<cv::Vec2f>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Vec2f>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Vec2f_getSize(std::vector<cv::Vec2f>* vector)
 {
@@ -187,22 +245,22 @@ CVAPI(cv::Vec2f*) vector_Vec2f_getPointer(std::vector<cv::Vec2f>* vector)
 }
 CVAPI(void) vector_Vec2f_delete(std::vector<cv::Vec2f>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Vec3f
 CVAPI(std::vector<cv::Vec3f>*) vector_Vec3f_new1()
 {
-    return new std::vector<cv::Vec3f>;
+    return trackHandle(new std::vector<cv::Vec3f>);
 }
 CVAPI(std::vector<cv::Vec3f>*) vector_Vec3f_new2(size_t size)
 {
-    return new std::vector<cv::Vec3f>(size);
+    return trackHandle(new std::vector<cv::Vec3f>(size));
 }
 CVAPI(std::vector<cv::Vec3f>*) vector_Vec3f_new3(cv::Vec3f* data, size_t dataLength)
 {
-    return new std::vector<cv::Vec3f>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Vec3f>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Vec3f_getSize(std::vector<cv::Vec3f>* vector)
 {
@@ -214,22 +272,22 @@ CVAPI(cv::Vec3f*) vector_Vec3f_getPointer(std::vector<cv::Vec3f>* vector)
 }
 CVAPI(void) vector_Vec3f_delete(std::vector<cv::Vec3f>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Vec4f
 CVAPI(std::vector<cv::Vec4f>*) vector_Vec4f_new1()
 {
-    return new std::vector<cv::Vec4f>;
+    return trackHandle(new std::vector<cv::Vec4f>);
 }
 CVAPI(std::vector<cv::Vec4f>*) vector_Vec4f_new2(size_t size)
 {
-    return new std::vector<cv::Vec4f>(size);
+    return trackHandle(new std::vector<cv::Vec4f>(size));
 }
 CVAPI(std::vector<cv::Vec4f>*) vector_Vec4f_new3(cv::Vec4f* data, size_t dataLength)
 {
-    return new std::vector<cv::Vec4f>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Vec4f>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Vec4f_getSize(std::vector<cv::Vec4f>* vector)
 {
@@ -241,22 +299,22 @@ CVAPI(cv::Vec4f*) vector_Vec4f_getPointer(std::vector<cv::Vec4f>* vector)
 }
 CVAPI(void) vector_Vec4f_delete(std::vector<cv::Vec4f>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Vec4i
 CVAPI(std::vector<cv::Vec4i>*) vector_Vec4i_new1()
 {
-    return new std::vector<cv::Vec4i>;
+    return trackHandle(new std::vector<cv::Vec4i>);
 }
 CVAPI(std::vector<cv::Vec4i>*) vector_Vec4i_new2(size_t size)
 {
-    return new std::vector<cv::Vec4i>(size);
+    return trackHandle(new std::vector<cv::Vec4i>(size));
 }
 CVAPI(std::vector<cv::Vec4i>*) vector_Vec4i_new3(cv::Vec4i* data, size_t dataLength)
 {
-    return new std::vector<cv::Vec4i>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Vec4i>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Vec4i_getSize(std::vector<cv::Vec4i>* vector)
 {
@@ -268,22 +326,22 @@ CVAPI(cv::Vec4i*) vector_Vec4i_getPointer(std::vector<cv::Vec4i>* vector)
 }
 CVAPI(void) vector_Vec4i_delete(std::vector<cv::Vec4i>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Vec6f
 CVAPI(std::vector<cv::Vec6f>*) vector_Vec6f_new1()
 {
-    return new std::vector<cv::Vec6f>;
+    return trackHandle(new std::vector<cv::Vec6f>);
 }
 CVAPI(std::vector<cv::Vec6f>*) vector_Vec6f_new2(size_t size)
 {
-    return new std::vector<cv::Vec6f>(size);
+    return trackHandle(new std::vector<cv::Vec6f>(size));
 }
 CVAPI(std::vector<cv::Vec6f>*) vector_Vec6f_new3(cv::Vec6f* data, size_t dataLength)
 {
-    return new std::vector<cv::Vec6f>(data, data + dataLength);;
+    return trackHandle(new std::vector<cv::Vec6f>(data, data + dataLength));;
 }
 CVAPI(size_t) vector_Vec6f_getSize(std::vector<cv::Vec6f>* vector)
 {
@@ -295,22 +353,22 @@ CVAPI(cv::Vec6f*) vector_Vec6f_getPointer(std::vector<cv::Vec6f>* vector)
 }
 CVAPI(void) vector_Vec6f_delete(std::vector<cv::Vec6f>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Vec6d
 CVAPI(std::vector<cv::Vec6d>*) vector_Vec6d_new1()
 {
-    return new std::vector<cv::Vec6d>;
+    return trackHandle(new std::vector<cv::Vec6d>);
 }
 CVAPI(std::vector<cv::Vec6d>*) vector_Vec6d_new2(size_t size)
 {
-    return new std::vector<cv::Vec6d>(size);
+    return trackHandle(new std::vector<cv::Vec6d>(size));
 }
 CVAPI(std::vector<cv::Vec6d>*) vector_Vec6d_new3(cv::Vec6d* data, size_t dataLength)
 {
-    return new std::vector<cv::Vec6d>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Vec6d>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Vec6d_getSize(std::vector<cv::Vec6d>* vector)
 {
@@ -322,22 +380,22 @@ CVAPI(cv::Vec6d*) vector_Vec6d_getPointer(std::vector<cv::Vec6d>* vector)
 }
 CVAPI(void) vector_Vec6d_delete(std::vector<cv::Vec6d>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Point2i
 CVAPI(std::vector<cv::Point>*) vector_Point2i_new1()
 {
-    return new std::vector<cv::Point>;
+    return trackHandle(new std::vector<cv::Point>);
 }
 CVAPI(std::vector<cv::Point>*) vector_Point2i_new2(size_t size)
 {
-    return new std::vector<cv::Point>(size);
+    return trackHandle(new std::vector<cv::Point>(size));
 }
 CVAPI(std::vector<cv::Point>*) vector_Point2i_new3(cv::Point* data, size_t dataLength)
 {
-    return new std::vector<cv::Point>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Point>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Point2i_getSize(std::vector<cv::Point>* vector)
 {
@@ -349,22 +407,22 @@ CVAPI(cv::Point*) vector_Point2i_getPointer(std::vector<cv::Point>* vector)
 }
 CVAPI(void) vector_Point2i_delete(std::vector<cv::Point>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Point2f
 CVAPI(std::vector<cv::Point2f>*) vector_Point2f_new1()
 {
-    return new std::vector<cv::Point2f>;
+    return trackHandle(new std::vector<cv::Point2f>);
 }
 CVAPI(std::vector<cv::Point2f>*) vector_Point2f_new2(size_t size)
 {
-    return new std::vector<cv::Point2f>(size);
+    return trackHandle(new std::vector<cv::Point2f>(size));
 }
 CVAPI(std::vector<cv::Point2f>*) vector_Point2f_new3(cv::Point2f* data, size_t dataLength)
 {
-    return new std::vector<cv::Point2f>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Point2f>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Point2f_getSize(std::vector<cv::Point2f>* vector)
 {
@@ -374,24 +432,28 @@ CVAPI(cv::Point2f*) vector_Point2f_getPointer(std::vector<cv::Point2f>* vector)
 {
     return &(vector->at(0));
 }
+CVAPI(DetachedVectorBase*) vector_Point2f_detach(std::vector<cv::Point2f> *vector, cv::Point2f **data, size_t *size)
+{
+    return detachVector(vector, data, size);
+}
 CVAPI(void) vector_Point2f_delete(std::vector<cv::Point2f>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Point3f
 CVAPI(std::vector<cv::Point3f>*) vector_Point3f_new1()
 {
-    return new std::vector<cv::Point3f>;
+    return trackHandle(new std::vector<cv::Point3f>);
 }
 CVAPI(std::vector<cv::Point3f>*) vector_Point3f_new2(size_t size)
 {
-    return new std::vector<cv::Point3f>(size);
+    return trackHandle(new std::vector<cv::Point3f>(size));
 }
 CVAPI(std::vector<cv::Point3f>*) vector_Point3f_new3(cv::Point3f* data, size_t dataLength)
 {
-    return new std::vector<cv::Point3f>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Point3f>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Point3f_getSize(std::vector<cv::Point3f>* vector)
 {
@@ -403,22 +465,22 @@ CVAPI(cv::Point3f*) vector_Point3f_getPointer(std::vector<cv::Point3f>* vector)
 }
 CVAPI(void) vector_Point3f_delete(std::vector<cv::Point3f>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Rect
 CVAPI(std::vector<cv::Rect>*) vector_Rect_new1()
 {
-    return new std::vector<cv::Rect>;
+    return trackHandle(new std::vector<cv::Rect>);
 }
 CVAPI(std::vector<cv::Rect>*) vector_Rect_new2(size_t size)
 {
-    return new std::vector<cv::Rect>(size);
+    return trackHandle(new std::vector<cv::Rect>(size));
 }
 CVAPI(std::vector<cv::Rect>*) vector_Rect_new3(cv::Rect* data, size_t dataLength)
 {
-    return new std::vector<cv::Rect>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Rect>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Rect_getSize(std::vector<cv::Rect>* vector)
 {
@@ -431,7 +493,7 @@ CVAPI(cv::Rect*) vector_Rect_getPointer(std::vector<cv::Rect> *vector)
 CVAPI(void) vector_Rect_delete(std::vector<cv::Rect> *vector)
 {    
     //vector->~vector();
-    delete vector;
+    deleteHandle(vector);
 }
 
 #pragma endregion
@@ -439,15 +501,15 @@ CVAPI(void) vector_Rect_delete(std::vector<cv::Rect> *vector)
 #pragma region cv::Rect2d
 CVAPI(std::vector<cv::Rect2d>*) vector_Rect2d_new1()
 {
-    return new std::vector<cv::Rect2d>;
+    return trackHandle(new std::vector<cv::Rect2d>);
 }
 CVAPI(std::vector<cv::Rect2d>*) vector_Rect2d_new2(size_t size)
 {
-    return new std::vector<cv::Rect2d>(size);
+    return trackHandle(new std::vector<cv::Rect2d>(size));
 }
 CVAPI(std::vector<cv::Rect2d>*) vector_Rect2d_new3(cv::Rect2d* data, size_t dataLength)
 {
-    return new std::vector<cv::Rect2d>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::Rect2d>(data, data + dataLength));
 }
 CVAPI(size_t) vector_Rect2d_getSize(std::vector<cv::Rect2d>* vector)
 {
@@ -459,7 +521,7 @@ CVAPI(cv::Rect2d*) vector_Rect2d_getPointer(std::vector<cv::Rect2d> *vector)
 }
 CVAPI(void) vector_Rect2d_delete(std::vector<cv::Rect2d> *vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 
 #pragma endregion
@@ -467,15 +529,15 @@ CVAPI(void) vector_Rect2d_delete(std::vector<cv::Rect2d> *vector)
 #pragma region cv::RotatedRect
 CVAPI(std::vector<cv::RotatedRect>*) vector_RotatedRect_new1()
 {
-    return new std::vector<cv::RotatedRect>;
+    return trackHandle(new std::vector<cv::RotatedRect>);
 }
 CVAPI(std::vector<cv::RotatedRect>*) vector_RotatedRect_new2(size_t size)
 {
-    return new std::vector<cv::RotatedRect>(size);
+    return trackHandle(new std::vector<cv::RotatedRect>(size));
 }
 CVAPI(std::vector<cv::RotatedRect>*) vector_RotatedRect_new3(cv::RotatedRect* data, size_t dataLength)
 {
-    return new std::vector<cv::RotatedRect>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::RotatedRect>(data, data + dataLength));
 }
 CVAPI(size_t) vector_RotatedRect_getSize(std::vector<cv::RotatedRect>* vector)
 {
@@ -487,7 +549,7 @@ CVAPI(cv::RotatedRect*) vector_RotatedRect_getPointer(std::vector<cv::RotatedRec
 }
 CVAPI(void) vector_RotatedRect_delete(std::vector<cv::RotatedRect> *vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 
 #pragma endregion
@@ -495,15 +557,15 @@ CVAPI(void) vector_RotatedRect_delete(std::vector<cv::RotatedRect> *vector)
 #pragma region cv::KeyPoint
 CVAPI(std::vector<cv::KeyPoint>*) vector_KeyPoint_new1()
 {
-    return new std::vector<cv::KeyPoint>;
+    return trackHandle(new std::vector<cv::KeyPoint>);
 }
 CVAPI(std::vector<cv::KeyPoint>*) vector_KeyPoint_new2(size_t size)
 {
-    return new std::vector<cv::KeyPoint>(size);
+    return trackHandle(new std::vector<cv::KeyPoint>(size));
 }
 CVAPI(std::vector<cv::KeyPoint>*) vector_KeyPoint_new3(cv::KeyPoint *data, size_t dataLength)
 {
-    return new std::vector<cv::KeyPoint>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::KeyPoint>(data, data + dataLength));
 }
 CVAPI(size_t) vector_KeyPoint_getSize(std::vector<cv::KeyPoint>* vector)
 {
@@ -513,25 +575,29 @@ CVAPI(cv::KeyPoint*) vector_KeyPoint_getPointer(std::vector<cv::KeyPoint>* vecto
 {
     return &(vector->at(0));
 }
+CVAPI(DetachedVectorBase*) vector_KeyPoint_detach(std::vector<cv::KeyPoint> *vector, cv::KeyPoint **data, size_t *size)
+{
+    return detachVector(vector, data, size);
+}
 CVAPI(void) vector_KeyPoint_delete(std::vector<cv::KeyPoint>* vector)
 {    
     //vector->~vector();
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::DMatch
 CVAPI(std::vector<cv::DMatch>*) vector_DMatch_new1()
 {
-    return new std::vector<cv::DMatch>;
+    return trackHandle(new std::vector<cv::DMatch>);
 }
 CVAPI(std::vector<cv::DMatch>*) vector_DMatch_new2(size_t size)
 {
-    return new std::vector<cv::DMatch>(size);
+    return trackHandle(new std::vector<cv::DMatch>(size));
 }
 CVAPI(std::vector<cv::DMatch>*) vector_DMatch_new3(cv::DMatch *data, size_t dataLength)
 {
-    return new std::vector<cv::DMatch>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::DMatch>(data, data + dataLength));
 }
 CVAPI(size_t) vector_DMatch_getSize(std::vector<cv::DMatch>* vector)
 {
@@ -541,20 +607,24 @@ CVAPI(cv::DMatch*) vector_DMatch_getPointer(std::vector<cv::DMatch>* vector)
 {
     return &(vector->at(0));
 }
+CVAPI(DetachedVectorBase*) vector_DMatch_detach(std::vector<cv::DMatch> *vector, cv::DMatch **data, size_t *size)
+{
+    return detachVector(vector, data, size);
+}
 CVAPI(void) vector_DMatch_delete(std::vector<cv::DMatch>* vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region vector<int>
 CVAPI(std::vector<std::vector<int> >*) vector_vector_int_new1()
 {
-    return new std::vector<std::vector<int> >;
+    return trackHandle(new std::vector<std::vector<int> >);
 }
 CVAPI(std::vector<std::vector<int> >*) vector_vector_int_new2(size_t size)
 {
-    return new std::vector<std::vector<int> >(size);
+    return trackHandle(new std::vector<std::vector<int> >(size));
 }
 CVAPI(size_t) vector_vector_int_getSize1(std::vector<std::vector<int> >* vec)
 {
@@ -581,20 +651,28 @@ CVAPI(void) vector_vector_int_copy(std::vector<std::vector<int> > *vec, int **ds
         memcpy(dst[i], src, length);
     }
 }
+CVAPI(size_t) vector_vector_int_getTotalSize(std::vector<std::vector<int> > *vec)
+{
+    return getTotalSizeOfVector(vec);
+}
+CVAPI(void) vector_vector_int_copyFlat(std::vector<std::vector<int> > *vec, int *data, int *offsets)
+{
+    copyFromVectorToFlatArray(vec, data, offsets);
+}
 CVAPI(void) vector_vector_int_delete(std::vector<std::vector<int> >* vec)
 {
-    delete vec;
+    deleteHandle(vec);
 }
 #pragma endregion
 
 #pragma region vector<float>
 CVAPI(std::vector<std::vector<float> >*) vector_vector_float_new1()
 {
-    return new std::vector<std::vector<float> >;
+    return trackHandle(new std::vector<std::vector<float> >);
 }
 CVAPI(std::vector<std::vector<float> >*) vector_vector_float_new2(size_t size)
 {
-    return new std::vector<std::vector<float> >(size);
+    return trackHandle(new std::vector<std::vector<float> >(size));
 }
 CVAPI(size_t) vector_vector_float_getSize1(std::vector<std::vector<float> >* vec)
 {
@@ -621,20 +699,28 @@ CVAPI(void) vector_vector_float_copy(std::vector<std::vector<float> > *vec, floa
         memcpy(dst[i], src, length);
     }
 }
+CVAPI(size_t) vector_vector_float_getTotalSize(std::vector<std::vector<float> > *vec)
+{
+    return getTotalSizeOfVector(vec);
+}
+CVAPI(void) vector_vector_float_copyFlat(std::vector<std::vector<float> > *vec, float *data, int *offsets)
+{
+    copyFromVectorToFlatArray(vec, data, offsets);
+}
 CVAPI(void) vector_vector_float_delete(std::vector<std::vector<float> >* vec)
 {
-    delete vec;
+    deleteHandle(vec);
 }
 #pragma endregion
 
 #pragma region vector<double>
 CVAPI(std::vector<std::vector<double> >*) vector_vector_double_new1()
 {
-    return new std::vector<std::vector<double> >;
+    return trackHandle(new std::vector<std::vector<double> >);
 }
 CVAPI(std::vector<std::vector<double> >*) vector_vector_double_new2(size_t size)
 {
-    return new std::vector<std::vector<double> >(size);
+    return trackHandle(new std::vector<std::vector<double> >(size));
 }
 CVAPI(size_t) vector_vector_double_getSize1(std::vector<std::vector<double> >* vec)
 {
@@ -661,25 +747,33 @@ CVAPI(void) vector_vector_double_copy(std::vector<std::vector<double> > *vec, do
         memcpy(dst[i], src, length);
     }
 }
+CVAPI(size_t) vector_vector_double_getTotalSize(std::vector<std::vector<double> > *vec)
+{
+    return getTotalSizeOfVector(vec);
+}
+CVAPI(void) vector_vector_double_copyFlat(std::vector<std::vector<double> > *vec, double *data, int *offsets)
+{
+    copyFromVectorToFlatArray(vec, data, offsets);
+}
 CVAPI(void) vector_vector_double_delete(std::vector<std::vector<double> >* vec)
 {
-    delete vec;
+    deleteHandle(vec);
 }
 #pragma endregion
 
 #pragma region vector<cv::KeyPoint>
 CVAPI(std::vector<std::vector<cv::KeyPoint> >*) vector_vector_KeyPoint_new1()
 {
-    return new std::vector<std::vector<cv::KeyPoint> >;
+    return trackHandle(new std::vector<std::vector<cv::KeyPoint> >);
 }
 CVAPI(std::vector<std::vector<cv::KeyPoint> >*) vector_vector_KeyPoint_new2(size_t size)
 {
-    return new std::vector<std::vector<cv::KeyPoint> >(size);
+    return trackHandle(new std::vector<std::vector<cv::KeyPoint> >(size));
 }
 CVAPI(std::vector<std::vector<cv::KeyPoint> >*) vector_vector_KeyPoint_new3(
     cv::KeyPoint **values, int size1, int *size2)
 {
-    std::vector<std::vector<cv::KeyPoint> > *vec = new std::vector<std::vector<cv::KeyPoint> >(size1);
+    std::vector<std::vector<cv::KeyPoint> > *vec = trackHandle(new std::vector<std::vector<cv::KeyPoint> >(size1));
     for (int i = 0; i < size1; i++)
     {
         vec->at(i) = std::vector<cv::KeyPoint>(values[i], values[i] + size2[i]);
@@ -706,20 +800,28 @@ CVAPI(void) vector_vector_KeyPoint_copy(std::vector<std::vector<cv::KeyPoint> >
 {
     copyFromVectorToArray(vec, dst);
 }
+CVAPI(size_t) vector_vector_KeyPoint_getTotalSize(std::vector<std::vector<cv::KeyPoint> > *vec)
+{
+    return getTotalSizeOfVector(vec);
+}
+CVAPI(void) vector_vector_KeyPoint_copyFlat(std::vector<std::vector<cv::KeyPoint> > *vec, cv::KeyPoint *data, int *offsets)
+{
+    copyFromVectorToFlatArray(vec, data, offsets);
+}
 CVAPI(void) vector_vector_KeyPoint_delete(std::vector<std::vector<cv::KeyPoint> >* vec)
 {
-    delete vec;
+    deleteHandle(vec);
 }
 #pragma endregion
 
 #pragma region vector<cv::DMatch>
 CVAPI(std::vector<std::vector<cv::DMatch> >*) vector_vector_DMatch_new1()
 {
-    return new std::vector<std::vector<cv::DMatch> >;
+    return trackHandle(new std::vector<std::vector<cv::DMatch> >);
 }
 CVAPI(std::vector<std::vector<cv::DMatch> >*) vector_vector_DMatch_new2(size_t size)
 {
-    return new std::vector<std::vector<cv::DMatch> >(size);
+    return trackHandle(new std::vector<std::vector<cv::DMatch> >(size));
 }
 CVAPI(size_t) vector_vector_DMatch_getSize1(std::vector<std::vector<cv::DMatch> >* vec)
 {
@@ -740,20 +842,28 @@ CVAPI(void) vector_vector_DMatch_copy(std::vector<std::vector<cv::DMatch> > *vec
 {
     copyFromVectorToArray(vec, dst);
 }
+CVAPI(size_t) vector_vector_DMatch_getTotalSize(std::vector<std::vector<cv::DMatch> > *vec)
+{
+    return getTotalSizeOfVector(vec);
+}
+CVAPI(void) vector_vector_DMatch_copyFlat(std::vector<std::vector<cv::DMatch> > *vec, cv::DMatch *data, int *offsets)
+{
+    copyFromVectorToFlatArray(vec, data, offsets);
+}
 CVAPI(void) vector_vector_DMatch_delete(std::vector<std::vector<cv::DMatch> >* vec)
 {
-    delete vec;
+    deleteHandle(vec);
 }
 #pragma endregion
 
 #pragma region vector<cv::Point>
 CVAPI(std::vector<std::vector<cv::Point> >*) vector_vector_Point_new1()
 {
-    return new std::vector<std::vector<cv::Point> >;
+    return trackHandle(new std::vector<std::vector<cv::Point> >);
 }
 CVAPI(std::vector<std::vector<cv::Point> >*) vector_vector_Point_new2(size_t size)
 {
-    return new std::vector<std::vector<cv::Point> >(size);
+    return trackHandle(new std::vector<std::vector<cv::Point> >(size));
 }
 CVAPI(size_t) vector_vector_Point_getSize1(std::vector<std::vector<cv::Point> >* vec)
 {
@@ -774,20 +884,28 @@ CVAPI(void) vector_vector_Point_copy(std::vector<std::vector<cv::Point> > *vec,
 {
     copyFromVectorToArray(vec, dst);
 }
+CVAPI(size_t) vector_vector_Point_getTotalSize(std::vector<std::vector<cv::Point> > *vec)
+{
+    return getTotalSizeOfVector(vec);
+}
+CVAPI(void) vector_vector_Point_copyFlat(std::vector<std::vector<cv::Point> > *vec, cv::Point *data, int *offsets)
+{
+    copyFromVectorToFlatArray(vec, data, offsets);
+}
 CVAPI(void) vector_vector_Point_delete(std::vector<std::vector<cv::Point> >* vec)
 {
-    delete vec;
+    deleteHandle(vec);
 }
 #pragma endregion
 
 #pragma region vector<cv::Point2f>
 CVAPI(std::vector<std::vector<cv::Point2f> >*) vector_vector_Point2f_new1()
 {
-    return new std::vector<std::vector<cv::Point2f> >;
+    return trackHandle(new std::vector<std::vector<cv::Point2f> >);
 }
 CVAPI(std::vector<std::vector<cv::Point2f> >*) vector_vector_Point2f_new2(size_t size)
 {
-    return new std::vector<std::vector<cv::Point2f> >(size);
+    return trackHandle(new std::vector<std::vector<cv::Point2f> >(size));
 }
 CVAPI(size_t) vector_vector_Point2f_getSize1(std::vector<std::vector<cv::Point2f> >* vec)
 {
@@ -808,9 +926,17 @@ CVAPI(void) vector_vector_Point2f_copy(std::vector<std::vector<cv::Point2f> > *v
 {
     copyFromVectorToArray(vec, dst);
 }
+CVAPI(size_t) vector_vector_Point2f_getTotalSize(std::vector<std::vector<cv::Point2f> > *vec)
+{
+    return getTotalSizeOfVector(vec);
+}
+CVAPI(void) vector_vector_Point2f_copyFlat(std::vector<std::vector<cv::Point2f> > *vec, cv::Point2f *data, int *offsets)
+{
+    copyFromVectorToFlatArray(vec, data, offsets);
+}
 CVAPI(void) vector_vector_Point2f_delete(std::vector<std::vector<cv::Point2f> >* vec)
 {
-    delete vec;
+    deleteHandle(vec);
 }
 
 #pragma endregion
@@ -818,11 +944,11 @@ CVAPI(void) vector_vector_Point2f_delete(std::vector<std::vector<cv::Point2f> >*
 #pragma region std::string
 CVAPI(std::vector<std::string>*) vector_string_new1()
 {
-    return new std::vector<std::string>;
+    return trackHandle(new std::vector<std::string>);
 }
 CVAPI(std::vector<std::string>*) vector_string_new2(size_t size)
 {
-    return new std::vector<std::string>(size);
+    return trackHandle(new std::vector<std::string>(size));
 }
 CVAPI(size_t) vector_string_getSize(std::vector<std::string> *vec)
 {
@@ -838,22 +964,22 @@ CVAPI(const char*) vector_string_elemAt(std::vector<std::string> *vector, int i)
 }
 CVAPI(void) vector_string_delete(std::vector<std::string> *vector)
 {    
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::Mat
 CVAPI(std::vector<cv::Mat>*) vector_Mat_new1()
 {
-    return new std::vector<cv::Mat>;
+    return trackHandle(new std::vector<cv::Mat>);
 }
 CVAPI(std::vector<cv::Mat>*) vector_Mat_new2(uint32_t size)
 {
-    return new std::vector<cv::Mat>(size);
+    return trackHandle(new std::vector<cv::Mat>(size));
 }
 CVAPI(std::vector<cv::Mat>*) vector_Mat_new3(cv::Mat **data, uint32_t dataLength)
 {
-    const auto vec = new std::vector<cv::Mat>(dataLength);
+    const auto vec = trackHandle(new std::vector<cv::Mat>(dataLength));
     for (size_t i = 0; i < dataLength; i++)
     {
         (*vec)[i] = *(data[i]);
@@ -885,22 +1011,22 @@ CVAPI(void) vector_Mat_addref(std::vector<cv::Mat>* vector)
 CVAPI(void) vector_Mat_delete(std::vector<cv::Mat>* vector)
 {
     //vector->~vector();
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::ml::DTrees::Node
 CVAPI(std::vector<cv::ml::DTrees::Node>*) vector_DTrees_Node_new1()
 {
-    return new std::vector<cv::ml::DTrees::Node>;
+    return trackHandle(new std::vector<cv::ml::DTrees::Node>);
 }
 CVAPI(std::vector<cv::ml::DTrees::Node>*) vector_DTrees_Node_new2(size_t size)
 {
-    return new std::vector<cv::ml::DTrees::Node>(size);
+    return trackHandle(new std::vector<cv::ml::DTrees::Node>(size));
 }
 CVAPI(std::vector<cv::ml::DTrees::Node>*) vector_DTrees_Node_new3(cv::ml::DTrees::Node *data, size_t dataLength)
 {
-    return new std::vector<cv::ml::DTrees::Node>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::ml::DTrees::Node>(data, data + dataLength));
 }
 CVAPI(size_t) vector_DTrees_Node_getSize(std::vector<cv::ml::DTrees::Node> *vector)
 {
@@ -912,22 +1038,22 @@ CVAPI(cv::ml::DTrees::Node*) vector_DTrees_Node_getPointer(std::vector<cv::ml::D
 }
 CVAPI(void) vector_DTrees_Node_delete(std::vector<cv::ml::DTrees::Node> *vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
 #pragma region cv::ml::DTrees::Split
 CVAPI(std::vector<cv::ml::DTrees::Split>*) vector_DTrees_Split_new1()
 {
-    return new std::vector<cv::ml::DTrees::Split>;
+    return trackHandle(new std::vector<cv::ml::DTrees::Split>);
 }
 CVAPI(std::vector<cv::ml::DTrees::Split>*) vector_DTrees_Split_new2(size_t size)
 {
-    return new std::vector<cv::ml::DTrees::Split>(size);
+    return trackHandle(new std::vector<cv::ml::DTrees::Split>(size));
 }
 CVAPI(std::vector<cv::ml::DTrees::Split>*) vector_DTrees_Split_new3(cv::ml::DTrees::Split *data, size_t dataLength)
 {
-    return new std::vector<cv::ml::DTrees::Split>(data, data + dataLength);
+    return trackHandle(new std::vector<cv::ml::DTrees::Split>(data, data + dataLength));
 }
 CVAPI(size_t) vector_DTrees_Split_getSize(std::vector<cv::ml::DTrees::Split> *vector)
 {
@@ -939,7 +1065,7 @@ CVAPI(cv::ml::DTrees::Split*) vector_DTrees_Split_getPointer(std::vector<cv::ml:
 }
 CVAPI(void) vector_DTrees_Split_delete(std::vector<cv::ml::DTrees::Split> *vector)
 {
-    delete vector;
+    deleteHandle(vector);
 }
 #pragma endregion
 
@@ -6,12 +6,12 @@
 CVAPI(cv::Ptr<cv::Stitcher>*) stitching_Stitcher_create(int mode)
 {
     cv::Ptr<cv::Stitcher> ptr = cv::Stitcher::create(static_cast<cv::Stitcher::Mode>(mode));
-    return new cv::Ptr<cv::Stitcher>(ptr);
+    return trackHandle(new cv::Ptr<cv::Stitcher>(ptr));
 }
 
 CVAPI(void) stitching_Ptr_Stitcher_delete(cv::Ptr<cv::Stitcher> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::Stitcher*) stitching_Ptr_Stitcher_get(cv::Ptr<cv::Stitcher> *obj)
@@ -154,6 +154,28 @@ CVAPI(int) stitching_Stitcher_stitch1_MatArray(
     return static_cast<int>(status);
 }
 
+// Result code: cv::Stitcher::Status. The job can be cancelled between the registration and the compositing.
+// The job shares the stitcher; do not use it elsewhere while the job is running
+CVAPI(cv::Ptr<NativeJob>*) stitching_Stitcher_stitch_job(
+    cv::Ptr<cv::Stitcher> *obj, const cv::Mat **images, const int imagesSize)
+{
+    const cv::Ptr<cv::Stitcher> stitcher = *obj;
+    std::vector<cv::Mat> imagesVec(imagesSize);
+    for (int i = 0; i < imagesSize; i++)
+        imagesVec[i] = NativeJob::retain(*images[i]);
+    return newJob("stitching_Stitcher_stitch", [=](NativeJob &job)
+    {
+        cv::Stitcher::Status status = stitcher->estimateTransform(imagesVec);
+        if (status == cv::Stitcher::OK)
+        {
+            job.checkCancelled();
+            job.results().resize(1);
+            status = stitcher->composePanorama(job.results()[0]);
+        }
+        job.setResultCode(static_cast<int>(status));
+    });
+}
+
 CVAPI(int) stitching_Stitcher_stitch2_InputArray(
     cv::Stitcher *obj, cv::_InputArray *images, 
 	const CvRect **rois, const int roisSize1, int *roisSize2,
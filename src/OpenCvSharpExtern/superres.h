@@ -37,7 +37,7 @@ CVAPI(cv::superres::FrameSource*) superres_Ptr_FrameSource_get(cv::Ptr<cv::super
 }
 CVAPI(void) superres_Ptr_FrameSource_delete(cv::Ptr<cv::superres::FrameSource> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 #pragma region SuperResolution
@@ -77,7 +77,7 @@ CVAPI(cv::superres::SuperResolution*) superres_Ptr_SuperResolution_get(
 }
 CVAPI(void) superres_Ptr_SuperResolution_delete(cv::Ptr<cv::superres::SuperResolution> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(int) superres_SuperResolution_getScale(cv::superres::SuperResolution *obj) { return obj->getScale(); }
@@ -100,7 +100,7 @@ CVAPI(int) superres_SuperResolution_getTemporalAreaRadius(cv::superres::SuperRes
 CVAPI(void) superres_SuperResolution_setTemporalAreaRadius(cv::superres::SuperResolution *obj, int val) { obj->setTemporalAreaRadius(val); }
 CVAPI(cv::Ptr<cv::superres::DenseOpticalFlowExt>*) superres_SuperResolution_getOpticalFlow(cv::superres::SuperResolution *obj)
 {
-    return new cv::Ptr<cv::superres::DenseOpticalFlowExt>(obj->getOpticalFlow());
+    return trackHandle(new cv::Ptr<cv::superres::DenseOpticalFlowExt>(obj->getOpticalFlow()));
 }
 CVAPI(void) superres_SuperResolution_setOpticalFlow(cv::superres::SuperResolution *obj, cv::Ptr<cv::superres::DenseOpticalFlowExt> *val)
 {
@@ -136,7 +136,7 @@ CVAPI(cv::superres::FarnebackOpticalFlow*) superres_Ptr_FarnebackOpticalFlow_get
 CVAPI(void) superres_Ptr_FarnebackOpticalFlow_delete(
     cv::Ptr<cv::superres::FarnebackOpticalFlow> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(double) superres_FarnebackOpticalFlow_getPyrScale(cv::superres::FarnebackOpticalFlow *obj) { return obj->getPyrScale(); }
@@ -173,7 +173,7 @@ CVAPI(cv::superres::DualTVL1OpticalFlow*) superres_Ptr_DualTVL1OpticalFlow_get(
 CVAPI(void) superres_Ptr_DualTVL1OpticalFlow_delete(
     cv::Ptr<cv::superres::DualTVL1OpticalFlow> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(double) superres_DualTVL1OpticalFlow_getTau(cv::superres::DualTVL1OpticalFlow *obj) { return obj->getTau(); }
@@ -208,7 +208,7 @@ CVAPI(cv::superres::BroxOpticalFlow*) superres_Ptr_BroxOpticalFlow_get(
 CVAPI(void) superres_Ptr_BroxOpticalFlow_delete(
     cv::Ptr<cv::superres::BroxOpticalFlow> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(double) superres_BroxOpticalFlow_getAlpha(cv::superres::BroxOpticalFlow *obj) { return obj->getAlpha(); }
@@ -238,7 +238,7 @@ CVAPI(cv::superres::PyrLKOpticalFlow*) superres_Ptr_PyrLKOpticalFlow_get(
 CVAPI(void) superres_Ptr_PyrLKOpticalFlow_delete(
     cv::Ptr<cv::superres::PyrLKOpticalFlow> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(int) superres_PyrLKOpticalFlow_getWindowSize(cv::superres::PyrLKOpticalFlow *obj) { return obj->getWindowSize(); }
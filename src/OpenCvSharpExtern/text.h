@@ -103,7 +103,7 @@ CVAPI(cv::Ptr<cv::text::OCRTesseract>*) text_OCRTesseract_create(
 CVAPI(void) text_Ptr_OCRTesseract_delete(
     cv::Ptr<cv::text::OCRTesseract> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::text::OCRTesseract*) text_OCRTesseract_get(
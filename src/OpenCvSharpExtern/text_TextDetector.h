@@ -25,19 +25,19 @@ CVAPI(cv::Ptr<cv::text::TextDetectorCNN>*) text_TextDetectorCNN_create1(
     }
 
     const auto ptr = cv::text::TextDetectorCNN::create(modelArchFilename, modelWeightsFilename, detectionSizesVec);
-    return new cv::Ptr<cv::text::TextDetectorCNN>(ptr);
+    return trackHandle(new cv::Ptr<cv::text::TextDetectorCNN>(ptr));
 }
 
 CVAPI(cv::Ptr<cv::text::TextDetectorCNN>*) text_TextDetectorCNN_create2(
     const char *modelArchFilename, const char *modelWeightsFilename)
 {
     const auto ptr = cv::text::TextDetectorCNN::create(modelArchFilename, modelWeightsFilename);
-    return new cv::Ptr<cv::text::TextDetectorCNN>(ptr);
+    return trackHandle(new cv::Ptr<cv::text::TextDetectorCNN>(ptr));
 }
 
 CVAPI(void) text_Ptr_TextDetectorCNN_delete(cv::Ptr<cv::text::TextDetectorCNN> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::text::TextDetectorCNN*) text_Ptr_TextDetectorCNN_get(cv::Ptr<cv::text::TextDetectorCNN>* obj)
@@ -49,7 +49,7 @@ CVAPI(int) tracking_Tracker_update(cv::Tracker* tracker, const cv::Mat* image, M
 
 CVAPI(void) tracking_Ptr_Tracker_delete(cv::Ptr<cv::Tracker> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::Tracker*) tracking_Ptr_Tracker_get(cv::Ptr<cv::Tracker> *ptr)
@@ -72,7 +72,7 @@ CVAPI(cv::Ptr<cv::TrackerKCF>*) tracking_TrackerKCF_create2(cv::TrackerKCF::Para
 
 CVAPI(void) tracking_Ptr_TrackerKCF_delete(cv::Ptr<cv::TrackerKCF> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::TrackerKCF*) tracking_Ptr_TrackerKCF_get(cv::Ptr<cv::TrackerKCF> *ptr)
@@ -95,7 +95,7 @@ CVAPI(cv::Ptr<cv::TrackerMIL>*) tracking_TrackerMIL_create2(cv::TrackerMIL::Para
 
 CVAPI(void) tracking_Ptr_TrackerMIL_delete(cv::Ptr<cv::TrackerMIL> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::TrackerMIL*) tracking_Ptr_TrackerMIL_get(cv::Ptr<cv::TrackerMIL> *ptr)
@@ -118,7 +118,7 @@ CVAPI(cv::Ptr<cv::TrackerBoosting>*) tracking_TrackerBoosting_create2(cv::Tracke
 
 CVAPI(void) tracking_Ptr_TrackerBoosting_delete(cv::Ptr<cv::TrackerBoosting> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::TrackerBoosting*) tracking_Ptr_TrackerBoosting_get(cv::Ptr<cv::TrackerBoosting> *ptr)
@@ -141,7 +141,7 @@ CVAPI(cv::Ptr<cv::TrackerMedianFlow>*) tracking_TrackerMedianFlow_create2(cv::Tr
 
 CVAPI(void) tracking_Ptr_TrackerMedianFlow_delete(cv::Ptr<cv::TrackerMedianFlow> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::TrackerMedianFlow*) tracking_Ptr_TrackerMedianFlow_get(cv::Ptr<cv::TrackerMedianFlow> *ptr)
@@ -164,7 +164,7 @@ CVAPI(cv::Ptr<cv::TrackerTLD>*) tracking_TrackerTLD_create2(cv::TrackerTLD::Para
 
 CVAPI(void) tracking_Ptr_TrackerTLD_delete(cv::Ptr<cv::TrackerTLD> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::TrackerTLD*) tracking_Ptr_TrackerTLD_get(cv::Ptr<cv::TrackerTLD> *ptr)
@@ -187,7 +187,7 @@ CVAPI(cv::Ptr<cv::TrackerGOTURN>*) tracking_TrackerGOTURN_create2(cv::TrackerGOT
 
 CVAPI(void) tracking_Ptr_TrackerGOTURN_delete(cv::Ptr<cv::TrackerGOTURN> *ptr)
 {
-	delete ptr;
+	deleteHandle(ptr);
 }
 
 CVAPI(cv::TrackerGOTURN*) tracking_Ptr_TrackerGOTURN_get(cv::Ptr<cv::TrackerGOTURN> *ptr)
@@ -205,7 +205,7 @@ CVAPI(cv::Ptr<cv::TrackerMOSSE>*) tracking_TrackerMOSSE_create()
 
 CVAPI(void) tracking_Ptr_TrackerMOSSE_delete(cv::Ptr<cv::TrackerMOSSE> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::TrackerMOSSE*) tracking_Ptr_TrackerMOSSE_get(cv::Ptr<cv::TrackerMOSSE> *ptr)
@@ -13,7 +13,7 @@ CVAPI(cv::Ptr<cv::MultiTracker>*) tracking_MultiTracker_create()
 
 CVAPI(void) tracking_Ptr_MultiTracker_delete(cv::Ptr<cv::MultiTracker> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(cv::MultiTracker*) tracking_Ptr_MultiTracker_get(cv::Ptr<cv::MultiTracker> *ptr)
@@ -16,7 +16,7 @@ CVAPI(void) video_BackgroundSubtractor_apply(cv::BackgroundSubtractor *obj, cv::
 
 CVAPI(void) video_Ptr_BackgroundSubtractor_delete(cv::Ptr<cv::BackgroundSubtractor> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 CVAPI(cv::BackgroundSubtractor*) video_Ptr_BackgroundSubtractor_get(cv::Ptr<cv::BackgroundSubtractor> *ptr)
 {
@@ -29,11 +29,11 @@ CVAPI(cv::BackgroundSubtractor*) video_Ptr_BackgroundSubtractor_get(cv::Ptr<cv::
 CVAPI(cv::Ptr<cv::BackgroundSubtractorMOG2>*) video_createBackgroundSubtractorMOG2(int history, double varThreshold, int detectShadows)
 {
     cv::Ptr<cv::BackgroundSubtractorMOG2> ptr = cv::createBackgroundSubtractorMOG2(history, varThreshold, detectShadows != 0);
-    return new cv::Ptr<cv::BackgroundSubtractorMOG2>(ptr);
+    return trackHandle(new cv::Ptr<cv::BackgroundSubtractorMOG2>(ptr));
 }
 CVAPI(void) video_Ptr_BackgroundSubtractorMOG2_delete(cv::Ptr<cv::BackgroundSubtractorMOG2> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::BackgroundSubtractorMOG2*) video_Ptr_BackgroundSubtractorMOG2_get(
@@ -158,11 +158,11 @@ CVAPI(cv::Ptr<cv::BackgroundSubtractorKNN>*) video_createBackgroundSubtractorKNN
 {
     cv::Ptr<cv::BackgroundSubtractorKNN> ptr = cv::createBackgroundSubtractorKNN(
         history, dist2Threshold, detectShadows != 0);
-    return new cv::Ptr<cv::BackgroundSubtractorKNN>(ptr);
+    return trackHandle(new cv::Ptr<cv::BackgroundSubtractorKNN>(ptr));
 }
 CVAPI(void) video_Ptr_BackgroundSubtractorKNN_delete(cv::Ptr<cv::BackgroundSubtractorKNN> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::BackgroundSubtractorKNN*) video_Ptr_BackgroundSubtractorKNN_get(
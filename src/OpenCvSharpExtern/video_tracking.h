@@ -43,53 +43,53 @@ CVAPI(void) video_KalmanFilter_delete(cv::KalmanFilter *obj)
 CVAPI(cv::Mat*) video_KalmanFilter_predict(cv::KalmanFilter *obj, cv::Mat *control)
 {
     cv::Mat result = obj->predict(entity(control));
-    return new cv::Mat(result);
+    return trackHandle(new cv::Mat(result));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_correct(cv::KalmanFilter *obj, cv::Mat *measurement)
 {
     cv::Mat result = obj->correct(*measurement);
-    return new cv::Mat(result);
+    return trackHandle(new cv::Mat(result));
 }
 
 CVAPI(cv::Mat*) video_KalmanFilter_statePre(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->statePre);
+    return trackHandle(new cv::Mat(obj->statePre));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_statePost(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->statePost);
+    return trackHandle(new cv::Mat(obj->statePost));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_transitionMatrix(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->transitionMatrix);
+    return trackHandle(new cv::Mat(obj->transitionMatrix));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_controlMatrix(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->controlMatrix);
+    return trackHandle(new cv::Mat(obj->controlMatrix));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_measurementMatrix(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->measurementMatrix);
+    return trackHandle(new cv::Mat(obj->measurementMatrix));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_processNoiseCov(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->processNoiseCov);
+    return trackHandle(new cv::Mat(obj->processNoiseCov));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_measurementNoiseCov(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->measurementNoiseCov);
+    return trackHandle(new cv::Mat(obj->measurementNoiseCov));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_errorCovPre(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->errorCovPre);
+    return trackHandle(new cv::Mat(obj->errorCovPre));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_gain(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->gain);
+    return trackHandle(new cv::Mat(obj->gain));
 }
 CVAPI(cv::Mat*) video_KalmanFilter_errorCovPost(cv::KalmanFilter *obj)
 {
-    return new cv::Mat(obj->errorCovPost);
+    return trackHandle(new cv::Mat(obj->errorCovPost));
 }
 #pragma endregion
 
@@ -165,7 +165,7 @@ CVAPI(cv::DenseOpticalFlow*) video_Ptr_DenseOpticalFlow_get(cv::Ptr<cv::DenseOpt
 }
 CVAPI(void) video_Ptr_DenseOpticalFlow_delete(cv::Ptr<cv::DenseOpticalFlow> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 #pragma endregion
@@ -8,20 +8,20 @@
 
 CVAPI(cv::VideoCapture*) videoio_VideoCapture_new1()
 {
-    return new cv::VideoCapture;
+    return trackHandle(new cv::VideoCapture);
 }
 CVAPI(cv::VideoCapture*) videoio_VideoCapture_new2(const char *filename)
 {
-    return new cv::VideoCapture(filename);
+    return trackHandle(new cv::VideoCapture(filename));
 }
 CVAPI(cv::VideoCapture*) videoio_VideoCapture_new3(int device)
 {
-    return new cv::VideoCapture(device);
+    return trackHandle(new cv::VideoCapture(device));
 }
 
 CVAPI(void) videoio_VideoCapture_delete(cv::VideoCapture *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 
@@ -9,11 +9,11 @@ using namespace cv::xfeatures2d;
 CVAPI(cv::Ptr<BriefDescriptorExtractor>*) xfeatures2d_BriefDescriptorExtractor_create(int bytes)
 {
     const auto ptr = BriefDescriptorExtractor::create(bytes);
-    return new cv::Ptr<BriefDescriptorExtractor>(ptr);
+    return trackHandle(new cv::Ptr<BriefDescriptorExtractor>(ptr));
 }
 CVAPI(void) xfeatures2d_Ptr_BriefDescriptorExtractor_delete(cv::Ptr<BriefDescriptorExtractor> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(void) xfeatures2d_BriefDescriptorExtractor_read(
@@ -55,11 +55,11 @@ CVAPI(cv::Ptr<FREAK>*) xfeatures2d_FREAK_create(int orientationNormalized,
         selectedPairsVec = std::vector<int>(selectedPairs, selectedPairs + selectedPairsLength);
     const auto ptr = FREAK::create(orientationNormalized != 0, scaleNormalized != 0,
         patternScale, nOctaves, selectedPairsVec);
-    return new cv::Ptr<FREAK>(ptr);
+    return trackHandle(new cv::Ptr<FREAK>(ptr));
 }
 CVAPI(void) xfeatures2d_Ptr_FREAK_delete(cv::Ptr<FREAK> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(FREAK*) xfeatures2d_Ptr_FREAK_get(cv::Ptr<FREAK> *ptr)
@@ -76,11 +76,11 @@ CVAPI(cv::Ptr<StarDetector>*) xfeatures2d_StarDetector_create(int maxSize, int r
 {
     const auto ptr = StarDetector::create(
         maxSize, responseThreshold, lineThresholdProjected, lineThresholdBinarized, suppressNonmaxSize);
-    return new cv::Ptr<StarDetector>(ptr);
+    return trackHandle(new cv::Ptr<StarDetector>(ptr));
 }
 CVAPI(void) xfeatures2d_Ptr_StarDetector_delete(cv::Ptr<StarDetector> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(StarDetector*) xfeatures2d_Ptr_StarDetector_get(cv::Ptr<StarDetector> *ptr)
@@ -95,11 +95,11 @@ CVAPI(StarDetector*) xfeatures2d_Ptr_StarDetector_get(cv::Ptr<StarDetector> *ptr
 CVAPI(cv::Ptr<LUCID>*) xfeatures2d_LUCID_create(const int lucid_kernel = 1, const int blur_kernel = 2)
 {
     const auto ptr = LUCID::create(lucid_kernel, blur_kernel);
-    return new cv::Ptr<LUCID>(ptr);
+    return trackHandle(new cv::Ptr<LUCID>(ptr));
 }
 CVAPI(void) xfeatures2d_Ptr_LUCID_delete(cv::Ptr<LUCID> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(LUCID*) xfeatures2d_Ptr_LUCID_get(cv::Ptr<LUCID> *ptr)
@@ -114,11 +114,11 @@ CVAPI(LUCID*) xfeatures2d_Ptr_LUCID_get(cv::Ptr<LUCID> *ptr)
 CVAPI(cv::Ptr<LATCH>*) xfeatures2d_LATCH_create(int bytes, int rotationInvariance, int half_ssd_size, double sigma)
 {
     const auto ptr = LATCH::create(bytes, rotationInvariance != 0, half_ssd_size, sigma);
-    return new cv::Ptr<LATCH>(ptr);
+    return trackHandle(new cv::Ptr<LATCH>(ptr));
 }
 CVAPI(void) xfeatures2d_Ptr_LATCH_delete(cv::Ptr<LATCH> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(LATCH*) xfeatures2d_Ptr_LATCH_get(cv::Ptr<LATCH> *ptr)
@@ -136,11 +136,11 @@ CVAPI(cv::Ptr<SIFT>*) xfeatures2d_SIFT_create(
 {
     const auto ptr = SIFT::create(
         nfeatures, nOctaveLayers, contrastThreshold, edgeThreshold, sigma);
-    return new cv::Ptr<SIFT>(ptr);
+    return trackHandle(new cv::Ptr<SIFT>(ptr));
 }
 CVAPI(void) xfeatures2d_Ptr_SIFT_delete(cv::Ptr<SIFT> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(SIFT*) xfeatures2d_Ptr_SIFT_get(cv::Ptr<SIFT> *ptr)
@@ -157,11 +157,11 @@ CVAPI(cv::Ptr<SURF>*) xfeatures2d_SURF_create(double hessianThreshold, int nOcta
 {
     const auto ptr = SURF::create(
         hessianThreshold, nOctaves, nOctaveLayers, extended != 0, upright != 0);
-    return new cv::Ptr<SURF>(ptr);
+    return trackHandle(new cv::Ptr<SURF>(ptr));
 }
 CVAPI(void) xfeatures2d_Ptr_SURF_delete(cv::Ptr<SURF> *ptr)
 {
-    delete ptr;
+    deleteHandle(ptr);
 }
 
 CVAPI(SURF*) xfeatures2d_Ptr_SURF_get(cv::Ptr<SURF> *ptr)
@@ -46,7 +46,7 @@ CVAPI(cv::Ptr<cv::ximgproc::EdgeBoxes>*) ximgproc_createEdgeBoxes(
 
 CVAPI(void) ximgproc_Ptr_EdgeBoxes_delete(cv::Ptr<cv::ximgproc::EdgeBoxes> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ximgproc::EdgeBoxes*) ximgproc_Ptr_EdgeBoxes_get(cv::Ptr<cv::ximgproc::EdgeBoxes> *ptr)
@@ -5,7 +5,7 @@
 
 CVAPI(void) ximgproc_FastLineDetector_delete(cv::Ptr<cv::ximgproc::FastLineDetector> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ximgproc::FastLineDetector*) ximgproc_Ptr_FastLineDetector_get(cv::Ptr<cv::ximgproc::FastLineDetector> *ptr)
@@ -43,7 +43,7 @@ CVAPI(cv::Ptr<cv::ximgproc::FastLineDetector>*) ximgproc_createFastLineDetector(
 {
     cv::Ptr<cv::ximgproc::FastLineDetector> ptr = cv::ximgproc::createFastLineDetector(
         length_threshold, distance_threshold, canny_th1, canny_th2, canny_aperture_size, do_merge != 0);
-    return new cv::Ptr<cv::ximgproc::FastLineDetector>(ptr);
+    return trackHandle(new cv::Ptr<cv::ximgproc::FastLineDetector>(ptr));
 }
 
 #endif
\ No newline at end of file
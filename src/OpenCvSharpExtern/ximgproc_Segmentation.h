@@ -14,7 +14,7 @@ CVAPI(cv::Ptr<GraphSegmentation>*) ximgproc_segmentation_createGraphSegmentation
 
 CVAPI(void) ximgproc_segmentation_Ptr_GraphSegmentation_delete(cv::Ptr<GraphSegmentation> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(GraphSegmentation*) ximgproc_segmentation_Ptr_GraphSegmentation_get(cv::Ptr<GraphSegmentation> *ptr)
@@ -91,19 +91,19 @@ CVAPI(cv::Ptr<SelectiveSearchSegmentationStrategyFill>*) ximgproc_segmentation_c
 
 CVAPI(void) ximgproc_segmentation_Ptr_SelectiveSearchSegmentationStrategyColor_delete(cv::Ptr<SelectiveSearchSegmentationStrategyColor> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 CVAPI(void) ximgproc_segmentation_Ptr_SelectiveSearchSegmentationStrategySize_delete(cv::Ptr<SelectiveSearchSegmentationStrategySize> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 CVAPI(void) ximgproc_segmentation_Ptr_SelectiveSearchSegmentationStrategyTexture_delete(cv::Ptr<SelectiveSearchSegmentationStrategyTexture> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 CVAPI(void) ximgproc_segmentation_Ptr_SelectiveSearchSegmentationStrategyFill_delete(cv::Ptr<SelectiveSearchSegmentationStrategyFill> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(SelectiveSearchSegmentationStrategyColor*) ximgproc_segmentation_Ptr_SelectiveSearchSegmentationStrategyColor_get(cv::Ptr<SelectiveSearchSegmentationStrategyColor> *ptr)
@@ -163,7 +163,7 @@ CVAPI(cv::Ptr<SelectiveSearchSegmentationStrategyMultiple>*) ximgproc_segmentati
 
 CVAPI(void) ximgproc_segmentation_Ptr_SelectiveSearchSegmentationStrategyMultiple_delete(cv::Ptr<SelectiveSearchSegmentationStrategyMultiple> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(SelectiveSearchSegmentationStrategyMultiple*) ximgproc_segmentation_Ptr_SelectiveSearchSegmentationStrategyMultiple_get(cv::Ptr<SelectiveSearchSegmentationStrategyMultiple> *ptr)
@@ -235,7 +235,7 @@ CVAPI(cv::Ptr<SelectiveSearchSegmentation>*) ximgproc_segmentation_createSelecti
 
 CVAPI(void) ximgproc_segmentation_Ptr_SelectiveSearchSegmentation_delete(cv::Ptr<SelectiveSearchSegmentation> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(SelectiveSearchSegmentation*) ximgproc_segmentation_Ptr_SelectiveSearchSegmentation_get(cv::Ptr<SelectiveSearchSegmentation> *ptr)
@@ -12,7 +12,7 @@ CVAPI(cv::Ptr<cv::ximgproc::RFFeatureGetter>*) ximgproc_createRFFeatureGetter()
 
 CVAPI(void) ximgproc_Ptr_RFFeatureGetter_delete(cv::Ptr<cv::ximgproc::RFFeatureGetter> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ximgproc::RFFeatureGetter*) ximgproc_Ptr_RFFeatureGetter_get(cv::Ptr<cv::ximgproc::RFFeatureGetter> *ptr)
@@ -40,7 +40,7 @@ CVAPI(cv::Ptr<cv::ximgproc::StructuredEdgeDetection>*) ximgproc_createStructured
 
 CVAPI(void) ximgproc_Ptr_StructuredEdgeDetection_delete(cv::Ptr<cv::ximgproc::StructuredEdgeDetection> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 
 CVAPI(cv::ximgproc::StructuredEdgeDetection*) ximgproc_Ptr_StructuredEdgeDetection_get(cv::Ptr<cv::ximgproc::StructuredEdgeDetection> *ptr)
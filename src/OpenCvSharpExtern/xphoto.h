@@ -22,12 +22,12 @@ CVAPI(void) xphoto_applyChannelGains(cv::_InputArray *src, cv::_OutputArray *dst
 CVAPI(cv::Ptr<cv::xphoto::GrayworldWB>*) xphoto_createGrayworldWB()
 {
     cv::Ptr<cv::xphoto::GrayworldWB> ptr = cv::xphoto::createGrayworldWB();
-    return new cv::Ptr<cv::xphoto::GrayworldWB>(ptr);
+    return trackHandle(new cv::Ptr<cv::xphoto::GrayworldWB>(ptr));
 }
 
 CVAPI(void) xphoto_Ptr_GrayworldWB_delete(cv::Ptr<cv::xphoto::GrayworldWB> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 CVAPI(cv::xphoto::GrayworldWB*) xphoto_Ptr_GrayworldWB_get(cv::Ptr<cv::xphoto::GrayworldWB>* ptr)
 {
@@ -52,12 +52,12 @@ CVAPI(cv::Ptr<cv::xphoto::LearningBasedWB>*) xphoto_createLearningBasedWB(const
 {
     std::string str_path_to_model(path_to_model);
     cv::Ptr<cv::xphoto::LearningBasedWB> ptr = cv::xphoto::createLearningBasedWB(str_path_to_model);
-    return new cv::Ptr<cv::xphoto::LearningBasedWB>(ptr);
+    return trackHandle(new cv::Ptr<cv::xphoto::LearningBasedWB>(ptr));
 }
 
 CVAPI(void) xphoto_Ptr_LearningBasedWB_delete(cv::Ptr<cv::xphoto::LearningBasedWB> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 CVAPI(cv::xphoto::LearningBasedWB*) xphoto_Ptr_LearningBasedWB_get(cv::Ptr<cv::xphoto::LearningBasedWB>* ptr)
 {
@@ -104,12 +104,12 @@ CVAPI(void) xphoto_LearningBasedWB_HistBinNum_set(cv::xphoto::LearningBasedWB* p
 CVAPI(cv::Ptr<cv::xphoto::SimpleWB>*) xphoto_createSimpleWB()
 {
     cv::Ptr<cv::xphoto::SimpleWB> ptr = cv::xphoto::createSimpleWB();
-    return new cv::Ptr<cv::xphoto::SimpleWB>(ptr);
+    return trackHandle(new cv::Ptr<cv::xphoto::SimpleWB>(ptr));
 }
 
 CVAPI(void) xphoto_Ptr_SimpleWB_delete(cv::Ptr<cv::xphoto::SimpleWB> *obj)
 {
-    delete obj;
+    deleteHandle(obj);
 }
 CVAPI(cv::xphoto::SimpleWB*) xphoto_Ptr_SimpleWB_get(cv::Ptr<cv::xphoto::SimpleWB>* ptr)
 {
@@ -1,5 +1,7 @@
 ﻿using System;
+using System.Diagnostics;
 using Xunit;
+using Xunit.Abstractions;
 
 namespace OpenCvSharp.Tests
 {
@@ -7,6 +9,11 @@ namespace OpenCvSharp.Tests
     
     public class VectorTest : TestBase
     {
+        public VectorTest(ITestOutputHelper output)
+            : base(output)
+        {
+        }
+
         [Fact]
         public void VectorOfMat()
         {
@@ -46,5 +53,118 @@ namespace OpenCvSharp.Tests
                 mat.Dispose();
             }
         }
+
+        [Fact]
+        public void VectorOfVectorToFlatArray()
+        {
+            var values = new[]
+            {
+                new[] {new KeyPoint(1, 2, 3), new KeyPoint(4, 5, 6)},
+                new KeyPoint[0],
+                new[] {new KeyPoint(7, 8, 9)},
+            };
+
+            using (var vec = new VectorOfVectorKeyPoint(values))
+            {
+                Assert.Equal(3L, vec.TotalSize);
+                var flat = vec.ToFlatArray();
+                Assert.Equal(3, flat.RowCount);
+                Assert.Equal(new[] {0, 2, 2, 3}, flat.Offsets);
+                Assert.Equal(0, flat.RowLength(1));
+                Assert.Equal(values[2][0], flat[2].Array[flat[2].Offset]);
+
+                var jagged = flat.ToJaggedArray();
+                var expected = vec.ToArray();
+                Assert.Equal(expected.Length, jagged.Length);
+                for (int i = 0; i < expected.Length; i++)
+                    Assert.Equal(expected[i], jagged[i]);
+            }
+
+            using (var empty = new VectorOfVectorKeyPoint())
+            {
+                var flat = empty.ToFlatArray();
+                Assert.Equal(0, flat.RowCount);
+                Assert.Empty(flat.Data);
+            }
+        }
+
+        [Fact]
+        public void FindContoursFlat()
+        {
+            using (var src = Image("lenna.png", ImreadModes.Grayscale))
+            using (var binary = src.Threshold(128, 255, ThresholdTypes.Binary))
+            {
+                Cv2.FindContours(binary.Clone(), out Point[][] contours, out HierarchyIndex[] hierarchy,
+                    RetrievalModes.List, ContourApproximationModes.ApproxNone);
+                Cv2.FindContoursFlat(binary.Clone(), out FlatJaggedArray<Point> flat, out HierarchyIndex[] flatHierarchy,
+                    RetrievalModes.List, ContourApproximationModes.ApproxNone);
+
+                Assert.Equal(contours.Length, flat.RowCount);
+                Assert.Equal(hierarchy.Length, flatHierarchy.Length);
+                var jagged = flat.ToJaggedArray();
+                for (int i = 0; i < contours.Length; i++)
+                    Assert.Equal(contours[i], jagged[i]);
+            }
+        }
+
+        [ExplicitFact]
+        public void BenchmarkFlatArrayAgainstToArray()
+        {
+            // a random binary image yields a few hundred thousand mostly tiny contours
+            using (var noise = new Mat(2000, 2000, MatType.CV_8UC1))
+            {
+                Cv2.Randu(noise, Scalar.All(0), Scalar.All(255));
+                Cv2.Threshold(noise, noise, 128, 255, ThresholdTypes.Binary);
+                IntPtr contoursPtr, hierarchyPtr;
+                NativeMethods.imgproc_findContours1_vector(noise.CvPtr, out contoursPtr, out hierarchyPtr,
+                    (int)RetrievalModes.List, (int)ContourApproximationModes.ApproxNone, new Point());
+
+                using (var contoursVec = new VectorOfVectorPoint(contoursPtr))
+                using (new VectorOfVec4i(hierarchyPtr))
+                {
+                    contoursVec.ToArray(); // warm-up
+                    contoursVec.ToFlatArray();
+
+                    const int runs = 5;
+                    var watch = Stopwatch.StartNew();
+                    for (int i = 0; i < runs; i++)
+                        contoursVec.ToArray();
+                    var jaggedMs = watch.Elapsed.TotalMilliseconds / runs;
+
+                    watch.Restart();
+                    for (int i = 0; i < runs; i++)
+                        contoursVec.ToFlatArray();
+                    var flatMs = watch.Elapsed.TotalMilliseconds / runs;
+
+                    output.WriteLine($"{contoursVec.Size1} contours, {contoursVec.TotalSize} points: " +
+                                     $"ToArray {jaggedMs:F2} ms, ToFlatArray {flatMs:F2} ms");
+                }
+            }
+        }
+
+        [Fact]
+        public void VectorDetach()
+        {
+            var values = new[] {new KeyPoint(1, 2, 3), new KeyPoint(4, 5, 6), new KeyPoint(7, 8, 9)};
+            using (var vec = new VectorOfKeyPoint(values))
+            {
+                using (var buf = vec.Detach())
+                {
+                    Assert.Equal(0, vec.Size);
+                    Assert.Equal(3, buf.Length);
+                    Assert.Equal(values, buf.ToArray());
+
+                    buf[1].Angle = 90;
+                    Assert.Equal(90f, buf.ToArray()[1].Angle);
+                }
+
+                using (var empty = vec.Detach())
+                {
+                    Assert.Equal(0, empty.Length);
+                    Assert.Equal(IntPtr.Zero, empty.Data);
+                    Assert.Empty(empty.ToArray());
+                }
+            }
+        }
     }
 }
\ No newline at end of file
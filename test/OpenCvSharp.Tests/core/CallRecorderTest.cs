@@ -0,0 +1,69 @@
+﻿using System.IO;
+using System.Text;
+using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    public class CallRecorderTest : TestBase
+    {
+        [Fact]
+        public void RecordsCalls()
+        {
+            var path = Path.Combine(Path.GetTempPath(), "opencvsharp_call_recorder_test.log");
+            try
+            {
+                using (var src = new Mat(32, 32, MatType.CV_8UC3, Scalar.All(100)))
+                using (var dst = new Mat())
+                {
+                    CallRecorder.Start(path, CallRecorderMode.Contents);
+                    Assert.True(CallRecorder.IsRecording);
+                    Cv2.CvtColor(src, dst, ColorConversionCodes.BGR2GRAY);
+                    Cv2.GaussianBlur(dst, dst, new Size(3, 3), 0);
+                    CallRecorder.Stop();
+                    Assert.False(CallRecorder.IsRecording);
+
+                    // other tests may run instrumented functions at the same time
+                    Assert.True(CallRecorder.RecordedCalls >= 2);
+                    // contents of both inputs
+                    Assert.True(CallRecorder.RecordedBytes > 32 * 32 * 4);
+                }
+
+                var log = File.ReadAllBytes(path);
+                Assert.Equal(CallRecorder.RecordedBytes, log.Length);
+                Assert.Equal("OCSRLOG1", Encoding.ASCII.GetString(log, 0, 8));
+            }
+            finally
+            {
+                CallRecorder.Stop();
+                if (File.Exists(path))
+                    File.Delete(path);
+            }
+        }
+
+        [Fact]
+        public void StoresSmallArraysInHashesMode()
+        {
+            var path = Path.Combine(Path.GetTempPath(), "opencvsharp_call_recorder_small_test.log");
+            try
+            {
+                using (var src = new Mat(16, 16, MatType.CV_8UC3, Scalar.All(100)))
+                using (var m = Cv2.GetRotationMatrix2D(new Point2f(8, 8), 30, 1))
+                using (var dst = new Mat())
+                {
+                    CallRecorder.Start(path, CallRecorderMode.Hashes);
+                    Cv2.WarpAffine(src, dst, m, src.Size());
+                    CallRecorder.Stop();
+
+                    // src (768 bytes) and the 2x3 matrix (48 bytes) are both below the size limit
+                    Assert.True(CallRecorder.RecordedBytes > 16 * 16 * 3 + 2 * 3 * 8);
+                }
+            }
+            finally
+            {
+                CallRecorder.Stop();
+                if (File.Exists(path))
+                    File.Delete(path);
+            }
+        }
+    }
+}
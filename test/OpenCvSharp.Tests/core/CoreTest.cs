@@ -425,6 +425,55 @@ namespace OpenCvSharp.Tests.Core
             Assert.Equal(3, nClasses);
             Assert.Equal(new[] {0, 1, 2, 2, 0, 1, 1}, labels);
         }
+
+        [Fact]
+        public void MarshallingTemporariesAreReused()
+        {
+            using (var b = new Mat(8, 8, MatType.CV_8UC1, Scalar.All(1)))
+            using (var g = new Mat(8, 8, MatType.CV_8UC1, Scalar.All(2)))
+            using (var r = new Mat(8, 8, MatType.CV_8UC1, Scalar.All(3)))
+            using (var merged = new Mat())
+            using (var concat = new Mat())
+            using (InputArray mergedArray = merged)
+            using (OutputArray concatArray = concat)
+            using (var encoded = new VectorOfByte())
+            {
+                var planes = new[] {b.CvPtr, g.CvPtr, r.CvPtr};
+                var prms = new[] {(int)ImwriteFlags.PngCompression, 1};
+
+                // the shims are called directly: the Cv2 methods also create the InputArray / OutputArray
+                // wrappers and the result vector on every call, which are not temporaries of the shims
+                void Run()
+                {
+                    NativeMethods.core_merge(planes, 3, merged.CvPtr);
+                    NativeMethods.core_hconcat1(planes, 3, concatArray.CvPtr);
+                    Assert.Equal(1, NativeMethods.imgcodecs_imencode_vector(".png", mergedArray.CvPtr, encoded.CvPtr, prms, prms.Length));
+                }
+
+                // the first calls size the thread's scratch vectors
+                Run();
+                Run();
+                bool counted = NativeMethods.core_heapAllocationCount(out var heapBefore) != 0;
+                ulong before = NativeMethods.core_scratchVectorAllocationCount();
+                for (int i = 0; i < 100; i++)
+                    Run();
+                Assert.Equal(before, NativeMethods.core_scratchVectorAllocationCount());
+                NativeMethods.core_heapAllocationCount(out var heapAfter);
+                if (counted)
+                    Assert.Equal(heapBefore, heapAfter);
+
+                Assert.Equal(new Vec3b(1, 2, 3), merged.Get<Vec3b>(7, 7));
+                Assert.Equal(new Size(24, 8), concat.Size());
+                Assert.Equal(0x89, encoded.ToArray()[0]);
+
+                NativeMethods.core_scratchVectorTrim();
+                Run();
+                Assert.True(NativeMethods.core_scratchVectorAllocationCount() > before);
+                NativeMethods.core_heapAllocationCount(out var heapTrimmed);
+                if (counted)
+                    Assert.True(heapTrimmed > heapAfter);
+            }
+        }
     }
 }
 
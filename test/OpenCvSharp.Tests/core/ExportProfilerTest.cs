@@ -0,0 +1,44 @@
+﻿using System.Linq;
+using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    public class ExportProfilerTest : TestBase
+    {
+        [Fact]
+        public void RecordsCalls()
+        {
+            if (!ExportProfiler.IsAvailable)
+            {
+                // nothing is recorded unless the native library was built with OPENCVSHARP_PROFILE_EXPORTS
+                ExportProfiler.Enabled = true;
+                Assert.False(ExportProfiler.Enabled);
+                Assert.Empty(ExportProfiler.GetEntries());
+                return;
+            }
+
+            try
+            {
+                ExportProfiler.Reset();
+                ExportProfiler.Enabled = true;
+                for (int i = 0; i < 10; i++)
+                {
+                    using (var mat = new Mat(10, 10, MatType.CV_8UC1))
+                    {
+                        Assert.Equal(10, mat.Rows);
+                    }
+                }
+                ExportProfiler.Enabled = false;
+
+                var entry = ExportProfiler.GetEntries().Single(e => e.Name == "core_Mat_new2");
+                Assert.True(entry.Calls >= 10);
+                Assert.Equal(entry.Calls, (ulong)entry.Histogram.Sum(c => (long)c));
+                Assert.True(entry.MaxNanoseconds <= entry.TotalNanoseconds);
+            }
+            finally
+            {
+                ExportProfiler.Enabled = false;
+            }
+        }
+    }
+}
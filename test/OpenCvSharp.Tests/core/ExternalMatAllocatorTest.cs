@@ -0,0 +1,67 @@
+﻿using System;
+using System.Runtime.InteropServices;
+using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    public class ExternalMatAllocatorTest : TestBase
+    {
+        [Fact]
+        public void ReleaseAfterLastReference()
+        {
+            // LiveCount is shared with the tests attaching buffers in parallel (FrameRing, mapped Mats),
+            // so the release is checked through this test's own callback
+            IntPtr buffer = Marshal.AllocHGlobal(64 * 48);
+            IntPtr released = IntPtr.Zero;
+
+            var mat = Mat.FromExternalData(48, 64, MatType.CV_8UC1, buffer, 0, data =>
+            {
+                released = data;
+                Marshal.FreeHGlobal(data);
+            });
+            mat.SetTo(Scalar.All(3));
+            Assert.True(ExternalMatAllocator.LiveCount >= 1);
+
+            using (var roi = new Mat(mat, new Rect(8, 8, 16, 16)))
+            {
+                mat.Dispose();
+                Assert.Equal(IntPtr.Zero, released);
+
+                // in-place processing keeps using the external buffer
+                Cv2.Add(roi, roi, roi);
+                Assert.Equal(6, roi.At<byte>(0, 0));
+                Assert.Equal(buffer + 8 * 64 + 8, roi.Data);
+            }
+
+            Assert.Equal(buffer, released);
+        }
+
+        [Fact]
+        public void ReallocationReleasesBuffer()
+        {
+            bool released = false;
+            IntPtr buffer = Marshal.AllocHGlobal(10 * 10 * 4);
+            using (var mat = Mat.FromExternalData(10, 10, MatType.CV_32FC1, buffer, 0, data =>
+            {
+                released = true;
+                Marshal.FreeHGlobal(data);
+            }))
+            {
+                mat.Create(20, 20, MatType.CV_32FC1);
+                Assert.True(released);
+                Assert.NotEqual(buffer, mat.Data);
+            }
+        }
+
+        [Fact]
+        public void PinnedArray()
+        {
+            var array = new float[6 * 5];
+            using (var mat = Mat.FromPinnedArray(6, 5, MatType.CV_32FC1, array))
+            {
+                mat.SetTo(Scalar.All(1.5));
+            }
+            Assert.All(array, v => Assert.Equal(1.5f, v));
+        }
+    }
+}
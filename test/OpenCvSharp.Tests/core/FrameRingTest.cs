@@ -0,0 +1,127 @@
+﻿using System;
+using System.Threading.Tasks;
+using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    public class FrameRingTest : TestBase
+    {
+        private static string NewName()
+        {
+            return "/opencvsharp_test_" + Guid.NewGuid().ToString("N").Substring(0, 16);
+        }
+
+        [Fact]
+        public void BlockingRingDeliversEveryFrame()
+        {
+            const int frameCount = 50;
+            string name = NewName();
+            using (var producer = FrameRing.Create(name, 3, 64 * 48, FrameRingPolicy.Block))
+            using (var reader = FrameRing.Open(name))
+            {
+                Assert.Equal(3, reader.SlotCount);
+                Assert.Equal(FrameRingPolicy.Block, reader.Policy);
+                int consumer = reader.AddConsumer();
+
+                var consume = Task.Run(() =>
+                {
+                    using (var frame = new Mat())
+                    {
+                        for (int i = 0; i < frameCount; i++)
+                        {
+                            Assert.True(reader.Acquire(consumer, frame, out var info, 5000));
+                            Assert.Equal(i, (long)info.Sequence);
+                            Assert.Equal(i * 1000L, info.Timestamp);
+                            Assert.Equal(0UL, info.Dropped);
+                            Assert.Equal(new Size(64, 48), frame.Size());
+                            Assert.Equal(MatType.CV_8UC1, frame.Type());
+                            Assert.Equal(48 * 64 * (i % 256), (int)Cv2.Sum(frame).Val0);
+                            reader.Release(consumer, info);
+                        }
+                    }
+                });
+
+                using (var src = new Mat(48, 64, MatType.CV_8UC1))
+                {
+                    for (int i = 0; i < frameCount; i++)
+                    {
+                        src.SetTo(Scalar.All(i % 256));
+                        Assert.True(producer.Write(src, i * 1000L, 5000));
+                    }
+                }
+                consume.Wait();
+                Assert.Equal(frameCount, producer.WriteSequence);
+            }
+        }
+
+        [Fact]
+        public void DropOldestSkipsOverwrittenFrames()
+        {
+            string name = NewName();
+            using (var producer = FrameRing.Create(name, 4, 16 * 16 * 3))
+            using (var reader = FrameRing.Open(name))
+            using (var frame = new Mat())
+            {
+                int consumer = reader.AddConsumer();
+                for (int i = 0; i < 10; i++)
+                {
+                    using (var slot = new Mat())
+                    {
+                        Assert.True(producer.BeginWrite(16, 16, MatType.CV_8UC3, slot));
+                        slot.SetTo(new Scalar(i, i + 1, i + 2));
+                        producer.Commit(i);
+                    }
+                }
+
+                Assert.True(reader.Acquire(consumer, frame, out var info, 0));
+                Assert.Equal(6UL, info.Sequence);
+                Assert.Equal(6UL, info.Dropped);
+                Assert.Equal(new Vec3b(6, 7, 8), frame.Get<Vec3b>(15, 15));
+                Assert.True(reader.IsValid(info));
+                reader.Release(consumer, info);
+
+                // overwrite the slot of frame 6 while frame 7 is held
+                Assert.True(reader.Acquire(consumer, frame, out info, 0));
+                Assert.Equal(7UL, info.Sequence);
+                using (var src = new Mat(16, 16, MatType.CV_8UC3, Scalar.All(0)))
+                {
+                    Assert.True(producer.Write(src, 10));
+                    Assert.True(reader.IsValid(info));
+                    Assert.True(producer.Write(src, 11));
+                    Assert.False(reader.IsValid(info));
+                }
+                reader.Release(consumer, info);
+
+                producer.Dispose();
+                Assert.True(reader.IsClosed);
+                int remaining = 0;
+                while (reader.Acquire(consumer, frame, out info, 0))
+                {
+                    reader.Release(consumer, info);
+                    remaining++;
+                }
+                Assert.Equal(4, remaining);
+            }
+        }
+
+        [Fact]
+        public void CreateDoesNotTakeOverALiveRing()
+        {
+            string name = NewName();
+            using (var producer = FrameRing.Create(name, 2, 16))
+            using (var reader = FrameRing.Open(name))
+            using (var src = new Mat(4, 4, MatType.CV_8UC1, Scalar.All(1)))
+            using (var frame = new Mat())
+            {
+                Assert.Throws<OpenCVException>(() => FrameRing.Create(name, 2, 16));
+
+                // the failed attempt left the ring alone
+                int consumer = reader.AddConsumer();
+                Assert.True(producer.Write(src, 0));
+                Assert.True(reader.Acquire(consumer, frame, out var info, 0));
+                Assert.Equal(0UL, info.Sequence);
+                reader.Release(consumer, info);
+            }
+        }
+    }
+}
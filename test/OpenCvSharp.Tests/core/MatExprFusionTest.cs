@@ -0,0 +1,217 @@
+﻿using System;
+using System.Diagnostics;
+using Xunit;
+using Xunit.Abstractions;
+
+namespace OpenCvSharp.Tests.Core
+{
+    // MatExpr.FusedEvaluation is process-wide: the operators of the tests running in parallel would be fused too
+    [CollectionDefinition(nameof(MatExprFusionTest), DisableParallelization = true)]
+    public class MatExprFusionCollection
+    {
+    }
+
+    [Collection(nameof(MatExprFusionTest))]
+    public class MatExprFusionTest : TestBase
+    {
+        public MatExprFusionTest(ITestOutputHelper output)
+            : base(output)
+        {
+        }
+
+        [Fact]
+        public void LazyOnlyWhenEnabled()
+        {
+            using (var a = new Mat(10, 10, MatType.CV_16UC1, Scalar.All(100)))
+            using (var b = new Mat(10, 10, MatType.CV_16UC1, Scalar.All(20)))
+            {
+                using (var e = a * 0.5 + b)
+                {
+                    Assert.False(e.IsFused);
+                }
+
+                MatExpr.FusedEvaluation = true;
+                try
+                {
+                    Assert.True(MatExpr.FusedEvaluation);
+                    using (var e = a * 0.5 + b)
+                    {
+                        Assert.True(e.IsFused);
+                        Assert.Equal(a.Size(), e.Size);
+                        Assert.Equal(MatType.CV_16UC1, e.Type);
+                        using (Mat m = e)
+                        {
+                            Assert.Equal(70, m.Get<ushort>(9, 9));
+                        }
+                    }
+                }
+                finally
+                {
+                    MatExpr.FusedEvaluation = false;
+                }
+            }
+        }
+
+        [Fact]
+        public void DepthMapChain()
+        {
+            using (var a = new Mat(240, 320, MatType.CV_16UC1))
+            using (var b = new Mat(240, 320, MatType.CV_16UC1))
+            using (var c = new Mat(240, 320, MatType.CV_16UC1))
+            {
+                Cv2.Randu(a, 0, 65535);
+                Cv2.Randu(b, 0, 65535);
+                Cv2.Randu(c, 0, 4);
+
+                using (var expected = Evaluate(false, () => (a * 0.5 + b) / c))
+                using (var actual = Evaluate(true, () => (a * 0.5 + b) / c))
+                {
+                    AssertNearlyEqual(expected, actual, 1);
+                }
+            }
+        }
+
+        [Fact]
+        public void SaturateCompareBitwise()
+        {
+            using (var a = new Mat(64, 100, MatType.CV_8UC3))
+            using (var b = new Mat(64, 100, MatType.CV_8UC3))
+            using (var c = new Mat(64, 100, MatType.CV_8UC3))
+            {
+                Cv2.Randu(a, 0, 256);
+                Cv2.Randu(b, 0, 256);
+                Cv2.Randu(c, 0, 256);
+
+                using (var expected = Evaluate(false, () => a + b - c))
+                using (var actual = Evaluate(true, () => a + b - c))
+                {
+                    AssertNearlyEqual(expected, actual, 0);
+                }
+                using (var expected = Evaluate(false, () => (~a ^ b) | c))
+                using (var actual = Evaluate(true, () => (~a ^ b) | c))
+                {
+                    AssertNearlyEqual(expected, actual, 0);
+                }
+                // scalar operands are saturated to the array depth first
+                using (var expected = Evaluate(false, () => (a & 300) | (b ^ -1)))
+                using (var actual = Evaluate(true, () => (a & 300) | (b ^ -1)))
+                {
+                    AssertNearlyEqual(expected, actual, 0);
+                }
+                using (var a1 = a.ExtractChannel(0))
+                using (var b1 = b.ExtractChannel(1))
+                using (var expected = Evaluate(false, () => a1.GreaterThan(100) & b1))
+                using (var actual = Evaluate(true, () => a1.GreaterThan(100) & b1))
+                {
+                    AssertNearlyEqual(expected, actual, 0);
+                }
+            }
+        }
+
+        [Fact]
+        public void ManyInputs()
+        {
+            var mats = new Mat[7];
+            try
+            {
+                for (int i = 0; i < mats.Length; i++)
+                {
+                    mats[i] = new Mat(50, 60, MatType.CV_32FC1);
+                    Cv2.Randu(mats[i], -100, 100);
+                }
+
+                Func<MatExpr> expr = () =>
+                {
+                    MatExpr e = mats[0] * 1.0;
+                    for (int i = 1; i < mats.Length; i++)
+                        e = e + mats[i] * (i + 1);
+                    return e;
+                };
+                using (var expected = Evaluate(false, expr))
+                using (var actual = Evaluate(true, expr))
+                {
+                    AssertNearlyEqual(expected, actual, 1e-3);
+                }
+            }
+            finally
+            {
+                foreach (var m in mats)
+                    m?.Dispose();
+            }
+        }
+
+        [Fact]
+        public void DoubleIsEvaluatedEagerly()
+        {
+            using (var a = new Mat(8, 8, MatType.CV_64FC1, Scalar.All(1e10 + 1)))
+            using (var b = new Mat(8, 8, MatType.CV_64FC1, Scalar.All(1e10)))
+            using (var actual = Evaluate(true, () => a - b))
+            {
+                Assert.Equal(1.0, actual.Get<double>(7, 7));
+            }
+        }
+
+        [ExplicitFact]
+        public void BenchmarkDepthMapChain()
+        {
+            using (var a = new Mat(2160, 3840, MatType.CV_16UC1))
+            using (var b = new Mat(2160, 3840, MatType.CV_16UC1))
+            using (var c = new Mat(2160, 3840, MatType.CV_16UC1))
+            using (var dst = new Mat(2160, 3840, MatType.CV_16UC1))
+            {
+                Cv2.Randu(a, 0, 65535);
+                Cv2.Randu(b, 0, 65535);
+                Cv2.Randu(c, 1, 4);
+                var all = new Rect(0, 0, dst.Width, dst.Height);
+
+                foreach (var fused in new[] { false, true })
+                {
+                    MatExpr.FusedEvaluation = fused;
+                    try
+                    {
+                        var watch = Stopwatch.StartNew();
+                        for (int i = 0; i < 20; i++)
+                        {
+                            using (var e = (a * 0.5 + b) / c - 100)
+                                dst[all] = e;
+                        }
+                        output.WriteLine($"{(fused ? "fused" : "eager")}: {watch.ElapsedMilliseconds / 20.0}ms");
+                    }
+                    finally
+                    {
+                        MatExpr.FusedEvaluation = false;
+                    }
+                }
+            }
+        }
+
+        private static Mat Evaluate(bool fused, Func<MatExpr> expr)
+        {
+            MatExpr.FusedEvaluation = fused;
+            try
+            {
+                using (var e = expr())
+                {
+                    Assert.Equal(fused, e.IsFused);
+                    return e.ToMat();
+                }
+            }
+            finally
+            {
+                MatExpr.FusedEvaluation = false;
+            }
+        }
+
+        private static void AssertNearlyEqual(Mat expected, Mat actual, double tolerance)
+        {
+            Assert.Equal(expected.Type(), actual.Type());
+            Assert.Equal(expected.Size(), actual.Size());
+            using (var diff = new Mat())
+            {
+                Cv2.Absdiff(expected, actual, diff);
+                Cv2.MinMaxLoc(diff.Reshape(1), out double _, out double maxVal);
+                Assert.True(maxVal <= tolerance, $"max difference {maxVal}");
+            }
+        }
+    }
+}
@@ -0,0 +1,141 @@
+﻿using System.Diagnostics;
+using Xunit;
+using Xunit.Abstractions;
+
+namespace OpenCvSharp.Tests.Core
+{
+    public class MatKernelTest : TestBase
+    {
+        public MatKernelTest(ITestOutputHelper output)
+            : base(output)
+        {
+        }
+
+        [Fact]
+        public void ScaleAdd()
+        {
+            using (var a = new Mat(31, 517, MatType.CV_8UC3, new Scalar(10, 100, 250)))
+            using (var b = new Mat(31, 517, MatType.CV_8UC1, Scalar.All(20)))
+            using (var kernel = new MatKernel("a * 0.5 + b"))
+            using (var dst = kernel.Run(MatType.CV_8UC3, a, b))
+            {
+                Assert.Equal(2, kernel.InputCount);
+                Assert.Equal(MatType.CV_8UC3, dst.Type());
+                Assert.Equal(a.Size(), dst.Size());
+                Assert.Equal(new Vec3b(25, 70, 145), dst.Get<Vec3b>(30, 516));
+            }
+        }
+
+        [Fact]
+        public void SwizzleAndSaturate()
+        {
+            using (var a = new Mat(16, 16, MatType.CV_8UC3, new Scalar(1, 2, 3)))
+            using (var swap = new MatKernel("a.z; a.y; a.x * 300"))
+            using (var dst = swap.Run(MatType.CV_8UC3, a))
+            {
+                Assert.Equal(3, swap.ChannelExpressionCount);
+                Assert.Equal(new Vec3b(3, 2, 255), dst.Get<Vec3b>(5, 5));
+            }
+        }
+
+        [Fact]
+        public void SelectAndCompare()
+        {
+            using (var a = new Mat(4, 4, MatType.CV_32FC1, Scalar.All(-2)))
+            using (var kernel = new MatKernel("a < 0 ? -a * 10 : clamp(a, 0, 1)"))
+            {
+                a.Set(0, 0, 1.5f);
+                using (var dst = kernel.Run(MatType.CV_16UC1, a))
+                {
+                    Assert.Equal(20, dst.Get<ushort>(3, 3));
+                    Assert.Equal(1, dst.Get<ushort>(0, 0));
+                }
+            }
+        }
+
+        [Fact]
+        public void InPlace()
+        {
+            using (var a = new Mat(8, 8, MatType.CV_8UC1, Scalar.All(55)))
+            using (var kernel = new MatKernel("255 - a"))
+            {
+                kernel.Run(a, MatType.CV_8UC1, a);
+                Assert.Equal(200, a.Get<byte>(7, 7));
+            }
+        }
+
+        [Fact]
+        public void ParseError()
+        {
+            Assert.Throws<OpenCVException>(() => new MatKernel("a + "));
+            Assert.Throws<OpenCVException>(() => new MatKernel("foo(a)"));
+
+            // rejected before the recursion of the parser exhausts the native stack
+            Assert.Throws<OpenCVException>(() => new MatKernel(new string('-', 100000) + "a"));
+            Assert.Throws<OpenCVException>(() => new MatKernel(new string('(', 100000) + "a" + new string(')', 100000)));
+        }
+
+        [Fact]
+        public void Cache()
+        {
+            MatKernel.ClearCache();
+            using (new MatKernel("a + 1"))
+            using (new MatKernel("a + 1"))
+            using (new MatKernel("a + 2"))
+            {
+                Assert.Equal(2, MatKernel.CacheSize());
+            }
+
+            // the least recently used kernels are dropped beyond the capacity of the cache
+            for (int i = 0; i < 1000; i++)
+            {
+                using (new MatKernel($"a + {i}"))
+                {
+                }
+            }
+            Assert.True(MatKernel.CacheSize() < 1000);
+            MatKernel.ClearCache();
+            Assert.Equal(0, MatKernel.CacheSize());
+        }
+
+        [ExplicitFact]
+        public void BenchmarkAgainstForEach()
+        {
+            var sizes = new[] {new Size(1920, 1080), new Size(3840, 2160)};
+            foreach (var size in sizes)
+            {
+                using (var src = new Mat(size, MatType.CV_8UC3))
+                using (var dst = new Mat())
+                using (var kernel = new MatKernel("a * 0.5 + 10"))
+                {
+                    Cv2.Randu(src, Scalar.All(0), Scalar.All(255));
+
+                    var watch = Stopwatch.StartNew();
+                    using (var copy = src.Clone())
+                    {
+                        watch.Restart();
+                        unsafe
+                        {
+                            copy.ForEachAsVec3b((value, position) =>
+                            {
+                                value->Item0 = (byte) (value->Item0 * 0.5 + 10);
+                                value->Item1 = (byte) (value->Item1 * 0.5 + 10);
+                                value->Item2 = (byte) (value->Item2 * 0.5 + 10);
+                            });
+                        }
+                        watch.Stop();
+                    }
+                    var forEachMs = watch.Elapsed.TotalMilliseconds;
+
+                    kernel.Run(dst, MatType.CV_8UC3, src); // warm-up
+                    watch.Restart();
+                    kernel.Run(dst, MatType.CV_8UC3, src);
+                    watch.Stop();
+                    var kernelMs = watch.Elapsed.TotalMilliseconds;
+
+                    output.WriteLine($"{size.Width}x{size.Height}: ForEachAsVec3b {forEachMs:F2} ms, MatKernel {kernelMs:F2} ms");
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,131 @@
+﻿using System.IO;
+using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    public class MatMappedTest : TestBase
+    {
+        [Fact]
+        public void CreateFlushReopen()
+        {
+            string path = Path.GetTempFileName();
+            try
+            {
+                using (var mat = Mat.CreateMapped(path, 300, 200, MatType.CV_16UC1))
+                {
+                    Assert.True(mat.IsMapped());
+                    Assert.Equal(new Size(200, 300), mat.Size());
+
+                    using (var roi = new Mat(mat, new Rect(50, 100, 20, 10)))
+                    {
+                        roi.SetTo(Scalar.All(1234));
+                        Assert.True(roi.IsMapped());
+                        Assert.True(roi.FlushMapped());
+                    }
+                    Assert.True(mat.FlushMapped());
+                }
+
+                using (var mat = Mat.OpenMapped(path))
+                using (var sum = new Mat())
+                {
+                    Assert.Equal(MatType.CV_16UC1, mat.Type());
+                    Assert.Equal(1234, mat.At<ushort>(100, 50));
+                    Assert.Equal(0, mat.At<ushort>(99, 50));
+                    Assert.Equal(1234.0 * 20 * 10, Cv2.Sum(mat).Val0);
+
+                    // imgproc reads the mapping directly
+                    Cv2.Blur(mat, sum, new Size(3, 3));
+                    Assert.Equal(1234, sum.At<ushort>(105, 60));
+                }
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+
+        [Fact]
+        public void FlushRoi()
+        {
+            string path = Path.GetTempFileName();
+            try
+            {
+                using (var mat = Mat.CreateMapped(path, 300, 200, MatType.CV_8UC3))
+                {
+                    // the last rows of the mapping, and an ROI in the middle flushed on its own
+                    using (var corner = new Mat(mat, new Rect(190, 290, 10, 10)))
+                    using (var middle = new Mat(mat, new Rect(20, 150, 30, 5)))
+                    {
+                        corner.SetTo(new Scalar(1, 2, 3));
+                        middle.SetTo(new Scalar(4, 5, 6));
+                        Assert.True(corner.FlushMapped());
+                        Assert.True(middle.FlushMapped());
+                    }
+                }
+
+                using (var mat = Mat.OpenMapped(path, false))
+                {
+                    Assert.Equal(new Vec3b(1, 2, 3), mat.At<Vec3b>(299, 199));
+                    Assert.Equal(new Vec3b(4, 5, 6), mat.At<Vec3b>(154, 49));
+                    Assert.Equal(new Vec3b(0, 0, 0), mat.At<Vec3b>(155, 49));
+                }
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+
+        [Fact]
+        public void NotMapped()
+        {
+            using (var mat = new Mat(10, 10, MatType.CV_8UC1))
+            {
+                Assert.False(mat.IsMapped());
+                Assert.False(mat.FlushMapped());
+            }
+        }
+
+        [Fact]
+        public void OpenInvalidFile()
+        {
+            string path = Path.GetTempFileName();
+            try
+            {
+                File.WriteAllBytes(path, new byte[100]);
+                Assert.Throws<OpenCVException>(() => Mat.OpenMapped(path));
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+
+        [Fact]
+        public void OpenOverflowingHeader()
+        {
+            string path = Path.GetTempFileName();
+            try
+            {
+                using (Mat.CreateMapped(path, 10, 10, MatType.CV_8UC1))
+                {
+                }
+
+                // rows = 2, step = 2^63: rows * step wraps around to 0
+                using (var stream = new FileStream(path, FileMode.Open, FileAccess.Write))
+                using (var writer = new BinaryWriter(stream))
+                {
+                    stream.Position = 8;
+                    writer.Write(2);
+                    stream.Position = 24;
+                    writer.Write(1UL << 63);
+                }
+                Assert.Throws<OpenCVException>(() => Mat.OpenMapped(path));
+            }
+            finally
+            {
+                File.Delete(path);
+            }
+        }
+    }
+}
@@ -394,6 +394,101 @@ namespace OpenCvSharp.Tests.Core
             Assert.Equal(data, data2);
         }
 
+        [Fact]
+        public void GetSetRegionConvertAndReorder()
+        {
+            using (var mat = new Mat(100, 120, MatType.CV_8UC3, Scalar.All(0)))
+            {
+                var indexer = mat.GetGenericIndexer<Vec3b>();
+                for (int y = 0; y < mat.Rows; y++)
+                    for (int x = 0; x < mat.Cols; x++)
+                        indexer[y, x] = new Vec3b((byte)x, (byte)y, (byte)(x + y));
+
+                var roi = new Rect(10, 20, 30, 40);
+                var rgb = new float[roi.Width * roi.Height * 3];
+                mat.GetRegion(roi, rgb, MatType.CV_32FC3, 1.0 / 255, 0, new[] {2, 1, 0});
+                for (int y = 0; y < roi.Height; y++)
+                {
+                    for (int x = 0; x < roi.Width; x++)
+                    {
+                        Vec3b expected = indexer[roi.Y + y, roi.X + x];
+                        int i = (y * roi.Width + x) * 3;
+                        Assert.Equal(expected.Item2 / 255.0, rgb[i], 5);
+                        Assert.Equal(expected.Item1 / 255.0, rgb[i + 1], 5);
+                        Assert.Equal(expected.Item0 / 255.0, rgb[i + 2], 5);
+                    }
+                }
+
+                // writing back with the same order restores the source pixels
+                using (var restored = new Mat(mat.Size(), mat.Type(), Scalar.All(0)))
+                {
+                    restored.SetRegion(roi, rgb, MatType.CV_32FC3, 255, 0, new[] {2, 1, 0});
+                    using (var expected = new Mat(mat, roi))
+                    using (var actual = new Mat(restored, roi))
+                    {
+                        Assert.Equal(0, Cv2.Norm(expected, actual, NormTypes.INF));
+                    }
+                    Assert.Equal(0, restored.At<Vec3b>(0, 0).Item0);
+                }
+            }
+        }
+
+        [Fact]
+        public void GetSetRegionStridedSubsetOfChannels()
+        {
+            using (var mat = new Mat(8, 8, MatType.CV_16UC4, new Scalar(1, 2, 3, 4)))
+            {
+                var roi = new Rect(2, 1, 5, 3);
+                const int stride = 64; // bytes per buffer row, wider than 5 * sizeof(short)
+                var buffer = new short[stride / sizeof(short) * roi.Height];
+                var handle = System.Runtime.InteropServices.GCHandle.Alloc(buffer, System.Runtime.InteropServices.GCHandleType.Pinned);
+                try
+                {
+                    // channel 3 only, saturated to 16S
+                    mat.GetRegion(roi, handle.AddrOfPinnedObject(), stride, MatType.CV_16SC1, 10000, 0, new[] {3});
+                    for (int y = 0; y < roi.Height; y++)
+                    {
+                        for (int x = 0; x < roi.Width; x++)
+                            Assert.Equal(short.MaxValue, buffer[y * stride / sizeof(short) + x]);
+                        Assert.Equal(0, buffer[y * stride / sizeof(short) + roi.Width]);
+                    }
+
+                    buffer[0] = 7;
+                    mat.SetRegion(roi, handle.AddrOfPinnedObject(), stride, MatType.CV_16SC1, 1, 0, new[] {1});
+                }
+                finally
+                {
+                    handle.Free();
+                }
+
+                Assert.Equal(new Vec4w(1, 7, 3, 4), mat.At<Vec4w>(roi.Y, roi.X));
+                Assert.Equal(new Vec4w(1, 32767, 3, 4), mat.At<Vec4w>(roi.Y, roi.X + 1));
+                Assert.Equal(new Vec4w(1, 2, 3, 4), mat.At<Vec4w>(0, 0));
+            }
+        }
+
+        [Fact]
+        public void GetRegionOverflowingRoi()
+        {
+            using (var mat = new Mat(8, 8, MatType.CV_8UC1, Scalar.All(0)))
+            {
+                var buffer = new byte[64];
+                var handle = System.Runtime.InteropServices.GCHandle.Alloc(buffer, System.Runtime.InteropServices.GCHandleType.Pinned);
+                try
+                {
+                    // x + width wraps around to a negative value
+                    Assert.Throws<OpenCVException>(() =>
+                        mat.GetRegion(new Rect(1, 0, int.MaxValue, 1), handle.AddrOfPinnedObject(), 0, MatType.CV_8UC1));
+                    Assert.Throws<OpenCVException>(() =>
+                        mat.SetRegion(new Rect(0, 1, 1, int.MaxValue), handle.AddrOfPinnedObject(), 0, MatType.CV_8UC1));
+                }
+                finally
+                {
+                    handle.Free();
+                }
+            }
+        }
+
         [Fact(Skip = "heavy")]
         public void Issue349()
         {
@@ -408,6 +503,34 @@ namespace OpenCvSharp.Tests.Core
 
             handle.Free();
         }
+
+        [Fact]
+        public unsafe void PlacementHeaders()
+        {
+            using (var mat = new Mat(100, 100, MatType.CV_8UC1, Scalar.All(1)))
+            {
+                int headerSize = (int)NativeMethods.core_Mat_sizeof();
+                long* buf = stackalloc long[(headerSize + sizeof(long) - 1) / sizeof(long)];
+
+                // the heap count is shared with the tests running in parallel, only this test makes placement headers
+                NativeMethods.core_Mat_headerCounts(out _, out var placementBefore);
+                for (int i = 0; i < 1000; i++)
+                {
+                    IntPtr roi = NativeMethods.core_Mat_placement_subMat1(new IntPtr(buf), mat.CvPtr, 10, 20, 30, 50);
+                    Assert.Equal(new IntPtr(buf), roi);
+                    Assert.Equal(10, NativeMethods.core_Mat_rows(roi));
+                    Assert.Equal(20, NativeMethods.core_Mat_cols(roi));
+                    NativeMethods.core_Mat_placement_delete(roi);
+
+                    IntPtr row = NativeMethods.core_Mat_placement_row(new IntPtr(buf), mat.CvPtr, i % 100);
+                    Assert.Equal(1, NativeMethods.core_Mat_rows(row));
+                    NativeMethods.core_Mat_placement_delete(row);
+                }
+
+                NativeMethods.core_Mat_headerCounts(out _, out var placement);
+                Assert.Equal(2000UL, placement - placementBefore);
+            }
+        }
     }
 }
 
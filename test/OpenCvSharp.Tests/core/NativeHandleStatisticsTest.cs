@@ -0,0 +1,71 @@
+﻿using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    public class NativeHandleStatisticsTest : TestBase
+    {
+        // other tests may create and release objects at the same time, so only lower bounds are checked
+
+        [Fact]
+        public void CountsMatAndVector()
+        {
+            var before = NativeHandleStatistics.GetSnapshot();
+            Assert.Equal(7, before.Length);
+
+            using (var mat = new Mat(10, 10, MatType.CV_8UC1))
+            using (var vec = new VectorOfPoint())
+            {
+                var alive = NativeHandleStatistics.GetSnapshot();
+                Assert.True(alive[(int)NativeHandleKind.Mat].Created >= before[(int)NativeHandleKind.Mat].Created + 1);
+                Assert.True(alive[(int)NativeHandleKind.Vector].Created >= before[(int)NativeHandleKind.Vector].Created + 1);
+                Assert.True(alive[(int)NativeHandleKind.Mat].Live >= 1);
+                Assert.True(alive[(int)NativeHandleKind.Mat].HighWater >= alive[(int)NativeHandleKind.Mat].Live);
+            }
+
+            var after = NativeHandleStatistics.GetSnapshot();
+            Assert.True(after[(int)NativeHandleKind.Mat].Deleted >= before[(int)NativeHandleKind.Mat].Deleted + 1);
+            Assert.True(after[(int)NativeHandleKind.Vector].Deleted >= before[(int)NativeHandleKind.Vector].Deleted + 1);
+        }
+
+        [Fact]
+        public void CountsAlgorithm()
+        {
+            var before = NativeHandleStatistics.Get(NativeHandleKind.Algorithm);
+            using (var orb = ORB.Create())
+            {
+                Assert.True(NativeHandleStatistics.Get(NativeHandleKind.Algorithm).Created >= before.Created + 1);
+            }
+            Assert.True(NativeHandleStatistics.Get(NativeHandleKind.Algorithm).Deleted >= before.Deleted + 1);
+        }
+
+        [Fact]
+        public void TrackBytes()
+        {
+            try
+            {
+                NativeHandleStatistics.SetTrackBytes(true);
+                using (var mat = new Mat(100, 100, MatType.CV_8UC3))
+                using (var roi = new Mat(mat, new Rect(0, 0, 10, 10)))
+                {
+                    var stats = NativeHandleStatistics.Get(NativeHandleKind.Mat);
+                    Assert.Equal(1, stats.BytesTracked);
+                    // the buffer shared by mat and roi is counted once
+                    Assert.True(stats.Bytes >= 100 * 100 * 3);
+                }
+
+                // the buffer is allocated after the Mat was created
+                using (var src = new Mat(10, 10, MatType.CV_8UC3))
+                using (var dst = new Mat())
+                {
+                    Cv2.Resize(src, dst, new Size(200, 200));
+                    Assert.True(NativeHandleStatistics.Get(NativeHandleKind.Mat).Bytes >= 200 * 200 * 3);
+                }
+            }
+            finally
+            {
+                NativeHandleStatistics.SetTrackBytes(false);
+            }
+            Assert.Equal(0, NativeHandleStatistics.Get(NativeHandleKind.Mat).BytesTracked);
+        }
+    }
+}
@@ -0,0 +1,70 @@
+﻿using System.Threading;
+using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    public class NativeJobTest : TestBase
+    {
+        [Fact]
+        public void FastNlMeansDenoising()
+        {
+            using (var src = new Mat(64, 64, MatType.CV_8UC1))
+            using (var expected = new Mat())
+            using (var called = new ManualResetEvent(false))
+            {
+                Cv2.Randu(src, Scalar.All(0), Scalar.All(256));
+                Cv2.FastNlMeansDenoising(src, expected);
+
+                using (var job = Cv2.FastNlMeansDenoisingJob(src))
+                {
+                    Assert.Equal(NativeJobStatus.Created, job.Status);
+                    job.Submit(priority: 1, completed: j => called.Set());
+                    Assert.True(job.Wait(30000));
+                    Assert.Equal(NativeJobStatus.Completed, job.Status);
+                    Assert.True(called.WaitOne(30000));
+
+                    Assert.Equal(1, job.ResultCount);
+                    using (var result = job.GetResult())
+                    {
+                        Assert.Equal(0, Cv2.Norm(result, expected, NormTypes.INF));
+                    }
+
+                    Assert.Throws<OpenCvSharpException>(() => job.Submit());
+                }
+            }
+        }
+
+        [Fact]
+        public void FailureIsReported()
+        {
+            // fastNlMeansDenoisingColored requires a 3-channel image; the OpenCV error is raised on a worker
+            // thread and must not reach the managed error handler (CI runs this against the Release build, /EHsc)
+            using (var src = new Mat(16, 16, MatType.CV_8UC1, Scalar.All(0)))
+            using (var job = Cv2.FastNlMeansDenoisingColoredJob(src))
+            {
+                job.Submit();
+                Assert.True(job.Wait(30000));
+                Assert.Equal(NativeJobStatus.Failed, job.Status);
+                Assert.NotEmpty(job.ErrorMessage);
+                Assert.Throws<OpenCvSharpException>(() => job.GetResult());
+            }
+        }
+
+        [Fact]
+        public void CancelBeforeSubmitLeavesItCreated()
+        {
+            using (var src = new Mat(16, 16, MatType.CV_8UC1, Scalar.All(0)))
+            using (var job = Cv2.FastNlMeansDenoisingJob(src))
+            {
+                job.Cancel();
+                Assert.Equal(NativeJobStatus.Created, job.Status);
+                Assert.Throws<OpenCvSharpException>(() => job.Wait(0));
+
+                // the earlier cancellation does not carry over to the submitted job
+                job.Submit();
+                Assert.True(job.Wait(30000));
+                Assert.Equal(NativeJobStatus.Completed, job.Status);
+            }
+        }
+    }
+}
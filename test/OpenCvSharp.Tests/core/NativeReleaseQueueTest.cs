@@ -0,0 +1,68 @@
+﻿using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    // The queue settings are process-wide, so these tests must not run in parallel with any other test
+    [CollectionDefinition(nameof(NativeReleaseQueueTest), DisableParallelization = true)]
+    public class NativeReleaseQueueCollection
+    {
+    }
+
+    [Collection(nameof(NativeReleaseQueueTest))]
+    public class NativeReleaseQueueTest : TestBase
+    {
+        [Fact]
+        public void DisposeMany()
+        {
+            var mats = new[]
+            {
+                new Mat(10, 10, MatType.CV_8UC1),
+                null,
+                new Mat(20, 20, MatType.CV_32FC3),
+                new Mat(),
+            };
+            mats[3].Dispose();
+
+            Mat.DisposeMany(mats);
+            Assert.True(mats[0].IsDisposed);
+            Assert.True(mats[2].IsDisposed);
+            Assert.True(mats[3].IsDisposed);
+        }
+
+        [Fact]
+        public void LargeBuffersAreReleasedInBackground()
+        {
+            var thresholdBytes = NativeReleaseQueue.ThresholdBytes;
+            try
+            {
+                NativeReleaseQueue.ThresholdBytes = 1 << 20;
+                NativeReleaseQueue.Enabled = true;
+                var before = NativeReleaseQueue.GetStats();
+                Assert.True(before.Enabled);
+
+                var large = new Mat(2048, 2048, MatType.CV_8UC1, Scalar.All(1));
+                var shared = new Mat(2048, 2048, MatType.CV_8UC1, Scalar.All(2));
+                var roi = new Mat(shared, new Rect(0, 0, 10, 10));
+                var small = new Mat(16, 16, MatType.CV_8UC1);
+
+                // only large holds the last reference to a buffer above the threshold
+                Mat.DisposeMany(new[] {large, shared, small});
+                NativeReleaseQueue.Flush();
+
+                var after = NativeReleaseQueue.GetStats();
+                Assert.True(after.Deferred >= before.Deferred + 1);
+                Assert.True(after.Released >= before.Released + 1);
+                Assert.Equal(2, (int)roi.Get<byte>(5, 5));
+
+                roi.Dispose(); // now the last reference of the shared buffer
+                NativeReleaseQueue.Flush();
+                Assert.True(NativeReleaseQueue.GetStats().Released >= after.Released + 1);
+            }
+            finally
+            {
+                NativeReleaseQueue.Enabled = false;
+                NativeReleaseQueue.ThresholdBytes = thresholdBytes;
+            }
+        }
+    }
+}
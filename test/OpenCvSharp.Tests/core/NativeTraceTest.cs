@@ -0,0 +1,43 @@
+﻿using System.IO;
+using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    public class NativeTraceTest : TestBase
+    {
+        [Fact]
+        public void WritesChromeTrace()
+        {
+            var path = Path.Combine(Path.GetTempPath(), "opencvsharp_trace_test.json");
+            try
+            {
+                NativeTrace.Start(path);
+                Assert.True(NativeTrace.IsActive);
+                using (NativeTrace.Region("outer \"quoted\""))
+                using (var src = new Mat(512, 512, MatType.CV_32FC1, Scalar.All(1)))
+                using (var kernel = new MatKernel("a * 2 + 1"))
+                using (var dst = new Mat())
+                {
+                    kernel.Run(dst, MatType.CV_32FC1, src);
+                }
+                NativeTrace.Stop();
+                Assert.False(NativeTrace.IsActive);
+
+                var count = NativeTrace.Flush();
+                Assert.True(count >= 3); // region begin / end, MatKernel loop and its tasks
+
+                var json = File.ReadAllText(path);
+                Assert.StartsWith("{", json);
+                Assert.Contains("\"traceEvents\"", json);
+                Assert.Contains("\"name\":\"outer \\\"quoted\\\"\"", json);
+                Assert.Contains("\"cat\":\"task\"", json);
+            }
+            finally
+            {
+                NativeTrace.Stop();
+                if (File.Exists(path))
+                    File.Delete(path);
+            }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+﻿using Xunit;
+
+namespace OpenCvSharp.Tests.Core
+{
+    // The pool counters and PooledMatAllocator.IsGlobal are process-wide, so these tests must not run
+    // in parallel with tests allocating Mats
+    [CollectionDefinition(nameof(PooledMatAllocatorTest), DisableParallelization = true)]
+    public class PooledMatAllocatorCollection
+    {
+    }
+
+    [Collection(nameof(PooledMatAllocatorTest))]
+    public class PooledMatAllocatorTest : TestBase
+    {
+        [Fact]
+        public void ReuseBuffer()
+        {
+            PooledMatAllocator.Reset();
+            for (int i = 0; i < 10; i++)
+            {
+                using (var mat = new Mat())
+                {
+                    PooledMatAllocator.Attach(mat);
+                    Assert.True(PooledMatAllocator.IsAttached(mat));
+                    mat.Create(480, 640, MatType.CV_8UC3);
+                }
+            }
+
+            var stats = PooledMatAllocator.GetStats();
+            Assert.Equal(1UL, stats.Misses);
+            Assert.Equal(9UL, stats.Hits);
+            Assert.Equal(0UL, stats.BytesInUse);
+            Assert.True(stats.BytesRetained >= 480 * 640 * 3);
+
+            PooledMatAllocator.Trim();
+            Assert.Equal(0UL, PooledMatAllocator.GetStats().BytesRetained);
+        }
+
+        [Fact]
+        public void Global()
+        {
+            PooledMatAllocator.Reset();
+            PooledMatAllocator.IsGlobal = true;
+            try
+            {
+                Assert.True(PooledMatAllocator.IsGlobal);
+                using (var src = new Mat(100, 100, MatType.CV_8UC1, Scalar.All(1)))
+                {
+                    for (int i = 0; i < 5; i++)
+                    {
+                        using (var dst = new Mat())
+                        {
+                            Cv2.Add(src, src, dst);
+                            Assert.Equal(2, dst.Get<byte>(99, 99));
+                        }
+                    }
+                }
+                Assert.True(PooledMatAllocator.GetStats().Hits >= 4);
+            }
+            finally
+            {
+                PooledMatAllocator.IsGlobal = false;
+                PooledMatAllocator.Trim();
+            }
+            Assert.False(PooledMatAllocator.IsGlobal);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+﻿using Xunit;
+
+namespace OpenCvSharp.Tests.Gapi
+{
+    public class GapiGraphTest : TestBase
+    {
+        [Fact]
+        public void GrayBlurResize()
+        {
+            using (var src = new Mat(120, 160, MatType.CV_8UC3))
+            using (var gray = new Mat())
+            using (var blurred = new Mat())
+            using (var expected = new Mat())
+            {
+                Cv2.Randu(src, Scalar.All(0), Scalar.All(256));
+                Cv2.CvtColor(src, gray, ColorConversionCodes.BGR2GRAY);
+                Cv2.GaussianBlur(gray, blurred, new Size(5, 5), 1.5);
+                Cv2.Resize(blurred, expected, new Size(80, 60));
+
+                foreach (var backend in new[] {GapiBackend.Cpu, GapiBackend.Fluid})
+                {
+                    using (var graph = new GapiGraph())
+                    {
+                        var input = graph.Input();
+                        var g = graph.CvtColor(input, ColorConversionCodes.BGR2GRAY);
+                        var b = graph.GaussianBlur(g, new Size(5, 5), 1.5);
+                        graph.Output(graph.Resize(b, new Size(80, 60)));
+
+                        using (var compiled = graph.Compile(backend, src))
+                        using (var dst = new Mat())
+                        {
+                            Assert.Equal(1, compiled.InputCount);
+                            Assert.Equal(1, compiled.OutputCount);
+                            compiled.GetOutputDesc(0, out var size, out var type);
+                            Assert.Equal(new Size(80, 60), size);
+                            Assert.Equal(MatType.CV_8UC1, type);
+
+                            compiled.Apply(src, dst);
+                            Assert.True(Cv2.Norm(dst, expected, NormTypes.INF) <= 2);
+
+                            // the output buffer is reused for the next frame
+                            var data = dst.Data;
+                            compiled.Apply(src, dst);
+                            Assert.Equal(data, dst.Data);
+                        }
+                    }
+                }
+            }
+        }
+
+        [Fact]
+        public void MultipleInputsAndOutputs()
+        {
+            using (var src1 = new Mat(32, 32, MatType.CV_8UC3))
+            using (var src2 = new Mat(32, 32, MatType.CV_8UC3))
+            using (var sum = new Mat())
+            using (var diff = new Mat())
+            using (var expectedSum = new Mat())
+            using (var expectedDiff = new Mat())
+            using (var graph = new GapiGraph())
+            {
+                Cv2.Randu(src1, Scalar.All(0), Scalar.All(256));
+                Cv2.Randu(src2, Scalar.All(0), Scalar.All(256));
+                Cv2.Add(src1, src2, expectedSum);
+                Cv2.Absdiff(src1, src2, expectedDiff);
+
+                var a = graph.Input();
+                var b = graph.Input();
+                graph.Output(graph.Add(a, b));
+                graph.Output(graph.AbsDiff(a, b));
+
+                using (var compiled = graph.Compile(GapiBackend.Cpu, src1, src2))
+                {
+                    compiled.Apply(new[] {src1, src2}, new[] {sum, diff});
+                    Assert.Equal(0, Cv2.Norm(sum, expectedSum, NormTypes.INF));
+                    Assert.Equal(0, Cv2.Norm(diff, expectedDiff, NormTypes.INF));
+                }
+            }
+        }
+
+        [Fact]
+        public void InputMustMatchCompiledMetadata()
+        {
+            using (var sample = new Mat(32, 32, MatType.CV_8UC1, Scalar.All(0)))
+            using (var other = new Mat(16, 16, MatType.CV_8UC1, Scalar.All(0)))
+            using (var dst = new Mat())
+            using (var graph = new GapiGraph())
+            {
+                graph.Output(graph.BitwiseNot(graph.Input()));
+                using (var compiled = graph.Compile(GapiBackend.Cpu, sample))
+                {
+                    Assert.Throws<OpenCVException>(() => compiled.Apply(other, dst));
+                }
+            }
+        }
+    }
+}
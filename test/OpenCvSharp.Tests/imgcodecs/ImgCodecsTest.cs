@@ -1,4 +1,6 @@
-﻿using System.Linq;
+﻿using System;
+using System.IO;
+using System.Linq;
 using System.Threading.Tasks;
 using Xunit;
 
@@ -61,5 +63,260 @@ namespace OpenCvSharp.Tests.ImgCodecs
                         page.Dispose();
             }
         }
+
+        [Fact]
+        public void StreamMultiPagesTiff()
+        {
+            string[] files = {
+                "multipage_p1.tif",
+                "multipage_p2.tif",
+                "multipage_p1.tif",
+            };
+
+            using (var writer = new ImagePageWriter("multi_stream.tiff"))
+            {
+                foreach (var file in files)
+                {
+                    using (var page = Image(file))
+                        writer.Write(page);
+                }
+                Assert.Equal(files.Length, writer.PageCount);
+                writer.Close();
+            }
+
+            using (var reader = new ImagePageReader("multi_stream.tiff"))
+            {
+                Assert.Equal(files.Length, reader.PageCount);
+
+                int i = 0;
+                foreach (var page in reader.ReadPages())
+                {
+                    using (var expected = Image(files[i++]))
+                        ImageEquals(expected, page);
+                }
+                Assert.Equal(files.Length, i);
+
+                using (var expected = Image(files[1]))
+                using (var page = reader.Read(1))
+                    ImageEquals(expected, page);
+            }
+
+            using (var reader = new ImagePageReader(Path.Combine("_data", "image", "lenna.png")))
+                Assert.Equal(1, reader.PageCount);
+        }
+
+        [Fact]
+        public void ImEncodeToNativeBuffer()
+        {
+            using (var src = Image("lenna.png", ImreadModes.Grayscale))
+            {
+                Assert.True(Cv2.ImEncode(".png", src, out byte[] expected));
+                Assert.True(Cv2.ImEncodeToNativeBuffer(".png", src, out var buf));
+                using (buf)
+                {
+                    Assert.Equal(expected.Length, buf.Length);
+                    Assert.Equal(expected, buf.ToArray());
+                    Assert.Equal(0x89, buf[0]);
+
+                    using (var decoded = Cv2.ImDecode(buf.ToArray(), ImreadModes.Grayscale))
+                    {
+                        ImageEquals(src, decoded);
+                    }
+                }
+            }
+        }
+
+        [Fact]
+        public void ImDecodeBatch()
+        {
+            using (var src = Image("lenna.png", ImreadModes.Color))
+            {
+                Assert.True(Cv2.ImEncode(".png", src, out byte[] png));
+                Assert.True(Cv2.ImEncode(".jpg", src, out byte[] jpg));
+                var bufs = new[] {png, new byte[] {1, 2, 3}, jpg, png};
+
+                var dst = new[] {new Mat(src.Size(), MatType.CV_8UC3), new Mat(), new Mat(), new Mat()};
+                var data = dst[0].Data;
+                try
+                {
+                    var results = Cv2.ImDecodeBatch(bufs, ImreadModes.Color, dst, maxConcurrency: 2);
+                    Assert.Equal(4, results.Length);
+                    Assert.Equal(ImageBatchStatus.Ok, results[0].Status);
+                    Assert.Equal(ImageBatchStatus.Failed, results[1].Status);
+                    Assert.Equal(ImageBatchStatus.Ok, results[2].Status);
+                    Assert.Equal(ImageBatchStatus.Ok, results[3].Status);
+                    Assert.True(results[0].Milliseconds >= 0);
+
+                    // the preallocated destination is written in place
+                    Assert.Equal(data, dst[0].Data);
+                    ImageEquals(src, dst[0]);
+                    ImageEquals(src, dst[3]);
+                    Assert.True(dst[1].Empty());
+                    Assert.Equal(src.Size(), dst[2].Size());
+                }
+                finally
+                {
+                    foreach (var mat in dst)
+                        mat.Dispose();
+                }
+            }
+        }
+
+        [Fact]
+        public void ImageEncoder()
+        {
+            using (var src = Image("lenna.png", ImreadModes.Color))
+            using (var encoder = new ImageEncoder(".jpg", new ImageEncodingParam(ImwriteFlags.JpegQuality, 80)))
+            {
+                Assert.True(Cv2.ImEncode(".jpg", src, out byte[] expected, new[] {(int) ImwriteFlags.JpegQuality, 80}));
+
+                Assert.True(encoder.Encode(src, out byte[] buf));
+                Assert.Equal(expected, buf);
+                Assert.True(encoder.SizeHint >= expected.Length);
+
+                // the session buffer is reused
+                Assert.True(encoder.Encode(src, out IntPtr data1, out int length1));
+                Assert.True(encoder.Encode(src, out IntPtr data2, out int length2));
+                Assert.Equal(data1, data2);
+                Assert.Equal(expected.Length, length2);
+
+                var slab = new byte[expected.Length * 2 + 10];
+                var dst = new[]
+                {
+                    new ArraySegment<byte>(slab, 0, expected.Length),
+                    new ArraySegment<byte>(slab, expected.Length, expected.Length + 10),
+                    new ArraySegment<byte>(new byte[16]),
+                };
+                var results = encoder.EncodeBatch(new[] {src, src, src}, dst, out var lengths, maxConcurrency: 2);
+                Assert.Equal(ImageBatchStatus.Ok, results[0].Status);
+                Assert.Equal(ImageBatchStatus.Ok, results[1].Status);
+                Assert.Equal(ImageBatchStatus.TooSmall, results[2].Status);
+                Assert.Equal(new[] {expected.Length, expected.Length, expected.Length}, lengths);
+                Assert.Equal(expected, slab.Take(expected.Length).ToArray());
+                Assert.Equal(expected, slab.Skip(expected.Length).Take(expected.Length).ToArray());
+            }
+        }
+
+        [Fact]
+        public void ImDecodeBatchReportsErrors()
+        {
+            // the OpenCV error (roi outside of the image) is raised on the pool threads and reported in the result
+            var jpg = File.ReadAllBytes(Path.Combine("_data", "image", "building.jpg"));
+            var dst = new[] {new Mat(), new Mat()};
+            try
+            {
+                var results = Cv2.ImDecodeBatch(new[] {jpg, jpg}, ImreadModes.Color, new Size(100, 100), dst, out _,
+                    new[] {new Rect(0, 0, 100, 100), new Rect(5000, 5000, 10, 10)}, 2);
+                Assert.Equal(ImageBatchStatus.Ok, results[0].Status);
+                Assert.Equal(ImageBatchStatus.Error, results[1].Status);
+                Assert.False(dst[0].Empty());
+                Assert.True(dst[1].Empty());
+            }
+            finally
+            {
+                foreach (var mat in dst)
+                    mat.Dispose();
+            }
+        }
+
+        [Fact]
+        public void ImDecodeReduced()
+        {
+            var jpg = File.ReadAllBytes(Path.Combine("_data", "image", "building.jpg"));
+            using (var full = Cv2.ImDecode(jpg, ImreadModes.Color))
+            using (var thumbnail = Cv2.ImDecodeReduced(jpg, new Size(200, 200), ImreadModes.Color, null, out var stats, true))
+            {
+                Assert.Equal(new Size(868, 600), stats.FullSize);
+                Assert.Equal(4, stats.Reduction);
+                Assert.Equal(new Size(217, 150), stats.DecodedSize);
+                Assert.Equal(new Size(200, 138), thumbnail.Size());
+                Assert.True(stats.BaselineMilliseconds >= 0);
+                Assert.False(double.IsNaN(stats.SavedMilliseconds));
+
+                using (var expected = new Mat())
+                {
+                    Cv2.Resize(full, expected, new Size(200, 138), 0, 0, InterpolationFlags.Area);
+                    Assert.True(Cv2.Norm(thumbnail, expected, NormTypes.L1) / thumbnail.Total() < 20);
+                }
+            }
+
+            // a region of interest, in full-resolution coordinates
+            using (var crop = Cv2.ImDecodeReduced(jpg, new Size(100, 0), ImreadModes.Color, new Rect(100, 100, 400, 300), out var stats))
+            {
+                Assert.Equal(4, stats.Reduction);
+                Assert.Equal(new Size(100, 75), crop.Size());
+                Assert.Equal(-1, stats.BaselineMilliseconds);
+            }
+
+            // other formats are decoded at full resolution and resized
+            using (var png = Cv2.ImReadReduced(Path.Combine("_data", "image", "lenna.png"), new Size(128, 128), ImreadModes.Color, null, out var stats))
+            {
+                Assert.Equal(1, stats.Reduction);
+                Assert.Equal(new Size(512, 512), stats.DecodedSize);
+                Assert.Equal(new Size(128, 128), png.Size());
+            }
+        }
+
+        [Fact]
+        public void ImageLoader()
+        {
+            string[] files =
+            {
+                Path.Combine("_data", "image", "building.jpg"),
+                Path.Combine("_data", "image", "not_exist.png"),
+                Path.Combine("_data", "image", "lenna.png"),
+            };
+            var options = new ImageLoaderOptions
+            {
+                Threads = 2,
+                MaxQueued = 2,
+                Size = new Size(64, 48),
+                ColorConversion = ColorConversionCodes.BGR2GRAY,
+            };
+
+            using (var loader = new ImageLoader(files, options))
+            using (var image = new Mat())
+            {
+                Assert.Equal(files.Length, loader.Count);
+                for (int i = 0; i < files.Length; i++)
+                {
+                    Assert.True(loader.TryTake(image, out var index, out var status));
+                    Assert.Equal(i, index);
+                    if (i == 1)
+                    {
+                        Assert.Equal(ImageBatchStatus.Failed, status);
+                        Assert.True(image.Empty());
+                        continue;
+                    }
+
+                    Assert.Equal(ImageBatchStatus.Ok, status);
+                    using (var src = Cv2.ImRead(files[i]))
+                    using (var resized = src.Resize(new Size(64, 48), 0, 0, InterpolationFlags.Area))
+                    using (var expected = resized.CvtColor(ColorConversionCodes.BGR2GRAY))
+                        ImageEquals(expected, image);
+                }
+                Assert.True(loader.IsCompleted);
+                Assert.False(loader.TryTake(image, out _, out _));
+            }
+        }
+
+        [Fact]
+        public void ImageLoaderReportsErrors()
+        {
+            // BGR2GRAY of a grayscale image raises an OpenCV error on the decoder thread
+            var options = new ImageLoaderOptions
+            {
+                Flags = ImreadModes.Grayscale,
+                ColorConversion = ColorConversionCodes.BGR2GRAY,
+            };
+            using (var loader = new ImageLoader(new[] {Path.Combine("_data", "image", "lenna.png")}, options))
+            using (var image = new Mat())
+            {
+                Assert.True(loader.TryTake(image, out var index, out var status));
+                Assert.Equal(0, index);
+                Assert.Equal(ImageBatchStatus.Error, status);
+                Assert.True(image.Empty());
+            }
+        }
     }
 }
\ No newline at end of file
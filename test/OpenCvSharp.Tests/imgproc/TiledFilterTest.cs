@@ -0,0 +1,113 @@
+﻿using System;
+using Xunit;
+
+namespace OpenCvSharp.Tests.ImgProc
+{
+    public class TiledFilterTest : TestBase
+    {
+        private static void AssertSameAsWholeImage(Mat src, TiledFilter filter, Action<Mat, Mat> wholeImage,
+            Size tileSize, long memoryBudget = 0)
+        {
+            using (var expected = new Mat())
+            using (var actual = new Mat())
+            {
+                wholeImage(src, expected);
+                filter.Apply(src, actual, tileSize, memoryBudget);
+
+                Assert.Equal(expected.Type(), actual.Type());
+                Assert.Equal(expected.Size(), actual.Size());
+                using (var diff = new Mat())
+                {
+                    Cv2.Compare(expected.Reshape(1), actual.Reshape(1), diff, CmpTypes.NE);
+                    Assert.Equal(0, Cv2.CountNonZero(diff));
+                }
+            }
+        }
+
+        [Fact]
+        public void LinearFilters()
+        {
+            using (var src = Image("lenna.png"))
+            {
+                var tile = new Size(61, 47);
+                using (var f = TiledFilter.GaussianBlur(new Size(0, 0), 2.5))
+                    AssertSameAsWholeImage(src, f, (s, d) => Cv2.GaussianBlur(s, d, new Size(0, 0), 2.5), tile);
+                using (var f = TiledFilter.Blur(new Size(7, 3), null, BorderTypes.Replicate))
+                    AssertSameAsWholeImage(src, f, (s, d) => Cv2.Blur(s, d, new Size(7, 3), null, BorderTypes.Replicate), tile);
+                using (var f = TiledFilter.Sobel(MatType.CV_16S, 1, 0, 5))
+                    AssertSameAsWholeImage(src, f, (s, d) => Cv2.Sobel(s, d, MatType.CV_16S, 1, 0, 5), tile);
+                using (var f = TiledFilter.Laplacian(MatType.CV_16S, 3, 1, 0, BorderTypes.Reflect))
+                    AssertSameAsWholeImage(src, f, (s, d) => Cv2.Laplacian(s, d, MatType.CV_16S, 3, 1, 0, BorderTypes.Reflect), tile);
+                using (var kernel = new Mat(3, 5, MatType.CV_32FC1, Scalar.All(1.0 / 15)))
+                using (var f = TiledFilter.Filter2D(-1, kernel, new Point(1, 2), 10, BorderTypes.Constant))
+                    AssertSameAsWholeImage(src, f, (s, d) => Cv2.Filter2D(s, d, -1, kernel, new Point(1, 2), 10, BorderTypes.Constant), tile);
+            }
+        }
+
+        [Fact]
+        public void MedianBlur()
+        {
+            using (var src = Image("lenna.png"))
+            using (var f = TiledFilter.MedianBlur(7))
+            {
+                Assert.Equal(new Size(3, 3), f.Halo);
+                AssertSameAsWholeImage(src, f, (s, d) => Cv2.MedianBlur(s, d, 7), new Size(100, 100));
+            }
+        }
+
+        [Fact]
+        public void Morphology()
+        {
+            using (var src = Image("lenna.png", ImreadModes.Grayscale))
+            using (var ellipse = Cv2.GetStructuringElement(MorphShapes.Ellipse, new Size(5, 5)))
+            {
+                foreach (MorphTypes op in new[]
+                    {MorphTypes.Erode, MorphTypes.Dilate, MorphTypes.Open, MorphTypes.Close,
+                     MorphTypes.Gradient, MorphTypes.TopHat, MorphTypes.BlackHat})
+                {
+                    using (var f = TiledFilter.MorphologyEx(op, ellipse, null, 2))
+                        AssertSameAsWholeImage(src, f, (s, d) => Cv2.MorphologyEx(s, d, op, ellipse, null, 2), new Size(50, 70));
+                    using (var f = TiledFilter.MorphologyEx(op, null, null, 3, BorderTypes.Reflect101))
+                        AssertSameAsWholeImage(src, f, (s, d) => Cv2.MorphologyEx(s, d, op, null, null, 3, BorderTypes.Reflect101), new Size(50, 70));
+                }
+            }
+        }
+
+        [Fact]
+        public void ColorConversion()
+        {
+            using (var src = Image("lenna.png"))
+            using (var gray = new Mat())
+            {
+                using (var f = TiledFilter.CvtColor(ColorConversionCodes.BGR2HSV))
+                    AssertSameAsWholeImage(src, f, (s, d) => Cv2.CvtColor(s, d, ColorConversionCodes.BGR2HSV), new Size(33, 33));
+
+                // demosaicing depends on the pixel parity, so odd tile sizes are rounded up
+                Cv2.CvtColor(src, gray, ColorConversionCodes.BGR2GRAY);
+                using (var f = TiledFilter.CvtColor(ColorConversionCodes.BayerBG2BGR_VNG))
+                    AssertSameAsWholeImage(gray, f, (s, d) => Cv2.CvtColor(s, d, ColorConversionCodes.BayerBG2BGR_VNG), new Size(33, 33));
+            }
+        }
+
+        [Fact]
+        public void MemoryBudget()
+        {
+            using (var src = Image("lenna.png"))
+            using (var f = TiledFilter.GaussianBlur(new Size(9, 9), 0))
+            {
+                // a budget smaller than one tile still processes the image, one tile at a time
+                AssertSameAsWholeImage(src, f, (s, d) => Cv2.GaussianBlur(s, d, new Size(9, 9), 0), new Size(64, 64), 1);
+            }
+        }
+
+        [Fact]
+        public void InPlaceIsRejected()
+        {
+            using (var src = Image("lenna.png"))
+            using (var f = TiledFilter.MedianBlur(3))
+            {
+                Assert.Throws<OpenCVException>(() => f.Apply(src, src, new Size(64, 64)));
+            }
+        }
+    }
+}